@@ -34,13 +34,11 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/drivers/flash.h>
 #include <zephyr/kernel.h>
-#include <zephyr/sys/crc.h>
 #include <zephyr/sys/base64.h>
 #include <hal/hal_flash.h>
 #elif __ESPRESSIF__
 #include <bootloader_utility.h>
 #include <esp_rom_sys.h>
-#include <esp_crc.h>
 #include <endian.h>
 #include <mbedtls/base64.h>
 #else
@@ -49,7 +47,6 @@
 #include <hal/hal_flash.h>
 #include <os/endian.h>
 #include <os/os_cputime.h>
-#include <crc/crc16.h>
 #include <base64/base64.h>
 #endif /* __ZEPHYR__ */
 
@@ -87,7 +84,10 @@ BOOT_LOG_MODULE_DECLARE(mcuboot);
 #define ARRAY_SIZE ZCBOR_ARRAY_SIZE
 #endif
 
-#if defined(MCUBOOT_SHA512)
+#if defined(MCUBOOT_BLAKE2S)
+    #define IMAGE_HASH_SIZE (32)
+    #define IMAGE_SHA_TLV   IMAGE_TLV_BLAKE2S
+#elif defined(MCUBOOT_SHA512)
     #define IMAGE_HASH_SIZE (64)
     #define IMAGE_SHA_TLV   IMAGE_TLV_SHA512
 #elif defined(MCUBOOT_SIGN_EC384)
@@ -102,6 +102,10 @@ BOOT_LOG_MODULE_DECLARE(mcuboot);
 #define MCUBOOT_SERIAL_MAX_RECEIVE_SIZE 512
 #endif
 
+#ifndef MCUBOOT_SERIAL_MAX_LINE_INPUT_LEN
+#define MCUBOOT_SERIAL_MAX_LINE_INPUT_LEN 128
+#endif
+
 #ifdef MCUBOOT_SERIAL_IMG_GRP_IMAGE_STATE
 #define BOOT_SERIAL_IMAGE_STATE_SIZE_MAX 48
 #else
@@ -138,19 +142,16 @@ BOOT_LOG_MODULE_DECLARE(mcuboot);
 /* base64 lib encodes data to null-terminated string */
 #define BASE64_ENCODE_SIZE(in_size) ((((((in_size) - 1) / 3) * 4) + 4) + 1)
 
-#define CRC16_INITIAL_CRC       0       /* what to seed crc16 with */
-#define CRC_CITT_POLYMINAL 0x1021
-
 #define ntohs(x) sys_be16_to_cpu(x)
 #define htons(x) sys_cpu_to_be16(x)
 #elif __ESPRESSIF__
 #define BASE64_ENCODE_SIZE(in_size) ((((((in_size) - 1) / 3) * 4) + 4) + 1)
-#define CRC16_INITIAL_CRC       0       /* what to seed crc16 with */
 
-#define base64_decode mbedtls_base64_decode
 #define base64_encode mbedtls_base64_encode
 #endif
 
+#define CRC16_INITIAL_CRC       0       /* what to seed crc16 with */
+
 #if (BOOT_IMAGE_NUMBER > 1)
 #define IMAGES_ITER(x) for ((x) = 0; (x) < BOOT_IMAGE_NUMBER; ++(x))
 #else
@@ -160,9 +161,24 @@ BOOT_LOG_MODULE_DECLARE(mcuboot);
 #define SWAP_USING_OFFSET_SECTOR_UPDATE_BEGIN 1
 #define BOOT_DIRECT_UPLOAD_SECONDARY_SLOT_ID_REMAINDER 0
 
+#if defined(MCUBOOT_SERIAL_WRITE_COMBINE_SIZE) && MCUBOOT_SERIAL_WRITE_COMBINE_SIZE > 0
+#define BOOT_SERIAL_WRITE_COMBINE
+#endif
+
+#if defined(MCUBOOT_ERASE_PROGRESSIVELY) && defined(MCUBOOT_SERIAL_ERASE_AHEAD_SECTORS) && \
+    MCUBOOT_SERIAL_ERASE_AHEAD_SECTORS > 0
+#define BOOT_SERIAL_ERASE_AHEAD
+#endif
+
+#ifdef MCUBOOT_SERIAL_RAW_PROTOCOL
 static char in_buf[MCUBOOT_SERIAL_MAX_RECEIVE_SIZE + 1];
-#ifndef MCUBOOT_SERIAL_RAW_PROTOCOL
-static char dec_buf[MCUBOOT_SERIAL_MAX_RECEIVE_SIZE + 1];
+#else
+/*
+ * The frame decoded so far is kept at the start of the buffer; each received
+ * line is read in right after it and base64 decoded in place, so room for one
+ * line is needed past the maximum decoded frame size.
+ */
+static char in_buf[MCUBOOT_SERIAL_MAX_RECEIVE_SIZE + MCUBOOT_SERIAL_MAX_LINE_INPUT_LEN + 1];
 #endif
 const struct boot_uart_funcs *boot_uf;
 static struct nmgr_hdr *bs_hdr;
@@ -172,6 +188,59 @@ static char bs_obuf[BOOT_SERIAL_OUT_MAX];
 
 static void boot_serial_output(void);
 
+#ifndef MCUBOOT_SERIAL_RAW_PROTOCOL
+/*
+ * Lookup table for CRC16-CCITT (polynomial 0x1021, not reflected), as used by
+ * the SMP over console transport.
+ */
+static const uint16_t boot_serial_crc16_tab[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
+    0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485,
+    0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4,
+    0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
+    0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
+    0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12,
+    0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
+    0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41,
+    0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
+    0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70,
+    0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
+    0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f,
+    0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e,
+    0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
+    0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c,
+    0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3,
+    0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a,
+    0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92,
+    0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9,
+    0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1,
+    0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8,
+    0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0,
+};
+
+static uint16_t
+boot_serial_crc16(uint16_t crc, const void *data, size_t len)
+{
+    const uint8_t *p = data;
+
+    while (len-- > 0) {
+        crc = (crc << 8) ^ boot_serial_crc16_tab[(uint8_t)(crc >> 8) ^ *p++];
+    }
+
+    return crc;
+}
+#endif
+
 #ifdef MCUBOOT_SERIAL_IMG_GRP_HASH
 #ifdef MCUBOOT_SWAP_USING_OFFSET
 static int boot_serial_get_hash(const struct image_header *hdr,
@@ -283,6 +352,102 @@ bs_list_img_ver(char *dst, int maxlen, struct image_version *ver)
 }
 #endif /* !MCUBOOT_USE_SNPRINTF */
 
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+/*
+ * Results of validating the images in each slot, kept across requests so that
+ * clients polling the image list do not cause every slot to be hashed again
+ * each time. An entry only applies while the header read from the slot is
+ * the one it was made for, and all entries are dropped whenever the slots
+ * are written to or their state is changed.
+ */
+#define BS_VAL_CACHE_EMPTY      0
+#define BS_VAL_CACHE_VALID      1
+#define BS_VAL_CACHE_INVALID    2
+
+struct bs_val_cache_entry {
+    uint8_t state;                  /* BS_VAL_CACHE_* */
+    uint32_t hdr_off;               /* Offset the header has been read from */
+    struct image_header hdr;
+#ifdef MCUBOOT_SERIAL_IMG_GRP_HASH
+    bool hash_cached;
+    int hash_rc;
+    uint8_t hash[IMAGE_HASH_SIZE];
+#endif
+};
+
+static struct bs_val_cache_entry bs_val_cache[BOOT_IMAGE_NUMBER][BOOT_NUM_SLOTS];
+
+static void
+bs_val_cache_invalidate(void)
+{
+    memset(bs_val_cache, 0, sizeof(bs_val_cache));
+}
+
+/*
+ * Returns the cache entry of a slot for the image with header @p hdr read at
+ * @p hdr_off; an entry made for a different header is emptied first.
+ */
+static struct bs_val_cache_entry *
+bs_val_cache_get(uint8_t image_index, uint32_t slot, const struct image_header *hdr,
+                 uint32_t hdr_off)
+{
+    struct bs_val_cache_entry *entry = &bs_val_cache[image_index][slot];
+
+    if (entry->state != BS_VAL_CACHE_EMPTY &&
+        (entry->hdr_off != hdr_off || memcmp(&entry->hdr, hdr, sizeof(*hdr)) != 0)) {
+        memset(entry, 0, sizeof(*entry));
+    }
+
+    if (entry->state == BS_VAL_CACHE_EMPTY) {
+        entry->hdr_off = hdr_off;
+        memcpy(&entry->hdr, hdr, sizeof(*hdr));
+    }
+
+    return entry;
+}
+#endif /* MCUBOOT_SERIAL_CACHE_VALIDATION */
+
+/*
+ * Validates the image in a slot for listing.
+ */
+static fih_ret
+bs_list_validate(struct boot_loader_state *state, uint8_t image_index, uint32_t slot,
+                 const struct flash_area *fap, struct image_header *hdr)
+{
+    FIH_DECLARE(fih_rc, FIH_FAILURE);
+    uint8_t tmpbuf[64];
+
+    BOOT_HOOK_CALL_FIH(boot_image_check_hook,
+                       FIH_BOOT_HOOK_REGULAR,
+                       fih_rc, image_index, slot);
+    if (FIH_EQ(fih_rc, FIH_BOOT_HOOK_REGULAR))
+    {
+#if defined(MCUBOOT_ENC_IMAGES)
+#if !defined(MCUBOOT_SINGLE_APPLICATION_SLOT)
+        if (IS_ENCRYPTED(hdr) && MUST_DECRYPT(fap, image_index, hdr)) {
+            FIH_CALL(boot_image_validate_encrypted, fih_rc, state, fap,
+                     hdr, tmpbuf, sizeof(tmpbuf));
+        } else {
+#endif
+            if (IS_ENCRYPTED(hdr)) {
+                /*
+                 * There is an image present which has an encrypted flag set but is
+                 * not encrypted, therefore remove the flag from the header and run a
+                 * normal image validation on it.
+                 */
+                hdr->ih_flags &= ~ENCRYPTIONFLAGS;
+            }
+#endif
+            FIH_CALL(bootutil_img_validate, fih_rc, state, hdr,
+                     fap, tmpbuf, sizeof(tmpbuf), NULL, 0, NULL);
+#if defined(MCUBOOT_ENC_IMAGES) && !defined(MCUBOOT_SINGLE_APPLICATION_SLOT)
+        }
+#endif
+    }
+
+    FIH_RET(fih_rc);
+}
+
 /*
  * List images.
  */
@@ -312,6 +477,9 @@ bs_list(struct boot_loader_state *state, char *buf, int len)
             FIH_DECLARE(fih_rc, FIH_FAILURE);
             int rc;
             uint8_t tmpbuf[64];
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+            struct bs_val_cache_entry *cache = NULL;
+#endif
 
 #ifdef MCUBOOT_SERIAL_IMG_GRP_IMAGE_STATE
             bool active = false;
@@ -349,33 +517,22 @@ bs_list(struct boot_loader_state *state, char *buf, int len)
 
             if (hdr.ih_magic == IMAGE_MAGIC)
             {
-                BOOT_HOOK_CALL_FIH(boot_image_check_hook,
-                                   FIH_BOOT_HOOK_REGULAR,
-                                   fih_rc, image_index, slot);
-                if (FIH_EQ(fih_rc, FIH_BOOT_HOOK_REGULAR))
-                {
-#if defined(MCUBOOT_ENC_IMAGES)
-#if !defined(MCUBOOT_SINGLE_APPLICATION_SLOT)
-                    if (IS_ENCRYPTED(&hdr) && MUST_DECRYPT(fap, image_index, &hdr)) {
-                        FIH_CALL(boot_image_validate_encrypted, fih_rc, state, fap,
-                                 &hdr, tmpbuf, sizeof(tmpbuf));
-                    } else {
-#endif
-                        if (IS_ENCRYPTED(&hdr)) {
-                            /*
-                             * There is an image present which has an encrypted flag set but is
-                             * not encrypted, therefore remove the flag from the header and run a
-                             * normal image validation on it.
-                             */
-                            hdr.ih_flags &= ~ENCRYPTIONFLAGS;
-                        }
-#endif
-                        FIH_CALL(bootutil_img_validate, fih_rc, state, &hdr,
-                                 fap, tmpbuf, sizeof(tmpbuf), NULL, 0, NULL);
-#if defined(MCUBOOT_ENC_IMAGES) && !defined(MCUBOOT_SINGLE_APPLICATION_SLOT)
-                    }
-#endif
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+#ifdef MCUBOOT_SWAP_USING_OFFSET
+                cache = bs_val_cache_get(image_index, slot, &hdr, start_off);
+#else
+                cache = bs_val_cache_get(image_index, slot, &hdr, 0);
+#endif
+                if (cache->state == BS_VAL_CACHE_EMPTY) {
+                    FIH_CALL(bs_list_validate, fih_rc, state, image_index, slot, fap, &hdr);
+                    cache->state = FIH_EQ(fih_rc, FIH_SUCCESS) ? BS_VAL_CACHE_VALID :
+                                                                 BS_VAL_CACHE_INVALID;
+                } else if (cache->state == BS_VAL_CACHE_VALID) {
+                    fih_rc = FIH_SUCCESS;
                 }
+#else
+                FIH_CALL(bs_list_validate, fih_rc, state, image_index, slot, fap, &hdr);
+#endif
             }
 
             if (FIH_NOT_EQ(fih_rc, FIH_SUCCESS)) {
@@ -383,12 +540,25 @@ bs_list(struct boot_loader_state *state, char *buf, int len)
             }
 
 #ifdef MCUBOOT_SERIAL_IMG_GRP_HASH
-            /* Retrieve hash of image for identification */
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+            if (cache->hash_cached) {
+                rc = cache->hash_rc;
+                memcpy(hash, cache->hash, sizeof(hash));
+            } else
+#endif
+            {
+                /* Retrieve hash of image for identification */
 #ifdef MCUBOOT_SWAP_USING_OFFSET
-            rc = boot_serial_get_hash(&hdr, fap, hash, start_off);
+                rc = boot_serial_get_hash(&hdr, fap, hash, start_off);
 #else
-            rc = boot_serial_get_hash(&hdr, fap, hash);
+                rc = boot_serial_get_hash(&hdr, fap, hash);
 #endif
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+                cache->hash_rc = rc;
+                memcpy(cache->hash, hash, sizeof(hash));
+                cache->hash_cached = true;
+#endif
+            }
 #endif
 
             zcbor_map_start_encode(cbor_state, 20);
@@ -621,6 +791,9 @@ bs_set(struct boot_loader_state *state, char *buf, int len)
 
 set_image_state:
     rc = boot_set_pending_multi(image_index, confirm);
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+    bs_val_cache_invalidate();
+#endif
 
 out:
     if (rc == 0) {
@@ -844,6 +1017,25 @@ finish:
 #endif
 
 #ifdef MCUBOOT_ERASE_PROGRESSIVELY
+/* Offset of next byte to erase; writes to flash are done in consecutive manner
+ * and erases are done to allow currently received chunk to be written; this
+ * state variable holds information where last erase has stopped to let us know
+ * whether erase is needed to be able to write current chunk.
+ */
+static off_t not_yet_erased = 0;
+
+#ifdef BOOT_SERIAL_ERASE_AHEAD
+/* Upload in progress, as seen by the erase-ahead scheduler; the remaining
+ * fields are only valid while active is set.
+ */
+static struct {
+    bool active;
+    uint8_t area_id;    /* Flash area the image is uploaded to */
+    off_t write_off;    /* Offset of the next byte to be written */
+    off_t end_off;      /* Offset past the last byte of the image */
+} bs_erase_ahead;
+#endif
+
 /** Erases range of flash, aligned to sector size
  *
  * Function will erase all sectors withing [start, end] range; it does not check
@@ -889,7 +1081,176 @@ static off_t erase_range(const struct flash_area *fap, off_t start, off_t end)
 
     return start + size;
 }
-#endif
+
+#ifdef BOOT_SERIAL_ERASE_AHEAD
+/** Erases the next not yet erased sector of an upload in progress
+ *
+ * Intended to be called while waiting for input, so that erase time is hidden
+ * behind the transfer of the following chunks instead of being spent when a
+ * chunk needs the space. Sectors are only erased within the image and no more
+ * than MCUBOOT_SERIAL_ERASE_AHEAD_SECTORS sectors past the one currently being
+ * written.
+ *
+ * @retval true if a sector has been erased, false if there was nothing to do.
+ */
+static bool bs_erase_ahead_step(void)
+{
+    const struct flash_area *fap;
+    struct flash_sector sect;
+    off_t limit;
+    off_t next;
+    bool erased = false;
+
+    if (!bs_erase_ahead.active || not_yet_erased < 0 ||
+        not_yet_erased >= bs_erase_ahead.end_off) {
+        return false;
+    }
+
+    if (flash_area_open(bs_erase_ahead.area_id, &fap)) {
+        bs_erase_ahead.active = false;
+        return false;
+    }
+
+    if (flash_area_get_sector(fap, not_yet_erased, &sect)) {
+        bs_erase_ahead.active = false;
+        goto done;
+    }
+
+    limit = bs_erase_ahead.write_off +
+            (off_t)flash_sector_get_size(&sect) * MCUBOOT_SERIAL_ERASE_AHEAD_SECTORS;
+
+    if (flash_sector_get_off(&sect) < limit) {
+        next = erase_range(fap, not_yet_erased, not_yet_erased);
+        if (next < 0) {
+            /* Leave it to the upload to retry the erase and report the error */
+            bs_erase_ahead.active = false;
+        } else {
+            not_yet_erased = next;
+            erased = true;
+        }
+    }
+
+done:
+    flash_area_close(fap);
+
+    return erased;
+}
+#endif /* BOOT_SERIAL_ERASE_AHEAD */
+#endif /* MCUBOOT_ERASE_PROGRESSIVELY */
+
+#ifdef BOOT_SERIAL_WRITE_COMBINE
+/*
+ * Write combining for uploaded image data: received chunks are gathered in a
+ * page-sized buffer and flash is only programmed with whole, page aligned
+ * pages, so small SMP chunks do not turn into many partial programs. Only the
+ * last page of an image is programmed partially filled, padded to the flash
+ * write alignment. A failed write drops the buffer and the whole upload, as
+ * data of chunks that have already been acknowledged may be lost with it.
+ */
+static struct {
+    uint32_t start;     /* Flash offset the upload started at */
+    uint32_t off;       /* Flash offset the start of the buffer maps to */
+    size_t len;         /* Number of bytes currently held in the buffer */
+    uint32_t chunks;    /* Number of chunks received for current upload */
+    uint32_t writes;    /* Number of flash writes issued for current upload */
+    uint8_t data[MCUBOOT_SERIAL_WRITE_COMBINE_SIZE] __attribute__((aligned(4)));
+} bs_wbuf;
+
+/*
+ * Drops any buffered data and restarts combining at flash offset @p off.
+ */
+static void
+bs_wbuf_reset(uint32_t off)
+{
+    bs_wbuf.start = off;
+    bs_wbuf.off = off;
+    bs_wbuf.len = 0;
+    bs_wbuf.chunks = 0;
+    bs_wbuf.writes = 0;
+}
+
+/*
+ * Programs buffered data to flash; a partially filled buffer is padded with
+ * the erased value up to the flash write alignment. On error, the buffer is
+ * reset to the start of the upload.
+ */
+static int
+bs_wbuf_flush(const struct flash_area *fap)
+{
+    size_t len;
+    int rc;
+
+    if (bs_wbuf.len == 0) {
+        return 0;
+    }
+
+    len = ALIGN_UP(bs_wbuf.len, flash_area_align(fap));
+    memset(&bs_wbuf.data[bs_wbuf.len], flash_area_erased_val(fap), len - bs_wbuf.len);
+
+    BOOT_LOG_DBG("Writing at 0x%x until 0x%x", bs_wbuf.off, bs_wbuf.off + (uint32_t)len);
+    rc = flash_area_write(fap, bs_wbuf.off, bs_wbuf.data, len);
+    if (rc != 0) {
+        bs_wbuf_reset(bs_wbuf.start);
+        return rc;
+    }
+
+    bs_wbuf.writes++;
+    bs_wbuf.off += len;
+    bs_wbuf.len = 0;
+
+    return 0;
+}
+
+/*
+ * Adds a received chunk to the write buffer, programming every page that gets
+ * filled. When the buffer is empty, whole pages are written straight from the
+ * chunk if its address is compatible with the flash write alignment. On error,
+ * the buffer is reset to the start of the upload.
+ */
+static int
+bs_wbuf_write(const struct flash_area *fap, const uint8_t *data, size_t len)
+{
+    const size_t page = sizeof(bs_wbuf.data);
+    const size_t align = flash_area_align(fap);
+    size_t copy;
+    int rc;
+
+    bs_wbuf.chunks++;
+
+    while (len > 0) {
+        if (bs_wbuf.len == 0 && len >= page && ((uintptr_t)data & (align - 1)) == 0) {
+            copy = len - (len % page);
+
+            BOOT_LOG_DBG("Writing at 0x%x until 0x%x", bs_wbuf.off,
+                         bs_wbuf.off + (uint32_t)copy);
+            rc = flash_area_write(fap, bs_wbuf.off, data, copy);
+            if (rc != 0) {
+                bs_wbuf_reset(bs_wbuf.start);
+                return rc;
+            }
+
+            bs_wbuf.writes++;
+            bs_wbuf.off += copy;
+        } else {
+            copy = MIN(len, page - bs_wbuf.len);
+            memcpy(&bs_wbuf.data[bs_wbuf.len], data, copy);
+            bs_wbuf.len += copy;
+
+            if (bs_wbuf.len == page) {
+                rc = bs_wbuf_flush(fap);
+                if (rc != 0) {
+                    return rc;
+                }
+            }
+        }
+
+        data += copy;
+        len -= copy;
+    }
+
+    return 0;
+}
+#endif /* BOOT_SERIAL_WRITE_COMBINE */
 
 /*
  * Image upload request.
@@ -912,18 +1273,9 @@ bs_upload(char *buf, int len)
     struct zcbor_string img_chunk_data = { 0 };
     size_t decoded = 0;
     bool ok;
-#ifdef MCUBOOT_ERASE_PROGRESSIVELY
-    static off_t not_yet_erased = 0;    /* Offset of next byte to erase; writes to flash
-                                         * are done in consecutive manner and erases are done
-                                         * to allow currently received chunk to be written;
-                                         * this state variable holds information where last
-                                         * erase has stopped to let us know whether erase
-                                         * is needed to be able to write current chunk.
-                                         */
-#ifdef BOOT_IMAGE_HAS_STATUS_FIELDS
+#if defined(MCUBOOT_ERASE_PROGRESSIVELY) && defined(BOOT_IMAGE_HAS_STATUS_FIELDS)
     static struct flash_sector status_sector;
 #endif
-#endif /* MCUBOOT_ERASE_PROGRESSIVELY */
 #ifdef MCUBOOT_SWAP_USING_OFFSET
     static uint32_t start_off = 0;
 #endif
@@ -991,6 +1343,19 @@ bs_upload(char *buf, int len)
         const size_t area_size = flash_area_get_size(fap);
 
         curr_off = 0;
+#ifdef BOOT_SERIAL_ERASE_AHEAD
+        bs_erase_ahead.active = false;
+#endif
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+        bs_val_cache_invalidate();
+#endif
+#ifdef BOOT_SERIAL_WRITE_COMBINE
+        if ((MCUBOOT_SERIAL_WRITE_COMBINE_SIZE % flash_area_align(fap)) != 0) {
+            rc = MGMT_ERR_EUNKNOWN;
+            BOOT_LOG_ERR("Write combine size is not a multiple of flash alignment");
+            goto out;
+        }
+#endif
 #if defined(MCUBOOT_ERASE_PROGRESSIVELY) && defined(BOOT_IMAGE_HAS_STATUS_FIELDS)
         /* Get trailer sector information; this is done early because inability to get
          * that sector information means that upload will not work anyway.
@@ -1058,6 +1423,17 @@ bs_upload(char *buf, int len)
         } else {
             start_off = 0;
         }
+#endif
+
+#ifdef BOOT_SERIAL_WRITE_COMBINE
+        /* Data still buffered from an earlier, unfinished, upload is dropped:
+         * the slot is being written again from the beginning.
+         */
+#ifdef MCUBOOT_SWAP_USING_OFFSET
+        bs_wbuf_reset(start_off);
+#else
+        bs_wbuf_reset(0);
+#endif
 #endif
     } else if (img_chunk_off != curr_off) {
         /* If received chunk offset does not match expected one jump, pretend
@@ -1071,6 +1447,11 @@ bs_upload(char *buf, int len)
         goto out;
     }
 
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+    /* Whatever has been cached about the slot no longer holds once it is written to */
+    bs_val_cache_invalidate();
+#endif
+
 #ifdef MCUBOOT_ERASE_PROGRESSIVELY
     /* Progressive erase will erase enough flash, aligned to sector size,
      * as needed for the current chunk to be written.
@@ -1089,6 +1470,28 @@ bs_upload(char *buf, int len)
     }
 #endif
 
+#ifdef BOOT_SERIAL_WRITE_COMBINE
+    /* The write buffer takes the whole chunk regardless of flash alignment;
+     * whatever is left buffered is written out with the last chunk of the image.
+     */
+    rem_bytes = 0;
+    rc = bs_wbuf_write(fap, img_chunk, img_chunk_len);
+    if (rc == 0 && curr_off + img_chunk_len == img_size) {
+        rc = bs_wbuf_flush(fap);
+        if (rc == 0) {
+            BOOT_LOG_INF("Image of %u chunks written with %u flash writes (%d saved)",
+                         bs_wbuf.chunks, bs_wbuf.writes,
+                         (int)bs_wbuf.chunks - (int)bs_wbuf.writes);
+        }
+    }
+    if (rc != 0) {
+        /* The buffer has been dropped along with data of earlier chunks, so
+         * the upload cannot resume here: have the client start over.
+         */
+        BOOT_LOG_ERR("Write failed, upload has to restart");
+        curr_off = 0;
+    }
+#else
     /* Writes are aligned to flash write alignment, so may drop a few bytes
      * from the end of the buffer; we will request these bytes again with
      * new buffer by responding with request for offset after the last aligned
@@ -1165,9 +1568,21 @@ bs_upload(char *buf, int len)
                               flash_area_align(fap));
 #endif
     }
+#endif /* BOOT_SERIAL_WRITE_COMBINE */
 
     if (rc == 0) {
         curr_off += img_chunk_len + rem_bytes;
+#ifdef BOOT_SERIAL_ERASE_AHEAD
+        bs_erase_ahead.active = (curr_off < img_size);
+        bs_erase_ahead.area_id = flash_area_get_id(fap);
+#ifdef MCUBOOT_SWAP_USING_OFFSET
+        bs_erase_ahead.write_off = curr_off + start_off;
+        bs_erase_ahead.end_off = img_size + start_off;
+#else
+        bs_erase_ahead.write_off = curr_off;
+        bs_erase_ahead.end_off = img_size;
+#endif
+#endif
         if (curr_off == img_size) {
 #if defined(MCUBOOT_ERASE_PROGRESSIVELY) && defined(BOOT_IMAGE_HAS_STATUS_FIELDS)
             /* Assure that sector for image trailer was erased. */
@@ -1402,6 +1817,10 @@ boot_serial_input(char *buf, int len)
             break;
         }
     } else if (MCUBOOT_PERUSER_MGMT_GROUP_ENABLED == 1) {
+#ifdef MCUBOOT_SERIAL_CACHE_VALIDATION
+        /* System specific commands may erase or otherwise change the slots */
+        bs_val_cache_invalidate();
+#endif
         if (bs_peruser_system_specific(hdr, buf, len, cbor_state) == 0) {
             boot_serial_output();
         }
@@ -1440,17 +1859,8 @@ boot_serial_output(void)
     boot_uf->write((const char *)bs_hdr, sizeof(*bs_hdr));
     boot_uf->write(data, len);
 #else
-#ifdef __ZEPHYR__
-    crc =  crc16_itu_t(CRC16_INITIAL_CRC, (uint8_t *)bs_hdr, sizeof(*bs_hdr));
-    crc =  crc16_itu_t(crc, data, len);
-#elif __ESPRESSIF__
-    /* For ESP32 it was used the CRC API in rom/crc.h */
-    crc =  ~esp_crc16_be(~CRC16_INITIAL_CRC, (uint8_t *)bs_hdr, sizeof(*bs_hdr));
-    crc =  ~esp_crc16_be(~crc, (uint8_t *)data, len);
-#else
-    crc = crc16_ccitt(CRC16_INITIAL_CRC, bs_hdr, sizeof(*bs_hdr));
-    crc = crc16_ccitt(crc, data, len);
-#endif
+    crc = boot_serial_crc16(CRC16_INITIAL_CRC, bs_hdr, sizeof(*bs_hdr));
+    crc = boot_serial_crc16(crc, data, len);
     crc = htons(crc);
 
     totlen = len + sizeof(*bs_hdr) + sizeof(crc);
@@ -1497,43 +1907,89 @@ boot_serial_output(void)
 }
 
 #ifndef MCUBOOT_SERIAL_RAW_PROTOCOL
+static int
+boot_serial_b64_val(char c)
+{
+    if (c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    } else if (c >= 'a' && c <= 'z') {
+        return c - 'a' + 26;
+    } else if (c >= '0' && c <= '9') {
+        return c - '0' + 52;
+    } else if (c == '+') {
+        return 62;
+    } else if (c == '/') {
+        return 63;
+    }
+
+    return -1;
+}
+
+/*
+ * Base64 decodes "in" into "out", stopping at the first character that is not
+ * part of the encoding (line terminator or padding). Every output byte is
+ * written after the input characters it comes from have been read, so "out"
+ * may point into the same buffer as "in", at or before it.
+ *
+ * Returns the number of decoded bytes, or -1 on bad encoding or if the result
+ * does not fit in "maxout" bytes.
+ */
+static int
+boot_serial_b64_decode(const char *in, int inlen, uint8_t *out, int maxout)
+{
+    uint32_t acc = 0;
+    int bits = 0;
+    int chars = 0;
+    int olen = 0;
+    int v;
+
+    while (inlen-- > 0 && (v = boot_serial_b64_val(*in)) >= 0) {
+        in++;
+        chars++;
+        acc = (acc << 6) | (uint32_t)v;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            if (olen == maxout) {
+                return -1;
+            }
+            out[olen++] = (uint8_t)(acc >> bits);
+        }
+    }
+
+    /* A single trailing character cannot carry a full byte. */
+    if ((chars % 4) == 1) {
+        return -1;
+    }
+
+    return olen;
+}
+
 /*
+ * Decodes one received line of a frame, appending it to "out", and updates
+ * the CRC of the frame as data is decoded.
+ *
  * Returns 1 if full packet has been received.
  */
 static int
-boot_serial_in_dec(char *in, int inlen, char *out, int *out_off, int maxout)
+boot_serial_in_dec(char *in, int inlen, char *out, int *out_off, uint16_t *crc, int maxout)
 {
     int decoded_len;
-    uint16_t crc;
+    int skip;
     uint16_t len;
 
-#ifdef __ZEPHYR__
-    size_t rc;
-    int err;
-    err = base64_decode( &out[*out_off], maxout - *out_off, &rc, in, inlen - 2);
-    if (err) {
-        return -1;
-    }
-    decoded_len = (int)rc;
-#elif __ESPRESSIF__
-    size_t rc;
-    int err;
-    err = base64_decode((unsigned char *)&out[*out_off], maxout - *out_off, &rc, (unsigned char *)in, inlen);
-    if (err) {
-        return -1;
-    }
-    decoded_len = (int)rc;
-#else
-    int rc;
-    if (*out_off + base64_decode_len(in) >= maxout) {
+    decoded_len = boot_serial_b64_decode(in, inlen, (uint8_t *)&out[*out_off],
+                                         maxout - *out_off);
+    if (decoded_len < 0) {
         return -1;
     }
-    rc = base64_decode(in, &out[*out_off]);
-    if (rc < 0) {
-        return -1;
+
+    /* The CRC covers everything that follows the length field. */
+    skip = 0;
+    if (*out_off < sizeof(uint16_t)) {
+        skip = MIN(decoded_len, (int)sizeof(uint16_t) - *out_off);
     }
-    decoded_len = rc;
-#endif
+    *crc = boot_serial_crc16(*crc, &out[*out_off + skip], decoded_len - skip);
 
     *out_off += decoded_len;
     if (*out_off <= sizeof(uint16_t)) {
@@ -1546,17 +2002,10 @@ boot_serial_in_dec(char *in, int inlen, char *out, int *out_off, int maxout)
     }
 
     out += sizeof(uint16_t);
-#ifdef __ZEPHYR__
-    crc = crc16_itu_t(CRC16_INITIAL_CRC, out, len);
-#elif __ESPRESSIF__
-    crc = ~esp_crc16_be(~CRC16_INITIAL_CRC, (uint8_t *)out, len);
-#else
-    crc = crc16_ccitt(CRC16_INITIAL_CRC, out, len);
-#endif
-    if (crc || len <= sizeof(crc)) {
+    if (*crc || len <= sizeof(*crc)) {
         return 0;
     }
-    *out_off -= sizeof(crc);
+    *out_off -= sizeof(*crc);
     out[*out_off] = '\0';
 
     return 1;
@@ -1616,6 +2065,8 @@ boot_serial_read_console(const struct boot_uart_funcs *f,int timeout_in_ms)
     int off;
 #ifndef MCUBOOT_SERIAL_RAW_PROTOCOL
     int dec_off = 0;
+    uint16_t crc = CRC16_INITIAL_CRC;
+    char *line;
 #endif
     int full_line;
     int max_input;
@@ -1656,8 +2107,22 @@ boot_serial_read_console(const struct boot_uart_funcs *f,int timeout_in_ms)
 #ifdef MCUBOOT_SERIAL_WAIT_FOR_DFU
         uint32_t start = k_uptime_get_32();
 #endif
+#ifdef MCUBOOT_SERIAL_RAW_PROTOCOL
         rc = f->read(in_buf + off, sizeof(in_buf) - off, &full_line);
+#else
+        rc = f->read(in_buf + dec_off + off, sizeof(in_buf) - dec_off - off, &full_line);
+#endif
         if (rc <= 0 && !full_line) {
+#ifdef BOOT_SERIAL_ERASE_AHEAD
+            /*
+             * No input pending; use the time to erase ahead of the upload,
+             * and poll again right away instead of idling if there was
+             * something to erase.
+             */
+            if (bs_erase_ahead_step()) {
+                goto check_timeout;
+            }
+#endif
 #ifndef MCUBOOT_SERIAL_WAIT_FOR_DFU
             allow_idle = true;
 #endif
@@ -1681,26 +2146,41 @@ boot_serial_read_console(const struct boot_uart_funcs *f,int timeout_in_ms)
         off = boot_serial_input_raw(in_buf, off, max_input);
 #else
         if (!full_line) {
-            if (off == max_input) {
+            if (dec_off + off == max_input) {
                 /*
-                 * Full line, no newline yet. Reset the input buffer.
+                 * Full buffer, no newline yet. Reset the input buffer, dropping
+                 * the frame that the line belongs to as it cannot fit anymore.
                  */
+                dec_off = 0;
                 off = 0;
             }
             goto check_timeout;
         }
-        if (in_buf[0] == SHELL_NLIP_PKT_START1 &&
-          in_buf[1] == SHELL_NLIP_PKT_START2) {
+
+        /*
+         * The line has been read in right after the part of the frame decoded
+         * so far, and is decoded in place onto the end of it.
+         */
+        line = &in_buf[dec_off];
+        rc = 0;
+        if (line[0] == SHELL_NLIP_PKT_START1 &&
+          line[1] == SHELL_NLIP_PKT_START2) {
             dec_off = 0;
-            rc = boot_serial_in_dec(&in_buf[2], off - 2, dec_buf, &dec_off, max_input);
-        } else if (in_buf[0] == SHELL_NLIP_DATA_START1 &&
-          in_buf[1] == SHELL_NLIP_DATA_START2) {
-            rc = boot_serial_in_dec(&in_buf[2], off - 2, dec_buf, &dec_off, max_input);
+            crc = CRC16_INITIAL_CRC;
+            rc = boot_serial_in_dec(&line[2], off - 2, in_buf, &dec_off, &crc,
+                                    MCUBOOT_SERIAL_MAX_RECEIVE_SIZE);
+        } else if (line[0] == SHELL_NLIP_DATA_START1 &&
+          line[1] == SHELL_NLIP_DATA_START2 && dec_off > 0) {
+            rc = boot_serial_in_dec(&line[2], off - 2, in_buf, &dec_off, &crc,
+                                    MCUBOOT_SERIAL_MAX_RECEIVE_SIZE);
         }
 
         /* serve errors: out of decode memory, or bad encoding */
         if (rc == 1) {
-            boot_serial_input(&dec_buf[2], dec_off - 2);
+            boot_serial_input(&in_buf[2], dec_off - 2);
+        }
+        if (rc != 0) {
+            dec_off = 0;
         }
         off = 0;
 #endif /* MCUBOOT_SERIAL_RAW_PROTOCOL */
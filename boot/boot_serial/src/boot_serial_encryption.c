@@ -46,6 +46,7 @@ boot_image_validate_encrypted(struct boot_loader_state *state,
 
 out:
     boot_enc_zeroize(BOOT_CURR_ENC(state));
+    boot_enc_cache_wipe(state);
     /* boot_enc_load() populates _bs.enckey[] with the raw AES key; wipe it
      * so it does not survive on the stack after this function returns.
      */
@@ -17,6 +17,7 @@
  * under the License.
  */
 #include <assert.h>
+#include <setjmp.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -33,19 +34,71 @@
 
 #include "boot_serial/boot_serial.h"
 #include "boot_serial_priv.h"
+#include "boot_test.h"
 
 TEST_CASE_DECL(boot_serial_setup)
 TEST_CASE_DECL(boot_serial_empty_msg)
 TEST_CASE_DECL(boot_serial_empty_img_msg)
 TEST_CASE_DECL(boot_serial_img_msg)
 TEST_CASE_DECL(boot_serial_upload_bigger_image)
+TEST_CASE_DECL(boot_serial_frame_multi_line)
+TEST_CASE_DECL(boot_serial_frame_tail)
+TEST_CASE_DECL(boot_serial_frame_bad_char)
+TEST_CASE_DECL(boot_serial_frame_bad_crc)
+TEST_CASE_DECL(boot_serial_frame_max_size)
+
+/* Encoded frame fed to boot_serial_start() by tx_lines(). */
+static const char *test_rx;
+static int test_rx_len;
+static int test_rx_off;
+static int test_rx_line_len;
+static jmp_buf test_rx_done;
+
+/* Number of response frames written back. */
+static int test_tx_frames;
+
+static int
+test_uart_read(char *str, int cnt, int *newline)
+{
+    int len;
+
+    if (test_rx_off == test_rx_len) {
+        /* All input consumed, return from boot_serial_start(). */
+        longjmp(test_rx_done, 1);
+    }
+
+    len = test_rx_len - test_rx_off;
+    if (len > test_rx_line_len) {
+        len = test_rx_line_len;
+    }
+    assert(len + 3 <= cnt);
+
+    if (test_rx_off == 0) {
+        str[0] = SHELL_NLIP_PKT_START1;
+        str[1] = SHELL_NLIP_PKT_START2;
+    } else {
+        str[0] = SHELL_NLIP_DATA_START1;
+        str[1] = SHELL_NLIP_DATA_START2;
+    }
+    memcpy(&str[2], &test_rx[test_rx_off], len);
+    str[len + 2] = '\n';
+    test_rx_off += len;
+
+    *newline = 1;
+    return len + 3;
+}
 
 static void
 test_uart_write(const char *str, int len)
 {
+    if (len == 2 && str[0] == SHELL_NLIP_PKT_START1 &&
+      str[1] == SHELL_NLIP_PKT_START2) {
+        test_tx_frames++;
+    }
 }
 
 static const struct boot_uart_funcs test_uart = {
+    .read = test_uart_read,
     .write = test_uart_write
 };
 
@@ -55,6 +108,52 @@ tx_msg(void *src, int len)
     boot_serial_input(src, len);
 }
 
+int
+tx_frame_enc(int payload_len, char *out)
+{
+    static uint8_t frame[MCUBOOT_SERIAL_MAX_RECEIVE_SIZE + 1];
+    struct nmgr_hdr *hdr;
+    uint16_t crc;
+    uint16_t len;
+    int off;
+
+    off = TX_FRAME_OVERHEAD + payload_len;
+    assert(off <= sizeof(frame));
+
+    len = htons(off - sizeof(len));
+    memcpy(frame, &len, sizeof(len));
+
+    hdr = (struct nmgr_hdr *)&frame[sizeof(len)];
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->nh_op = NMGR_OP_WRITE;
+    hdr->nh_group = htons(MGMT_GROUP_ID_DEFAULT);
+    hdr->nh_id = NMGR_ID_CONS_ECHO_CTRL;
+    hdr->nh_len = htons(payload_len);
+    memset(hdr + 1, 0x5a, payload_len);
+
+    crc = crc16_ccitt(CRC16_INITIAL_CRC, hdr, sizeof(*hdr) + payload_len);
+    crc = htons(crc);
+    memcpy(&frame[off - sizeof(crc)], &crc, sizeof(crc));
+
+    return base64_encode(frame, off, out, 1);
+}
+
+int
+tx_lines(const char *enc, int len, int line_len)
+{
+    test_rx = enc;
+    test_rx_len = len;
+    test_rx_off = 0;
+    test_rx_line_len = line_len;
+    test_tx_frames = 0;
+
+    if (setjmp(test_rx_done) == 0) {
+        boot_serial_start(&test_uart);
+    }
+
+    return test_tx_frames;
+}
+
 TEST_SUITE(boot_serial_suite)
 {
     boot_serial_setup();
@@ -62,6 +161,11 @@ TEST_SUITE(boot_serial_suite)
     boot_serial_empty_img_msg();
     boot_serial_img_msg();
     boot_serial_upload_bigger_image();
+    boot_serial_frame_multi_line();
+    boot_serial_frame_tail();
+    boot_serial_frame_bad_char();
+    boot_serial_frame_bad_crc();
+    boot_serial_frame_max_size();
 }
 
 int
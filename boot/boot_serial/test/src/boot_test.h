@@ -41,8 +41,34 @@
 extern "C" {
 #endif
 
+#ifndef MCUBOOT_SERIAL_MAX_RECEIVE_SIZE
+#define MCUBOOT_SERIAL_MAX_RECEIVE_SIZE 512
+#endif
+
+#define CRC16_INITIAL_CRC       0
+
+/* Bytes a frame adds around "payload_len" bytes of SMP payload. */
+#define TX_FRAME_OVERHEAD       (sizeof(uint16_t) + \
+                                 sizeof(struct nmgr_hdr) + sizeof(uint16_t))
+
+/* Base64 characters per line that fit MCUBOOT_SERIAL_MAX_LINE_INPUT_LEN. */
+#define TX_LINE_LEN             124
+
 void tx_msg(void *src, int len);
 
+/*
+ * Builds a console frame (length, SMP header and payload, CRC16) carrying a
+ * console echo control request with "payload_len" filler bytes, and base64
+ * encodes it into "out". Returns the encoded length.
+ */
+int tx_frame_enc(int payload_len, char *out);
+
+/*
+ * Feeds the "len" encoded characters at "enc" to boot_serial_start() as one
+ * frame, "line_len" characters per line. Returns the number of responses.
+ */
+int tx_lines(const char *enc, int len, int line_len);
+
 #ifdef __cplusplus
 }
 #endif
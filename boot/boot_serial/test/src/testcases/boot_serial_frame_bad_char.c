@@ -0,0 +1,41 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "boot_test.h"
+
+TEST_CASE(boot_serial_frame_bad_char)
+{
+    static char enc[BASE64_ENCODE_SIZE(TX_FRAME_OVERHEAD + 200) + 1];
+    char c;
+    int len;
+    int rc;
+
+    len = tx_frame_enc(200, enc);
+
+    /* Invalid character in the middle of the second line. */
+    c = enc[TX_LINE_LEN + 61];
+    enc[TX_LINE_LEN + 61] = '*';
+    rc = tx_lines(enc, len, TX_LINE_LEN);
+    assert(rc == 0);
+
+    /* The following frame is received normally. */
+    enc[TX_LINE_LEN + 61] = c;
+    rc = tx_lines(enc, len, TX_LINE_LEN);
+    assert(rc == 1);
+}
@@ -0,0 +1,39 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "boot_test.h"
+
+TEST_CASE(boot_serial_frame_max_size)
+{
+    static char enc[BASE64_ENCODE_SIZE(MCUBOOT_SERIAL_MAX_RECEIVE_SIZE) + 1];
+    int len;
+    int rc;
+
+    /* A frame of exactly MCUBOOT_SERIAL_MAX_RECEIVE_SIZE bytes fits. */
+    len = tx_frame_enc(MCUBOOT_SERIAL_MAX_RECEIVE_SIZE - TX_FRAME_OVERHEAD,
+                       enc);
+    rc = tx_lines(enc, len, TX_LINE_LEN);
+    assert(rc == 1);
+
+    /* One more byte does not. */
+    len = tx_frame_enc(MCUBOOT_SERIAL_MAX_RECEIVE_SIZE - TX_FRAME_OVERHEAD + 1,
+                       enc);
+    rc = tx_lines(enc, len, TX_LINE_LEN);
+    assert(rc == 0);
+}
@@ -0,0 +1,37 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "boot_test.h"
+
+TEST_CASE(boot_serial_frame_multi_line)
+{
+    static char enc[BASE64_ENCODE_SIZE(TX_FRAME_OVERHEAD + 200) + 1];
+    int len;
+    int rc;
+
+    /* Three lines, the last one partially filled. */
+    len = tx_frame_enc(200, enc);
+    assert(len > 2 * TX_LINE_LEN);
+    rc = tx_lines(enc, len, TX_LINE_LEN);
+    assert(rc == 1);
+
+    /* One base64 quantum per line. */
+    rc = tx_lines(enc, len, 4);
+    assert(rc == 1);
+}
@@ -0,0 +1,45 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "boot_test.h"
+
+TEST_CASE(boot_serial_frame_tail)
+{
+    char enc[BASE64_ENCODE_SIZE(TX_FRAME_OVERHEAD + 2) + 1];
+    int payload_len;
+    int len;
+    int rc;
+
+    /*
+     * Frames of 13 and 14 bytes end in "==" and "=" when padded; the decoder
+     * must accept them with and without the padding.
+     */
+    for (payload_len = 1; payload_len <= 2; payload_len++) {
+        len = tx_frame_enc(payload_len, enc);
+        assert(enc[len - 1] == '=');
+        rc = tx_lines(enc, len, TX_LINE_LEN);
+        assert(rc == 1);
+
+        while (enc[len - 1] == '=') {
+            len--;
+        }
+        rc = tx_lines(enc, len, TX_LINE_LEN);
+        assert(rc == 1);
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * BLAKE2s (RFC 7693) with a 32 byte digest and no key, usable as the image
+ * digest in place of SHA-256 when MCUBOOT_BLAKE2S is enabled. It needs no
+ * crypto library and is noticeably faster than SHA-256 in software on 32-bit
+ * cores.
+ */
+
+#ifndef __BOOTUTIL_CRYPTO_BLAKE2S_H_
+#define __BOOTUTIL_CRYPTO_BLAKE2S_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE  (64)
+#define BOOTUTIL_CRYPTO_BLAKE2S_DIGEST_SIZE (32)
+
+typedef struct {
+    uint32_t h[8];
+    uint32_t t[2];
+    uint32_t buflen;
+    uint8_t buf[BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE];
+} bootutil_blake2s_context;
+
+void bootutil_blake2s_init(bootutil_blake2s_context *ctx);
+void bootutil_blake2s_update(bootutil_blake2s_context *ctx, const void *data,
+                             uint32_t data_len);
+void bootutil_blake2s_finish(bootutil_blake2s_context *ctx, uint8_t *output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOTUTIL_CRYPTO_BLAKE2S_H_ */
@@ -48,6 +48,9 @@
 #if defined(MCUBOOT_USE_TINYCRYPT)
     #include <tinycrypt/ecc_dsa.h>
     #include <tinycrypt/constants.h>
+    #if defined(MCUBOOT_ECDSA_P256_COMB_TEETH)
+        #include "bootutil/crypto/ecdsa_p256_comb.h"
+    #endif
 #endif /* MCUBOOT_USE_TINYCRYPT */
 
 #if defined(MCUBOOT_USE_CC310)
@@ -194,11 +197,31 @@ static int bootutil_decode_sig(uint8_t signature[NUM_ECC_BYTES * 2], uint8_t *cp
 }
 #endif /* not MCUBOOT_ECDSA_NEED_ASN1_SIG */
 
+#if defined(MCUBOOT_ECDSA_P256_COMB_TEETH)
+#define BOOTUTIL_ECDSA_P256_G_COMB          bootutil_ecdsa_p256_g_comb
+#define BOOTUTIL_ECDSA_P256_G_COMB_TEETH    MCUBOOT_ECDSA_P256_COMB_TEETH
+#else
+#define BOOTUTIL_ECDSA_P256_G_COMB          NULL
+#define BOOTUTIL_ECDSA_P256_G_COMB_TEETH    0
+#endif
+
+#if defined(MCUBOOT_ECDSA_P256_KEY_COMB_TEETH)
+typedef struct {
+    /* Comb table of the public key, from imgtool getpub --comb-teeth. */
+    const uECC_word_t *key_comb;
+} bootutil_ecdsa_context;
+
+static inline void bootutil_ecdsa_init(bootutil_ecdsa_context *ctx)
+{
+    ctx->key_comb = NULL;
+}
+#else
 typedef uintptr_t bootutil_ecdsa_context;
 static inline void bootutil_ecdsa_init(bootutil_ecdsa_context *ctx)
 {
     (void)ctx;
 }
+#endif /* MCUBOOT_ECDSA_P256_KEY_COMB_TEETH */
 
 static inline void bootutil_ecdsa_drop(bootutil_ecdsa_context *ctx)
 {
@@ -228,7 +251,19 @@ static inline int bootutil_ecdsa_verify(bootutil_ecdsa_context *ctx,
     }
     pk++;
 
+#if defined(MCUBOOT_ECDSA_P256_KEY_COMB_TEETH)
+    rc = uECC_verify_comb(pk, hash, BOOTUTIL_CRYPTO_ECDSA_P256_HASH_SIZE, signature,
+                          BOOTUTIL_ECDSA_P256_G_COMB, BOOTUTIL_ECDSA_P256_G_COMB_TEETH,
+                          ctx->key_comb,
+                          ctx->key_comb != NULL ? MCUBOOT_ECDSA_P256_KEY_COMB_TEETH : 0,
+                          uECC_secp256r1());
+#elif defined(MCUBOOT_ECDSA_P256_COMB_TEETH)
+    rc = uECC_verify_comb(pk, hash, BOOTUTIL_CRYPTO_ECDSA_P256_HASH_SIZE, signature,
+                          BOOTUTIL_ECDSA_P256_G_COMB, BOOTUTIL_ECDSA_P256_G_COMB_TEETH,
+                          NULL, 0, uECC_secp256r1());
+#else
     rc = uECC_verify(pk, hash, BOOTUTIL_CRYPTO_ECDSA_P256_HASH_SIZE, signature, uECC_secp256r1());
+#endif
     if (rc != TC_CRYPTO_SUCCESS) {
         return -1;
     }
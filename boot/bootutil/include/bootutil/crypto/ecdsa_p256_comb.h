@@ -0,0 +1,2053 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Fixed-base comb tables of the NIST P-256 generator for
+ * uECC_verify_comb(), selected by MCUBOOT_ECDSA_P256_COMB_TEETH.
+ *
+ * Generated by scripts/ecdsa_p256_comb.py, do not edit.
+ */
+
+#ifndef __BOOTUTIL_CRYPTO_ECDSA_P256_COMB_H_
+#define __BOOTUTIL_CRYPTO_ECDSA_P256_COMB_H_
+
+#include <tinycrypt/ecc.h>
+
+#if MCUBOOT_ECDSA_P256_COMB_TEETH == 1
+static const uECC_word_t bootutil_ecdsa_p256_g_comb[16] = {
+    0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+    0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+    0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+    0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2,
+};
+#elif MCUBOOT_ECDSA_P256_COMB_TEETH == 2
+static const uECC_word_t bootutil_ecdsa_p256_g_comb[48] = {
+    0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+    0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+    0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+    0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2,
+    0xd789bd85, 0x57c84fc9, 0xc297eac3, 0xfc35ff7d,
+    0x88c6766e, 0xfb982fd5, 0xeedb5e67, 0x447d739b,
+    0x72e25b32, 0x0c7e33c9, 0xa7fae500, 0x3d349b95,
+    0x3a4aaff7, 0xe12e9d95, 0x834131ee, 0x2d4825ab,
+    0x2a1d367f, 0x13949c93, 0x1a0a11b7, 0xef7fbd2b,
+    0xb91dfc60, 0xddc6068b, 0x8a9c72ff, 0xef951932,
+    0x7376d8a8, 0x196035a7, 0x95ca1740, 0x23183b08,
+    0x022c219c, 0xc1ee9807, 0x7dbb2c9b, 0x611e9fc3,
+};
+#elif MCUBOOT_ECDSA_P256_COMB_TEETH == 3
+static const uECC_word_t bootutil_ecdsa_p256_g_comb[112] = {
+    0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+    0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+    0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+    0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2,
+    0xbf780c2c, 0xfdc73e83, 0x2d666817, 0xffdc6794,
+    0x02436893, 0xc14b66dd, 0x0d54650c, 0x6eec9567,
+    0xedbfcd32, 0x089ec1a1, 0x3a07ff89, 0x79ab6615,
+    0x65ea0105, 0xfc281de0, 0x997732c2, 0x14bb5350,
+    0x7318188e, 0xaec90264, 0xca167099, 0x410bec28,
+    0x099c202b, 0xbf664d2f, 0x55fa625c, 0x13ccca34,
+    0x05421c0c, 0xaa84c231, 0x6cdb0d71, 0x6b647521,
+    0xfb216a5e, 0xe90446b1, 0xaf46893d, 0x4b5ba5a5,
+    0xa9aa52df, 0x3cd5f4e4, 0xb42a627f, 0x18c452b1,
+    0xd991ece6, 0x6dbc4189, 0x7f608bf7, 0x45a511c9,
+    0x125ec16c, 0x7b52bd12, 0xd22955ce, 0x5a919b27,
+    0xcb625ad2, 0x3fe3337f, 0x73ea9b6d, 0x73be0ec7,
+    0x016476ea, 0xc6e4b6d0, 0xd4ec2510, 0x71b9a7e5,
+    0xcbe490d2, 0x1975b71e, 0xb52acd25, 0xdf6b472f,
+    0x784055eb, 0xf1738716, 0xb87d399e, 0xccc7b0b3,
+    0x1bb51119, 0x3c9a1337, 0xa88fd593, 0xb42639e1,
+    0xb56bc451, 0x48d63748, 0xa939440a, 0x0544de81,
+    0x664ec19c, 0xda24eb0b, 0x41f42bf6, 0x4fb6e562,
+    0x66bb5d6b, 0x21b2c80e, 0xd25bd41b, 0xa4123924,
+    0xbce2d418, 0x6f95f5f2, 0x4d6d91d8, 0xa9232776,
+    0xf119b8cc, 0x546a08e7, 0x8afc696a, 0x03b7d523,
+    0x459f70b4, 0x0a896132, 0xa86a9116, 0x57a46257,
+    0xbb314c65, 0xfaa56fef, 0x74795c6d, 0xf4e61f40,
+    0x437850d6, 0x1a3c5652, 0x6621ec11, 0x7c4b127d,
+};
+#elif MCUBOOT_ECDSA_P256_COMB_TEETH == 4
+static const uECC_word_t bootutil_ecdsa_p256_g_comb[240] = {
+    0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+    0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+    0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+    0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2,
+    0x8e14db63, 0x90e75cb4, 0xad651f7e, 0x29493baa,
+    0x326e25de, 0x8492592e, 0x2811aaa5, 0x0fa822bc,
+    0x5f462ee7, 0xe4112454, 0x50fe82f5, 0x34b1a650,
+    0xb3df188b, 0x6f4ad4bc, 0xf5dba80d, 0xbff44ae8,
+    0x097992af, 0x93391ce2, 0x0d35f1fa, 0xe96c98fd,
+    0x95e02789, 0xb257c0de, 0x89d6726f, 0x300a4bbc,
+    0xc08127a0, 0xaa54a291, 0xa9d806a5, 0x5bb1eead,
+    0xff1e3c6f, 0x7f1ddb25, 0xd09b4644, 0x72aac7e0,
+    0xd789bd85, 0x57c84fc9, 0xc297eac3, 0xfc35ff7d,
+    0x88c6766e, 0xfb982fd5, 0xeedb5e67, 0x447d739b,
+    0x72e25b32, 0x0c7e33c9, 0xa7fae500, 0x3d349b95,
+    0x3a4aaff7, 0xe12e9d95, 0x834131ee, 0x2d4825ab,
+    0x2a1d367f, 0x13949c93, 0x1a0a11b7, 0xef7fbd2b,
+    0xb91dfc60, 0xddc6068b, 0x8a9c72ff, 0xef951932,
+    0x7376d8a8, 0x196035a7, 0x95ca1740, 0x23183b08,
+    0x022c219c, 0xc1ee9807, 0x7dbb2c9b, 0x611e9fc3,
+    0x0b57f4bc, 0xcae2b192, 0xc6c9bc36, 0x2936df5e,
+    0xe11238bf, 0x7dea6482, 0x7b51f5d8, 0x55066379,
+    0x348a964c, 0x44ffe216, 0xdbdefbe1, 0x9fb3d576,
+    0x8d9d50e5, 0x0afa4001, 0x8aecb851, 0x15716484,
+    0xfc5cde01, 0xe48ecaff, 0x0d715f26, 0x7ccd84e7,
+    0xf43e4391, 0xa2e8f483, 0xb21141ea, 0xeb5d7745,
+    0x731a3479, 0xcac917e2, 0x2844b645, 0x85f22cfe,
+    0x58006cee, 0x0990e6a1, 0xdbecc17b, 0xeafd72eb,
+    0x313728be, 0x6cf20ffb, 0xa3c6b94a, 0x96439591,
+    0x44315fc5, 0x2736ff83, 0xa7849276, 0xa6d39677,
+    0xc357f5f4, 0xf2bab833, 0x2284059b, 0x824a920c,
+    0x2d27ecdf, 0x66b8babd, 0x9b0b8816, 0x674f8474,
+    0x677c8a3e, 0x2df48c04, 0x0203a56b, 0x74e02f08,
+    0xb8c7fedb, 0x31855f7d, 0x72c9ddad, 0x4e769e76,
+    0xb824bbb0, 0xa4c36165, 0x3b9122a5, 0xfb9ae16f,
+    0x06947281, 0x1ec00572, 0xde830663, 0x42b99082,
+    0xdda868b9, 0x6ef95150, 0x9c0ce131, 0xd1f89e79,
+    0x08a1c478, 0x7fdc1ca0, 0x1c6ce04d, 0x78878ef6,
+    0x1fe0d976, 0x9c62b912, 0xbde08d4f, 0x6ace570e,
+    0x12309def, 0xde53142c, 0x7b72c321, 0xb6cb3f5d,
+    0xc31a3573, 0x7f991ed2, 0xd54fb496, 0x5b82dd5b,
+    0x812ffcae, 0x595c5220, 0x716b1287, 0x0c88bc4d,
+    0x5f48aca8, 0x3a57bf63, 0xdf2564f3, 0x7c8181f4,
+    0x9c04e6aa, 0x18d1b5b3, 0xf3901dc6, 0xdd5ddea3,
+    0x3e72ad0c, 0xe96a79fb, 0x42ba792f, 0x43a0a28c,
+    0x083e49f3, 0xefe0a423, 0x6b317466, 0x68f344af,
+    0x3fb24d4a, 0xcdfe17db, 0x71f5c626, 0x668bfc22,
+    0x24d67ff3, 0x604ed93c, 0xf8540a20, 0x31b9c405,
+    0xa2582e7f, 0xd36b4789, 0x4ec39c28, 0x0d1a1014,
+    0xedbad7a0, 0x663c62c3, 0x6f461db9, 0x4052bf4b,
+    0x188d25eb, 0x235a27c3, 0x99bfcc5b, 0xe724f339,
+    0x71d70cc8, 0x862be6bd, 0x90b0fc61, 0xfecf4d51,
+    0xa1d4cfac, 0x74346c10, 0x8526a7a4, 0xafdf5cc0,
+    0xf62bff7a, 0x123202a8, 0xc802e41a, 0x1eddbae2,
+    0xd603f844, 0x8fa0af2d, 0x4c701917, 0x36e06b7e,
+    0x73db33a0, 0x0c45f452, 0x560ebcfc, 0x43104d86,
+    0x0d1d78e5, 0x9615b511, 0x25c4744b, 0x66b0de32,
+    0x6aaf363a, 0x0a4a46fb, 0x84f7a21c, 0xb48e26b4,
+    0x21a01b2d, 0x06ebb0f6, 0x8b7b0f98, 0xc004e404,
+    0xfed6f668, 0x64131bcd, 0x4d4d3dab, 0xfac01540,
+};
+#elif MCUBOOT_ECDSA_P256_COMB_TEETH == 5
+static const uECC_word_t bootutil_ecdsa_p256_g_comb[496] = {
+    0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+    0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+    0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+    0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2,
+    0x071e5c83, 0xeea6bc92, 0x8542a0be, 0x8bd27f19,
+    0x2a58e5b1, 0x20a845b7, 0x5026d73f, 0x54ccc941,
+    0x140916a1, 0xcfd08ef7, 0x5d8ee496, 0x929e0bcc,
+    0xdad2bf22, 0x3a8f8715, 0xb4514532, 0x1c433f45,
+    0x04bac870, 0xf7d24bb7, 0x3a23c6ab, 0x593a09a0,
+    0xf94c9d1d, 0xdfcc2358, 0x297bed02, 0x3cfa0f87,
+    0x40f26940, 0xce98a30b, 0x0248a8af, 0x62121c0d,
+    0x8309af9b, 0xa758aa80, 0x70be12c6, 0xe4e37694,
+    0x3ecca7e0, 0xc739a5ea, 0x6743333e, 0xa7d2c98f,
+    0x224d9428, 0x0fef6335, 0x5c792a0c, 0x7ef2ee3c,
+    0x552ac094, 0x302b22dd, 0xdfbd3d20, 0x81b21450,
+    0xd5e609db, 0xa4f67f51, 0x30acc011, 0xafb68627,
+    0x86ef7d7d, 0xdd37e3ff, 0x088b86db, 0xf6d77c27,
+    0x254c5491, 0x28fe9a4f, 0x6df0fd5e, 0xd6690337,
+    0xaddad596, 0x9ff04992, 0x9e4373f9, 0xf3d1a7af,
+    0xdf074167, 0xa13e9578, 0xe6d13d22, 0x20e2a53c,
+    0xb0879605, 0xd7b86aee, 0xbe3c7265, 0xa424ec2d,
+    0x12f01e9e, 0x276203c2, 0xb77e46e9, 0xb666fac5,
+    0x3bf0c52d, 0xf431bb1a, 0x726cd8b6, 0xef46a44a,
+    0xee3de5a9, 0xeb5abc19, 0x90246904, 0x38aaa380,
+    0x525d6abf, 0xaebfd735, 0x96bea25a, 0xc302f8f4,
+    0x544920a4, 0xdb82b3ea, 0x02eadb2e, 0x621c75d1,
+    0x9ef485f0, 0x8939dc4c, 0x57c46d63, 0x225d03d8,
+    0x522d7f70, 0x4fdac96f, 0xb4fa649d, 0xd7c4a4fe,
+    0x943e832a, 0x9c762ef1, 0x1786df70, 0x07e50ab0,
+    0x2589f18e, 0x90f573a8, 0xa7c2a51a, 0x0d2bf28b,
+    0x5b20d37c, 0x48263af1, 0x60551446, 0x27ec9db9,
+    0x94b4e7ed, 0x7087a10a, 0x13bd00ac, 0x0cac3f43,
+    0xc0b9372a, 0x8bc659aa, 0xedd9583f, 0xf7659958,
+    0x8c267d88, 0x9f05f94a, 0xc99a739d, 0x00dc46e7,
+    0xdf55d0f2, 0x4af50a00, 0x8156bf6a, 0xb5eb202d,
+    0x5228c111, 0x40d1e3ab, 0x45793424, 0x0312a557,
+    0x9e6486e0, 0x9d90cda8, 0x1c7522c0, 0xc8a820bd,
+    0x08dcd7ab, 0x867c5580, 0x882a7892, 0x3c510ce2,
+    0x646d54c6, 0x0e283334, 0xeda4e046, 0x33392776,
+    0x5ba997b0, 0xc3a7fc08, 0x5acf053f, 0xd35e620f,
+    0x7eb8cfee, 0x8d9692f7, 0x0d8c013d, 0x05e3f223,
+    0x84e32e59, 0x76347a52, 0x15b0a1e5, 0x3c53e290,
+    0xfae798d4, 0x538b7da5, 0x00d23591, 0x1b9f1bd1,
+    0x9a08693f, 0x11a9f072, 0x140efeb3, 0xd30e7cda,
+    0x4dd6c004, 0x81dec926, 0xdad210d5, 0xbfed14fe,
+    0xb96b9911, 0x39f9ff69, 0x29c2024d, 0x02fd7b73,
+    0x715d29fc, 0x50cfceb8, 0x0c236311, 0xb682b999,
+    0xc7797831, 0x00f34add, 0x59927df3, 0x42ebd3cb,
+    0xf8e8f683, 0x6dfcf787, 0x3f7fbe90, 0x13d72b7a,
+    0x2df232cf, 0xfd426d94, 0x5fe39aad, 0xed84bb42,
+    0x732995fc, 0x023e67a1, 0x355430e3, 0x67dd0a8e,
+    0x97a1d703, 0x0cf83b61, 0x583c33f2, 0xa3233455,
+    0x68142904, 0x27014ab4, 0x00cfa617, 0xfb500882,
+    0x7009b958, 0x6745ff87, 0xd449242d, 0x9e9889bc,
+    0x575616c8, 0x035b613b, 0x138e99e2, 0x00855156,
+    0x292e6aa0, 0x94c0d24b, 0x7e79b3a2, 0xd9ba5b68,
+    0x5f165d99, 0xcebbbc7b, 0x8a4eee61, 0x50cc51c1,
+    0x1b4d0d1f, 0xb31d2353, 0x66382ada, 0x95e18452,
+    0x0a839b5b, 0xacad4f81, 0x4142ff0f, 0xa0a2a96e,
+    0x1f4fa12f, 0x3eaa8289, 0x6b0fb8f3, 0x68d68c8f,
+    0x839bb85f, 0x320f09c3, 0xa050e62c, 0x0101fb06,
+    0x9ad53458, 0x557582c9, 0x1666432b, 0x55d5398d,
+    0x4fed936f, 0xf7f63118, 0x1833d9e1, 0xd90d6a7f,
+    0x8ebaa72a, 0x059c6a9e, 0x49ff8e2d, 0x576e2290,
+    0x51bbb3f1, 0x9311a269, 0x8d0f4f65, 0xe80f26bd,
+    0x6beccbb9, 0x9d3dc334, 0x101e5de4, 0x54e244d5,
+    0xf1b19e28, 0xb3ad4c6e, 0x58c2e3b7, 0x4334fbc0,
+    0x35df9c25, 0x19bd4107, 0xec106eb6, 0xd6bbec0e,
+    0xe5046dc5, 0x788251c7, 0xf179327b, 0x12839b95,
+    0x4a8cb46e, 0xf1c05d98, 0x3c00736b, 0x443737cd,
+    0x12cd8fe5, 0xa760a456, 0x0817bdd9, 0x797489de,
+    0xf42c23e8, 0xc56eb80a, 0xe6fe7af5, 0x83719dd7,
+    0x3fefcfc8, 0xe8881a83, 0xb9b5290b, 0xaea3c9e0,
+    0x771e4688, 0x10b37ecd, 0xd4d021b6, 0xee0816a3,
+    0xb3a8caa1, 0x8e9929bf, 0xc105f2d1, 0x48915dcf,
+    0xdb49019f, 0x3a5fdf82, 0xad9006e1, 0xc4a438e3,
+    0x87de4b29, 0x5db9620f, 0xd91ecb2e, 0xd7420c18,
+    0x32acf105, 0x301ba1b2, 0x7853a937, 0xdb96bb0c,
+    0xc359ac34, 0xd84bfef6, 0x64852a1d, 0xab80cef0,
+    0xb9da1717, 0x3fbee4d3, 0x7a13222c, 0xb325074e,
+    0xe83ad2c9, 0x5d6dc503, 0xaed035be, 0xca9f7a1d,
+    0xcbd21e33, 0x552788ac, 0xe09cb9f0, 0x8699dd31,
+    0x329bf961, 0x38584196, 0xb82a5af9, 0x4cb20e96,
+    0xc72c78c1, 0x24199908, 0xe92859b7, 0x16e65484,
+    0x052fde29, 0x6a201c4b, 0x0031dbb4, 0x6c897123,
+    0x16c1da96, 0x4a759982, 0x2cc67214, 0xeec0b975,
+    0x812c864e, 0xb908b9f1, 0x8439f6ba, 0x367fb66a,
+    0xf966f329, 0x789d664b, 0xf7f1d283, 0xe02af770,
+    0xdb3038dd, 0xa20a2c70, 0xe99d5c7c, 0x5f0b46d5,
+    0x4b600b83, 0xc9b97d37, 0x3df3245e, 0x186c7f79,
+    0x4f1ce57f, 0x2af72460, 0x91e2d8ed, 0x9249897f,
+    0x8d2ea797, 0x8139b36a, 0x9ab58913, 0x9c428db8,
+    0x6471aaa0, 0xb4a196fb, 0x1b6b9730, 0xdcbab650,
+    0x295b57d2, 0x7afccc8a, 0x4e33a65d, 0xee2280f4,
+    0x890fcd12, 0xc47a0803, 0x82604f6b, 0x4e98a98d,
+    0xed5fbbd2, 0x0d598f06, 0xa6a1eb84, 0xce46ec91,
+    0x4be6458d, 0x1f1e4f3f, 0x595e6547, 0x5f72cc22,
+    0x271a93f1, 0x5bc5341e, 0x58a5f263, 0xc62e155c,
+    0x58ba7ff4, 0x5f6f845a, 0x7e36a6ad, 0x67e1f7dc,
+    0xeeaa4d04, 0xd33a7657, 0x18267e4e, 0xff9f2322,
+    0x4a53789f, 0xd369f11f, 0x3696b437, 0xc7876fb6,
+    0x0baba29a, 0xa0e8f0a7, 0x32f6e514, 0xa0318a5f,
+    0x11775a08, 0x5c4a43d1, 0x362eebb1, 0x418c507c,
+    0x09a325aa, 0xfd08903f, 0xf0eebb3a, 0xf320b8fc,
+    0xc7644c1d, 0xe33f0255, 0xbb9002d8, 0x4030ecc3,
+    0xf4646f9f, 0xa4486916, 0x959c44fa, 0x5e677d0c,
+    0xd88b9144, 0xe2e7d7d0, 0x6248f91f, 0x5d93a86f,
+    0x02993aea, 0xe33d0bd5, 0x3100d31e, 0x449f0ce6,
+    0x73cf2678, 0x3fcd925a, 0xa6d0afc7, 0x34ca923b,
+    0x3067791f, 0x9011091d, 0x5a7941e4, 0x8c568874,
+    0xfc339800, 0x34d37180, 0x595c51f4, 0x7744316b,
+    0xe88c6420, 0xf2ddb693, 0x5bad14d2, 0xfb3a48b1,
+    0xfdaab256, 0x52df1588, 0x3127354c, 0x68c0cd44,
+    0xa591f853, 0x2a849471, 0x93d0cb92, 0xe4da88e9,
+    0x1639c624, 0x6d1ea35d, 0x263707ba, 0x60fe2a36,
+    0xd0f3bc51, 0x97fc50de, 0x10062e80, 0xf7fa4d15,
+    0x024c168d, 0xc429a113, 0x3feaa272, 0xb6c935fb,
+    0xe639ec09, 0xb58a6071, 0xf9c13de7, 0x4b59253a,
+    0xfbfb8955, 0x6d2d68f2, 0x50723fe2, 0xf0064c12,
+    0x01f185f5, 0xe85d7820, 0x7fa79c93, 0xaa0307bf,
+    0x5b696527, 0x2e75a266, 0x5a00169c, 0x1a2530b0,
+    0x4286fb42, 0x76c4c180, 0x8e831d5b, 0x825f0194,
+    0xef703739, 0xdbf0a11f, 0xce5b106a, 0x106f9bc4,
+    0x24111150, 0x61794c4f, 0xbc723a17, 0x435872fe,
+};
+#elif MCUBOOT_ECDSA_P256_COMB_TEETH == 6
+static const uECC_word_t bootutil_ecdsa_p256_g_comb[1008] = {
+    0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+    0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+    0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+    0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2,
+    0xb049e7cd, 0xcd013f88, 0xe57fdc00, 0xe8f9257a,
+    0xfc3a9301, 0x3be71969, 0x58cff937, 0x987f256d,
+    0x6efa35d6, 0xb7254bbc, 0x07aaffdb, 0x47b46052,
+    0x0007e39e, 0xe860ebd6, 0x94ec505c, 0x8e926956,
+    0x5a1c3fb1, 0x59db167c, 0xbf318eb2, 0x98b3ce2a,
+    0xd2bc2fa6, 0x2df1c41e, 0x6ed1b2af, 0xefcc2c43,
+    0x97b25513, 0x17fe07f1, 0x3734a589, 0x46824533,
+    0xed34f543, 0xa5384a77, 0x8d9f3863, 0xf3684f9c,
+    0xbf780c2c, 0xfdc73e83, 0x2d666817, 0xffdc6794,
+    0x02436893, 0xc14b66dd, 0x0d54650c, 0x6eec9567,
+    0xedbfcd32, 0x089ec1a1, 0x3a07ff89, 0x79ab6615,
+    0x65ea0105, 0xfc281de0, 0x997732c2, 0x14bb5350,
+    0x7318188e, 0xaec90264, 0xca167099, 0x410bec28,
+    0x099c202b, 0xbf664d2f, 0x55fa625c, 0x13ccca34,
+    0x05421c0c, 0xaa84c231, 0x6cdb0d71, 0x6b647521,
+    0xfb216a5e, 0xe90446b1, 0xaf46893d, 0x4b5ba5a5,
+    0x4862c5db, 0xaca2fa08, 0xa1717f8a, 0xddffc222,
+    0xe4e09fd2, 0xab839a14, 0x980330f5, 0xf86a9078,
+    0xc1dd7dcc, 0x6890f24c, 0xea6efd98, 0xf75dccfa,
+    0xff9a093b, 0xba2612b8, 0x2568653c, 0x20347d0c,
+    0xcbdb1c78, 0xd3b22809, 0x30f6cda4, 0x5591c8eb,
+    0xbfe80f8b, 0xb6e28740, 0x40e7e7e7, 0x0f74342a,
+    0x351c51f2, 0xd2968e87, 0xf5e17b5e, 0x65c5c581,
+    0x9d994e2e, 0x6f58f02a, 0xf5c1ec07, 0x531c0b00,
+    0x1a6b665e, 0xeb042121, 0xa7f6803a, 0x802f779e,
+    0x3c0804c3, 0x47501f2a, 0x4945a1d4, 0xa263919b,
+    0x30bcdcfb, 0x9ee40400, 0x4c00efe2, 0xac3f83df,
+    0xe60d60c5, 0x2e9d3c9d, 0x2aed20fc, 0x873200bd,
+    0x8b21aa51, 0x2b52c47d, 0x5a7e870d, 0x0f503629,
+    0x88b45127, 0xbaa92814, 0xc402e050, 0x27d6451e,
+    0x5567432d, 0x5c96ec14, 0x0f4150c7, 0xcdeb9829,
+    0xcdeef566, 0x5d91740c, 0x1be9e583, 0x2a58fa5e,
+    0x5788c0f6, 0xd8142dff, 0x247fde25, 0x89bf5229,
+    0x14e2280f, 0x5c971ddb, 0x09904e3f, 0x785b7e91,
+    0x2e7e6f0b, 0x445e4519, 0x4ce293dd, 0x8789440e,
+    0xc797be30, 0x96b84f57, 0xfa3ea32d, 0x6b44059d,
+    0x2195a979, 0x73b7c550, 0xb8dd5813, 0x2d7ed474,
+    0xe104e9ac, 0xc0b9ecd2, 0xa2bd0ed8, 0xdc90d975,
+    0x4dd6eb2e, 0x9fb55203, 0xc01dfde8, 0x50d554bb,
+    0xf0977a30, 0x4cfd3277, 0x815374c4, 0xc87ce232,
+    0xcf9a3ca9, 0xe4b541b6, 0x08b49b2f, 0x1c650587,
+    0xf552641e, 0xb95f91b3, 0x5c301277, 0xbddc23ac,
+    0x04daba43, 0x519d0700, 0x8450cfa2, 0xc003dcc3,
+    0x4e48efde, 0x73a1c8f5, 0x5b04f761, 0x7d0ca942,
+    0x1703406d, 0xcb4dc35b, 0x75dac54c, 0x4fd3afc9,
+    0x29f02878, 0x112321eb, 0xad6b225f, 0xafb18d2f,
+    0xf1776a67, 0xddf58273, 0xf6b96c2f, 0x96889755,
+    0x22208ffb, 0x31a8d663, 0xfcca4877, 0x5ed81c10,
+    0xe834a3c4, 0xff0e1f34, 0x1c4ab236, 0x0d59b6ae,
+    0x015a211b, 0x10eb194a, 0x3892ddc5, 0xed6e13e0,
+    0xfb3f678d, 0xac88df04, 0x544026a9, 0x6f0fbf44,
+    0x619cecba, 0xcde8cd7a, 0x80d9a8cc, 0x02f322e5,
+    0x336aaf40, 0x2dc61e1b, 0x4251f5b7, 0x897e87bd,
+    0x6511b370, 0x2fb32023, 0x2341f499, 0x460fa9cf,
+    0xcbaf01a7, 0x03e63b79, 0x44157434, 0x937e123f,
+    0x809e4a1a, 0x9d59226e, 0x41775e62, 0x18d6f63a,
+    0xa9aa52df, 0x3cd5f4e4, 0xb42a627f, 0x18c452b1,
+    0xd991ece6, 0x6dbc4189, 0x7f608bf7, 0x45a511c9,
+    0x125ec16c, 0x7b52bd12, 0xd22955ce, 0x5a919b27,
+    0xcb625ad2, 0x3fe3337f, 0x73ea9b6d, 0x73be0ec7,
+    0x016476ea, 0xc6e4b6d0, 0xd4ec2510, 0x71b9a7e5,
+    0xcbe490d2, 0x1975b71e, 0xb52acd25, 0xdf6b472f,
+    0x784055eb, 0xf1738716, 0xb87d399e, 0xccc7b0b3,
+    0x1bb51119, 0x3c9a1337, 0xa88fd593, 0xb42639e1,
+    0xc219c20b, 0x86a38d54, 0xb50a4733, 0xafcdd2ca,
+    0x72096638, 0xf4cf8797, 0x24ce0e94, 0xd949caa2,
+    0x96f9ae13, 0x678664ae, 0xc984de46, 0x00ef5ba9,
+    0x8d549567, 0x622abc7f, 0x57db924d, 0x673ed500,
+    0x20b4d697, 0x41e94206, 0x29fa0df9, 0xa10fd0d9,
+    0x76022c38, 0xf11eb0a7, 0xa5621c63, 0xffcb7ddc,
+    0x0927965a, 0x24e37b1b, 0xbd2c199e, 0x8d9fc102,
+    0x907f3f85, 0x862de75e, 0x5a9c778e, 0xd3985129,
+    0xb56bc451, 0x48d63748, 0xa939440a, 0x0544de81,
+    0x664ec19c, 0xda24eb0b, 0x41f42bf6, 0x4fb6e562,
+    0x66bb5d6b, 0x21b2c80e, 0xd25bd41b, 0xa4123924,
+    0xbce2d418, 0x6f95f5f2, 0x4d6d91d8, 0xa9232776,
+    0xf119b8cc, 0x546a08e7, 0x8afc696a, 0x03b7d523,
+    0x459f70b4, 0x0a896132, 0xa86a9116, 0x57a46257,
+    0xbb314c65, 0xfaa56fef, 0x74795c6d, 0xf4e61f40,
+    0x437850d6, 0x1a3c5652, 0x6621ec11, 0x7c4b127d,
+    0xe83cfa35, 0x6dd25e26, 0x1ff3bddc, 0x61e44da0,
+    0x121733fa, 0xb7b67b02, 0xfcd798ca, 0x7c48f60d,
+    0x090f5154, 0x244d234a, 0x8cae33bb, 0x93b7f2fb,
+    0x426d1516, 0x158bf2f6, 0xa801e86e, 0xa8a947a8,
+    0x56c8815e, 0xf41e0307, 0x7d37a2f1, 0xbaf647e3,
+    0xfefafbf5, 0x7791eb36, 0x35b7f606, 0x158262fb,
+    0x32dce9e5, 0xf6c32255, 0x361b4780, 0x6c7cd4ce,
+    0x3f85288f, 0xe5be5e70, 0xc98e624a, 0x4c281aa3,
+    0x7fd58ae5, 0x9d7f749e, 0x37ea57a2, 0xc78ba263,
+    0x4f5ab5b7, 0xb5c05127, 0x5f2d643b, 0x6fd3f54d,
+    0x2116b8ce, 0x3428e311, 0x71b28987, 0xc52d1d24,
+    0x8299421f, 0x87f70be9, 0x64f49798, 0x0a5fd098,
+    0x4d6a3def, 0x5b2911dd, 0xb96008f1, 0x4bedd07c,
+    0xe36e7d64, 0xee748a6f, 0x4bbf5cf4, 0xbfc49934,
+    0x8e74750f, 0x55c6f62d, 0x48919902, 0x22639f87,
+    0x958a248f, 0xfa01aa94, 0xed51aa40, 0x2743ae8a,
+    0xe76ccbc0, 0x75ea69cb, 0xa762deb7, 0xc9736051,
+    0xaf2bff4c, 0xa720d4c6, 0xbe6d6dba, 0x8e4c7b10,
+    0x2f128433, 0xaf5c0efe, 0xa1fe85ec, 0x834cbf1f,
+    0x2685f018, 0xd321c5a6, 0x717a5340, 0xb5b09cf6,
+    0x86eb7815, 0x9cdda821, 0xce413265, 0x8c003612,
+    0x91b577f5, 0x8bce1fab, 0x488f730c, 0x0f3f29ff,
+    0xe6960d55, 0xebb08063, 0xaecbf467, 0x1a9699e2,
+    0x4ce5761b, 0x6b1564a4, 0x81382996, 0x08f00ea5,
+    0x96bf8ea5, 0x6c10cdd2, 0xe8cd868f, 0xe28c488a,
+    0x46442d00, 0xba9226c3, 0xfa1f864b, 0x9125caed,
+    0x2e21b4af, 0xf33bd66e, 0x68dbe58c, 0x12dc5537,
+    0xe5353044, 0xd9b85123, 0x07bc6b60, 0xf4925bde,
+    0x70514a21, 0x0d17ff39, 0xdadd80ee, 0xd2a7b5ba,
+    0x8126c8c4, 0x941e33c3, 0x1d57c1de, 0xb9e156d0,
+    0xea8105ad, 0x220d500d, 0x0202f3ae, 0x6a2aa462,
+    0x3dc96356, 0x450056ab, 0x452142c3, 0x506ab6aa,
+    0x1b20d599, 0xe0cb1029, 0x10a5fba0, 0x7b1ed83d,
+    0x04007713, 0x7d5fb32b, 0x79c82639, 0x93bab590,
+    0x49b97d9d, 0x977fa5a6, 0x3551254a, 0xa3592333,
+    0xa9f7a3eb, 0x8f277388, 0xe3026e2c, 0x36aba935,
+    0xc05131cd, 0xf197735b, 0x22beb567, 0x05650768,
+    0xf7f55b1f, 0xdbf2b189, 0x132c2614, 0xaa144c82,
+    0xb3822251, 0xf41cbe14, 0xffd0afbe, 0xb1ce72b2,
+    0x844743fa, 0x01a14d18, 0x923739b8, 0xc1d89fe3,
+    0x0b79847d, 0xf0f679f1, 0x6bb19be6, 0x3719a8b6,
+    0xdc7f43d5, 0x2ddb6c3d, 0xda0982e2, 0x2800043a,
+    0x908d9eda, 0xfe5b0083, 0xb8513ae9, 0xa87058db,
+    0x84a4dc3b, 0xb6c07965, 0x67e82909, 0x0f991746,
+    0x5f3f5b80, 0x12416a5c, 0xda522422, 0x58e903db,
+    0x4291867e, 0x18cc80f1, 0x7a152c2b, 0xb2035cf8,
+    0x95c80ede, 0x71125691, 0xaf97c5b0, 0xbfe02568,
+    0x8a14e493, 0x603e1dc5, 0x749680de, 0xf12f359c,
+    0x6aa2b49d, 0x1caab0ba, 0x6f7fc502, 0x6a75a768,
+    0x57ea120f, 0x6a5ea5a8, 0xdb6bdf96, 0x998cd5f9,
+    0x467184a9, 0xd2d7ba4c, 0x25c03723, 0xbe178e54,
+    0xbc389ef3, 0x6bfc1707, 0x7b7d9fb3, 0x3256a8a0,
+    0xfea77b0c, 0x40429d1b, 0x595e9a31, 0x4651a4dc,
+    0xe712693a, 0x8900aab1, 0x84bf612d, 0x90ea7767,
+    0x0d02f2b6, 0xbdd10425, 0xfb4d594f, 0xf5583bcc,
+    0x5ba7b6a1, 0x75754462, 0x101e86f4, 0xd1a321d3,
+    0x5ac0b3db, 0x7a2f10b2, 0xf0b98928, 0xe6deffa0,
+    0xe6b0b01a, 0xb4b2939b, 0x0a3f2ca8, 0xa03e1d52,
+    0x2cbead24, 0xfc779531, 0xd30fa3f9, 0xe8362908,
+    0xf23b00bb, 0x6f29d6f4, 0xebb82e0a, 0xea1ad22f,
+    0xe62da069, 0x6890b26c, 0x7c586265, 0xa5702319,
+    0x865672ab, 0xe64e19bf, 0xa07d9893, 0xa66503f5,
+    0x21fe4743, 0xe4deb7c0, 0x7d7100be, 0x3bae847d,
+    0xe17b1d29, 0x1769fca7, 0x320afc60, 0xadba60ec,
+    0x89806e19, 0x74814e1c, 0xf9ec85de, 0x9135fc8d,
+    0x09afd25b, 0x0ee660a6, 0x6740a284, 0x943de3b7,
+    0x622227d9, 0xdba0327f, 0xd4c486e8, 0xa524c6d6,
+    0x7134581a, 0x217fb779, 0xe4254a7e, 0xafa3b65f,
+    0xc4e48158, 0xa3c9d614, 0xae8fc508, 0xb26b4a98,
+    0x38b68e18, 0x44ef8be0, 0xdb271fcd, 0xbe9cf596,
+    0x8e6f95ad, 0x737b653e, 0x9b9e4d0a, 0x73dbe6ff,
+    0xa4139f59, 0x4b772a8c, 0x66c67e8a, 0xa1f335e5,
+    0x2d00715b, 0x0abfa3ee, 0xc8297b47, 0xf3f65dc1,
+    0x00669e85, 0x4199b659, 0x23c09567, 0x7588df7f,
+    0x868d3227, 0xabdf62fa, 0x8099a8fc, 0xa0844d34,
+    0x3babbc72, 0x3361b9c0, 0x6d5bf03b, 0xbb0357a4,
+    0xf77cf152, 0xc0b161fb, 0x8ce30043, 0x243c4fed,
+    0x050e20df, 0xb1b4a2d0, 0xc34999ae, 0x5a61a286,
+    0x70214eb7, 0x8c7baf68, 0xf2c261fe, 0x975bca7d,
+    0x1ed91ae8, 0x03c6df31, 0xa1380d38, 0xe8cfaaad,
+    0x016f613c, 0xa6bcc84d, 0xc2ec4e56, 0xae5ce038,
+    0xf8be76b4, 0xad80f035, 0x84642dd4, 0x00456c5c,
+    0xde3648c8, 0x0ef7079f, 0x68d0a170, 0x7bf0b3ab,
+    0x56c684e3, 0xa85c96b8, 0x91d65c88, 0xfd39b0f2,
+    0x966d28dd, 0xc79e3178, 0x89f8a2c1, 0x67ba8686,
+    0x4acf8d42, 0xaf1f9c6d, 0xe0847f7d, 0x2d2b4273,
+    0x69130cec, 0x1d9e1a90, 0x9383e7b5, 0x95cb10fd,
+    0x44cc71ae, 0x73438a26, 0x1ee4ea49, 0x37eaeb10,
+    0x620c767b, 0x2a675b54, 0x5ae6598e, 0xf1235f08,
+    0x48a35e9b, 0x3cf6a1cd, 0xd8a1b5f8, 0xf11a113e,
+    0x1742a887, 0xa401985d, 0xb6a73d9b, 0x3f83bd07,
+    0x82736067, 0x3c7307a0, 0x1f12fbb6, 0x64a1a66d,
+    0xd84a37de, 0x1c12b5cb, 0xc7b1ea1a, 0x56d66db4,
+    0x2ce31e9a, 0x852be420, 0xe40faf48, 0x17be9c2d,
+    0x38cc8797, 0x735b3ccb, 0x34b1093e, 0x1f8d9d80,
+    0xe75b81c0, 0xd8cc6e86, 0x3fdbe697, 0x6914bf94,
+    0x0ccf3981, 0x422618c9, 0x8dab3936, 0x7f5f9610,
+    0x8e0a6a28, 0xca4ab750, 0xd5bab133, 0x8266e2fe,
+    0xab5500f6, 0xfaa7545b, 0x5d994d86, 0xa91edaeb,
+    0x67fb462d, 0x0a5b194b, 0x287178ce, 0x089cfd68,
+    0x00b16f35, 0x54b44d33, 0x002d5707, 0x59988ef3,
+    0xd0494f94, 0x256fe1eb, 0x7f710de4, 0xaef84169,
+    0x8bd49604, 0xca38fb1f, 0xbfa0b15c, 0xaec9daae,
+    0x642cf6dd, 0x1551365e, 0x160e8fff, 0x75b8b0fa,
+    0x01feea35, 0xb2466027, 0x317c61f1, 0xea17f580,
+    0x786aaceb, 0x8d71eaba, 0x1cc47dab, 0x7de7454a,
+    0xff1b1266, 0x10b69d62, 0xb9ab079c, 0xe22cc59b,
+    0x42b2d441, 0x9a57e43f, 0xe8c85f85, 0x22340fec,
+    0xedab9cb9, 0x6033d113, 0xe69d45ee, 0x1df87ba3,
+    0xe4d65a03, 0x93436236, 0x3f98a508, 0x5893f6f9,
+    0xaad54fab, 0xb3832e15, 0x6bc7365e, 0x3277ff0d,
+    0x200c4fb8, 0xe8301118, 0xd4e9384d, 0x26e471bc,
+    0x68c28f39, 0x1c1dd91a, 0xf35669ca, 0xfa494334,
+    0x51abb743, 0x77b40abd, 0xe7873a25, 0xee7400ba,
+    0xed2309d9, 0xf15d9bf5, 0x3da8785a, 0x8a90d13f,
+    0x1be8b67d, 0x7e4fb96c, 0xcae9ed81, 0x196c1ba4,
+    0xc52427d8, 0x3276c5a4, 0xf5a34b64, 0x66958243,
+    0xf36e0d92, 0x04166798, 0xc6e9e63f, 0x43e33927,
+    0xf0ca8d2b, 0x899aed76, 0x0af50dd8, 0x43b89cde,
+    0x5951e13b, 0x805ea21e, 0x28413043, 0xe210daa4,
+    0x98a174fc, 0xe17f627b, 0x4dfa285e, 0x5ebce1ff,
+    0x54c5f925, 0xc95fe23d, 0x3188ba78, 0x5ea59a09,
+    0x2d2d8163, 0x6615bb54, 0x5db03d95, 0x37be4a1e,
+    0x4fc47762, 0xc51b5692, 0xd142931d, 0xb994ca42,
+    0x0758035b, 0xce46a165, 0xe070a0c9, 0xb33df1ad,
+    0x686934c9, 0xbf01fb38, 0xf0f16ed0, 0x1cba6257,
+    0xee93409c, 0xe538a9b6, 0x4a6b38da, 0xd82429a1,
+    0xa5c215b1, 0x1488770d, 0x891d7658, 0x4ade1f8e,
+    0x51a03105, 0xbf93cda8, 0x7be433ed, 0xb14f4a60,
+    0xfa1c97a1, 0x0aa4c4c3, 0xbced726e, 0xfe1a6375,
+    0x0409c304, 0x4db68287, 0xebf37af4, 0x08fb9622,
+    0xf6abdff4, 0x677003ec, 0x3fb7cc37, 0xe6b2e872,
+    0x27ade63f, 0xfe702b4b, 0xa105673a, 0x5df11a33,
+    0xa362b9ce, 0x0d33cb80, 0x855bb209, 0xa7bb42f5,
+    0xc95fe575, 0xfdcc6096, 0x2351dec6, 0xff0e08d7,
+    0xbb6a5b28, 0xa3323ff5, 0x89f7a2ab, 0x2caa2dae,
+    0x51ff89bb, 0x252566b6, 0xdb973ddc, 0x453c333e,
+    0xd83f2cc2, 0xfbcd5a09, 0x3121dbd5, 0x187818ec,
+    0x3b46b949, 0xaea1b45f, 0x55f753e0, 0x42314623,
+    0xb09991fa, 0xd59ab00b, 0x0ae0c8d7, 0xee05650d,
+    0x2da7eb49, 0x2096d676, 0xfb775e41, 0x6e04768e,
+    0xaf24f76c, 0xc3349c3d, 0xde0c90f6, 0xe6db6cca,
+    0xa416fd87, 0x98aa01f5, 0x781ec427, 0x84c3270b,
+    0x021034b2, 0x37680f04, 0x654bf735, 0xeb90fe3c,
+    0xe4976dd8, 0xeaf7623c, 0xe29bd0b4, 0x92528b1a,
+    0x645cec2a, 0x78158ecd, 0xb11325e9, 0x3265ead8,
+    0xc04780b7, 0x1ca27af8, 0x2465867d, 0x14ef0845,
+    0x2feefe38, 0xb45c1887, 0x5d8730e9, 0x7c4d96bc,
+    0xb3571976, 0x8e35bf16, 0x346864e7, 0xe2eb0c63,
+    0x7e9b6c7f, 0x2b7b57e0, 0x70b35a98, 0x3157cf6f,
+    0x5ac49ea5, 0xfec24c14, 0x6b1a32ae, 0xc20c5690,
+    0x345fa335, 0xeaef7b4e, 0x4077475f, 0xb4c9655d,
+    0x6c38b3da, 0x3c3d8c9b, 0x754433e3, 0x80818302,
+    0xe29e542a, 0xfe68ab07, 0xd12cbb2c, 0x81a25a61,
+    0x8f685647, 0x559948a7, 0x83a56574, 0xe14ebcf6,
+    0x7a77db0f, 0x1a606632, 0x0892ce93, 0xf49d838f,
+    0xfcf866b9, 0xf3f4e3fe, 0xe18b0ad5, 0x152a0807,
+    0x1b9b2e7b, 0x2ec4c706, 0xdadd006f, 0x41d7e92b,
+    0x1d4b6ef7, 0xff0a8a79, 0xb2aa2f47, 0x02344dff,
+    0x357a0681, 0x1726d704, 0xc1bc85f4, 0x4ce6bb77,
+    0x8916a00d, 0x651ebb86, 0x001e908d, 0xba4d2da9,
+    0x1684fcb0, 0x5f2b68e6, 0x10ac6edf, 0xc3ff8d75,
+    0xf5c49a61, 0x6997e3ea, 0xb1a4dc68, 0x8f4ff372,
+    0xc95c2db2, 0xbea7ce04, 0x9d10f761, 0x2accb4f4,
+    0xafcc2bef, 0xb9e437f4, 0x3ada2b53, 0x4f1fb2d6,
+    0xbb580c9a, 0xe6c0e12d, 0x33c7546d, 0x25183734,
+    0xbfd92fb9, 0xab12d90f, 0xa185ae46, 0x2cb9b9b3,
+    0x9ce6f49f, 0x2a0c7a7e, 0xb48f21f2, 0x531f307f,
+};
+#elif MCUBOOT_ECDSA_P256_COMB_TEETH == 7
+static const uECC_word_t bootutil_ecdsa_p256_g_comb[2032] = {
+    0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+    0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+    0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+    0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2,
+    0xedee30ee, 0x0375c0c6, 0x679189f1, 0x48526336,
+    0xb1840971, 0x9ba834fc, 0x974ac9f3, 0x9ba1e12f,
+    0x67b43c5e, 0x8a96b83b, 0x8c7d4f38, 0x62067ebb,
+    0x86a877be, 0x277c3eea, 0x311bea6c, 0x03d2f132,
+    0x66d4e2bc, 0x58bdfa8e, 0x9b1f858b, 0x8f77a569,
+    0xb6fb1070, 0xfeec5805, 0x9d64351f, 0x1cdf701e,
+    0x2783ba45, 0xba427042, 0xf7665b19, 0x54b09ce3,
+    0x8c656862, 0x0bca94aa, 0xc43c6b76, 0xc37d7f62,
+    0x8a6edbf5, 0xe3065e08, 0x9662876b, 0x2f335256,
+    0xfdadd0af, 0x68991da7, 0xa3dd7774, 0x870ac12b,
+    0xf02f8ce3, 0x1906d2dc, 0x2e5f297e, 0xd03c6402,
+    0x69d05a67, 0x8de7efd7, 0x999a7699, 0x7543728b,
+    0x717a0611, 0x49f68919, 0x28f17701, 0x3976a296,
+    0x5df3cb83, 0x09cdeb9d, 0xcfb6448f, 0x183c55cc,
+    0x70efbce8, 0x1b6d1b3f, 0x167e6228, 0x79ff4484,
+    0xf6290b34, 0xfa41c36f, 0xe5b76b65, 0xeaef1249,
+    0x3cbbefed, 0xab814d53, 0x954dc9bf, 0xf8be9039,
+    0xcd8c0283, 0xf4a37670, 0xe6ba82a1, 0x2f9dbe73,
+    0xd1d6a70b, 0xb81599f8, 0x6f03ea33, 0x999f89e2,
+    0x6760d69f, 0x03c22e40, 0xadf757c5, 0x21fcf329,
+    0xa97ab1ec, 0xb41b1d2d, 0x83ceba2b, 0xb7917784,
+    0x8d2850de, 0x45fbec0d, 0x3a6376b1, 0x7a20b5fd,
+    0x685f8d97, 0xb2d21722, 0x22ee2184, 0xa073f8d6,
+    0x3f46a374, 0x97cc8951, 0x175fadad, 0x477f1d41,
+    0x5ab90065, 0xc828bbee, 0xbbfa75b7, 0x26ddc475,
+    0x59f2e876, 0x899db939, 0x252b48e4, 0x778468f5,
+    0xf2d79ff1, 0xc8f76aa2, 0x00acdaaf, 0x27bbcaef,
+    0x7f01e2e9, 0x6f65136a, 0x0eb39ca0, 0x43341ab1,
+    0xfc602827, 0x16305832, 0x55c1b372, 0x08e0b379,
+    0x2aa3a67b, 0x7dcb57f7, 0x4fb0f09a, 0x5ff1b63d,
+    0x1c854f7f, 0x370a4636, 0x2830f455, 0xd837f9a7,
+    0xa2d58ace, 0xaa0d33f2, 0xc490b3f0, 0x562e4757,
+    0x67133da0, 0xd951455c, 0x7d522801, 0x5c33d2d5,
+    0x5522513b, 0xeb861b7e, 0xa9bddb23, 0xdd94e527,
+    0xed52f78d, 0x9aae881a, 0x35636a4a, 0xb866257d,
+    0x6d5c0edf, 0x5096ae5e, 0x76d903cb, 0xabe29c09,
+    0x79023d63, 0x8157fd7f, 0x056de78b, 0x7f9603bf,
+    0x214df921, 0x3790a889, 0x9a3a5a1a, 0xa20ccb8e,
+    0xf75787b1, 0x9beb594b, 0x86119c08, 0xdd806f4f,
+    0xd8071364, 0x6d3a51e8, 0x157a43aa, 0xfcaa5616,
+    0x5e65793a, 0x3edeae1f, 0x750d12e8, 0xf7446d1e,
+    0x32b15d89, 0x91347bb2, 0xc3482a16, 0x59d23a8a,
+    0xb992738b, 0x5f5745f5, 0x6d8c4fac, 0xafcb7db5,
+    0x131c4daf, 0x80996007, 0x073e6f3a, 0xc8581e57,
+    0x375c4aeb, 0x517cac57, 0x4ff16bd2, 0x352499bc,
+    0xb0d265e8, 0x2c1b1032, 0xf4174ea4, 0x2db3b36b,
+    0x3315c1a4, 0x626c820d, 0xf851dcc4, 0xc0e3ce26,
+    0x8e9ee4e8, 0x274f1dfc, 0xe6039e6e, 0x3030e74e,
+    0xf9b57d43, 0xcf8c5bc9, 0xdf7837f5, 0x06aab1b2,
+    0xde594798, 0x00b2f292, 0x52fd480d, 0x85002aad,
+    0xc6a29dc5, 0x59b94e2d, 0xcef0cafe, 0xf8908623,
+    0xf6e8fc35, 0x677cd748, 0xefe8f5b3, 0xabe7eee3,
+    0x3488885f, 0xd7bb0d96, 0xd505f8f6, 0xbe034bef,
+    0x32acf6cc, 0x64cd8f6e, 0xab84b50f, 0x915f8e4c,
+    0x2dc91bd4, 0x0642ae38, 0xaa59ac9e, 0x966c989e,
+    0xfc41c571, 0x2d5eadc1, 0xef9d42cb, 0x43f8da79,
+    0x87354b7a, 0x8ed9c7e7, 0xc3915c97, 0x022eca56,
+    0xe53cde1d, 0x2397f463, 0xd77e0848, 0x85685474,
+    0xd16e04c6, 0x8954402b, 0x1fd6fdbd, 0x06a891dc,
+    0x2a6f7287, 0xeebc913b, 0x0bf587b6, 0x20b50eb5,
+    0xca5e59ad, 0x276cb26d, 0x13041de1, 0xb688aafb,
+    0x143bcf73, 0x2f7d2235, 0x5977e774, 0xa91c7497,
+    0x2f9d1ac9, 0xf60def81, 0x86e16ee7, 0x0c67d5ea,
+    0x4730f8d1, 0x85dd2dd9, 0x3b61ef8a, 0xf59a5dd7,
+    0x8cf36ad9, 0xd3f9d42d, 0x79829551, 0xb9690b4d,
+    0x69c0cb15, 0x68f8aa7c, 0x4417cc22, 0x7a14d317,
+    0x769c0deb, 0x762f4567, 0x466db4a7, 0x41c83cce,
+    0x3f81112a, 0x26096400, 0xafa5346c, 0x8d3f9367,
+    0x7595efcf, 0xacc48903, 0x6a99cfd4, 0x4a5b7171,
+    0xfedc0578, 0x85bbf7ed, 0xf5ec256b, 0x1db5d227,
+    0xffe44b30, 0x6ed1be54, 0x7c5e5a75, 0xb04d6820,
+    0x2aef51da, 0xa8fa90ca, 0x30239a66, 0x9f26c31d,
+    0x1cd329c4, 0x152f12bc, 0x919fb8b3, 0x7ec9c9a6,
+    0xc3cb6101, 0xa1633deb, 0x3f037ef9, 0x5a4400f3,
+    0xa2ac85aa, 0xa5a4f01f, 0x1c1b7fbf, 0x86524ec3,
+    0xefa0da04, 0xeedc62af, 0x8c41927d, 0x038920e4,
+    0x80a1c3b9, 0xfbe83618, 0x1401c46d, 0x9f95b0ae,
+    0x4a76b0f7, 0x6c6a8cd0, 0x99159bdb, 0x5b246b29,
+    0x3aff0d3d, 0x6e68971a, 0xfbb6d2f9, 0x2b046407,
+    0x73ab7a26, 0xed8e3ff4, 0x9f05a12e, 0xb1cd0623,
+    0x58bcb681, 0xa38f92c9, 0xb4024243, 0x29cbe354,
+    0x638128b8, 0x28968c22, 0x3fac03a3, 0x133d93a5,
+    0x97d94915, 0xf6c9ec09, 0xce34773a, 0x18c47ab6,
+    0x0ab90ef5, 0xc46d03ef, 0xe8e5606b, 0x187459b0,
+    0x4440b2b4, 0x0f0d0ac3, 0xbc2466eb, 0x6e5babc4,
+    0x6e87ae5d, 0x75d997e5, 0xca353d97, 0x7b2a3707,
+    0xd2ef2f0d, 0x428039e7, 0xcc91e514, 0x48db0cf6,
+    0xa685b5f5, 0xe15faae7, 0xa42752cc, 0x71503b9e,
+    0xf2a2270a, 0x28cae647, 0xe1a786a1, 0xff3a8651,
+    0x7e36c0c8, 0x9ef04005, 0x2970472b, 0x2bc9d2bc,
+    0x0593b93c, 0x0ecd4c3a, 0xf98e059c, 0xbc1125cc,
+    0x85722f61, 0xe06b7568, 0x71f2cc65, 0xb3ab9ecb,
+    0xfb261aa1, 0x2c69afa5, 0xd0c7a52c, 0xead7ebfe,
+    0xb646aa17, 0x3daa5f8c, 0x57a729fe, 0xd1f26b51,
+    0x4f4a595f, 0x2a8c2a34, 0x9369f6b9, 0x85c3e8ce,
+    0xd4c3b33d, 0x1f710903, 0x48fc1423, 0x48f60972,
+    0x8eb04a4d, 0xc6905560, 0x76ea53bb, 0x8e39bc8b,
+    0xfbce3120, 0x77a02bc2, 0x22134187, 0x8238d667,
+    0x28e5919c, 0x5bcea4a7, 0x2003207a, 0xdd211d2c,
+    0xe91352f7, 0x6c3c9666, 0x6a085074, 0xb9a3b4c7,
+    0xa28f8357, 0x84a6754d, 0xb1e5c11c, 0xa888dbcd,
+    0x14bc3317, 0x04f6d9b1, 0xddf0882e, 0x33f6e36f,
+    0xae7f395c, 0x51f4afb5, 0x52720c58, 0xc20ecf52,
+    0xdf7e9952, 0xd7311e4f, 0xdf4f8977, 0x9e193aa7,
+    0x5b58ae2e, 0x8d45f320, 0xeed918e9, 0xd47253cc,
+    0x2b80860e, 0xfd48b25d, 0x4802d44f, 0xd501838d,
+    0x6b63cdcc, 0x885b2282, 0x2a147627, 0x4d41f849,
+    0x4fd44948, 0xd6577473, 0x59e4672b, 0xd3dccc92,
+    0x7dbcd045, 0xcc5c715c, 0x6ac5be08, 0xcb2a442f,
+    0x1a304fd3, 0x6fc337a4, 0xde391401, 0xbe2b31de,
+    0x4d3d27a8, 0x5204390d, 0x8e70b527, 0xfefc9aab,
+    0xc7df79df, 0x3f9b7392, 0x2c667970, 0x90eba9be,
+    0x9bc307e8, 0x78471b6d, 0xbf92140b, 0x769a1bcf,
+    0x030738e4, 0x4ff6e35f, 0xb8918dcb, 0x303cf36d,
+    0xa1033335, 0x66e0519d, 0x81ea8709, 0x539dcd64,
+    0x6c346fae, 0xc20fc355, 0xc85f2a05, 0x85cc0e9a,
+    0xe76a12cc, 0x28a277c4, 0x3ec44c95, 0x53bfed84,
+    0x20359286, 0x2aed6811, 0x752e012e, 0x041d2ca5,
+    0x717476e9, 0x881723b2, 0xa64a3fe6, 0x60c9ef6e,
+    0x62dd41e9, 0x69f0a26e, 0xb74fbf79, 0x19d42e8c,
+    0x9d2157ff, 0xae03ad0f, 0x7d07f1ee, 0xe9817b13,
+    0xe4eb8eee, 0x751a418a, 0x57874a09, 0xcafb6c86,
+    0x73ce8988, 0x16cec081, 0x913b9e0e, 0x9c6ab445,
+    0x9ab4e2e0, 0x01a1cbb9, 0xd5c5c67a, 0x2adafb1e,
+    0xa0d850bd, 0x021d982a, 0x684f68eb, 0xad607931,
+    0xddf6fdcd, 0x17c84c69, 0xeb3f4758, 0x653daef9,
+    0xef152b37, 0x3deaa6ab, 0xf69b2dab, 0xde7fdabe,
+    0x41754fa5, 0xdd7206b0, 0xf9e0180c, 0x2dc979f8,
+    0xda6136ca, 0x510bfc65, 0xb36fd47c, 0x2e845ca0,
+    0x39dd5bb6, 0xc01716b9, 0x074fdb24, 0x7e39fd71,
+    0xc369e75b, 0x0f68aa57, 0xf4812e28, 0xf2868eff,
+    0x48bc3d12, 0x2a243cf0, 0xf613e54d, 0xa9e08182,
+    0xb98f8d22, 0xcaa9300d, 0xb24f88ec, 0x2e1dd47b,
+    0xb72a2a93, 0x9fdbff50, 0x5d9d5271, 0x8970f0d5,
+    0x7c42a345, 0x268f3bcc, 0xdf9f7224, 0xe4cc1179,
+    0x56abd051, 0x099ca8ca, 0x85b95353, 0x2fb9e599,
+    0xd863f759, 0xc097390c, 0x582bb10d, 0xea211e6e,
+    0xa6eeaf2d, 0xf6a7e773, 0x596e7d3e, 0x604cd7a9,
+    0x5ac9834e, 0x511e5e9f, 0x152e025e, 0x726ab215,
+    0xc7493ab8, 0xa8d1aab9, 0xf215eab7, 0xb0d3047f,
+    0x31386b9a, 0x7432a568, 0x6b22f44b, 0x5eaa5d28,
+    0xbcec4dbf, 0xf12faa49, 0x93b62c32, 0x3d791330,
+    0x7caa6385, 0x211cc054, 0xc3144294, 0x7e56d9b4,
+    0x6ed5ebb8, 0x06792e13, 0xca8404b5, 0x692fdf6e,
+    0x0825dbca, 0x5b6ccf3c, 0x6c34611a, 0xa1a44d3e,
+    0xf7c7830f, 0xf850daba, 0x19ee0adc, 0x56c18328,
+    0x77cd678e, 0x499d1290, 0x11d507fa, 0xa7e84f16,
+    0x6b637a85, 0x5c967c61, 0x241806cc, 0x7e8cf775,
+    0xc047ec08, 0x93faa7b8, 0x2a564e48, 0x75d93a3c,
+    0x8e40783e, 0x775a5850, 0xa5723c39, 0x0ee8d540,
+    0xad05f672, 0xd65ac60e, 0x2f2ada52, 0x17148401,
+    0xa1935de7, 0xfd4c754f, 0x061a7c82, 0xffac4bd5,
+    0xd4d77718, 0x8c76490b, 0x1c75ed5b, 0x42b94812,
+    0xb29e28e0, 0x32010fcf, 0xff4122e4, 0x5485b44b,
+    0x8898c910, 0xe3f6ea95, 0x911b3fd5, 0xe7d089f0,
+    0xf4cd9441, 0xde87b50b, 0xd8a21e74, 0x97178a0e,
+    0x1a6fb1be, 0x3e9d81c0, 0x8653c8e3, 0xd9a803ed,
+    0x8e49efb2, 0x18c67e5a, 0xb9f2ac55, 0x9b3d25f7,
+    0xa2a90e50, 0x313ba23d, 0x810690bc, 0x1c09a37e,
+    0x18b63eda, 0x0fbe0345, 0x6496f26c, 0x36d4e308,
+    0x5ec596ce, 0x6f10d9a4, 0x9fd1f674, 0x42a08c27,
+    0xc43b83a6, 0x3eea2867, 0x57b71750, 0xa13ae0fc,
+    0x2b9d74b9, 0xe3ca37ef, 0x44753857, 0xa36378b8,
+    0x8ee7fa49, 0x6ae6d13b, 0x6bdb78b5, 0x0a179e6c,
+    0x49ebc3ed, 0x1245d890, 0xbfd91a7e, 0x3b98c994,
+    0x64ff8b35, 0xf35b885e, 0xf355ffec, 0x96660a48,
+    0x51bbf899, 0x247a9dae, 0x4f36401b, 0x16b0668b,
+    0xfc6d187c, 0xb213c88b, 0x7d325507, 0x5501f3e4,
+    0x2b0d84fa, 0xe1f5f54e, 0x3c4665b5, 0x33c8ec06,
+    0xa7c49ecd, 0x8d7abe9a, 0x288b5c07, 0xfe4ce5ba,
+    0x90e0ac9d, 0x917a5d2f, 0x033fa1b6, 0xf435581f,
+    0xe7c8651d, 0xa5ec4c6d, 0xcc70571d, 0x1d9de93d,
+    0x7b7d8dd2, 0xddd4eb0f, 0x5547dfd0, 0x3f78f6be,
+    0x604c7c2e, 0x3a6db541, 0x6f2f1d36, 0x10ca9a6f,
+    0x27afc848, 0x174de235, 0x85e89cd7, 0x7d7a044f,
+    0xed532118, 0x378042b8, 0x1f51fa9f, 0x1d119a38,
+    0x65010581, 0x5a048cba, 0xa9764f1e, 0x8ea1cdeb,
+    0x75a732a4, 0xcb1c7daa, 0x4f0a783d, 0xb8b3097b,
+    0xd2c386a0, 0xc091534e, 0x1f09d937, 0x5aef873a,
+    0xd2ddb723, 0x25a954a4, 0xa491bff6, 0x46345836,
+    0x2545c3f6, 0x01957c79, 0x59cc90d6, 0x4dd11bbe,
+    0x61ac362b, 0xae526077, 0xcdc0a72d, 0x0d0cd0c5,
+    0x9e4947d7, 0x71c841c9, 0xe05a7686, 0x5db7ea1a,
+    0x88bbda1e, 0xf2d51753, 0x110c6d73, 0xdd0da9aa,
+    0x21a14396, 0x5cf767d1, 0xc7676311, 0x8af5fecb,
+    0xadf34b24, 0xe85586e9, 0x017cbcd5, 0x592b7771,
+    0x3d7dcaa5, 0x7baf3ef5, 0x60252948, 0x975acaef,
+    0x39161610, 0x7484bb4a, 0x233d4e21, 0x2e9d3fd8,
+    0x1f5d4f2e, 0x24bd92e1, 0xed3a7fe3, 0x33eed23d,
+    0x9921bcaa, 0x30ef3276, 0x6a190783, 0xfe1e1720,
+    0xd0b38fc1, 0xa74bbfca, 0x26238537, 0x6ad56fbd,
+    0xa24dce0d, 0x1453c53f, 0x572e13f3, 0xb8d66f8d,
+    0x7802b536, 0x7b11c780, 0x4a8a4483, 0x57e701f1,
+    0x76ae31f7, 0x85df91fa, 0x20f85c0c, 0x4f3b77e0,
+    0x2d12869f, 0x99210458, 0xe672032e, 0x3c27086a,
+    0xf2d08016, 0x122fa51b, 0x071462d8, 0x549cdfef,
+    0x6ddba35b, 0x55135fa9, 0x0c99feba, 0x3c4793c2,
+    0x65cd5361, 0xa6984ded, 0x23f804fe, 0xc1e9df72,
+    0x34782a6f, 0x5161a44d, 0x8f580e37, 0xc2b44296,
+    0x677f245d, 0xbb2456ca, 0x6bcd8a73, 0xf8d4093f,
+    0xf5f7557b, 0xad422072, 0x528d1b1f, 0x95e2f63a,
+    0x23401918, 0x414b2e31, 0xb978207c, 0x7b1e1e4d,
+    0x5f136cc8, 0x0d3152ea, 0xf099189e, 0x4d020b31,
+    0xbda0aac9, 0x1e2b24a9, 0x36837bc5, 0x6ec0a871,
+    0x80c658c5, 0xa9d5f262, 0xeda7045c, 0x71c15750,
+    0xc92a5ff3, 0x54f4299b, 0xe7fe3be8, 0x607d7c03,
+    0xe3354062, 0x1ea184fe, 0x665a39b1, 0x7d676238,
+    0x706292b1, 0x45280843, 0x12dad77f, 0xf5fb0200,
+    0x0567b6af, 0x0a3ce7d9, 0x1fe9b060, 0x35fce2cc,
+    0xd6c366e2, 0x978de280, 0x63a55c24, 0x35c82caa,
+    0x6f52247f, 0x7e575b4c, 0x52c0d05a, 0x543c7250,
+    0x2a4c5063, 0xc0652107, 0x921b47e9, 0x0b30c4e1,
+    0x75a86757, 0xe1101bf7, 0xc58780f2, 0x3f34b01c,
+    0x8a62312e, 0x0fd080f8, 0x693bcb40, 0xb0d3cc7e,
+    0x990247bb, 0xe63ba9c1, 0x6f1a0521, 0x097dd003,
+    0x4ba1cdf9, 0xba8e4a48, 0x7e38f247, 0xb8e2eb26,
+    0xe395ad3c, 0xba9a9d9f, 0x2e93a661, 0x8c413908,
+    0xf91ef0e7, 0x5512ee0e, 0x807d27c0, 0xa2339a1e,
+    0x0e64b317, 0xd9bd695f, 0xc836d45d, 0x5f8d0b8a,
+    0x5deaf05c, 0x3304fd5a, 0xec8e61a8, 0x21ec4326,
+    0x3e929ca8, 0x9cfcae87, 0xe8bd2f23, 0xf2da271f,
+    0x961d7e30, 0x04539fe3, 0x67d3492f, 0x0a20e7bf,
+    0xae6657c2, 0xb614ea24, 0x9a218f37, 0x9cce0ecf,
+    0x745fc317, 0xa549588d, 0x8f34fc73, 0xb3344364,
+    0x837a26a6, 0xe438131e, 0x5958f726, 0x5e96aec3,
+    0x52ffaa7a, 0x5386fa43, 0x7218161c, 0x23dc2ba6,
+    0xd020ead4, 0x9d192948, 0xf4deede3, 0x33b8bc21,
+    0xb4d35887, 0x25f35e39, 0x1aacafe1, 0xb676e24c,
+    0xae118bec, 0xca0bb384, 0x2d6ec371, 0x7e5efc7a,
+    0x931f7a75, 0x35ca3d70, 0x11152993, 0x972b1cec,
+    0xfe636b50, 0x4803e014, 0xbc38f77d, 0xa1519bcb,
+    0x7bea81ed, 0xdb75a829, 0xda4b0f60, 0x3f2043e5,
+    0x69cf4771, 0xb0a95a25, 0xa00f7f88, 0x2b7227e1,
+    0x6bfa88ca, 0x27135ac5, 0x64569862, 0xe23ce9ff,
+    0x4a5cf2e1, 0x1b2ed0ee, 0xf96e6063, 0x854c61db,
+    0xf7a16380, 0xa0459b90, 0x1524fe40, 0xbe700cee,
+    0x2c206717, 0xc6b3f2ad, 0x75abd071, 0xf1692c26,
+    0x7394c19c, 0xbdd153de, 0x89285704, 0x447bcd3b,
+    0x34641e7f, 0x78da031d, 0xa80bc2d0, 0x8e6ae13b,
+    0x341942bb, 0x72648472, 0xd78b4f89, 0x57c7ce3e,
+    0x470948e1, 0xa6fa57b5, 0x9c4b3a94, 0xb5daf912,
+    0x95ab0453, 0x5f7c1c2f, 0xf43204f5, 0x6fc9b32f,
+    0x99305932, 0x9a6963de, 0x8bea4def, 0x71c34993,
+    0xd7d51cd0, 0x4044f679, 0x1760f324, 0x5bdfe769,
+    0xd9fc1b22, 0xc0ba31a4, 0x13b372b4, 0x60a1ae4c,
+    0xcc798845, 0x7434dd76, 0x038a735d, 0xa7e388bf,
+    0x3405bc7d, 0x1124e44e, 0x3b79415d, 0x4386fe5f,
+    0xf54544e3, 0xc43dc6ff, 0x310f5380, 0x73ca7b06,
+    0x0050f080, 0x8eb8b673, 0x4bf15388, 0x95f5bbf9,
+    0x71d3ac47, 0x1c420273, 0x506aebc7, 0xe7fe1a77,
+    0x99e9e32b, 0x48c989da, 0x676496a8, 0xf8edfb37,
+    0x93cb5838, 0x1de51e78, 0x10e65daf, 0x6a87c46d,
+    0xf40e5465, 0x90a24801, 0x5d1db99e, 0x2f5a5536,
+    0x3bd54e4b, 0x2576a471, 0xd2f78e00, 0xe87dcf14,
+    0x66dafb79, 0x31278d3d, 0x9091c8ac, 0xa942cf12,
+    0x84b5b27b, 0x55c2d2b3, 0xab579fe1, 0x52d5cee6,
+    0xe1337260, 0x4457378e, 0x7c9bbec6, 0x0ee69996,
+    0x1abe01ed, 0x1f85f7fe, 0x2797ad1f, 0x06202ab2,
+    0xe3c529a0, 0x3c86d58d, 0x22d8eb49, 0x4df48a4f,
+    0xd3e2e217, 0xfa8f3853, 0x808659e7, 0xd0a42cab,
+    0x6d6585d1, 0xa1a8ffd4, 0xabafa172, 0xa149e128,
+    0x78d9712a, 0x8f5b3ade, 0x0c2862cb, 0x9c70167c,
+    0xe2584aec, 0x6d636942, 0xc5dd4e2c, 0xc7aa1f93,
+    0x2d174b65, 0x5bfa8723, 0x522a96e4, 0x64ce6d36,
+    0x8aa80ecf, 0x9d5dbba3, 0xf79bc683, 0xe5ce325d,
+    0x00c3847d, 0x1572db6b, 0x84e193f7, 0x0141de5e,
+    0x37fd6721, 0x489ff471, 0x0d3a321c, 0xeb35fa6a,
+    0x5de420dc, 0x3aa151b3, 0x73d2c367, 0x2d1ab835,
+    0xd385a729, 0x6171553c, 0x5164c6ca, 0x7af92da5,
+    0x144a5c5a, 0xfbd0e439, 0x291576c1, 0x9744f27a,
+    0x5d955ed1, 0x607c6318, 0xce236be6, 0x5377113a,
+    0x2cf909d9, 0x9b19348d, 0x4f5ec18e, 0x71520cdd,
+    0x68f49a02, 0x95e90264, 0x12144ba8, 0x322ff25c,
+    0x7806e1ff, 0x7408073b, 0x74c50b6b, 0xea087b6c,
+    0x350ccb95, 0xcf684d3e, 0xe5b85b78, 0xc98ad7d7,
+    0x77bb028b, 0x5656ae5a, 0xe40b70e5, 0x1c4f33cd,
+    0xd1b3bb5d, 0x45261e75, 0x8ddbdf10, 0x1a0627fe,
+    0x18a57e32, 0xc7197ac3, 0x2d326cca, 0xfce636d8,
+    0x2ea40061, 0xc54ac12a, 0x12f318c7, 0xb1fad885,
+    0x4f7d05f9, 0xea8bafee, 0x76cd5ba6, 0xf433b714,
+    0x376bf946, 0x5d04be4f, 0xbcaae24f, 0x8cc1466c,
+    0x20773338, 0x0d408530, 0x71445735, 0x2551e5d2,
+    0x61299c54, 0x4fab7428, 0x7407b865, 0x5e68748e,
+    0x067948af, 0x8c76ab10, 0x62c13fe5, 0x627eb864,
+    0x7d702e80, 0xec5e5cc7, 0xa8ef02d3, 0x310eefc5,
+    0x64f07b5b, 0xfc8455ac, 0x8c40a254, 0x49e1d826,
+    0xa0879d1e, 0x5c576ae2, 0xa25ec098, 0xec4e52da,
+    0x9adb6e80, 0xbbced3dd, 0x23c408d3, 0xbd41dfa2,
+    0x8422ee92, 0x1478d8f4, 0xc5c9c065, 0xd9cf461d,
+    0xaafbcf7a, 0x7b277a4b, 0x54223594, 0x6015f6d0,
+    0x9e88e975, 0x95e02181, 0xc2eb27c9, 0x678f4c04,
+    0x50494ad5, 0xde9a5f8d, 0x21a29006, 0xdf082aa7,
+    0x30f0681b, 0x4c8b876b, 0x1b763543, 0x1b635ae9,
+    0xc125c12c, 0xb36c8605, 0xbca1ea11, 0x90cd1070,
+    0x32417470, 0xbbadcdb8, 0x67f527db, 0x0cdd185a,
+    0xa5b50054, 0x01f972bf, 0x5bee1982, 0x6006e987,
+    0x9e8123c6, 0xf2c91a32, 0x82782dfb, 0xc684be8e,
+    0x57dfb88c, 0x35c5c97a, 0xdb160070, 0x53fbe826,
+    0x1afb0c93, 0x774b46ad, 0x72374583, 0x7ee4845f,
+    0xe8363459, 0xcddcaaab, 0x76650369, 0xd0076503,
+    0x58b1ff29, 0x92c6c46e, 0x05b0500b, 0x5c30d989,
+    0x3a9a0269, 0x268cb82b, 0x0743dd0a, 0xcb20f1d4,
+    0xf18f9a55, 0xc244224a, 0xc72b298a, 0x036e32bf,
+    0x56898e8e, 0x35b032e2, 0xbbaee0b2, 0x6c3c17df,
+    0xd90416ea, 0x1116f263, 0x62b80f23, 0x101b6d5c,
+    0x6114d4c1, 0xfc02de5e, 0x81400ad2, 0xffeb4041,
+    0x339c3b00, 0xf702e73a, 0xe34b4cc7, 0x36e9b488,
+    0xab4e3285, 0x74cecfd5, 0x03f23b11, 0x6ae02fb5,
+    0x12a99d2c, 0x5738fcae, 0xf9a6efa2, 0x4dcbf645,
+    0xe452f126, 0xc63dd4eb, 0x1bd2f110, 0x462cb8cf,
+    0xdf85cbf6, 0xcefdb215, 0xf24cd959, 0x06237fc5,
+    0x5720a5f7, 0xfe158f41, 0x7ba270a0, 0xc5c768fa,
+    0x201a61c5, 0xbda88ff1, 0x1260680e, 0x2658a4a1,
+    0x98580cb0, 0xdf89a1a6, 0x83c296a6, 0x6b7e2746,
+    0x77381a9e, 0xada106c3, 0xcd9395d3, 0x1e001a52,
+    0xbdcfa117, 0x4ad13205, 0x43bf89ef, 0x434aa11b,
+    0x7f8c6a16, 0xbe3b93c7, 0x1e7eeb97, 0xa111691c,
+    0xf831c143, 0xc20662a7, 0x4bad54eb, 0xa8d5b128,
+    0x26e900b3, 0xf9e1d4c2, 0x0231b6b4, 0x8f58482e,
+    0x0b3c2fa3, 0xff6f737b, 0x1af5207e, 0x3592deba,
+    0x565997b7, 0xd1b7ca7d, 0xa06afdf8, 0x9abfc1e7,
+    0xa692ec51, 0xc260d954, 0xfc7313cd, 0xacfa9310,
+    0x6a3842b1, 0x473cf020, 0x18a1c763, 0x60cb0f18,
+    0x86cc53c0, 0xc1c96c3c, 0x76caf2d1, 0xf7d907dc,
+    0x48c60096, 0x929a3b15, 0x1ed1f604, 0x3a5e2845,
+    0xf6889ea7, 0x7c6a713e, 0xe7b579fc, 0x44544057,
+    0x4cdca524, 0x87130f8c, 0xaae8c04f, 0x41d1c96c,
+    0xa6033d7e, 0x3c1f415d, 0x5ae7dbd3, 0xfcd2940b,
+    0x3803b697, 0x18cf336a, 0x43df76c2, 0x3d161f27,
+    0x1466f364, 0x03028d02, 0x449a2d05, 0x4c488221,
+    0x4379dd6e, 0xb0bc9ebc, 0xe9dcea59, 0x0a1afceb,
+    0x80e45176, 0x55764b45, 0x7d58e0a8, 0x4db4d66f,
+    0x35b3656a, 0xd93f0276, 0xe6bc9a10, 0x74630cc7,
+    0xb932adab, 0xe82325c5, 0x420770af, 0xd82f31d9,
+    0xa5ece08c, 0x30b4df4b, 0x32f2aa4a, 0xa0b3b51e,
+    0x17249a2a, 0x2b3a3408, 0xa1e6fd40, 0x038f163a,
+    0xb16ce3d5, 0x8e68bae3, 0x45e6addf, 0x2366e808,
+    0xbd8229ec, 0xbddc7f51, 0xf48b9ecc, 0xf8b03dfd,
+    0x4d9620d2, 0x0d96889d, 0x10772574, 0xbb7bd8db,
+    0x5e81014c, 0x09ba186d, 0xea037947, 0xc23d2549,
+    0x5a1949b7, 0x42218368, 0xffa82c56, 0xbf74f78e,
+    0x4545dbf6, 0x57d63fae, 0x6b0cf9b6, 0xf1cf5892,
+    0x26087c01, 0xc2a0ad34, 0x0c930f68, 0xf4e4d1fe,
+    0xf763282c, 0x75e60572, 0xa3667f6f, 0x939e06ba,
+    0x797f1725, 0x2c6fea0d, 0x8329981f, 0x5e82f233,
+    0x417bfc0c, 0xe09472be, 0xc8400f5c, 0xf4005031,
+    0xf6c122a8, 0xadb9eb78, 0x6d687f74, 0xe561a948,
+    0xe822d48f, 0x9b6bf3d2, 0xad298fe1, 0x059c9212,
+    0x78d80ecb, 0x95cf1ca0, 0xd11127eb, 0x27ea1d59,
+    0x99300fc2, 0x96c89c5a, 0x02b3d55a, 0xa99e00e0,
+    0x84e7c072, 0x59e766fe, 0xbf72aba1, 0xdb5f4f67,
+    0xfb33097d, 0xd629057d, 0x24588385, 0xdff379e7,
+    0x668740ed, 0xbd8bd787, 0xc5e971a0, 0x07bdd7c4,
+    0x23136d18, 0xe6938589, 0x71e7a6a6, 0x54e8ab7d,
+    0xa65f21de, 0x3ffd8a5a, 0x1d5a3483, 0x452bc48b,
+    0x1c625ddb, 0xed92c8a2, 0xa91648fb, 0x3f5913e4,
+    0xa8a370ef, 0x45226040, 0x7a8b955a, 0xf7104cec,
+    0x97124479, 0x5ab4cf5f, 0x73cfd499, 0xce0b469c,
+    0xe433e07b, 0xb51056c8, 0xa1d6e672, 0xc4a6379c,
+    0x45811df9, 0x9921fcea, 0xe2db10e5, 0x23997e13,
+    0x48706874, 0xbe8a4b24, 0xf67a3326, 0x1a225da2,
+    0x9bba06cc, 0xdcb8e255, 0x4dbe416d, 0xa9cb8a72,
+    0x7d4ddeef, 0x83acd726, 0xb73c448c, 0x039dec7d,
+    0x56fac819, 0x64e17a70, 0xa7c1e330, 0xba3fe14b,
+    0x57b77133, 0x3c6887d4, 0x1324f743, 0x5fc726c3,
+    0xb4416b49, 0x61e02b60, 0xf451d44f, 0xad9ecce8,
+    0x4d9af768, 0x7d8d52af, 0x33626482, 0x121b624c,
+    0x1f05a7a5, 0xbfbace13, 0x081513f6, 0x4c8cdb1e,
+    0xe31b373d, 0x8d4ad81d, 0x25482047, 0x7fc6989b,
+    0x01d838df, 0xe220378a, 0xbd0b6f21, 0x1f30a383,
+    0x7a382ca6, 0x7601df64, 0x980b2b8f, 0xdde6f522,
+    0xd6a64713, 0xba088463, 0x5be274d4, 0xedb44c61,
+    0x4b5e7018, 0x2c185c89, 0x036c4cdb, 0x41d56ef8,
+    0xb9f6a6f7, 0xb278f0bd, 0xbf1e1d35, 0x81394fe4,
+    0x313ca827, 0x39eb6488, 0x89b397f4, 0x8542546d,
+    0x0c922ccb, 0xa50b02ab, 0x601067c0, 0x46c0e7ca,
+    0x92d30134, 0x3b080781, 0xed096010, 0xf1844ead,
+    0x985dcc49, 0x7a2b1e06, 0x8d22a72a, 0x769ef55f,
+    0x8f140839, 0xc2a50862, 0xb3f999f8, 0x8e9fc3a4,
+    0x2d43077d, 0x809a8e1a, 0x45c7e1d0, 0xd305544f,
+    0xd5a60665, 0xb017c38a, 0x75e88ea6, 0xc9467b05,
+    0x6f7875f8, 0xa1f30d0f, 0xd4d52601, 0x6c509286,
+    0x1f2e45f0, 0xd1a5fb7c, 0x13401739, 0x5ff49a6b,
+    0x87fa69e2, 0x4a4c26bb, 0x6b6acc99, 0x214eaccb,
+    0xf861fdf3, 0xc5cd2b6a, 0x73a6b84a, 0xf6fb9a9d,
+    0x21b6a042, 0xf005ab45, 0xef92abaa, 0x6155140a,
+    0x5e2f09a8, 0x1add366d, 0xa71df611, 0xeceb92b6,
+    0xb8a41a56, 0xde92041e, 0xd1e898a0, 0x74ae29f7,
+    0x925f1bcf, 0x99c02786, 0x5be1197f, 0x4c4f91f3,
+    0x65647440, 0x4d0a5377, 0x225a8b2c, 0xf4917bee,
+    0x759767c2, 0xfa755a6b, 0xd46f4804, 0x74ff7812,
+    0xcdeedfd4, 0x951140c7, 0x9380f1c5, 0x6d00e598,
+    0xd7ae823c, 0xd1e6c783, 0x2a1a8b21, 0x5ea14128,
+    0x378e97ce, 0xfb08b8b6, 0x95971fa7, 0x1cb9107b,
+    0x51317866, 0x94d21d0a, 0xab2b9c75, 0xbaa3941e,
+    0xcdfa7b88, 0x1a2ba3a8, 0xeb970d1d, 0x6b03964c,
+    0x0bb76779, 0x1a20a370, 0x306978ed, 0x111ce0e1,
+    0x4ac022c4, 0x75948097, 0x43655cb0, 0xb645f91b,
+    0x12cd92b0, 0x5bcf539f, 0x3a757338, 0x2137a937,
+    0xe36ae9a7, 0xead461a2, 0x12cf530e, 0xe1a101da,
+    0x6f88e860, 0xdb769d5a, 0xd80551b8, 0xa54aa42c,
+    0x7d393c1a, 0xd7dd3047, 0xa7449f61, 0xe3205539,
+    0xe0569acf, 0x969114e6, 0x7ce850cb, 0x3fc43bf3,
+    0xe522e4ac, 0xb7756fa7, 0xd081ce83, 0xecab876d,
+    0xcd528b04, 0xd5debc9a, 0x1b786569, 0x625f31b8,
+    0x9fa42b4d, 0x2d317967, 0xaebc9b0d, 0xc7ddc4ab,
+    0xb53cbc38, 0x315918e7, 0xccd2550e, 0xd5c518dd,
+    0xe5aa733c, 0x2ef47ccb, 0xc28e171e, 0xf300d8de,
+    0x53a30f8d, 0xeb7ea8bb, 0x443201c2, 0xb7848b15,
+    0x65b7a055, 0xf9670bad, 0x946ef162, 0x086f65eb,
+    0x42129e75, 0xe775d31b, 0xe4811425, 0x2dcd0b77,
+    0x6679f9bf, 0xbf6eba4a, 0xe3387be3, 0xb2c13681,
+    0xd5c95c8d, 0xd65c0764, 0x1721da03, 0xe11f8821,
+    0xb9760799, 0x4e9ecd19, 0x465e5431, 0x06b94ad8,
+    0x1bea72e0, 0xee764ddf, 0xb211aee1, 0x36462bd1,
+    0x2f36fb4e, 0x436d7a52, 0x652e7f00, 0xf755f660,
+    0xf3369fe4, 0xfbd2a03a, 0xc2285263, 0x8af2982c,
+    0x352a4c84, 0x1414722e, 0xabe7c579, 0xb39164c8,
+    0x95484c63, 0x4e993055, 0xc12a00cd, 0xd5b1d40e,
+    0x5f0fa7e9, 0x10917732, 0x76f6ad12, 0x8112aaec,
+    0x2e769094, 0x51ad6c57, 0x28b20fbc, 0x4c90638f,
+    0x89b9b68d, 0xe55fbaf5, 0x7405f739, 0x31bb4fc1,
+    0x686f057e, 0xaa157461, 0x4ae16adf, 0x3b10a8b5,
+    0x07605f1b, 0xc3e983b1, 0x8d413930, 0xe3b13e08,
+    0xa62fced0, 0x6166a94e, 0xb3204c3e, 0xeac83d88,
+    0x80bcbc8a, 0x30e0b7dc, 0xc5effa98, 0x2e048d49,
+    0x185449f2, 0x328b4160, 0x2113533c, 0xcdd52bef,
+    0x51732fca, 0x4bd2b345, 0x58836acd, 0x1d1f89d8,
+    0xa2d942a8, 0x85837648, 0xa22abe50, 0x84e0fa3f,
+    0x3f897130, 0x5bb2a97b, 0xc763182c, 0x6bfb07c6,
+    0xb1686c8f, 0x605895c6, 0x5279f0b4, 0x6014326c,
+    0x7051c4a1, 0x76e75141, 0x13f25022, 0xe69c8a36,
+    0x8a9e97a1, 0xec0d6d30, 0xdf30d70c, 0x63513760,
+    0x7368b7a3, 0x284c5321, 0x48094fc7, 0x8e8823e6,
+    0xf4c7af80, 0xa5cd86be, 0xa47799bd, 0x6794200a,
+    0x80210825, 0xdddffa66, 0xc43ba36a, 0x83d1af06,
+    0x18053678, 0x98bbe4b0, 0xf426f786, 0xcb297c10,
+    0x38ea1ef3, 0xb5841fa2, 0x4bb34022, 0xac1b6cb4,
+    0x4618e123, 0x6059f09f, 0xa66bf193, 0x62575192,
+    0x9af6d75d, 0xc529cf79, 0x1a4b66fb, 0xcab819ed,
+    0xf0ca8bf0, 0x741c31ea, 0x62ff6ed1, 0xe1d97dec,
+    0x2c7bd60f, 0xa4832d22, 0x552a462f, 0x541a3619,
+    0xdbb7484c, 0x4447ac34, 0x662ba479, 0x1b21fd3a,
+    0xcae027d2, 0x902c53c2, 0xb6c3266a, 0x4833d498,
+    0x1da1b1d6, 0xcbd88b2e, 0xc27b1e7c, 0x7b87d24b,
+    0x0c3b0b1d, 0x3d774398, 0xf86a7731, 0x6910d00a,
+    0xdd8a50ac, 0xab22c0bc, 0x86d5b8b2, 0xa7111611,
+    0xccfb442d, 0x998e16b2, 0x1f29a772, 0x45e46a3c,
+    0x2ec49b3c, 0x6856d9fd, 0x1119f756, 0x93be0eb7,
+    0x6df9ef32, 0xd6b2f2a2, 0xba03f017, 0x472aef99,
+    0x992feeac, 0xf9469686, 0xdd2dcc54, 0xd7e91988,
+    0x5f443f67, 0xc4d50db9, 0x8bd36311, 0x2589e78c,
+    0x2d16bcb7, 0x7a58240d, 0x735406f1, 0x1e919fc3,
+    0x66f42da8, 0xa7f9f8fe, 0x9a32bdd9, 0x8bb9df26,
+    0x2ee5701e, 0x66ceb32e, 0x3e6d2a65, 0x0b1c63fc,
+    0xa841114a, 0x919abf7b, 0x45b20c63, 0x1fc16320,
+    0x292a2401, 0xe1cd4d12, 0x61797af9, 0x316f7e6f,
+    0x9e20785c, 0x526242ab, 0xfd705c50, 0x36e3d412,
+    0x12b479e2, 0xb7309923, 0xf24e63e1, 0x022f7397,
+    0x732f6b79, 0x52e59bdc, 0xf2d164d0, 0xcdf78298,
+    0x70adc81c, 0xd1d20980, 0x960a6585, 0xc8b2dda7,
+    0x2e7b4dc2, 0xdd183c83, 0xa4664c88, 0xf656144f,
+    0x4e99242b, 0x66dd8d86, 0x78e0dd46, 0x9c9dee9d,
+    0x66760073, 0x2ca79436, 0x20d638ce, 0xe97e38b8,
+    0x7450fd77, 0x3e65bad4, 0xf34ae714, 0x558fd989,
+    0x6d86e483, 0xe458929f, 0x361ed211, 0x403e195c,
+    0xf982cb9d, 0xbee0f0f9, 0xb9f3b703, 0x310626b8,
+    0x53f1b157, 0x368c5e82, 0xa863892c, 0x357226ec,
+    0xc6fb151a, 0x77d30c0e, 0x971ab9b7, 0x449f5e48,
+    0xe83d22e3, 0xcc748405, 0xb24ca275, 0x9162b379,
+    0x4b19fd36, 0xd2273139, 0xbda82a01, 0x070cc4b6,
+    0xc9747b7e, 0x669feb9a, 0xab9f91c0, 0x723a6967,
+    0xcd0028e3, 0x9b731621, 0xa56348b5, 0xf7077de1,
+    0x99621421, 0x53f7541d, 0x317b67d3, 0x100d3167,
+    0xf79132d2, 0xe2a4b6b7, 0x9ff4cefb, 0xa4cba24a,
+    0x7cdf62c3, 0x6f45c450, 0x41beea4d, 0x2f0c8267,
+    0xb33cf553, 0xae2cf87d, 0xa6b4c27c, 0xc50cadda,
+    0xe95e0dec, 0xc534b887, 0xbd82cec7, 0xa2074157,
+    0xe247b7fa, 0xf3c96d24, 0xfd7dcb2e, 0x87f4fb64,
+    0x7d286ec2, 0x3fba3a3e, 0x91a9195b, 0x2a278df2,
+    0x436afe4c, 0x4c6f213a, 0x582aa567, 0xdc1e4204,
+    0x248cbe15, 0xb4db2792, 0xa2317ca7, 0x3d0ee41d,
+    0x4f8a2278, 0xe97fc113, 0x6255e059, 0xefc7b9c2,
+    0x502a1c11, 0x028d1768, 0xa6f94e61, 0x3b7627e1,
+    0x9b25d403, 0x6ac340a8, 0x0472f36e, 0xe42fcef6,
+    0xdcfaea04, 0xa70637cd, 0x7912171a, 0xa307fe97,
+    0x2fcd396f, 0xb9975a73, 0xa9019979, 0x875e1667,
+    0x0e736a92, 0x7be84994, 0x86c989fa, 0xd5ac8113,
+    0x264d7506, 0x79c046c6, 0x6e52047a, 0x8ab146b5,
+    0x9384bffa, 0x4d390157, 0x7251e621, 0x9c54821f,
+    0xe3253875, 0xcf118fda, 0x0b835969, 0x97159178,
+    0xc7f0be4c, 0xfa2686d3, 0xd8c57b94, 0x8678c219,
+    0xa9de6e6f, 0xe94ae5cc, 0xe02c002b, 0xa809c530,
+    0xd0bf0cf6, 0xf8613a85, 0x49b5056a, 0x07bbb3a0,
+    0x1cc0c289, 0x2f384bdc, 0x51776494, 0xf07e08ad,
+    0x979c0f51, 0x8544b598, 0x122d9076, 0x20404024,
+    0xa5011809, 0x529ec13c, 0xbf0052cf, 0x26056b4a,
+    0xa068910c, 0x80f1ccaa, 0x58efbb37, 0x8fbcce1b,
+    0xf1b20c19, 0xbfdf0eb5, 0x30dc3810, 0x7845fd81,
+    0x54cf5fa1, 0x02f4615c, 0x359ae114, 0x99b85163,
+    0xf303c9a3, 0xd32ef27d, 0xd7524e61, 0x7a11c23d,
+    0x6c1e9848, 0x5e02cec2, 0x60453fb4, 0xd032291f,
+    0x8b6266d9, 0x1be2de55, 0x5d2bcf0e, 0x36fbe423,
+    0xa79976d4, 0xf6820f29, 0xf6e30808, 0x9eda119e,
+};
+#elif MCUBOOT_ECDSA_P256_COMB_TEETH == 8
+static const uECC_word_t bootutil_ecdsa_p256_g_comb[4080] = {
+    0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+    0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2,
+    0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+    0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2,
+    0x185a5943, 0x3a5a9e22, 0x5c65dfb6, 0x1ab91936,
+    0x262c71da, 0x21656b32, 0xaf22af89, 0x7fe36b40,
+    0x699ca101, 0xd50d152c, 0x7b8af212, 0x74b3d586,
+    0x07dca6f1, 0x9f09f404, 0x25b63624, 0xe697d458,
+    0x8101e6e4, 0x16fc51ff, 0xfccc3ac2, 0x830895e4,
+    0x4aa7358f, 0x608548c2, 0x0cedc02a, 0xe3579822,
+    0x52c392c3, 0xaad2b998, 0xc523e6ef, 0xf0570bed,
+    0x768a3299, 0xf3e4b396, 0x1f433a2d, 0x700f948e,
+    0x8e14db63, 0x90e75cb4, 0xad651f7e, 0x29493baa,
+    0x326e25de, 0x8492592e, 0x2811aaa5, 0x0fa822bc,
+    0x5f462ee7, 0xe4112454, 0x50fe82f5, 0x34b1a650,
+    0xb3df188b, 0x6f4ad4bc, 0xf5dba80d, 0xbff44ae8,
+    0x097992af, 0x93391ce2, 0x0d35f1fa, 0xe96c98fd,
+    0x95e02789, 0xb257c0de, 0x89d6726f, 0x300a4bbc,
+    0xc08127a0, 0xaa54a291, 0xa9d806a5, 0x5bb1eead,
+    0xff1e3c6f, 0x7f1ddb25, 0xd09b4644, 0x72aac7e0,
+    0xee4039a0, 0xd6e260f8, 0x6c224571, 0xe0d3eb33,
+    0x680a7daa, 0xa9cad33b, 0x606a4a62, 0x14cb5692,
+    0x9d83bc01, 0xfe93d315, 0x8039927c, 0x5205ef8d,
+    0x997a9a3b, 0x878487ed, 0x3e1e4663, 0x53098cfa,
+    0xd945111e, 0x30368cb6, 0xf5c4ad42, 0x585a137e,
+    0xffea17c1, 0xc22c48c5, 0x958f1608, 0xa5ab9e10,
+    0x785b4ed9, 0xc34a47b8, 0x49a10f77, 0x46ed771c,
+    0xad0648f4, 0x629e17eb, 0x8b1aa09a, 0xd3ebc611,
+    0x7512218e, 0xa84aa939, 0x74ca0141, 0xe9a521b0,
+    0x18a2e902, 0x57880b3a, 0x12a677a6, 0x4a5b5066,
+    0x4c4f3840, 0x0beada7a, 0x19e26d9d, 0x626db154,
+    0xe1627d40, 0xc42604fb, 0xeac089f1, 0xeb13461c,
+    0xcc049786, 0xc761c1fe, 0x5e98c12d, 0x48f9c187,
+    0xfd208dfb, 0x00d1a0a5, 0xa0642197, 0x418d68de,
+    0x51b50759, 0x481eef55, 0xc16caad0, 0x17429c50,
+    0x2ef8d320, 0x43563962, 0xa5ba6dd4, 0x5d7b26f6,
+    0x27a43281, 0xf9faed09, 0x4103ecbc, 0x5e52c414,
+    0xa815c857, 0xc342967a, 0x1c6a220a, 0x0781b829,
+    0xeac55f80, 0x5a8343ce, 0xe54a05e3, 0x88f80eee,
+    0x12916434, 0x97b2a14f, 0xf0151593, 0x690cde8d,
+    0xe38e3820, 0xc52c00ca, 0xdd561bec, 0x82d789a6,
+    0x74647ebe, 0x54a0fe52, 0xa7b5d4fb, 0x57f62eec,
+    0x48f81460, 0xaa60759d, 0xec356dce, 0x0d300594,
+    0xefea8f48, 0x60e9c067, 0x89bfe2ad, 0x5e5ff8bf,
+    0xfa3289d5, 0x5920d7b0, 0x28994439, 0x54d5dad9,
+    0x27caa747, 0x27035d26, 0x88e9843c, 0x91c821d4,
+    0x9aa8a566, 0xe130dead, 0x0408ebad, 0x7b7df6ea,
+    0x34938dac, 0x919adc37, 0x8f879f44, 0xdb7aecc7,
+    0xc6fae6d7, 0xbc499ee7, 0x7e1c792e, 0xeddf9c6c,
+    0x5bf70c35, 0xc9c6f541, 0x90422d81, 0x06f0afdb,
+    0x4dbc747a, 0x214f0ad0, 0xaf7ae617, 0x41a7cf1a,
+    0xdde64646, 0x7bab8955, 0x3f9804c4, 0x77f9e8f7,
+    0xc96900d8, 0x5d01a765, 0x5e4ec965, 0xf0698ff7,
+    0xbcdf6567, 0x92052d44, 0xd6536c02, 0xbc07bb82,
+    0x83762c71, 0x5fe58ccf, 0xc2e7ba73, 0x635f210e,
+    0xc7b19a1e, 0xa17bf29f, 0x1d90902a, 0xeb165f9c,
+    0xf2159928, 0xaf972b45, 0x4760c41e, 0xd86848c8,
+    0x6b47957b, 0x269843f1, 0x2086a46c, 0xe018aaa2,
+    0x99698420, 0x21a03322, 0x4fed7bb9, 0xd36d88b3,
+    0xba0dbc83, 0xf2fe8863, 0x7f10ee50, 0x383f4db0,
+    0xd789bd85, 0x57c84fc9, 0xc297eac3, 0xfc35ff7d,
+    0x88c6766e, 0xfb982fd5, 0xeedb5e67, 0x447d739b,
+    0x72e25b32, 0x0c7e33c9, 0xa7fae500, 0x3d349b95,
+    0x3a4aaff7, 0xe12e9d95, 0x834131ee, 0x2d4825ab,
+    0x2a1d367f, 0x13949c93, 0x1a0a11b7, 0xef7fbd2b,
+    0xb91dfc60, 0xddc6068b, 0x8a9c72ff, 0xef951932,
+    0x7376d8a8, 0x196035a7, 0x95ca1740, 0x23183b08,
+    0x022c219c, 0xc1ee9807, 0x7dbb2c9b, 0x611e9fc3,
+    0x0af44892, 0x9dda03e1, 0xffa77f1e, 0xdd78a219,
+    0x8aee6cba, 0x67aa472a, 0xa822a856, 0xe42c3142,
+    0xf20db957, 0xbee346fe, 0xd00f7365, 0xbd464186,
+    0x032c4f8e, 0x21774e51, 0xc011817a, 0x8ad034d0,
+    0xd94b1a05, 0x1f969276, 0xadf9e430, 0xca9b1154,
+    0x4b3cf7fb, 0x8930de36, 0xb9a7112b, 0x4ee298bb,
+    0xcaba1c4a, 0xc7551f59, 0xfb972962, 0x79a86b84,
+    0xb38a628c, 0xe47c8ac6, 0x463a6a4c, 0x2cbbf338,
+    0x0b57f4bc, 0xcae2b192, 0xc6c9bc36, 0x2936df5e,
+    0xe11238bf, 0x7dea6482, 0x7b51f5d8, 0x55066379,
+    0x348a964c, 0x44ffe216, 0xdbdefbe1, 0x9fb3d576,
+    0x8d9d50e5, 0x0afa4001, 0x8aecb851, 0x15716484,
+    0xfc5cde01, 0xe48ecaff, 0x0d715f26, 0x7ccd84e7,
+    0xf43e4391, 0xa2e8f483, 0xb21141ea, 0xeb5d7745,
+    0x731a3479, 0xcac917e2, 0x2844b645, 0x85f22cfe,
+    0x58006cee, 0x0990e6a1, 0xdbecc17b, 0xeafd72eb,
+    0xa7dde09f, 0x9f95a5ab, 0x221aa522, 0xc1e70873,
+    0x724a8b0a, 0x3774353a, 0xf0fe9dfe, 0xb942b33f,
+    0x34fc7653, 0xe9601ac3, 0xc2beaa26, 0xae3e0880,
+    0x4fab6ae5, 0xd6c52e03, 0xa61e51ef, 0x0b909273,
+    0x1a780592, 0x91ba25b5, 0x1500d337, 0xee59a574,
+    0x9288e474, 0xe36f1c44, 0xd85f6d65, 0xd3e89acc,
+    0xd8871d87, 0x0f5590ec, 0x92e2f47a, 0x565c81ca,
+    0x841fb007, 0x55942307, 0xa5dc1163, 0xa4f12b40,
+    0x471bd072, 0x298ad9c1, 0xf6d4b375, 0xb286a3b3,
+    0xda5f8abd, 0xb6cbd28c, 0x700ba968, 0x529dc0b0,
+    0xaa8c414a, 0x44672963, 0xbc3089da, 0x99685e9c,
+    0x1e39fce6, 0x9ab4c983, 0xc49bc6a7, 0x9b5426c7,
+    0xab0c3e88, 0x1fe36ffc, 0xba8303d2, 0xc2b3b386,
+    0xadc757ca, 0x72aabf6e, 0x5eec7013, 0x1240b6fd,
+    0x1a9310a3, 0x106308a8, 0x2c136832, 0xb9f4ab88,
+    0xf43cc68f, 0x48a48000, 0x214b70d9, 0xe54f16a7,
+    0x0fee06c8, 0xd9d5e5c8, 0x41d13f39, 0x8bf29817,
+    0xfdaa2b5f, 0x7f25bf81, 0x5ec68bbf, 0x0a70f85c,
+    0xd5e4d954, 0xf2cfc922, 0x83421b3d, 0x5d404051,
+    0x20a2e32f, 0x383e025c, 0x848ef239, 0x63228d59,
+    0x52ffcef3, 0xbaf7d307, 0x9eec8a3e, 0x46b57e18,
+    0xf7ea3bdb, 0x77a91d71, 0x2bc76af7, 0x771f4575,
+    0xfce5c8b5, 0xd918b424, 0x53df5f8f, 0xef6a2851,
+    0x2615a6d0, 0xc375b434, 0x42161a6e, 0x32e41149,
+    0x5543f33f, 0xfa268bc1, 0x79a1e862, 0x057848f6,
+    0xe778c5d5, 0x2acc9e80, 0x1f24fb5c, 0x81cf6721,
+    0x0f94bce2, 0x87656e35, 0x9851bb7e, 0x9650c9c8,
+    0x92e85c53, 0x0d41954d, 0x45b0a71a, 0xef55045a,
+    0x9ef0f09e, 0xea5d651d, 0xcad74dc7, 0x2fe6a994,
+    0x8003a37e, 0xa6c44b75, 0x8579357a, 0xdb525471,
+    0x2ed0f0b1, 0x8732a3e3, 0xb0bb5647, 0xbe207a55,
+    0x32d4eceb, 0x4335fde2, 0x72c4ad3e, 0x91b67e63,
+    0xab018c7e, 0xcdedcb0d, 0xad8cee06, 0xf29e7e82,
+    0xc417b614, 0x7ce355b7, 0xf8bff7eb, 0xcd20145a,
+    0xe5457eb3, 0xaec6a202, 0x75459f98, 0xef934b95,
+    0xc00f55de, 0x10475df1, 0xcb510c09, 0xd4619f15,
+    0x152b9a0e, 0x7ff55fc4, 0x8473875d, 0x3f68c71c,
+    0x57862556, 0xe52b3f50, 0x97b14c6e, 0xe3ddb10a,
+    0x68dba9f2, 0x36758574, 0xd269de87, 0xd1d4f5dd,
+    0x41c3def2, 0x57392917, 0x72836177, 0xd3b0f1bf,
+    0xf7f82f2a, 0xaee9c75d, 0x4afdf43a, 0x9e4c3587,
+    0x37371326, 0xf5622df4, 0x6ec73617, 0x8a535f56,
+    0x223094b7, 0xc5f9a0ac, 0x4c8c7669, 0xcde53386,
+    0x085a92bf, 0x37e02819, 0x68b08bd7, 0x0455c084,
+    0x374e4457, 0x9bf49908, 0x5eecb703, 0x40bf984b,
+    0x68f1f6f1, 0x9b6f997e, 0x9d565a0c, 0x47b54b04,
+    0x69900111, 0x241301c3, 0x776f48bb, 0x4e2a6ea3,
+    0x0feb1cc1, 0x77368e75, 0x15a4a7df, 0xe7afea29,
+    0x9477b5d9, 0x0c0a6e2c, 0x876dc444, 0xf9a4bf62,
+    0xb6cdc279, 0x5050a949, 0xb77f8276, 0x06bada7a,
+    0xea48dac9, 0xc8b4aed1, 0x7ea1070f, 0xdebd8a4b,
+    0x1366eb70, 0x427d4910, 0x0e6cb18a, 0x5b476dfd,
+    0xd961d446, 0x03220fb8, 0x0626c5d7, 0x176324e4,
+    0x722425cc, 0xd43b2ebc, 0x86dbc8f8, 0x29d6274e,
+    0xc08d73db, 0x58185a44, 0xe1239ea5, 0x9c8c1cbf,
+    0xbac64731, 0x2b1cfe87, 0xa5816948, 0x6c16b472,
+    0x23a81ffb, 0xe2753cb1, 0xb82a9f20, 0x22278fa5,
+    0xf09c4be2, 0x4b032745, 0x059ffd23, 0x5f68c836,
+    0x1dbf8f8d, 0xbf3ae369, 0xf9fb8d66, 0xb2b1552c,
+    0x34925367, 0x0c84bfb3, 0x9e109af7, 0x0639e57e,
+    0xc60c4684, 0xd8218845, 0x0859a19e, 0x66a66447,
+    0x3ed6dfca, 0x9e18931e, 0x6fea0609, 0x3b5b03e6,
+    0xa9d7edbb, 0xd8bc19b5, 0x64477877, 0x95ffd112,
+    0xf35c8263, 0x2cd1ca07, 0x38e14ddc, 0x76f1e0c8,
+    0x611d1a41, 0xa3d21037, 0x4b11663f, 0x62b730a1,
+    0xedf0f22e, 0x9ebd9fa2, 0xcb79ea5a, 0x2c1a2336,
+    0xac53b363, 0x294b5675, 0x729cb7fe, 0x2c2988be,
+    0xb587c2e9, 0x146454ff, 0x1dfc32e7, 0x2e1c4770,
+    0x67429e4d, 0x8722658c, 0x0561f51e, 0xbe9522aa,
+    0xd9d59f46, 0x3d622057, 0x89ef69a2, 0x76e96b46,
+    0xb797faed, 0x16aa0650, 0x15ff8993, 0x75b78e22,
+    0x27f9fb88, 0x1575c0cb, 0xf705e319, 0xcf218959,
+    0x278c340a, 0x7c5c3e44, 0x12d66f3b, 0x4d546068,
+    0xae23c5d8, 0x29a751b1, 0x8a2ec908, 0x3e29864e,
+    0x26dbb850, 0x142d2a66, 0x765bd780, 0xad1744c4,
+    0xe322d1ed, 0x1f150e68, 0x3dc31e7e, 0x239b90ea,
+    0x87617f0e, 0xcf15dc9c, 0x6858d44b, 0x85b40dee,
+    0x121421de, 0xa96c9e4b, 0x05d45c5a, 0x191eb33a,
+    0x199cf43b, 0xc9c16e10, 0x28ee6e02, 0xf245c57b,
+    0x45e9654f, 0xf3eb80dd, 0x592282a1, 0x8a9365ff,
+    0x7a53322a, 0x78c41652, 0x09776f8e, 0x305dde67,
+    0xf8862ed4, 0xdbcab759, 0x49f72ff7, 0x820f4dd9,
+    0x2b5debd4, 0x6cc544a6, 0x7b4e8cc4, 0x75be5d93,
+    0x215c14d3, 0x1b481b1b, 0x783a05ec, 0x140406ec,
+    0x7e0e3190, 0x44f65f50, 0xea3f501a, 0x1370d12f,
+    0x8c6615b0, 0xb8635f9a, 0xb3cd1c0f, 0xff29dc0f,
+    0x738114f6, 0x07f8a15d, 0xeecc62e3, 0x14def0ab,
+    0x09b8e6b6, 0x24dd6595, 0x3439a422, 0xc43831f3,
+    0x93501899, 0x42293cdf, 0x1cc1e2e5, 0xe7f0390c,
+    0xcbf28253, 0xe1ef732a, 0x1f2b6b79, 0xe21f15f3,
+    0xd622619a, 0xcfc0f97c, 0x726b5a08, 0xc056b494,
+    0x4d24ee97, 0x38c94cb1, 0xbc052d44, 0x4a3fc23c,
+    0x60d54267, 0xa30935f7, 0x652f6cd5, 0x5c5093ba,
+    0x0b854da9, 0x8720d196, 0x2c10d86c, 0xf361d706,
+    0x723b99e4, 0xd11a3d27, 0x2f7d40c8, 0x8a18ce4b,
+    0xc3d3516d, 0x44bdb2fa, 0x6b183cfb, 0x2c990dbb,
+    0x96480ca6, 0xed303f4c, 0xce200b86, 0xe2dbe559,
+    0x4ceb95a3, 0x87704e32, 0x21cd1c8d, 0x5991daa2,
+    0x75c04ee0, 0x20a4bdad, 0xd3ab3659, 0x9fe5ed7d,
+    0x1dd427e8, 0x0efb4bea, 0x8ce1431a, 0xde5d5896,
+    0xa52342b3, 0xaf31d989, 0xc03eb194, 0x918e1fb4,
+    0x6b6cb7b9, 0x303e35f0, 0xe062a8c2, 0x33fef524,
+    0x512e5bc0, 0x692a4fbe, 0xf5162c74, 0x067cfb0d,
+    0x20859bd2, 0x519ad6ff, 0xd84dbd4e, 0x0a5b4caa,
+    0xfbb7f12d, 0x4193640b, 0xdfd6c3f3, 0xef8bf285,
+    0x010729ac, 0x23fe7442, 0x2c214cd9, 0xff25f55a,
+    0xf30f0fc8, 0xd77bf411, 0x2ab82b74, 0x1a08ebc7,
+    0x74a58d77, 0x00c15ba7, 0x8a405100, 0x94f114d3,
+    0xd0a62b2c, 0x1fd07ab7, 0x9f776819, 0x31c6f056,
+    0x8edc0d13, 0xe0443b93, 0x63ae46a6, 0x1b9d594e,
+    0xc14453e5, 0x5ab358fc, 0x9a58ab51, 0xfb52863b,
+    0x01683cef, 0x473ab211, 0xed96c8e1, 0xed16ba54,
+    0x29ba369a, 0x2641769d, 0xcd922263, 0xe498612f,
+    0x1898ead9, 0x861b8e4c, 0x95baf610, 0xc3948bd4,
+    0x3ff24345, 0xb529a79b, 0xbe0a3da8, 0xa2b8624a,
+    0x94743717, 0x2f5b7f80, 0x218a7b61, 0xbe92ada7,
+    0xfd943a71, 0xef977470, 0xef2d93e1, 0x2dbfbc52,
+    0x62b812a7, 0xfbe20b47, 0x3ef44b43, 0xa1547557,
+    0x89bc18d0, 0xf18068cb, 0xb7e40a72, 0xd0702163,
+    0x92efaf4f, 0xb5115ad4, 0x8c4b8a43, 0x384d5627,
+    0xc0b0755e, 0x80d58211, 0xb4cacf23, 0xca274a6d,
+    0xecf21b69, 0xae21f1b4, 0x03b2b318, 0x8d84f419,
+    0x9f10418f, 0xc518f894, 0xd91762a0, 0xc73b5fdf,
+    0xec26c110, 0xc98ecbf6, 0x6953fd62, 0x15bcd7d0,
+    0x061457fe, 0xc877db08, 0xc6471595, 0x60eb5c88,
+    0x808ec0ed, 0x03ce1e41, 0xe27f462a, 0x4a014325,
+    0xa4fba4fc, 0x7961a1cd, 0x662743c7, 0x206d4beb,
+    0x41cda791, 0x47f12714, 0x2f381bb9, 0xb069f7e0,
+    0xcb87dea8, 0x6e6f4859, 0x39546374, 0x4787ec66,
+    0x6121b977, 0x1cbf27b3, 0x44e182ab, 0xca7ee915,
+    0x7f985b5b, 0x40bd566d, 0x6d5fdb9a, 0x4225339a,
+    0x2fc8c2a3, 0x4cd02584, 0x70f14a3d, 0x0d4c0016,
+    0x9b6d8676, 0x9a89a4cc, 0xad3055b9, 0xcbe46247,
+    0x6b4f6a92, 0x8a8c8b10, 0x570e8f0f, 0xd96633a7,
+    0xe8b04cc1, 0xd1fda6e8, 0x40ba4a72, 0x215d4ce6,
+    0xf64c3358, 0xd7533270, 0x9825b9fd, 0x4d144dea,
+    0x66fdc380, 0xa3baaf1d, 0x4cd0c836, 0x1b08f73d,
+    0x9d67ff49, 0x563f9fba, 0x5af864ec, 0x1577aca8,
+    0x0c0b7b43, 0xe61a8c7e, 0xa8e5ec0a, 0xcdbe96b5,
+    0x8e1d9252, 0xe3061205, 0x138e5ef8, 0x78286cc9,
+    0x253bcbf0, 0x0f8364c4, 0x03bb9180, 0xf26390c7,
+    0xad1e3bb3, 0x4ebccda4, 0x85a5d1eb, 0xb08c91a3,
+    0xb643475c, 0x60dc9158, 0x2ba0101b, 0x39bd97d6,
+    0xc502fbe0, 0x6fd29d96, 0x3158a73c, 0xb8fe20c1,
+    0xe0106368, 0xfc0ddf3b, 0x93f52b68, 0xd3c72ba5,
+    0xa8787924, 0x7c6bdf85, 0x532189d3, 0x9645c64a,
+    0x824e2771, 0x58d3cc9b, 0x6e82dc91, 0x9b7e75e1,
+    0xe0ed1cc0, 0xbf4ec9f6, 0x3260f488, 0xffb683e6,
+    0xa4f0c81b, 0x8821c701, 0x881d4342, 0xeaa11d49,
+    0x79a87eef, 0x346fab79, 0x39848086, 0xa9c3643e,
+    0xf6c6e053, 0xe040a053, 0xe1f9d4ba, 0x0d287400,
+    0xbd4aa53c, 0xa48cf15d, 0x11e94cef, 0x76cdf40c,
+    0x7ef30e41, 0x3f023041, 0x4ce753c8, 0x9184493f,
+    0x2a7516ca, 0x5a228849, 0x660402f4, 0x97c0af3a,
+    0x8a23e934, 0xd0db8ce7, 0xe707a0b2, 0x4f22360c,
+    0x2032d181, 0xb487dbb9, 0xcb5623fd, 0xc6d1b0f9,
+    0x2bc5c755, 0x8746f483, 0x775a0fe2, 0x3dc6f57f,
+    0x0f21c2c9, 0x87bccbe9, 0xeae51818, 0xdb93a6b1,
+    0xa87aa88a, 0xf5754a37, 0x73972e83, 0x2791bf54,
+    0xdeac962d, 0x65fe92b6, 0x5db3c2a5, 0x7675343a,
+    0x1c77336e, 0x5c2ce444, 0xd14b1a55, 0x6fd6234a,
+    0x10c24e9e, 0x1e25c808, 0xd88c3194, 0x7e941cef,
+    0xe4b9453f, 0xbfa7a9ba, 0xdb055169, 0x6256b1bf,
+    0xd4956f06, 0x835e6cd4, 0x2948048d, 0x7d3bcf9d,
+    0x18064104, 0x82480753, 0x0891878c, 0xf3c2f9c4,
+    0x29af296d, 0x1d6cbef1, 0x55b9ed41, 0xa57ddaa3,
+    0x903a1cdf, 0x4f47c7f1, 0x197db90d, 0x45057fcf,
+    0xca13fa12, 0xc125bb25, 0xd7f746df, 0x5bcfd6f3,
+    0x313728be, 0x6cf20ffb, 0xa3c6b94a, 0x96439591,
+    0x44315fc5, 0x2736ff83, 0xa7849276, 0xa6d39677,
+    0xc357f5f4, 0xf2bab833, 0x2284059b, 0x824a920c,
+    0x2d27ecdf, 0x66b8babd, 0x9b0b8816, 0x674f8474,
+    0x677c8a3e, 0x2df48c04, 0x0203a56b, 0x74e02f08,
+    0xb8c7fedb, 0x31855f7d, 0x72c9ddad, 0x4e769e76,
+    0xb824bbb0, 0xa4c36165, 0x3b9122a5, 0xfb9ae16f,
+    0x06947281, 0x1ec00572, 0xde830663, 0x42b99082,
+    0xbb162b85, 0x40b11c79, 0x5a890653, 0x426e2f71,
+    0x7586e3c3, 0xe9e180a6, 0x65dbb34a, 0x507b542a,
+    0xe489b8ad, 0x225f912a, 0x301369c1, 0x33520333,
+    0xd338ecde, 0xca383ce7, 0xd11a51d6, 0x5eb5701e,
+    0xfbcbc0c3, 0x490e66bc, 0x15065b98, 0xe8d7b164,
+    0x3e1a841c, 0xf2f80e3e, 0x7696fcf5, 0x62d4a49f,
+    0xf521f731, 0x86eddee7, 0x77305b14, 0x90337684,
+    0xf36fa83e, 0x56193ecb, 0xd347d332, 0xd18b33eb,
+    0xdda868b9, 0x6ef95150, 0x9c0ce131, 0xd1f89e79,
+    0x08a1c478, 0x7fdc1ca0, 0x1c6ce04d, 0x78878ef6,
+    0x1fe0d976, 0x9c62b912, 0xbde08d4f, 0x6ace570e,
+    0x12309def, 0xde53142c, 0x7b72c321, 0xb6cb3f5d,
+    0xc31a3573, 0x7f991ed2, 0xd54fb496, 0x5b82dd5b,
+    0x812ffcae, 0x595c5220, 0x716b1287, 0x0c88bc4d,
+    0x5f48aca8, 0x3a57bf63, 0xdf2564f3, 0x7c8181f4,
+    0x9c04e6aa, 0x18d1b5b3, 0xf3901dc6, 0xdd5ddea3,
+    0xfb696d7b, 0x8b030fea, 0x400cfa69, 0x9d11bdca,
+    0x8fa8a597, 0x3bcfb88d, 0xff476ef0, 0xaa59e783,
+    0x88f5a016, 0xfbad3413, 0x5c0aba02, 0x2a4147fa,
+    0xd831450e, 0xda2c96d0, 0x30e77dd1, 0x30a12aad,
+    0x30076ed0, 0xdfa412e5, 0xece43efe, 0x90e7efc3,
+    0xe9c9c2a2, 0x7d021b57, 0xb498993d, 0xe3ddf1b7,
+    0x846b4d7e, 0x5b955c48, 0xae7c855e, 0x959131ad,
+    0x77227a7b, 0x8490e467, 0xa60ce85f, 0x283833a8,
+    0x2fb3062c, 0xfb5a3d22, 0xb65437ec, 0x5682157e,
+    0x76fd0872, 0x7657711b, 0x4ad70bcc, 0xce6d933a,
+    0xfc3e65c1, 0xa9cebba1, 0xd4111c9d, 0x0fda9930,
+    0x9a834dd3, 0xd1edb57b, 0x5d2c8bb7, 0xa8839960,
+    0x8c4150cc, 0x88bc6c8d, 0xad6c3923, 0x73758b21,
+    0x29928820, 0xd43a7503, 0x95ea9feb, 0x790ecf86,
+    0x1bfb5292, 0x59a580f7, 0x9f51de15, 0x0f7a900f,
+    0x9d6239f6, 0xf444c49a, 0xd87decf6, 0xe340d641,
+    0x1026b033, 0x1ebb28ac, 0x3a50d3ac, 0xff199a09,
+    0xe869a58e, 0xa2c053e4, 0x414dd6be, 0xb05e35aa,
+    0x6754449f, 0xfbcb4c4a, 0xf8427d60, 0xc25c0899,
+    0xc5ae69de, 0xd7e45688, 0x6646039a, 0x47270f9c,
+    0xe872889a, 0x0dfab50a, 0x703913a8, 0xfab939d7,
+    0x16b20242, 0x4ebc7144, 0xd2f8bae8, 0x22bc5020,
+    0x9d713946, 0xabeaaae6, 0x3ef21012, 0x3c2cd39e,
+    0xaef98a9b, 0xac67692c, 0x78e64c2e, 0x616222e4,
+    0xb6a8a95d, 0xffcdcc28, 0xf068c865, 0x61948cc6,
+    0x48a3fbb6, 0x02790b8c, 0x93239bc6, 0xfaa43bed,
+    0x77a8fe3d, 0x97747046, 0x3e4708bd, 0x5f83ca7a,
+    0x43482e7d, 0x1388e9e2, 0x026921ca, 0xd21a75f1,
+    0xa15bbae6, 0x7549f1b1, 0x8ba6bbcf, 0xa9c4ebbc,
+    0x3ab26d77, 0xf3deb351, 0x7f94bbb6, 0xfd3bcf2d,
+    0x46fe3ddc, 0xfa8344d7, 0xd2f4fdab, 0xbad3e545,
+    0xf8de5d37, 0xba4ccb8e, 0xd97112db, 0xada514fe,
+    0x8bcf4dbf, 0x017fa5e2, 0x80217643, 0xabcaeada,
+    0x4bbf5a9f, 0xefb61274, 0x5144598e, 0xf28dc88b,
+    0xb384a585, 0x2fd4905e, 0x73df56d7, 0x30987256,
+    0x671dd081, 0xe1913ca6, 0x8249b59b, 0x1a242940,
+    0x1f70723f, 0xda398393, 0xb21ac825, 0x6cfe750a,
+    0xf4eb6e64, 0x92c6a768, 0x47c9e925, 0x4290db0b,
+    0x413464c5, 0xf9d2fb88, 0xc8971f1a, 0x64aa8ad3,
+    0xf2ebcd3c, 0x263bead1, 0x3374c163, 0xb5d01e33,
+    0x3e72ad0c, 0xe96a79fb, 0x42ba792f, 0x43a0a28c,
+    0x083e49f3, 0xefe0a423, 0x6b317466, 0x68f344af,
+    0x3fb24d4a, 0xcdfe17db, 0x71f5c626, 0x668bfc22,
+    0x24d67ff3, 0x604ed93c, 0xf8540a20, 0x31b9c405,
+    0xa2582e7f, 0xd36b4789, 0x4ec39c28, 0x0d1a1014,
+    0xedbad7a0, 0x663c62c3, 0x6f461db9, 0x4052bf4b,
+    0x188d25eb, 0x235a27c3, 0x99bfcc5b, 0xe724f339,
+    0x71d70cc8, 0x862be6bd, 0x90b0fc61, 0xfecf4d51,
+    0x15a27295, 0x63fec45f, 0x74d2b111, 0xa41a773e,
+    0x12dde90d, 0x9341bc09, 0xaa83c35c, 0x5583dafa,
+    0x05f406f4, 0xbc93ae0b, 0xc427f2ec, 0xcf73a836,
+    0x2c6e92a6, 0x0af26be5, 0x49b67cd6, 0xe096722b,
+    0x00aef6e0, 0xf4b1ad53, 0x92448ec8, 0x51d353e9,
+    0x4f5f7050, 0xbda23624, 0x5172ddf2, 0x38641e4c,
+    0x0dafe306, 0xd076b5ae, 0x042f9b7f, 0xbaf02e13,
+    0x7bb9888d, 0xefb76553, 0xeee3a756, 0x28ac3017,
+    0xa1d4cfac, 0x74346c10, 0x8526a7a4, 0xafdf5cc0,
+    0xf62bff7a, 0x123202a8, 0xc802e41a, 0x1eddbae2,
+    0xd603f844, 0x8fa0af2d, 0x4c701917, 0x36e06b7e,
+    0x73db33a0, 0x0c45f452, 0x560ebcfc, 0x43104d86,
+    0x0d1d78e5, 0x9615b511, 0x25c4744b, 0x66b0de32,
+    0x6aaf363a, 0x0a4a46fb, 0x84f7a21c, 0xb48e26b4,
+    0x21a01b2d, 0x06ebb0f6, 0x8b7b0f98, 0xc004e404,
+    0xfed6f668, 0x64131bcd, 0x4d4d3dab, 0xfac01540,
+    0x72600e54, 0xff8d09c0, 0x10203d11, 0x1960edaf,
+    0x377756fc, 0x429dd48f, 0x884d880e, 0x4fa4a1ea,
+    0x8d24ad69, 0x7fa9eaf1, 0xae16e60f, 0x4b9a578c,
+    0x35364b6a, 0x7e8849f3, 0x426f03fe, 0x3a6681db,
+    0x8fa9f0a4, 0x62427d34, 0xa7621aa3, 0xef92aac0,
+    0x6bc20d7f, 0x9a3bfb57, 0x57add1cf, 0xe00f53af,
+    0x9a8e182b, 0xaa091420, 0x65870acd, 0x6dbadf70,
+    0x9e7fa3d9, 0x1873e2cb, 0xae5822e9, 0x15b8c5b7,
+    0x593d097f, 0x6b53bf21, 0x84d5959a, 0xbf667bea,
+    0xeeb4beac, 0xd1609f4f, 0xcac8251d, 0x69a5b074,
+    0x5318ecb3, 0x612d6531, 0xd420d3e0, 0x66a6aebc,
+    0x685d7231, 0x6840955e, 0x1daa4128, 0x454f241c,
+    0xa5d67e8a, 0x8d3e6d40, 0xa18b743b, 0xe139639f,
+    0x948e7dc2, 0x63749ea0, 0x526bde8f, 0xabd4c85f,
+    0x2d812dfe, 0x731da794, 0x67ed8673, 0x9a9c0ddd,
+    0xa83f2506, 0x63feba54, 0xf64a622e, 0x475baed2,
+    0xb40aab96, 0x1aa70ad1, 0xf911ec64, 0xf7accaed,
+    0x70fa959c, 0x637899ce, 0x109a2589, 0xe9bc4fe4,
+    0x1bf979e4, 0x7bcce0d0, 0xbb65d9be, 0x2941c273,
+    0xbae3365e, 0x4997cc24, 0x8b08213e, 0x20efcfbb,
+    0xbdd6fa57, 0xdde6c1b0, 0x6877584c, 0x64da38dc,
+    0x88a2ea3b, 0x5efd04d6, 0x8de94787, 0x5e12f389,
+    0x4c229e61, 0x822dc6f3, 0x32c58ce1, 0x0220a965,
+    0x12104d90, 0xbff58f54, 0x6f430c30, 0xcc9c71a8,
+    0x146a91dd, 0x69a3f7af, 0x77603291, 0x66fb0376,
+    0x34331450, 0xf8ba5650, 0x5d12fc47, 0x4d88f26e,
+    0xde1d8482, 0x52e87a6f, 0xd84f6dc4, 0x71fc3d27,
+    0x1c1bfc10, 0x80660eb4, 0x39ad0a51, 0x2f4241dd,
+    0x5da65e89, 0xcea18fed, 0xb6030005, 0x89d02e3a,
+    0x16b45eab, 0x593303db, 0x40b36824, 0xf5d40404,
+    0xb6e6ca16, 0x8e62c398, 0xa0f8db73, 0xb6680f4a,
+    0x3735f704, 0xe2cb53ab, 0x005e4955, 0x90eaf4b0,
+    0xd030702a, 0x4ea9bf09, 0xce4824bb, 0xe8e44ea4,
+    0x821e5b58, 0x0aaa6a0a, 0x117da962, 0x2090fa8e,
+    0x80902901, 0x1b68c306, 0x0b4e7472, 0xaf0a7e97,
+    0x0393f96b, 0xebb4408c, 0xec32f258, 0x984bd632,
+    0x1159f10e, 0x807d9af8, 0xb42511bc, 0xe05eff00,
+    0x61b05022, 0x2ee9f026, 0x29fb81a6, 0x3d45853a,
+    0xf75bc3a9, 0xa6b9c16e, 0x515a90e0, 0x82111a06,
+    0xedfc125e, 0x87211449, 0xa80a8311, 0x4e4de334,
+    0x637d797d, 0x270a098d, 0xff736545, 0x60ff39ed,
+    0x9d6b4a9b, 0xeb3df8bf, 0x0e6155fa, 0x0ac9835f,
+    0x640bc0e9, 0x50c04b69, 0x3fe89b08, 0xfa24f733,
+    0x5c6872b2, 0xd8ac7b19, 0x3d00d534, 0xd6882b26,
+    0x0236a83d, 0xe0052323, 0xcd9a2912, 0x1fb825a3,
+    0x3f92d724, 0x69479cbc, 0x38ec3ddd, 0x389eff26,
+    0x1eb367c1, 0xe9ffea6c, 0x91f3a0de, 0x113a50c5,
+    0xb7b0af9e, 0xcfd0310c, 0x31ea1ac9, 0x5e1b21c9,
+    0x48aceff5, 0xda6e2f06, 0xea0dfe34, 0x78ddc159,
+    0x14db328c, 0xb5f5fb47, 0xe6f3ba6a, 0x9419acf5,
+    0xc66c1b27, 0xb19cd157, 0xf91bdb7b, 0x473be3d3,
+    0xee3174a1, 0x08a1f515, 0x1b427e86, 0x565a9071,
+    0x863def2f, 0x71db5c74, 0x86db595a, 0x46fc6cc6,
+    0xb0578f7c, 0x41a41f2a, 0x00c9bc26, 0x3af24209,
+    0xb3c9ab1a, 0x134233fd, 0xb6070f59, 0x7870f3a9,
+    0xdf2af343, 0x39b1f3b2, 0x4ab472ab, 0x6013da0e,
+    0xf319ca96, 0xa4ab1856, 0xf8f15fac, 0xfad93fe2,
+    0xa833145e, 0x9a143ff7, 0xf19e3798, 0xb7f41bbe,
+    0x88fba40d, 0xe71b2d47, 0xfd3b7782, 0xfbe87b9f,
+    0xdef04692, 0x51bed9be, 0x0a92fe70, 0x9d86b0cc,
+    0x901d3434, 0xe4269dbe, 0xfe90a0f6, 0x93b1c84f,
+    0xc4383c70, 0x9e0ab0cf, 0x9ef8f7f3, 0x94a875b9,
+    0x7bd07e21, 0x7c54e527, 0x24c1f8a1, 0x4426e751,
+    0xa59e4156, 0x88d04ff3, 0x2e3f9185, 0xca552076,
+    0x3f32bef2, 0xc6c3baae, 0xccbf8eb6, 0x130ee8f7,
+    0x8e7e89c3, 0x09ec2b46, 0xbc2625f9, 0x3fbfbd74,
+    0xb27173d1, 0x88502a08, 0x3cf0d529, 0xbb3271ff,
+    0xeb6fc065, 0x1409df32, 0x75196790, 0x21531773,
+    0x0da1427c, 0x93eb1d71, 0x410e3f28, 0xb5f1a270,
+    0xa9325717, 0x7e9d484b, 0x576b2b28, 0xf883c4ab,
+    0x15b0cc94, 0x8471e075, 0x560fab54, 0xaee70132,
+    0xdd9dec7a, 0xb461efe8, 0x488ab1d0, 0x6086f208,
+    0xd41345eb, 0x8a9b3774, 0x4320bec3, 0xe42d2ea2,
+    0xd72435ff, 0xebb176e7, 0xca2c0e18, 0x3841166e,
+    0xd372be35, 0x9c27a301, 0xe329d0df, 0x7518195c,
+    0xca99fe01, 0x203c98cb, 0x89f4ced9, 0x84d9c1a6,
+    0xb789034e, 0xa7f47395, 0xe3acd77c, 0x5378515c,
+    0xa20bcd3f, 0x29d692e0, 0x59e44b71, 0xbfd07180,
+    0x6733f199, 0x92cd3e15, 0x99f9141a, 0x43428c81,
+    0x07e9c6e8, 0x47e891ec, 0x75deaf04, 0x47103963,
+    0x07888c81, 0xe2403426, 0x87490006, 0x03547365,
+    0x1fca7f34, 0x48369a11, 0x6e2f531d, 0x383707d0,
+    0x9f7d10dc, 0xdc6a8214, 0xc9d5ef32, 0xca0b8578,
+    0xcdb6f94d, 0x8a4a5b65, 0x9b236f7a, 0x287ff192,
+    0x48c1555e, 0x886878ca, 0xaf70db2d, 0x5fb1fbc9,
+    0xb15fda95, 0xdffff48f, 0x8fb2fa61, 0xfd98525d,
+    0x57f0c9a8, 0x9a481e75, 0x27069783, 0x9bab3b2a,
+    0xa223c95e, 0x9569dffb, 0x0f6b2d61, 0x93840d78,
+    0x23baeb04, 0xeaaaa5d8, 0x3a4708fa, 0xb7adca0c,
+    0x17b23442, 0x1394cbdc, 0x1d926d0f, 0xb241aa94,
+    0x1de2521d, 0xda7549f5, 0xe4b48a02, 0xee7534c9,
+    0x46ba6568, 0x1dde0dee, 0x21b920e4, 0x85aa7eed,
+    0xbaf91228, 0x348857ea, 0x4ecb2af2, 0x892d0a81,
+    0x91e8b82b, 0x06136e7f, 0x495431ad, 0x0869ec0d,
+    0x2e051cdf, 0x54fa49c4, 0x823c9b51, 0xcb47adca,
+    0x265eb81a, 0x70a00076, 0x9b7675a0, 0x5572895c,
+    0x96c14e8f, 0x9d1adf60, 0x2c06a25a, 0x06597793,
+    0x58d5a91a, 0xb2dcbd1f, 0xde733f89, 0x1283033b,
+    0x9bbd6a2d, 0xb4020e0e, 0x7d383846, 0xe8b07157,
+    0xa635c7be, 0x84af4665, 0x34dd7d5f, 0x549c0eaa,
+    0xe86e02ab, 0xf29fb08f, 0x0d5c06ca, 0xa8266dc1,
+    0x2f48f49f, 0x25d5e27d, 0xe6f31bb3, 0xa2ebf469,
+    0x0382a8eb, 0x86ae97d9, 0x363f04f7, 0xcb92f44b,
+    0x002d76f6, 0x391b9654, 0x4432235d, 0x27bebd8c,
+    0x3765581e, 0x7b3068d0, 0x1dc2d82e, 0x561d30f5,
+    0xb1f23d69, 0x8a404541, 0x1b4084ce, 0x6a25fb20,
+    0x60206329, 0x50180e1b, 0x5cf443d5, 0x1e15941a,
+    0xd06a4007, 0xf5763393, 0x19cfb424, 0x5a0aebfc,
+    0xe529a049, 0xa2d545da, 0xc73a541a, 0xa581a768,
+    0xe0950a67, 0xafe88b1e, 0x52b8fcca, 0x62778f74,
+    0x0b8483fc, 0x44bb1bfa, 0x6e882c24, 0x5d727f5a,
+    0x553a776c, 0x4e4cbe60, 0x1ae91088, 0xe155b2f8,
+    0x1b207a93, 0x5d84a3a3, 0xb71b2f04, 0xfbae3d63,
+    0x6013b8ba, 0xaa9cebc1, 0xd1c608d1, 0xfc9aa3cf,
+    0xcf8cd72d, 0x1e3f596c, 0xda16b20c, 0x26152558,
+    0x85ac096c, 0x6db0b1cd, 0x2bb637da, 0x34ab0e43,
+    0x12c953e4, 0xa9f4f5c1, 0x2a6a470a, 0xfe518080,
+    0x0b17775b, 0x5455fbcb, 0xc1752bb7, 0x4f117894,
+    0x544a3be7, 0x5b5e49de, 0x22c3ec1c, 0x0dde356f,
+    0x01da56c9, 0xe26ae66a, 0x35ffd9dc, 0xab3b6155,
+    0xc94f4326, 0x21ad037b, 0x01f60a81, 0xdd3c9aad,
+    0xa3106421, 0x4f11ee65, 0xadbacc80, 0x4751fe00,
+    0xd3c2917e, 0xe4683589, 0x71d43f65, 0xfa8bd144,
+    0x11a422f6, 0x200697f3, 0x1fa0772b, 0xe83d7d4f,
+    0x59b21469, 0xca907bff, 0xc44627de, 0xecfda9fd,
+    0x5af99278, 0x8b32c8bb, 0x51c0a6fc, 0x2298506c,
+    0x9d7bfc5f, 0x2227244e, 0xbc8dcdbc, 0xd903a0c9,
+    0xa5809f67, 0x8916acec, 0x4c45bbd7, 0xfef3434a,
+    0xc5332d4d, 0x12749619, 0x076108b7, 0x78346549,
+    0x52f84fde, 0x44f0646e, 0x9b855f0e, 0xaca1b2fa,
+    0xbb5acc3e, 0x9f40edd1, 0x5cb0077a, 0x341dd551,
+    0x7731c386, 0x4162bf6f, 0x7d37f6e4, 0x30fc315c,
+    0xbe224934, 0x07c6577e, 0x133b52f5, 0x0bd79c64,
+    0x26ea9a30, 0x6d440b9b, 0x8af95af2, 0xdc9823e4,
+    0x951a08eb, 0xf3dcb38a, 0xcd6f6b4f, 0xcaedc3a2,
+    0x55572efd, 0xb648efdb, 0x043c56dd, 0xb2656a22,
+    0x7cab3106, 0x24c2e7a2, 0x45ddcbcc, 0xe70143a5,
+    0xe23c4d47, 0x121738aa, 0xc9729043, 0xd3559359,
+    0x5f6e4215, 0xd0abcedd, 0xd8c94522, 0xf09ef638,
+    0xfbf9ab22, 0x7bdde51f, 0x95edb586, 0x7aa22698,
+    0x530e8727, 0xc7e05f58, 0x88a132f3, 0xd41592d9,
+    0x4835f583, 0x7cb9b486, 0x8f603959, 0x0d5caba2,
+    0x7d850a76, 0xb97c361d, 0x0751fedf, 0x75d0638a,
+    0xeb862fbe, 0xad213d44, 0x597d997b, 0xcb814263,
+    0x85fba82b, 0x5e2a21f5, 0xee80d718, 0xe2b23452,
+    0x8f8d3ad4, 0x61cd936d, 0xaea80a6b, 0x537e0faa,
+    0x65c03360, 0xe8a1913b, 0xe9a48461, 0xad915586,
+    0xc9e7c92d, 0x197c7be0, 0x0476e6db, 0x98ff32e1,
+    0xf8d734ca, 0x56131598, 0x32ab6115, 0xa90c803b,
+    0x294f6172, 0xf20b6904, 0x29bb4956, 0x9c4c8c6b,
+    0xa3443e3c, 0x72523cbc, 0x1aaf4a8f, 0x403fc2d5,
+    0xf99a6339, 0x264bcaa0, 0x6437cec7, 0xf837ca9f,
+    0x15685448, 0x3bb78084, 0x1186bde2, 0x0fc3a28f,
+    0xcf4eebdf, 0xd41f0cfa, 0xae3a0ddc, 0x8384f799,
+    0x10b4f451, 0xf4ee653f, 0x833d3476, 0xc2f5d30f,
+    0x38e0e1ce, 0x6c3bceb3, 0xaa489e30, 0x76570d52,
+    0xa38218cf, 0xb7aeab38, 0xa9e0d3c4, 0x2b07aeb1,
+    0x47a4c94d, 0xf0d16be2, 0x91fd763c, 0x5af88695,
+    0x2a9da273, 0x053ab914, 0x61ebe016, 0x10d130ab,
+    0xd34e284a, 0x5099b9c8, 0x6ed4de65, 0xb21a4103,
+    0xf8e85a02, 0x940f3648, 0x555e9ca4, 0x014ff0a9,
+    0x2ebff5ce, 0x656e0598, 0x7cd3977c, 0x7104ded9,
+    0x6385dfe7, 0x9a4c0512, 0x0830e76d, 0x0627be3c,
+    0xb14a50bf, 0xf8c14705, 0x8c3faa7e, 0x3b4a1d7f,
+    0xe6a868a0, 0x84b1e14b, 0x47bc1e4f, 0x7b98a2bb,
+    0xcc803733, 0x0e6df4e4, 0x7958e14d, 0xb751a536,
+    0x5b9871b7, 0xf925771b, 0xe16ed05e, 0xeffa615a,
+    0xc695ddd6, 0x3141411a, 0x61468d10, 0x91eb562a,
+    0xe895df07, 0x6a703f10, 0x01876bd8, 0xfd75f3fa,
+    0x0ce08ffe, 0xeb5b06e7, 0x2783dfee, 0x68f6b854,
+    0x78712655, 0x90c76f8a, 0xf310bf7f, 0xcf5293d2,
+    0xfda45028, 0xfbc8044d, 0x92e40ce6, 0xcbe1feba,
+    0xc0c1ce9f, 0xfd4c1473, 0x7eda11d3, 0x27f187b9,
+    0xd9845057, 0x024cd871, 0xa174d4d3, 0xcf6b116f,
+    0xd279352f, 0xd300b23f, 0x23f12526, 0x364bc658,
+    0x2ab7b709, 0xc7908819, 0xb6bfc532, 0xc2de1fa1,
+    0x4396e4c1, 0xe998ceea, 0x6acea274, 0xfc82ef0b,
+    0x2250e927, 0x230f729f, 0x2f420109, 0xd0b2f94d,
+    0xb38d4966, 0x4305addd, 0x624c3b45, 0x10b838f8,
+    0x58954e7a, 0x7db26366, 0x8b0719e5, 0x97145982,
+    0xd93f535c, 0x64549b3d, 0xa76e5bf3, 0x93978b4d,
+    0x5a01c10e, 0xe2b1f3ee, 0xa9d19ea8, 0x76f210af,
+    0xc4264d57, 0xf04aca7a, 0x483487ba, 0x9f989031,
+    0xe6280f91, 0x84132d01, 0xb3a040cf, 0xf34b31ce,
+    0xeee8cb7e, 0x75cec1ff, 0xf8735fb1, 0x566bf7fa,
+    0x5975d2fd, 0xc360c19a, 0xf075ec6c, 0x93b3ce8d,
+    0x815d65ce, 0x718b6e47, 0xd1c39345, 0x17ec17c1,
+    0x6dac86b0, 0x4a1d862f, 0xe6dfab8e, 0x268c55b1,
+    0xcffcaf2d, 0xb535fd34, 0xa23b8b1b, 0x9c8838df,
+    0xe178f644, 0xb2fb47fd, 0xf5d8be2c, 0x201173f5,
+    0x9968eeee, 0x485e1c8d, 0xf856b514, 0x165d69ea,
+    0x756b5779, 0x17b6206c, 0xafe2ae9a, 0x8dac7611,
+    0xdbdf389d, 0x0c55f223, 0x61eda89e, 0x76030246,
+    0xa1150650, 0x18975ae2, 0xc911375c, 0x77aaebab,
+    0x2fe056e6, 0xedae9ad1, 0x2dde44e4, 0x8aa8f740,
+    0xe2873522, 0x9d288103, 0xfb60cd48, 0xf34aaca7,
+    0x08bdf594, 0xbc7bcc73, 0xa9178a0b, 0x8fec77f2,
+    0x949edfb7, 0x7bb27826, 0xf137d62f, 0x77b0d0c5,
+    0x88f8a9ea, 0x5add7b4b, 0x966cda49, 0x133edfbd,
+    0xeab66f18, 0x0189ca26, 0x55f452b1, 0x40c07b47,
+    0x23369fc9, 0x4bd6b726, 0x53d0b876, 0x57f2929e,
+    0xf2340687, 0xc2d5cba4, 0x4a866aba, 0x96161000,
+    0x2e407a5e, 0x49997bcd, 0x92ddcb24, 0x69ab197d,
+    0x8fe5131c, 0x2cf1f243, 0xcee75e44, 0x7acb9fad,
+    0xb34983b1, 0xfb5f7e26, 0xd3fbb145, 0x7e38e207,
+    0xaf71ed7f, 0xf608ee91, 0x686e5aea, 0x6d78f612,
+    0x607e751e, 0x2f9d2e63, 0x2748ba3b, 0x8607cb37,
+    0xf4fe56a9, 0x006f6d32, 0x6d242b89, 0x2980bd5a,
+    0x23d2d4c0, 0x254e8394, 0x7aea685b, 0xf57f0c91,
+    0x6f75aaea, 0xa60d880f, 0xa333bf5b, 0x24eb9acc,
+    0x1cda5dea, 0xe3de4ccb, 0xc51a6b4f, 0xfeef9341,
+    0x8bac4c4d, 0x743125f8, 0xacd079cc, 0x69f891c5,
+    0x3dba87e7, 0x6384ab74, 0xb78a63ac, 0xe8f20516,
+    0x03fa5c24, 0xc6d198de, 0xb50c2893, 0x7afb3d4f,
+    0x3a4cf320, 0xe4d418b9, 0x4faa9acc, 0xaac22a0e,
+    0x552c1f31, 0x08a7cc67, 0xd6668beb, 0x36009a3a,
+    0xb34d794f, 0x09a16e3b, 0x4e743813, 0x8c3f4a31,
+    0x651c9834, 0xe8a7b747, 0xd2c76536, 0x4667ebb9,
+    0xb8a887ab, 0x1f6884fa, 0xa08df843, 0xd021bc8d,
+    0x55f59432, 0xfc2d4609, 0x38d06677, 0x2d5c1ac7,
+    0xfaecb3e4, 0x1d348841, 0x0406e1ce, 0xe2e6d3b5,
+    0x87679b85, 0x504b9726, 0x78812b43, 0x25279d03,
+    0x56676779, 0x7e329009, 0xb002bcf5, 0xf0184a5b,
+    0xd630da82, 0x49e88336, 0xf08564a7, 0x92d01b0b,
+    0x36cfa9e8, 0x9460f46a, 0x84a462f7, 0x6800b8a8,
+    0xc06a6673, 0x9f5d99a2, 0xb101b4f6, 0x1ab172c7,
+    0x5321c59c, 0xf699c703, 0xed13bc1f, 0x0b9aca14,
+    0xdfaa5eaa, 0x91c6eebb, 0x4f346816, 0x885ae502,
+    0xc9757170, 0xdbdeb29d, 0xcbf1b409, 0x55b5a898,
+    0xa4c0cbd2, 0x01b3dfd4, 0xd97e4324, 0x38611618,
+    0x57bee79e, 0xf3ea3774, 0xbc20e2c6, 0x60941f4e,
+    0x53c47b89, 0x21d8f508, 0xb8f41362, 0x7e7d03d3,
+    0xf202481a, 0xcc38452e, 0xabc96fed, 0x50d19d86,
+    0xc62cd055, 0x83fb2d63, 0x7b81568e, 0xbd6058b0,
+    0x70737bb6, 0x628271f1, 0x83f257d4, 0xc51419ed,
+    0x09ef7dd9, 0x9ee514e4, 0xf8467e37, 0xf78e1fbe,
+    0x339fe5ce, 0x045ef431, 0xd24c26d1, 0xef414a60,
+    0x661f3bbe, 0xc4151215, 0xa31d0a51, 0xca270c0b,
+    0x89d02271, 0x0bddc41d, 0x55b9ae92, 0x5da2412a,
+    0x1b6552cc, 0xe2a468e2, 0x29cbeee5, 0x0920500e,
+    0x92873d50, 0x8272ef36, 0x79cc84d1, 0xe6325d26,
+    0x38675522, 0xd634f48d, 0xe4d5882c, 0x1d96882c,
+    0x5c7604c9, 0x7f0b5356, 0xd43110a3, 0x3c33b393,
+    0x96de3985, 0x4bcb6430, 0x9f50539e, 0x35c125a1,
+    0x8c720a67, 0xbad5f61f, 0x16bfc3dd, 0x2c3c19bc,
+    0x65d64e56, 0x997d4265, 0x49504379, 0xab25034f,
+    0x1410392e, 0x1f6297f6, 0x12e86d68, 0xbef8d14a,
+    0x1dfbd10b, 0xd6405555, 0x0d44fbaa, 0x53cad2bd,
+    0x0d25ca56, 0x60d14d0e, 0xbcf946ff, 0x31cce9a5,
+    0xbef23766, 0x7f2e2c69, 0x0d8e4b51, 0x4e3c677a,
+    0x6bb0d0ce, 0xa7c52eca, 0xd0391ca8, 0x1a2389c8,
+    0x7e8b1d46, 0x41165173, 0xa70684b1, 0x71094b90,
+    0x66554187, 0x76f6c646, 0xd3bac858, 0xde2a1e0e,
+    0xca976e8b, 0xa81f6685, 0xf60c851c, 0x48a9d631,
+    0x336936e6, 0x95a81b38, 0xf7934cbd, 0x588c234f,
+    0x68db8031, 0x5603885c, 0x5c1a48c7, 0x9c777837,
+    0x8709b816, 0xfc9c7afb, 0xd4ab7632, 0xf0190802,
+    0x4c80bd1e, 0x609275b0, 0x3680a202, 0x791851e2,
+    0x5899ef09, 0x0b4fd3fb, 0xacb207b3, 0x53b13f9c,
+    0x7c507f60, 0x3c993d16, 0x8d9e3b7c, 0xf1ef5083,
+    0x0ad2fe5c, 0xf426fe06, 0x9022c4cb, 0xb8746069,
+    0x403efce0, 0xa1f27672, 0x53e2cc9a, 0xc34b4a30,
+    0xd0e57d9f, 0x7e49b3ab, 0x13463806, 0x9906218b,
+    0x8bff74a6, 0x91a140b9, 0xe37c6ea3, 0x52de5611,
+    0xe28b1b92, 0xad1e58c9, 0x77a11d29, 0xbfc3ead0,
+    0xba1de923, 0x9f5d367a, 0xafb30e89, 0xc1ee712f,
+    0x75876ac6, 0x04886f34, 0x54b5c1c3, 0xb1d36d27,
+    0x18cba903, 0xb36b5fd0, 0x696a7139, 0x9b4a54bc,
+    0x519e0427, 0xdb84065d, 0xb863af57, 0xd69dda22,
+    0x6ad4bc18, 0x71bb07b4, 0xc29564f8, 0x41cdad11,
+    0x503cc09b, 0x7272b74c, 0x46ba501d, 0x72e4d2b6,
+    0x5033cca7, 0xf477717d, 0xf3df9d57, 0xfeeec42c,
+    0x57186ac4, 0x435b40ee, 0x97b24f3d, 0xa16130ea,
+    0x453c442e, 0xf2b8c361, 0x647e46e4, 0x532de1cf,
+    0x64ccd9ef, 0xfaf3c94f, 0x182eb339, 0x4e7192ec,
+    0xf2dfea04, 0x45cbeda8, 0x539889dc, 0xcb652c2d,
+    0xd34c847e, 0x8e6576bb, 0xd5de9a09, 0xccaeb5ee,
+    0xbf91842d, 0x604ca87d, 0x7de9e9ed, 0x363b9c74,
+    0x84919f51, 0x20e28af4, 0x7279a592, 0x8ea65e9c,
+    0xadec5331, 0x1df4b333, 0x0b1573df, 0x1b42a7c7,
+    0x55ef6c3c, 0xe9ee350d, 0x058a3ba9, 0xf84a8cad,
+    0xe079d281, 0x5316a4fb, 0x11a280e5, 0xc9bf6f15,
+    0x860e512e, 0x77414a7a, 0xd9430464, 0xb5722bcf,
+    0xfcd817ba, 0x631d68d7, 0x20f282f6, 0xcb8de2d9,
+    0x86af53ca, 0xe3cc6151, 0x609c485f, 0x3cbbe8d7,
+    0x2024de09, 0xed635088, 0x3ed70f65, 0x3b9b4f1c,
+    0x4e292129, 0x9c0b92e3, 0x137df53d, 0x4add5adc,
+    0xecdb4d15, 0x74bad233, 0x1a3d8634, 0x90610274,
+    0x2374f412, 0x12022915, 0x162247d9, 0xc1c05129,
+    0x04b21320, 0x4a49989b, 0xcb478149, 0xda65930f,
+    0x69fb4789, 0xed96215f, 0xad7fccb6, 0x3cfce1cf,
+    0x00687bbd, 0xe454254f, 0xb30413b9, 0x5d96fddd,
+    0x5dee2192, 0x20f89c80, 0x5cfb0642, 0x6919a925,
+    0xe8e3e133, 0x94a30525, 0x68585ed2, 0x66209c61,
+    0x6de12c85, 0x0c904364, 0xf0248824, 0xdac80d74,
+    0xf320f71f, 0x7b7fa943, 0xd5882c26, 0x0a244a2a,
+    0x702476b5, 0xeee44b35, 0xe45c2258, 0x7ed031a0,
+    0xbd6f8514, 0xb422d1e7, 0x5972a107, 0xe51f547c,
+    0xc9cf343d, 0xa25bcd6f, 0x097c184e, 0x8ca922ee,
+    0xa9fe9a06, 0xa62f98b3, 0x25bb1387, 0x1c309a2b,
+    0xc6ee75b0, 0xa352a845, 0x4afafbab, 0x0d667013,
+    0x824a9c3f, 0xf2c9f8cc, 0x6671ea61, 0x1123ced9,
+    0xc4c0426b, 0xe2064c2b, 0x5dda8f0c, 0xae8a4ac7,
+    0x8b03f8d0, 0x4789d01e, 0x2fd8bec7, 0x6d8a6838,
+    0x1967c459, 0x9295dbeb, 0x3472c98e, 0xb0014883,
+    0x08011828, 0xc5049777, 0xa2c4e503, 0x20b87b8a,
+    0xe057c277, 0x3063175d, 0x8fe582dd, 0x1bd53933,
+    0x5f69a044, 0x0d11adef, 0x919776be, 0xf5c6fa49,
+    0xe418daad, 0x27326510, 0x625c8dda, 0x31c73944,
+    0x43030723, 0x32b46d0d, 0xcfd15d0c, 0x39a10292,
+    0x99961dea, 0x1ef74176, 0x175f71ee, 0xa0ba92f0,
+    0x08f50113, 0x33f788b2, 0x71a8271d, 0xfb83754a,
+    0x16898779, 0x60ffee0c, 0xf624c894, 0x07f24f18,
+    0x0adc727d, 0xa3b4c6e6, 0x68229401, 0xbe61fbae,
+    0x634fe770, 0xe7c012bf, 0xbc5336ed, 0x1b4108e0,
+    0x34e57c7e, 0x68a1116b, 0xcd615837, 0x39012ba1,
+    0xbd26c6ae, 0x2c8ca159, 0xcccfc5a6, 0x843d7f20,
+    0x81fbacad, 0x03349ce1, 0x656b250f, 0xeb34ef6f,
+    0x0c299bce, 0x66e79036, 0x4ff14d30, 0xf50639f6,
+    0x1e49dd7a, 0x9b887542, 0xf0b88704, 0xa64bff59,
+    0xb7f335bb, 0x00a5a2c3, 0x48af3a1a, 0x0dfaf15d,
+    0xaae1ae3a, 0x3c0a7831, 0x8cdca788, 0x4832590d,
+    0xecf2985c, 0x9937352d, 0x18129bfb, 0x069199d7,
+    0xd9875fcc, 0xd747e700, 0xbfec3698, 0x0707e099,
+    0x03541f94, 0xb1a8e69a, 0x3dfed107, 0xce50f2c0,
+    0xedd8d48c, 0xe235cb04, 0xd14ff204, 0x06de6b81,
+    0xc4600a5e, 0x5ca05ca3, 0xdd87634b, 0x00aa7aa4,
+    0x4817fb86, 0xc00f85a4, 0xc3977369, 0xdad5c91c,
+    0x0fd59e11, 0x8c944e76, 0x102fad5f, 0x3876cba1,
+    0xd83faa56, 0xa454c3fa, 0x332010b9, 0x1ed7d1b9,
+    0x0024b889, 0xa1011a27, 0xac0cd344, 0x05e4d0dc,
+    0xeb6a2a24, 0x52b520f0, 0x3217257a, 0x3a2b03f0,
+    0xb315365b, 0x0b25c598, 0xa33802f1, 0x4f9fbbf4,
+    0xdf1000b7, 0xf17bbaf7, 0x92ed176a, 0xd7f06111,
+    0xe9aed821, 0xe6d03f9e, 0xc3c2c608, 0x6479a7fb,
+    0x833fe7d0, 0x4d4ad114, 0x5dc730b9, 0x0633f165,
+    0xdf1d043d, 0xf20fc2af, 0xb58d5a62, 0xf330240d,
+    0xa0058c3b, 0xfc7d229c, 0xc78dd9f6, 0x15fee545,
+    0x5bc98cda, 0x501e8288, 0xd046ac04, 0x41ef80e5,
+    0x461210fb, 0x557d9f49, 0xb8753f81, 0x4ab5b6b2,
+    0x8618edf1, 0x9cda05e2, 0xdbf91167, 0xd9bbbdf1,
+    0x5b3f7f24, 0x210e5999, 0x3290e994, 0x5556c6a3,
+    0xfd9d9264, 0xdfa4617f, 0xa4034316, 0x35f67e2c,
+    0xa6f5d2c1, 0xe732b3c2, 0xb6d666f1, 0x6384a08e,
+    0x2dc58892, 0xb2d37da4, 0x03bdeb8d, 0xed936a9c,
+    0x1f8ed30f, 0x13ca866a, 0xe07de033, 0xceedb9c0,
+    0x3e5135b4, 0x88f742d4, 0x0ec7d64c, 0xf329daa7,
+    0x9a484a31, 0x0d463e11, 0x70cdddcf, 0x978e9348,
+    0x8939ca0b, 0xc5d60ab4, 0x9378f406, 0x95adebe4,
+    0x9718f642, 0x097b65a7, 0x8ea4a221, 0x93cb902b,
+    0x7b6d5fdb, 0xf072428c, 0xe51424d6, 0x7c4e4dbb,
+    0x2db584df, 0xeeea7c18, 0xe8141b67, 0xd3b0dc0a,
+    0x8e33832b, 0xc42bb0bd, 0x82b2725c, 0x3b6d0ef3,
+    0x8cfc624b, 0x85918af4, 0x8ee47c9b, 0xdf895bd3,
+    0xc15185f0, 0x8bb5d0bb, 0x585c96b0, 0x819d351a,
+    0x154be8dd, 0x6a83828d, 0xc36963d6, 0x299c4da5,
+    0x289149a5, 0xea4c1463, 0xac879905, 0xf3fcccf2,
+    0xe13a9610, 0x2185dc73, 0xf3cf0208, 0xcd651aa7,
+    0x46927d66, 0xa481d874, 0x28198bba, 0x6a9a3c39,
+    0x3f54042d, 0xfc590faa, 0xb0ee6067, 0x10dd490f,
+    0xaac4170a, 0x9baf4d7a, 0x0d75821e, 0x6da147f0,
+    0x3879d7d8, 0x58e0a73c, 0xa60bcd77, 0x86699898,
+    0x598a46eb, 0xae7cd4da, 0x0187f877, 0x428dede8,
+    0x2af12355, 0x32ca235d, 0xa4b075f4, 0xc0d84aec,
+    0xd35d8953, 0x48ced071, 0x7e1eedbe, 0x867c3459,
+    0x1a074661, 0x36dc5ad7, 0x9e6861cb, 0x939ee1b7,
+    0x5b609c5b, 0x0e5e70eb, 0x28282282, 0xa8796969,
+    0x7ba8bb79, 0xc617bac6, 0x152dae15, 0x194a24f2,
+    0xded33571, 0x39f582c5, 0x91f4fb95, 0x2b9a8ed7,
+    0x82a3ef27, 0x0442464e, 0x87b3fac1, 0xa7e35647,
+    0xa367dea6, 0x005bad87, 0x019da0dd, 0x0f3cdd60,
+    0xa59305ff, 0x306f746a, 0xb2909721, 0x971f1ed8,
+    0xb852cdd7, 0x4511c44c, 0x975b995d, 0xeb6bf1dd,
+    0x572add8d, 0x2601f683, 0xd054b296, 0x21121447,
+    0x42cf0265, 0xf4f62401, 0xe3a79a2a, 0x6467317b,
+    0xaf927b35, 0xf04ed2d1, 0x6534b5a1, 0x8e96e1cf,
+    0xaf4247b2, 0x58adb933, 0x0537352e, 0x48cebf9b,
+    0x966ff1fa, 0x8df30a42, 0xe788e9c4, 0x239e0726,
+    0xd79b48b0, 0x5c6958a2, 0x4e914e8e, 0x22272e55,
+    0x7e106a1f, 0x191cbb75, 0x5f71c539, 0x4f8a6029,
+    0xf7158bea, 0x25b336a3, 0x27774720, 0x2c80a110,
+    0x0a0b4413, 0x14d2f6a4, 0x43d8d04a, 0x13a5bee3,
+    0xe4a44502, 0x93b68c5f, 0x364957b2, 0x5da5d14c,
+    0x26d8258c, 0x75168f8a, 0xeb43c098, 0xb455e8a4,
+    0xb1ebe50c, 0x640614a3, 0x76acaa65, 0x3f805476,
+    0x8b4d91ff, 0x69530604, 0x519859d3, 0x903bb9ea,
+    0x9f5fac7f, 0x93a59e69, 0x390d8900, 0x1df54929,
+    0x8ce5fa33, 0x823dba18, 0x2350281b, 0x5574f271,
+    0x0309488a, 0xf111b200, 0xed2e78be, 0x6dba1852,
+    0xc5f6a056, 0xa848d319, 0x8c4b59c2, 0xf1ae1709,
+    0x881bd57f, 0x757d507b, 0xed484551, 0xd7db6879,
+    0x8529cc2b, 0x0ce00c9c, 0xebd18ac3, 0xfb339802,
+    0x1fc78e0c, 0x250c5af3, 0x04f7fda9, 0x84eeb8e9,
+    0x9ffe80e6, 0xa5a17e06, 0x703285cf, 0xde96f184,
+    0x3fe41e6f, 0xcceabb01, 0x8724d28e, 0x2f674547,
+    0xb8bd6d72, 0x7babf7e2, 0xfcbef7cb, 0x0d6b8ab0,
+    0x19abcaf5, 0x9be634cc, 0x02919487, 0xc0eebac0,
+    0x3bd130b6, 0x9f1bfedd, 0x22d625c1, 0x24dab3a1,
+    0xb4206e3a, 0x46ab327c, 0x555042a3, 0x232d3373,
+    0x0eb9ea81, 0x8ddae1b5, 0xcb9f9e6d, 0xbe1cf505,
+    0xcbcdafe6, 0xe854e0a5, 0x43534d5a, 0xf1e98103,
+    0x340f393c, 0xa7273058, 0x8cfd2794, 0x7329508c,
+    0x538e99cd, 0xe715886a, 0x651e2938, 0x494d5a8f,
+    0x694b2061, 0xe8e08261, 0xc40be3ca, 0x0971a6ff,
+    0x455d0d81, 0x56643934, 0x73f8fcef, 0x10c24d59,
+    0xbb38a630, 0xa612c437, 0x92f1445e, 0x4ef9a80e,
+    0x1ee44719, 0xa9a648e2, 0x0d1dc166, 0x2f62feca,
+    0x97178ba3, 0x69c3d990, 0x9ff67325, 0xec8a3ad8,
+    0x90828f9a, 0x7ce0d6ac, 0x5c9531ce, 0xb2bd1a02,
+    0xbb10ab9d, 0x5c1b4412, 0xaeee4c0e, 0x387518cd,
+    0x98f368aa, 0x87de57ce, 0xbb92be7a, 0x21f57922,
+    0xf1744809, 0x65d54499, 0xd9e3102d, 0x777b407c,
+    0xe746eaa6, 0x09d92a8e, 0x5c0b2593, 0xfe861385,
+    0x658b8eaf, 0x2696f3ff, 0x1a3c51e1, 0x896fcf1c,
+    0xfc538f16, 0x8d8e617e, 0x610922e6, 0x1cd3c38f,
+    0xd6eac1c9, 0x84c50345, 0xa4205d21, 0x61ff42c1,
+    0x8230a9a6, 0x7b741b5d, 0x8bf29bb9, 0xf579deb9,
+    0x98ffd997, 0x39671277, 0xf4fcb1e1, 0x6de16859,
+    0xea723b7f, 0xc6b7a38d, 0xf4fb138f, 0x77d3e0f2,
+    0xa150fa04, 0x9b478f3a, 0x69b0beed, 0x5b961787,
+    0x1d842031, 0x66d0eecb, 0xa5aedbc6, 0xafa9c66e,
+    0xfaad16d1, 0x67515b87, 0x15840989, 0xd827c8b4,
+    0xc8a420ed, 0x5e1b7bb1, 0xdc28e5bd, 0x8ea03cab,
+    0xd45188d7, 0xfc4d874f, 0xc22ecf90, 0x2f661c17,
+    0x328fb9ef, 0xdceafeb7, 0x311cb1f3, 0x3478e062,
+    0x03e042ea, 0xb7fbe79e, 0x28a8a8fb, 0xfb0249aa,
+    0xb8ee1b8b, 0x50b4bb44, 0x3d152813, 0x0e540e9f,
+    0x09aa13a2, 0x48e514e1, 0x9c5fbc3e, 0x172f4633,
+    0xa37cfbfe, 0xdd8d54f8, 0xf8ffb4a9, 0x7b03cdfe,
+    0x24070df5, 0xca347052, 0x99bf4616, 0x0b659251,
+    0xee44254b, 0xce2e30d8, 0x415ba4f1, 0xa45c28fd,
+    0x5e8366aa, 0xcc31d2bf, 0x59b2f313, 0x8e249aeb,
+    0x56f93781, 0x8874151d, 0x22891225, 0x3b208cda,
+    0x53f5b5af, 0x9f9f4b01, 0x457c10bc, 0x60aaa403,
+    0x0300cd5e, 0x52a2bda0, 0xa7436841, 0xe4503bb0,
+    0x7c7158c1, 0xe34045fe, 0x15ac62a9, 0xdca8e0d7,
+    0x9361cf42, 0xa423dc88, 0xca111dd0, 0x25953391,
+    0x4509733e, 0xcd1bf722, 0x5e552eae, 0x62a8f8a7,
+    0x4dfb5704, 0xa6a1a79c, 0xa2abc546, 0x215f2de4,
+    0x4dcca7d6, 0xee3ede74, 0x493ed75f, 0xbbd935cd,
+    0xad8fbf6a, 0x228b7867, 0x49f109d0, 0x2b4dccba,
+    0x6cea145c, 0x2ededda5, 0x052d7980, 0x33ae4c04,
+    0xdf1203af, 0x487e1051, 0x30c418f9, 0x343ed3d8,
+    0x0495ea86, 0x715ad94e, 0xe945824b, 0xc78a5ac5,
+    0x8c935e5f, 0x3680071a, 0xf58543c1, 0x7d764e91,
+    0xee52df5e, 0x4db687f0, 0xfecf1d1d, 0x7ead1e20,
+    0x5fe9a684, 0x453cb994, 0xb65bb00a, 0x1ca6c43f,
+    0xd51630d5, 0x99039a8a, 0x97c7d645, 0x0ca741ed,
+    0xf45be76b, 0x614e1441, 0x177d8e3d, 0xa5ef3ec0,
+    0x45e70812, 0xe3662065, 0xa25ebc68, 0x05d525ac,
+    0x916e827a, 0x11c3041b, 0x868bc04c, 0x7d5ab00a,
+    0x1e80ea45, 0x129f80b1, 0x82ab5457, 0x663c8854,
+    0xc4268106, 0x0ea0ef30, 0x9827ed70, 0x9037b2f3,
+    0x583f6310, 0xc3db4e2f, 0x2ab10678, 0x10a3f54b,
+    0x706e16c5, 0x7097dd2b, 0xaf165242, 0xd4770a89,
+    0x370e1411, 0x9514515e, 0x0da518ef, 0xad237305,
+    0x1c86789a, 0x1f5ba028, 0xa557050d, 0x53c33fab,
+    0x401788b3, 0x41d49663, 0xa1636f3b, 0x37fbf41e,
+    0x0f7b0609, 0x07763b95, 0xacaa8d51, 0xbf50bc02,
+    0x6e61b1c6, 0xc2a5c173, 0xf46a6605, 0xa9116c70,
+    0x336f30c4, 0x5999001a, 0x504b641a, 0x4d8b3c3b,
+    0x31696b82, 0x3a1a5507, 0xe650fe2b, 0x605a5fd0,
+    0x4624ad94, 0xe45bcf34, 0x42ff1bcf, 0x360522e1,
+    0x0583b20b, 0x0ec6913b, 0xa3e4a361, 0x87004ddc,
+    0xb029d3d7, 0x94b476bc, 0x8883a492, 0x355100cb,
+    0x82e9a1db, 0x1c540464, 0xdb0836b1, 0xe35df7eb,
+    0x6ba5ddb7, 0x2db5a7f5, 0x72ef8a86, 0x921bc05b,
+    0x8ddcd14f, 0xd697f63e, 0x19352ce1, 0x0646fe17,
+    0x18ac6f86, 0x63dfc0b7, 0xd0531de8, 0xe2fb9537,
+    0xd0136ae3, 0x481eaf13, 0x8e4bd2f7, 0xe01af14a,
+    0x88f974ec, 0x49ee4f9f, 0x92aef323, 0xd764a4c6,
+    0x1e03afa9, 0x443cb43f, 0x736e1021, 0xc0c7bf9e,
+    0x9bb57932, 0x72f792d1, 0x0514514c, 0x1bed9845,
+    0x44c50cb7, 0xa4eb06a6, 0x4efdcedd, 0x8254b868,
+    0xc9dadade, 0x47bb74d9, 0xb3d95615, 0x2d48e4ec,
+    0xc15aa29f, 0xadfc9cf1, 0x78462b89, 0x0cba2046,
+    0x479f4bfe, 0x9b0d9abb, 0x5e3c4768, 0x3e790d21,
+    0x375c643c, 0xa3ad44cd, 0x6ac0dc43, 0x9dfbbb65,
+    0x55c762ec, 0xda6ffb79, 0xde78a5e1, 0x12294f31,
+    0x4d704863, 0x0ae22c68, 0x6c18c02e, 0x61114035,
+    0xd96dd1ed, 0x2360d888, 0x0a936c6b, 0x1b99cc55,
+    0x8609f93f, 0x4372a3f5, 0x4dc993c4, 0x0afc214a,
+    0xa6bf396f, 0xba08d6c7, 0xaf2235e2, 0xa6d44568,
+    0xbdec43ed, 0xe3e1c378, 0xd9ca7e1d, 0x00b80a92,
+    0xc7ab8183, 0x06750a2a, 0x97f4eb7b, 0x042dd3d6,
+    0x3d0efa7a, 0x4cc4d792, 0xd9793753, 0xff36e487,
+    0x4e06e132, 0x104dff63, 0x6d1706fe, 0x9773ae26,
+    0x3ffebb01, 0x97299181, 0xdfc694ff, 0x59006dc6,
+    0xdc0b1061, 0x2ffbcf19, 0x139ad48c, 0x846730ad,
+    0x12ca3c26, 0xcbbd5f20, 0x8855a59a, 0xebc3d35e,
+    0x5b93e742, 0x18644a97, 0xf8f4be3a, 0x0da658f5,
+    0x3fe32589, 0x4b3c3785, 0x61ce3030, 0x5290bec1,
+    0x3df40f6f, 0xe6fad49d, 0xcca526f5, 0x885dd6df,
+    0x4a1807a1, 0xc0b00e7c, 0x3404d5a1, 0x3fecd70b,
+    0x6782d8d7, 0xe77bfe48, 0x7155ec7d, 0x54ab18c9,
+    0xb3202407, 0x77cdb71f, 0x67ba5604, 0x8441556c,
+    0xe9d78dd4, 0x38694e01, 0xb58c2f9b, 0xf84fbbfb,
+    0xa234c73f, 0x3bd303d3, 0xff16883f, 0x82396be5,
+    0xe886df4e, 0x56ecf3fd, 0x817255a6, 0xcad118bd,
+    0x1aa338db, 0xba6926ba, 0xaa1981ff, 0x2a677961,
+    0x05f4cc58, 0x75a1590c, 0xa69f58c8, 0x43f076bc,
+    0x79786c3a, 0x8ada939b, 0x95a50c0a, 0x3a758d61,
+    0xba2155ef, 0x22348461, 0xebfe41ad, 0x5985f593,
+    0x91fb5cf7, 0xadffad55, 0xe54e241c, 0xb8891adc,
+    0x24fc05cd, 0x18115178, 0x092d97be, 0x2c73fd44,
+    0x2bebb106, 0x5b5a8cba, 0xee17d82a, 0x017cc283,
+    0x42ee8fdb, 0x19974730, 0x89433e44, 0xf16121e8,
+    0xa2ff19e7, 0x760eaad5, 0xa1ec8caa, 0xd71a2864,
+    0x7f42a1bf, 0x26f1caf3, 0x82f27586, 0xcabd266e,
+    0x6af484f4, 0x0971375b, 0x0a43e6fa, 0xabf356cc,
+    0x91c5e0f8, 0xc7b50396, 0x3a8efac5, 0xbaf618fe,
+    0x15a2316f, 0xcb21fe99, 0x0f2635d3, 0x1565ca3b,
+    0x79fb664d, 0x01babf6d, 0xb9659aa1, 0xa14b4ab5,
+    0xb64daa60, 0x6fe4c1bd, 0x938edb85, 0xea4b209d,
+    0x3290b2f4, 0xe322af73, 0x292af72e, 0x4bacded7,
+    0xb1e09d85, 0xf01824e4, 0xcaa001b1, 0x485c0038,
+    0x7c092020, 0x954e5fa8, 0x99a7318d, 0x06591ec9,
+    0x6fc3ea5b, 0xc3506151, 0xda3e40c7, 0xcfb13598,
+    0x826f6eb1, 0xb447cc06, 0xcc4b15bb, 0xb9176be6,
+    0xc61599ec, 0x0204e321, 0x4e9fce6b, 0x66512cbd,
+    0x6891ea5a, 0xf59ca041, 0x5a12f3c8, 0xac0d2cc0,
+    0xefadecb4, 0x2f827232, 0xc3a86505, 0x743a048f,
+    0xf9aa9765, 0xd0154838, 0x11fedb76, 0xa548e7ec,
+    0x61e77c87, 0x10a67ed6, 0x5e165be4, 0xa4394d9e,
+    0x012ddf9f, 0x2798852b, 0xbf4fcb96, 0xd5539be9,
+    0xb08c6b69, 0x198a79b9, 0xa37060d9, 0xe23bd3cb,
+    0x68a6a401, 0xcc7f52c9, 0x57091704, 0xdf697f4b,
+    0x7514abbe, 0xc429b0b8, 0x3212ca5b, 0x9dfd8b3f,
+    0x84a74d26, 0x4c82a438, 0xdc49feee, 0x94fc7759,
+    0x73af33a7, 0xa604d0ca, 0x99993f69, 0xa2028cc5,
+    0x733d26c8, 0x06d21477, 0x3704942e, 0x97ea2867,
+    0xf123fe2d, 0x26fd5fb5, 0x62c4c70e, 0x19d166cc,
+    0xabbfe286, 0x4af25ce1, 0xfcdeed1a, 0xa53341c7,
+    0xcd20e76d, 0xcb1d3464, 0x4ab23d35, 0x56decf3e,
+    0xe524aafb, 0xdd832027, 0x05a43863, 0xee102be5,
+    0xd463f935, 0xf9a6bffa, 0x44f43b95, 0xc49eae38,
+    0x8b894f9b, 0x59e60bd8, 0xb510a245, 0x77c0a893,
+    0xac45e9f3, 0xf6133ded, 0x7e0a7bba, 0x7f88fc4e,
+    0x751bb0fd, 0x8c615daa, 0x5623e6e8, 0x64ba7615,
+    0x4bd8deac, 0xf6bf0161, 0x3997b513, 0x68c635f0,
+    0xe7753698, 0x8d15f49d, 0x166245dd, 0xb1d6f20c,
+    0x92eea7b3, 0x998ac40b, 0x0c3c0922, 0xe5c81e0b,
+    0x85a9e76a, 0xf65ca633, 0x88a56acd, 0x2779b4b3,
+    0xeefb0c07, 0x405ba189, 0xa7d62d55, 0x6591e281,
+    0x6bd408b4, 0x48c896d1, 0x9c6baf95, 0x47ce08a1,
+    0xa887eebc, 0x4f4ddce9, 0xae7398d9, 0x0447f868,
+    0x9cbaa537, 0xb70895fe, 0xe15eff33, 0xdc935601,
+    0xa2a7c433, 0x035c1d08, 0xf0fb4cac, 0x5f37ccef,
+    0xa47c229b, 0xf5a4aa87, 0x1136ee1b, 0x19dc19b9,
+    0x51e08c26, 0x1d5ded4c, 0x4f85d804, 0x41ab4614,
+    0x738106ca, 0xf02dd1d4, 0x2ab68aff, 0x20cc8ff4,
+    0x3c3ce367, 0xc1c053e7, 0x33f9e08d, 0x48517644,
+    0xb7f6be1f, 0x1e3081ab, 0x0d8a6fb0, 0xd7768c94,
+    0x31905283, 0x70e00c75, 0xae64d738, 0xa176c395,
+    0x1fa3578c, 0x9e5850bc, 0x611fe506, 0x087565ce,
+    0x9feeea5c, 0x51ab984b, 0x947b45f1, 0x9ebdec88,
+    0xb792fbec, 0x587c5da0, 0xee9e8acb, 0x5986356b,
+    0x24e55c73, 0xfaa63b4d, 0x4c985649, 0xcefb8440,
+    0x540926df, 0x1c20fe34, 0x79c38de9, 0x6204487e,
+    0x5881270e, 0x7b5348a9, 0x0767a863, 0xa40c8baf,
+    0xdc53717d, 0x4f0ec8f0, 0xebb3b85e, 0x42fc6006,
+    0x067977ff, 0x95f962d2, 0xd50ae583, 0x6194bdd5,
+    0x2c4fa8aa, 0x76c2178c, 0x3abf1768, 0x35277d4f,
+    0xe5e8d851, 0x4a22db58, 0xbf903362, 0xaf64998d,
+    0x7fbef628, 0xc3c2b412, 0x0008abb4, 0xa69c7756,
+    0xdd3a1376, 0x3f52438e, 0x7688a086, 0x3a6f4c49,
+    0x126f5476, 0x8dca1641, 0x5e790b59, 0x7de645ce,
+    0x45125197, 0x5b51a327, 0xf79973fb, 0x796aba23,
+    0xb78a0575, 0x06129252, 0x031e9f63, 0x6cb9019d,
+    0x01f22992, 0x03928544, 0x6eca6194, 0xda7fa95f,
+    0x6346268c, 0x5abf16bb, 0x8ec5dca6, 0xac24e560,
+    0xbc92bc35, 0x72889d45, 0xbbd19859, 0x2c2efedb,
+    0xd347feca, 0x89eb1b96, 0xcda31e4a, 0xc8c78f4f,
+    0x9b5ebee5, 0x9948cc8c, 0x6f69b457, 0x56952543,
+    0xdaa7367a, 0x6a3b3ef7, 0x3eae86cd, 0x2becf2d4,
+    0x8a9bcb17, 0x663509a6, 0xbbbbc36e, 0xc670543e,
+    0x28bc89e8, 0x7b292496, 0x376de4ad, 0xb1ac125e,
+    0xf591522e, 0x4736603b, 0x7c775b6b, 0x9c2c6267,
+    0x8e2a143b, 0xca91de65, 0xdc7ab49b, 0x2a626e93,
+    0xe7fbc78f, 0x86320365, 0x6df16f90, 0x9ddcadc5,
+    0x9099b9c9, 0x4131bfd0, 0xeb850dda, 0x3bf11e70,
+    0xb34f5321, 0x422705c3, 0x082e4d79, 0x21ba3c52,
+    0xe427ebe9, 0x76a27c83, 0x5eeb87b8, 0x2e1d8cd4,
+    0x72955119, 0xecfaa6e5, 0x077cbc91, 0xa2d7916c,
+    0x3581c6cd, 0x8cbe4d6e, 0xfd43f5ec, 0x5f07093e,
+    0xb1571512, 0x2fff27f8, 0x976d2d4b, 0x3d5929b3,
+    0x00b64b81, 0x171dc0c2, 0xf03fcd1e, 0x36f4b114,
+    0x97a014f4, 0x11451b78, 0xb73f2090, 0x277fa77b,
+    0xaf5cab24, 0x6fcde854, 0x467a04b7, 0xd4e8aa74,
+    0x7bcf3d2c, 0x14d14d59, 0xa0abcaae, 0xc56d84f7,
+    0xe9ec1dd7, 0x937608b1, 0x867114f6, 0xdf5054eb,
+    0x6ddf93a6, 0x6b013bc5, 0xdd3e48fc, 0x5bff4f05,
+    0xe8eb9fa6, 0xa6874da5, 0x5d53d5d9, 0x8717f1d9,
+    0xe775420a, 0x7255dc15, 0xd119777e, 0x71cd2638,
+    0xaca9fc16, 0xed636262, 0x6937763b, 0x5171c1f7,
+    0x037ec77b, 0x1bf18c1d, 0xbf3b8213, 0x63b482de,
+    0x7d6de321, 0x0bc91e66, 0x7469772e, 0xfae8dd8f,
+    0x4ef060b6, 0x61eaa825, 0xddb31399, 0xf46bad95,
+    0xc21213c9, 0x92708587, 0x7d09eb1c, 0x11d287d0,
+    0x6ea52f68, 0xa79815d8, 0xeddb10a7, 0xb54bb792,
+    0x636d0ae6, 0x2d7c4576, 0x7fcbeeec, 0x4b387e0b,
+    0x103707cb, 0xa3f9a9d0, 0x1398a20c, 0xd20da011,
+    0x77bb0455, 0xfd1fac78, 0x8afbe9ce, 0x5cc544d7,
+    0x78baca74, 0x15846d91, 0x4901dd7d, 0x30271d42,
+    0x4b037401, 0xee0af6df, 0xf4b85d2d, 0x55cd3618,
+    0x493fb0dc, 0x4ea35646, 0x81bd0405, 0xadfceaf6,
+    0x5b1ddf0d, 0x342df99f, 0x605d3bb9, 0x2fe483a7,
+    0x639e33d9, 0xdaadd46a, 0x91623d28, 0x9b4daab1,
+    0x03c5178a, 0xe7980bd9, 0x72f35b9c, 0x4a5ed035,
+    0x32ed344c, 0x5c0945c0, 0x92a40b28, 0xdcd9f5eb,
+    0x51e6c89a, 0x58d2fb9b, 0x75ddbbba, 0x3f2bbaf8,
+    0xffb0a284, 0x4ab9791c, 0x7bad9a46, 0xe12ec09a,
+    0x0b89d4bd, 0x048df69b, 0xb70fba85, 0x222888ef,
+    0xcce017f6, 0x44a0c5f6, 0xc264855c, 0xebc469d8,
+    0xd7cb56bb, 0xb6420b9d, 0xea5f6aec, 0x24f72349,
+    0x86efe6a9, 0xe35956d8, 0x4b12634f, 0xbae5fb78,
+    0x7bca0bc1, 0x1bcb36a5, 0xc6ad55f1, 0xdadf6dce,
+    0x6080e0f8, 0x9de1e8e7, 0xb2567ac5, 0x681d6be2,
+    0x763f4fcb, 0xdeb1edd4, 0xe58790f1, 0x2a6a766e,
+    0xcf14e1b0, 0x263f2166, 0xc48087f3, 0x1dfcab92,
+    0x778189c5, 0xc0c38d52, 0xa201226f, 0x68f81bc5,
+    0x35e974ba, 0x890e8ba3, 0x9b23a1d3, 0xb6634418,
+    0xda3b7af3, 0x7cde9e81, 0x6ca457e4, 0xd7e854a2,
+    0x8e7a3d5e, 0x6d2992bc, 0xd1da4558, 0xc85b3262,
+    0xee5df4eb, 0x32fb658a, 0x75a1aea2, 0x9c82e929,
+    0x90638f38, 0x5079da88, 0x5a2cc1f6, 0xac9d5b23,
+    0xa4b6436b, 0x4c315413, 0xe22c0b32, 0x183b4444,
+    0x81769921, 0xffd20056, 0x8dbb9503, 0x6cbb0b44,
+    0xde1300a9, 0x61f97d99, 0x83953873, 0x41841225,
+    0xdb0c465c, 0x9f249e32, 0xdc2447be, 0xefa5ceed,
+    0x6c191d51, 0x9ab30d9a, 0x9005b6a4, 0xdbf4dded,
+    0x00e670fe, 0x90bd6b03, 0xc8efd72e, 0x2b961781,
+    0x96409eb3, 0x02ac3618, 0x4ac5731b, 0xa9040e46,
+    0x80e8987a, 0x00744fb8, 0xc571fb67, 0x37b726d8,
+    0x7d57d0f1, 0x2ad96a5a, 0x0a8ef52a, 0xdc59d323,
+    0x751b6beb, 0xa9e01754, 0x49e1c809, 0xbf0df92f,
+    0x39f81c9e, 0xe86e9a3d, 0x7783946a, 0xb47a9004,
+    0x541cb355, 0x72ba430f, 0xac3fdf37, 0x5b8ee3fa,
+    0x635ae687, 0xdf371fda, 0xd30bc7d3, 0x75429f37,
+    0x0a90fb23, 0xc0d58d9b, 0xac1d5e95, 0x59575436,
+    0x0c6ce683, 0xb5d21d64, 0x08076b0a, 0xeaa6f725,
+    0x8646fbec, 0x081d887c, 0x5af13ff5, 0x9cba423e,
+    0xf54fc3c0, 0x9bb2fc49, 0x26c5c719, 0x79f37273,
+    0x15cdf0ae, 0x05af002f, 0x2aa017e0, 0x7562190a,
+    0x05a0af19, 0x64777efc, 0x6292ac20, 0xc3cda2ed,
+    0x640d9419, 0xf25592e5, 0xb4bb2e1f, 0x5308b91d,
+    0xbf1444ce, 0xbc5d3721, 0xed42874a, 0xe4b6bd8c,
+    0xabae0290, 0x2d50b9af, 0x47c018ab, 0x6b64bf26,
+    0xb376ce56, 0x580e9c32, 0x9fd6e193, 0x7d700ee2,
+    0x1eec566b, 0x12bd427a, 0x61ea45a6, 0xe9f73a45,
+    0x08490971, 0x55617aa8, 0xdbca1ad2, 0x4a5aa3ab,
+    0x8384b6ac, 0x58beb1a6, 0x07e4444c, 0x76323ee2,
+    0x0c4a3b64, 0xe88f54d3, 0xce1c832d, 0xf7615b0d,
+    0x973d58fe, 0x2f67adb0, 0xc3cef173, 0xb2871e1c,
+    0x7a97569e, 0xed83d2a2, 0xab59d53a, 0xd11912b4,
+    0xa435918d, 0x10764c79, 0xef2764c3, 0xca537a69,
+    0x90125dee, 0x94d56bc8, 0xe778a787, 0xb531f3b8,
+    0xaf58f361, 0x3bd55133, 0xe15c70e5, 0xfe17e49f,
+    0xc6f1d920, 0xdd93b546, 0x36ccb9f9, 0x0c5ff33b,
+    0x28f1575f, 0x43aca5e6, 0x5c274ad0, 0xa55b4f60,
+    0x06589232, 0x5a6fda9d, 0x560e6363, 0x967f03d6,
+    0x6176fe56, 0x8913e989, 0x543db0ef, 0xacb44d40,
+    0x8e895b40, 0xab0e252a, 0xd42959e6, 0xab32c974,
+    0x44a05ad1, 0xbc3f7e15, 0x6511572e, 0x65271ba1,
+    0xbcd91c45, 0xfcf99e08, 0xaca75397, 0xef84f18b,
+    0x6e525d1f, 0x15464f30, 0x425d091f, 0x0d216a15,
+    0x0ac21d69, 0x1f87dcaf, 0x67416519, 0xaab24306,
+    0x7f5d18f8, 0x1768a8b8, 0xc40a8c75, 0xce3e7c99,
+    0x37b6d3ee, 0x4f31f586, 0x74ac2be8, 0x4f6a0343,
+    0xc47589cc, 0x6cb479f4, 0xc8dea1b6, 0x34f06e15,
+    0x053e171b, 0xe091b4dd, 0x240fdd1f, 0x6989fd6d,
+    0x9ff2123f, 0xde25a063, 0x513a6da1, 0x0e04bcc9,
+    0xe9343616, 0x64981b01, 0xcb86e631, 0x90502cbc,
+    0x86a5defc, 0x44e595ec, 0xc5f1c69e, 0x5684a676,
+    0xc2d85a87, 0xe4b9d8cf, 0x5ccd436b, 0xa9cd9009,
+    0x3d913783, 0x33195343, 0x0ac25661, 0x949349c5,
+    0x564efa22, 0x2be3f5f5, 0x1ee27deb, 0xc5f4cef5,
+    0x0e25bd0d, 0x3b239e56, 0x9bf10706, 0xdaf3f4f1,
+    0x5b919a7d, 0x788294b5, 0xbf83cb15, 0x1bc79c9e,
+    0x1e312dcb, 0xe0642403, 0x051194cd, 0x7ffa38df,
+};
+#else
+#error "Unsupported MCUBOOT_ECDSA_P256_COMB_TEETH"
+#endif
+
+#endif /* __BOOTUTIL_CRYPTO_ECDSA_P256_COMB_H_ */
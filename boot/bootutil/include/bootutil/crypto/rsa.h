@@ -57,6 +57,9 @@
 #endif
 #endif /* BOOTUTIL_CRYPTO_RSA_CRYPT_ENABLED */
 #include "mbedtls/asn1.h"
+#if defined(BOOTUTIL_CRYPTO_RSA_SIGN_ENABLED) && defined(MCUBOOT_RSA_MONT_CONSTANTS)
+#include "bootutil/crypto/rsa_mont.h"
+#endif
 
 #endif /* MCUBOOT_USE_MBED_TLS */
 
@@ -349,6 +352,28 @@ static inline int bootutil_rsa_public(bootutil_rsa_context *ctx, const uint8_t *
 {
     return mbedtls_rsa_public(ctx, input, output);
 }
+
+#if defined(MCUBOOT_RSA_MONT_CONSTANTS)
+/*
+ * Same as bootutil_rsa_public(), using R^2 mod N and -N^-1 mod 2^32 that
+ * were precomputed for the modulus instead of having Mbed TLS derive them.
+ * Keys that the Montgomery code does not handle go through Mbed TLS.
+ */
+static inline int bootutil_rsa_public_mont(bootutil_rsa_context *ctx, const uint8_t *rr,
+                                           uint32_t n0, const uint8_t *input, uint8_t *output)
+{
+    uint8_t n[BOOTUTIL_RSA_MONT_MAX_LEN];
+    size_t len = mbedtls_rsa_get_len(ctx);
+
+    if (len > sizeof(n) || len % 4 != 0 ||
+        mbedtls_mpi_cmp_int(&ctx->MBEDTLS_CONTEXT_MEMBER(E), 65537) != 0 ||
+        mbedtls_mpi_write_binary(&ctx->MBEDTLS_CONTEXT_MEMBER(N), n, len) != 0) {
+        return mbedtls_rsa_public(ctx, input, output);
+    }
+
+    return bootutil_rsa_mont_public(n, rr, n0, input, output, len);
+}
+#endif /* MCUBOOT_RSA_MONT_CONSTANTS */
 #endif /* BOOTUTIL_CRYPTO_RSA_SIGN_ENABLED */
 
 #endif /* MCUBOOT_USE_MBED_TLS */
@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * RSA public key operation, output = input^65537 mod N, done with
+ * Montgomery multiplications on 32-bit limbs. R^2 mod N and -N^-1 mod 2^32
+ * are taken from the caller (imgtool emits them next to the public key), so
+ * that nothing has to be derived from the modulus at boot.
+ *
+ * All numbers are big endian byte strings of the modulus length, which has
+ * to be a multiple of 4 bytes; R is 2^(8 * length). The operation works on
+ * public data only and is not constant time.
+ */
+
+#ifndef __BOOTUTIL_CRYPTO_RSA_MONT_H_
+#define __BOOTUTIL_CRYPTO_RSA_MONT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Largest supported modulus, in bytes. */
+#define BOOTUTIL_RSA_MONT_MAX_LEN   (3072 / 8)
+#define BOOTUTIL_RSA_MONT_MAX_LIMBS (BOOTUTIL_RSA_MONT_MAX_LEN / 4)
+
+static inline void
+bootutil_rsa_mont_load(uint32_t *x, const uint8_t *be, size_t limbs)
+{
+    const uint8_t *p = be + limbs * 4;
+    size_t i;
+
+    for (i = 0; i < limbs; i++) {
+        p -= 4;
+        x[i] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+               ((uint32_t)p[2] << 8) | p[3];
+    }
+}
+
+static inline void
+bootutil_rsa_mont_store(uint8_t *be, const uint32_t *x, size_t limbs)
+{
+    uint8_t *p = be + limbs * 4;
+    size_t i;
+
+    for (i = 0; i < limbs; i++) {
+        p -= 4;
+        p[0] = (uint8_t)(x[i] >> 24);
+        p[1] = (uint8_t)(x[i] >> 16);
+        p[2] = (uint8_t)(x[i] >> 8);
+        p[3] = (uint8_t)x[i];
+    }
+}
+
+/* Returns non-zero if a >= n. */
+static inline int
+bootutil_rsa_mont_ge(const uint32_t *a, const uint32_t *n, size_t limbs)
+{
+    while (limbs-- > 0) {
+        if (a[limbs] != n[limbs]) {
+            return a[limbs] > n[limbs];
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * out = a * b / R mod n, for a, b < n (CIOS method). out may alias a or b.
+ */
+static inline void
+bootutil_rsa_mont_mul(uint32_t *out, const uint32_t *a, const uint32_t *b,
+                      const uint32_t *n, uint32_t n0, size_t limbs)
+{
+    uint32_t t[BOOTUTIL_RSA_MONT_MAX_LIMBS + 2];
+    uint64_t acc;
+    uint32_t m;
+    uint32_t borrow;
+    size_t i;
+    size_t j;
+
+    for (j = 0; j < limbs + 2; j++) {
+        t[j] = 0;
+    }
+
+    for (i = 0; i < limbs; i++) {
+        acc = 0;
+        for (j = 0; j < limbs; j++) {
+            acc += (uint64_t)a[j] * b[i] + t[j];
+            t[j] = (uint32_t)acc;
+            acc >>= 32;
+        }
+        acc += t[limbs];
+        t[limbs] = (uint32_t)acc;
+        t[limbs + 1] = (uint32_t)(acc >> 32);
+
+        m = t[0] * n0;
+        acc = ((uint64_t)m * n[0] + t[0]) >> 32;
+        for (j = 1; j < limbs; j++) {
+            acc += (uint64_t)m * n[j] + t[j];
+            t[j - 1] = (uint32_t)acc;
+            acc >>= 32;
+        }
+        acc += t[limbs];
+        t[limbs - 1] = (uint32_t)acc;
+        t[limbs] = t[limbs + 1] + (uint32_t)(acc >> 32);
+    }
+
+    /* t < 2n here; one subtraction brings it below n. */
+    if (t[limbs] != 0 || bootutil_rsa_mont_ge(t, n, limbs)) {
+        borrow = 0;
+        for (j = 0; j < limbs; j++) {
+            acc = (uint64_t)t[j] - n[j] - borrow;
+            t[j] = (uint32_t)acc;
+            borrow = (uint32_t)(acc >> 32) & 1;
+        }
+    }
+
+    for (j = 0; j < limbs; j++) {
+        out[j] = t[j];
+    }
+}
+
+/*
+ * output = input^65537 mod n, where rr = R^2 mod n and n0 = -n^-1 mod 2^32.
+ *
+ * Returns 0 on success, -1 if the length is not supported or if input is
+ * not smaller than n.
+ */
+static inline int
+bootutil_rsa_mont_public(const uint8_t *n_be, const uint8_t *rr_be,
+                         uint32_t n0, const uint8_t *input, uint8_t *output,
+                         size_t len)
+{
+    uint32_t n[BOOTUTIL_RSA_MONT_MAX_LIMBS];
+    uint32_t x[BOOTUTIL_RSA_MONT_MAX_LIMBS];
+    uint32_t y[BOOTUTIL_RSA_MONT_MAX_LIMBS];
+    size_t limbs = len / 4;
+    int i;
+
+    if (len == 0 || len % 4 != 0 || len > BOOTUTIL_RSA_MONT_MAX_LEN) {
+        return -1;
+    }
+
+    bootutil_rsa_mont_load(n, n_be, limbs);
+    bootutil_rsa_mont_load(x, input, limbs);
+    if ((n[0] & 1) == 0 || bootutil_rsa_mont_ge(x, n, limbs)) {
+        return -1;
+    }
+
+    /* y = x * R mod n, then y = x^65536 * R mod n by 16 squarings. */
+    bootutil_rsa_mont_load(y, rr_be, limbs);
+    bootutil_rsa_mont_mul(y, y, x, n, n0, limbs);
+    for (i = 0; i < 16; i++) {
+        bootutil_rsa_mont_mul(y, y, y, n, n0, limbs);
+    }
+
+    /* Multiplying by x, which is not in Montgomery form, drops the R. */
+    bootutil_rsa_mont_mul(y, y, x, n, n0, limbs);
+    bootutil_rsa_mont_store(output, y, limbs);
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOTUTIL_CRYPTO_RSA_MONT_H_ */
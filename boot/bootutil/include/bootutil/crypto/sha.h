@@ -41,7 +41,14 @@
     #error "One crypto backend must be defined: either CC310/MBED_TLS/TINYCRYPT/PSA_CRYPTO/CUSTOM_CRYPTO"
 #endif
 
-#if defined(MCUBOOT_SHA512)
+#if defined(MCUBOOT_BLAKE2S)
+    #if defined(MCUBOOT_SHA512) || defined(MCUBOOT_SIGN_EC384) || \
+        defined(MCUBOOT_SIGN_RSA) || defined(MCUBOOT_SIGN_PURE)
+        #error "MCUBOOT_BLAKE2S can not be combined with the selected signature or hash"
+    #endif
+    #define IMAGE_HASH_SIZE (32)
+    #define EXPECTED_HASH_TLV IMAGE_TLV_BLAKE2S
+#elif defined(MCUBOOT_SHA512)
     #define IMAGE_HASH_SIZE (64)
     #define EXPECTED_HASH_TLV IMAGE_TLV_SHA512
 #elif defined(MCUBOOT_SIGN_EC384)
@@ -95,13 +102,52 @@
     #include <cc310_glue.h>
 #endif /* MCUBOOT_USE_CC310 */
 
+#if defined(MCUBOOT_BLAKE2S)
+    #include "bootutil/crypto/blake2s.h"
+#endif /* MCUBOOT_BLAKE2S */
+
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#if defined(MCUBOOT_USE_PSA_CRYPTO)
+#if defined(MCUBOOT_BLAKE2S)
+
+/*
+ * The image digest, and with it the key hash, is BLAKE2s whatever crypto
+ * backend is used for the signature.
+ */
+typedef bootutil_blake2s_context bootutil_sha_context;
+
+static inline int bootutil_sha_init(bootutil_sha_context *ctx)
+{
+    bootutil_blake2s_init(ctx);
+    return 0;
+}
+
+static inline int bootutil_sha_drop(bootutil_sha_context *ctx)
+{
+    (void)ctx;
+    return 0;
+}
+
+static inline int bootutil_sha_update(bootutil_sha_context *ctx,
+                                      const void *data,
+                                      uint32_t data_len)
+{
+    bootutil_blake2s_update(ctx, data, data_len);
+    return 0;
+}
+
+static inline int bootutil_sha_finish(bootutil_sha_context *ctx,
+                                      uint8_t *output)
+{
+    bootutil_blake2s_finish(ctx, output);
+    return 0;
+}
+
+#elif defined(MCUBOOT_USE_PSA_CRYPTO)
 
 typedef psa_hash_operation_t bootutil_sha_context;
 
@@ -209,7 +255,7 @@ static inline int bootutil_sha_finish(bootutil_sha_context *ctx,
 
 #endif /* MCUBOOT_USE_MBED_TLS */
 
-#if defined(MCUBOOT_USE_TINYCRYPT)
+#if defined(MCUBOOT_USE_TINYCRYPT) && !defined(MCUBOOT_BLAKE2S)
 #if defined(MCUBOOT_SHA512)
 typedef struct tc_sha512_state_struct bootutil_sha_context;
 #else
@@ -252,9 +298,9 @@ static inline int bootutil_sha_finish(bootutil_sha_context *ctx,
     return tc_sha256_final(output, ctx);
 #endif
 }
-#endif /* MCUBOOT_USE_TINYCRYPT */
+#endif /* MCUBOOT_USE_TINYCRYPT && !MCUBOOT_BLAKE2S */
 
-#if defined(MCUBOOT_USE_CC310)
+#if defined(MCUBOOT_USE_CC310) && !defined(MCUBOOT_BLAKE2S)
 static inline int bootutil_sha_init(bootutil_sha_context *ctx)
 {
     cc310_sha256_init(ctx);
@@ -282,7 +328,7 @@ static inline int bootutil_sha_finish(bootutil_sha_context *ctx,
     cc310_sha256_finalize(ctx, output);
     return 0;
 }
-#endif /* MCUBOOT_USE_CC310 */
+#endif /* MCUBOOT_USE_CC310 && !MCUBOOT_BLAKE2S */
 
 #ifdef __cplusplus
 }
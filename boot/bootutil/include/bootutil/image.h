@@ -101,6 +101,7 @@ extern "C" {
 #define IMAGE_TLV_SHA256            0x10    /* SHA256 of image hdr and body */
 #define IMAGE_TLV_SHA384            0x11    /* SHA384 of image hdr and body */
 #define IMAGE_TLV_SHA512            0x12    /* SHA512 of image hdr and body */
+#define IMAGE_TLV_BLAKE2S           0x13    /* BLAKE2s of image hdr and body */
 #define IMAGE_TLV_RSA2048_PSS       0x20    /* RSA2048 of hash output */
 #define IMAGE_TLV_ECDSA224          0x21    /* ECDSA of hash output - Not supported anymore */
 #define IMAGE_TLV_ECDSA_SIG         0x22    /* ECDSA of hash output */
@@ -238,7 +239,7 @@ int32_t bootutil_get_img_security_cnt(struct boot_loader_state *state, int slot,
                                       uint32_t *img_security_cnt);
 
 #if !defined(MCUBOOT_HW_KEY)
-int bootutil_find_key(uint8_t *keyhash, uint8_t keyhash_len);
+int bootutil_find_key(const uint8_t *keyhash, uint8_t keyhash_len);
 #else
 int bootutil_find_key(uint8_t image_index, uint8_t *key, uint16_t key_len);
 #endif
@@ -36,6 +36,19 @@ extern "C" {
 struct bootutil_key {
     const uint8_t *key;
     const unsigned int *len;
+#ifdef MCUBOOT_RSA_MONT_CONSTANTS
+    /* R^2 mod N and -N^-1 mod 2^32 of the RSA modulus, see imgtool getpub. */
+    const uint8_t *rsa_rr;
+    const unsigned int *rsa_n0;
+#endif
+#ifdef MCUBOOT_ECDSA_P256_KEY_COMB_TEETH
+    /* Comb table of the ECDSA P-256 key, see imgtool getpub --comb-teeth. */
+    const unsigned int *ec_comb;
+#endif
+#ifdef MCUBOOT_ED25519_KEY_POINT
+    /* x coordinate of the Ed25519 key, see imgtool getpub. */
+    const uint8_t *ed25519_x;
+#endif
 };
 
 extern const struct bootutil_key bootutil_keys[];
@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __WARM_BOOT_H__
+#define __WARM_BOOT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef MCUBOOT_WARM_BOOT_CACHE
+/*
+ * Storage for the slot decisions of the last boot, to be provided by the
+ * platform. It must keep its contents across warm resets, as retained RAM
+ * does. Records are authenticated with a key from boot_warm_boot_key(), so
+ * the storage itself may be writable by the application.
+ */
+
+#define BOOT_WARM_BOOT_KEY_SIZE 32
+
+/**
+ * Reads the key authenticating the records.
+ *
+ * The key must only be readable by MCUboot, e.g. a key slot locked before
+ * the application starts, or a key built into MCUboot where its flash is
+ * not readable by the application.
+ *
+ * @param key   Buffer for the key, cleared by the caller after use.
+ *
+ * @return      0 on success; nonzero if no key is available, which
+ *              disables the cache.
+ */
+int boot_warm_boot_key(uint8_t key[BOOT_WARM_BOOT_KEY_SIZE]);
+
+/**
+ * Reads the record stored by boot_warm_boot_record_write().
+ *
+ * @param data  Buffer for the record.
+ * @param len   Size of the record.
+ *
+ * @return      0 on success; nonzero if no record is stored.
+ */
+int boot_warm_boot_record_read(void *data, size_t len);
+
+/**
+ * Stores a record, replacing the one stored before.
+ *
+ * @param data  The record.
+ * @param len   Size of the record.
+ *
+ * @return      0 on success; nonzero on failure.
+ */
+int boot_warm_boot_record_write(const void *data, size_t len);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __WARM_BOOT_H__ */
@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "mcuboot_config/mcuboot_config.h"
+
+#if defined(MCUBOOT_BLAKE2S)
+
+#include <string.h>
+
+#include "bootutil/crypto/blake2s.h"
+
+static const uint32_t blake2s_iv[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+
+static const uint8_t blake2s_sigma[10][16] = {
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+    { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+    {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+    {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+    {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+    { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+    { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+    {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+    { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 },
+};
+
+static inline uint32_t
+blake2s_ror(uint32_t x, unsigned n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+static inline uint32_t
+blake2s_load32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+#define BLAKE2S_G(a, b, c, d, x, y)                 \
+    do {                                            \
+        v[a] = v[a] + v[b] + (x);                   \
+        v[d] = blake2s_ror(v[d] ^ v[a], 16);        \
+        v[c] = v[c] + v[d];                         \
+        v[b] = blake2s_ror(v[b] ^ v[c], 12);        \
+        v[a] = v[a] + v[b] + (y);                   \
+        v[d] = blake2s_ror(v[d] ^ v[a], 8);         \
+        v[c] = v[c] + v[d];                         \
+        v[b] = blake2s_ror(v[b] ^ v[c], 7);         \
+    } while (0)
+
+static void
+blake2s_compress(bootutil_blake2s_context *ctx, const uint8_t *block,
+                 int last)
+{
+    uint32_t m[16];
+    uint32_t v[16];
+    const uint8_t *s;
+    int i;
+
+    for (i = 0; i < 16; i++) {
+        m[i] = blake2s_load32(block + 4 * i);
+    }
+
+    for (i = 0; i < 8; i++) {
+        v[i] = ctx->h[i];
+        v[i + 8] = blake2s_iv[i];
+    }
+    v[12] ^= ctx->t[0];
+    v[13] ^= ctx->t[1];
+    if (last) {
+        v[14] = ~v[14];
+    }
+
+    for (i = 0; i < 10; i++) {
+        s = blake2s_sigma[i];
+        BLAKE2S_G(0, 4,  8, 12, m[s[0]],  m[s[1]]);
+        BLAKE2S_G(1, 5,  9, 13, m[s[2]],  m[s[3]]);
+        BLAKE2S_G(2, 6, 10, 14, m[s[4]],  m[s[5]]);
+        BLAKE2S_G(3, 7, 11, 15, m[s[6]],  m[s[7]]);
+        BLAKE2S_G(0, 5, 10, 15, m[s[8]],  m[s[9]]);
+        BLAKE2S_G(1, 6, 11, 12, m[s[10]], m[s[11]]);
+        BLAKE2S_G(2, 7,  8, 13, m[s[12]], m[s[13]]);
+        BLAKE2S_G(3, 4,  9, 14, m[s[14]], m[s[15]]);
+    }
+
+    for (i = 0; i < 8; i++) {
+        ctx->h[i] ^= v[i] ^ v[i + 8];
+    }
+}
+
+static void
+blake2s_add_count(bootutil_blake2s_context *ctx, uint32_t n)
+{
+    ctx->t[0] += n;
+    if (ctx->t[0] < n) {
+        ctx->t[1]++;
+    }
+}
+
+void
+bootutil_blake2s_init(bootutil_blake2s_context *ctx)
+{
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        ctx->h[i] = blake2s_iv[i];
+    }
+    /* Parameter block: 32 byte digest, no key, fanout 1, depth 1. */
+    ctx->h[0] ^= 0x01010000 | BOOTUTIL_CRYPTO_BLAKE2S_DIGEST_SIZE;
+    ctx->t[0] = 0;
+    ctx->t[1] = 0;
+    ctx->buflen = 0;
+}
+
+void
+bootutil_blake2s_update(bootutil_blake2s_context *ctx, const void *data,
+                        uint32_t data_len)
+{
+    const uint8_t *p = data;
+    uint32_t fill;
+
+    if (data_len == 0) {
+        return;
+    }
+
+    /*
+     * The last block has to be compressed with the final flag, so a full
+     * buffer is only compressed once more data is known to follow.
+     */
+    fill = BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE - ctx->buflen;
+    if (data_len > fill) {
+        memcpy(ctx->buf + ctx->buflen, p, fill);
+        blake2s_add_count(ctx, BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE);
+        blake2s_compress(ctx, ctx->buf, 0);
+        ctx->buflen = 0;
+        p += fill;
+        data_len -= fill;
+
+        while (data_len > BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE) {
+            blake2s_add_count(ctx, BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE);
+            blake2s_compress(ctx, p, 0);
+            p += BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE;
+            data_len -= BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE;
+        }
+    }
+
+    memcpy(ctx->buf + ctx->buflen, p, data_len);
+    ctx->buflen += data_len;
+}
+
+void
+bootutil_blake2s_finish(bootutil_blake2s_context *ctx, uint8_t *output)
+{
+    int i;
+
+    blake2s_add_count(ctx, ctx->buflen);
+    memset(ctx->buf + ctx->buflen, 0,
+           BOOTUTIL_CRYPTO_BLAKE2S_BLOCK_SIZE - ctx->buflen);
+    blake2s_compress(ctx, ctx->buf, 1);
+
+    for (i = 0; i < 8; i++) {
+        output[4 * i] = (uint8_t)ctx->h[i];
+        output[4 * i + 1] = (uint8_t)(ctx->h[i] >> 8);
+        output[4 * i + 2] = (uint8_t)(ctx->h[i] >> 16);
+        output[4 * i + 3] = (uint8_t)(ctx->h[i] >> 24);
+    }
+}
+
+#endif /* MCUBOOT_BLAKE2S */
@@ -76,6 +76,12 @@ boot_status_entry_sz(uint32_t min_write_sz)
     defined(MCUBOOT_SINGLE_APPLICATION_SLOT_RAM_LOAD)
     /* Single image MCUboot modes do not have a swap status fields */
     return 0;
+#elif defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    /* Swap status is recorded in its own partition. */
+    return 0;
+#elif defined(MCUBOOT_SWAP_STATUS_COMPACT)
+    /* The entries of one swap step are bits of a single write unit. */
+    return min_write_sz;
 #else
     return BOOT_STATUS_STATE_COUNT * min_write_sz;
 #endif
@@ -84,7 +90,16 @@ boot_status_entry_sz(uint32_t min_write_sz)
 uint32_t
 boot_status_sz(uint32_t min_write_sz)
 {
+#if defined(MCUBOOT_SWAP_STATUS_COMPACT) &&          \
+    !defined(MCUBOOT_SINGLE_APPLICATION_SLOT) &&     \
+    !defined(MCUBOOT_FIRMWARE_LOADER) &&             \
+    !defined(MCUBOOT_SINGLE_APPLICATION_SLOT_RAM_LOAD)
+    /* One bit per entry, rounded up to whole write units. */
+    return ALIGN_UP((BOOT_STATUS_MAX_ENTRIES * BOOT_STATUS_STATE_COUNT + 7) / 8,
+                    min_write_sz);
+#else
     return BOOT_STATUS_MAX_ENTRIES * boot_status_entry_sz(min_write_sz);
+#endif
 }
 
 uint32_t
@@ -215,6 +230,32 @@ boot_trailer_scramble_offset(const struct flash_area *fa, size_t alignment, size
     return ret;
 }
 
+#if defined(MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS)
+/*
+ * Returns the size of the largest erase block, from the ones advertised by
+ * flash_area_erase_blocks(), that has a boundary at @p at and extends by at
+ * most @p room bytes from there; 0 if none is larger than @p sector_size.
+ * Blocks are aligned to their size on the device, not within the area.
+ */
+static uint32_t
+boot_erase_block_size(const struct flash_area *fa, uint32_t at, uint32_t room,
+                      uint32_t sector_size)
+{
+    uint32_t blocks = flash_area_erase_blocks(fa);
+    uint32_t dev_off = flash_area_get_off(fa) + at;
+    uint32_t size;
+
+    /* Largest block first */
+    for (size = UINT32_C(0x80000000); size > sector_size; size >>= 1) {
+        if ((blocks & size) != 0 && size <= room && (dev_off & (size - 1)) == 0) {
+            return size;
+        }
+    }
+
+    return 0;
+}
+#endif
+
 int
 boot_erase_region(const struct flash_area *fa, uint32_t off, uint32_t size, bool backwards)
 {
@@ -230,6 +271,11 @@ boot_erase_region(const struct flash_area *fa, uint32_t off, uint32_t size, bool
     } else if (device_requires_erase(fa)) {
         uint32_t end_offset = 0;
         struct flash_sector sector;
+#if defined(MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS)
+        /* End of the last sector in range, forwards only */
+        uint32_t end_limit = 0;
+        uint32_t bsize;
+#endif
 
         BOOT_LOG_DBG("boot_erase_region: device with erase");
 
@@ -256,6 +302,9 @@ boot_erase_region(const struct flash_area *fa, uint32_t off, uint32_t size, bool
             }
 
             end_offset = flash_sector_get_off(&sector);
+#if defined(MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS)
+            end_limit = end_offset + flash_sector_get_size(&sector);
+#endif
         }
 
         while (true) {
@@ -273,6 +322,25 @@ boot_erase_region(const struct flash_area *fa, uint32_t off, uint32_t size, bool
             off = flash_sector_get_off(&sector);
             csize = flash_sector_get_size(&sector);
 
+#if defined(MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS)
+            /* Where a whole erase block fits in what is left of the range,
+             * erase it in one go instead of the sector; the sectors at the
+             * unaligned edges of the range are still erased one by one.
+             */
+            if (backwards) {
+                bsize = boot_erase_block_size(fa, off + csize, off + csize - end_offset, csize);
+                if (bsize != 0) {
+                    off = off + csize - bsize;
+                    csize = bsize;
+                }
+            } else {
+                bsize = boot_erase_block_size(fa, off, end_limit - off, csize);
+                if (bsize != 0) {
+                    csize = bsize;
+                }
+            }
+#endif
+
             rc = flash_area_erase(fa, off, csize);
 
             if (rc < 0) {
@@ -314,6 +382,24 @@ end:
     return rc;
 }
 
+int
+boot_erase_region_start(const struct flash_area *fa, uint32_t off, uint32_t size)
+{
+    if (!device_requires_erase(fa)) {
+        return boot_erase_region(fa, off, size, false);
+    }
+
+#if defined(MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC)
+    /* The erase goes round the redirection of flash_area_erase(), drop what
+     * it may have cached of the range.
+     */
+    boot_flash_cache_invalidate();
+    return flash_area_erase_start(fa, off, size);
+#else
+    return flash_area_erase(fa, off, size);
+#endif
+}
+
 int
 boot_scramble_region(const struct flash_area *fa, uint32_t off, uint32_t size, bool backwards)
 {
@@ -107,7 +107,9 @@ int boot_trailer_scramble_offset(const struct flash_area *fa, size_t alignment,
 
 /**
  * Erases a region of device that requires erase prior to write; does
- * nothing on devices without erase.
+ * nothing on devices without erase. With MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS
+ * the erase blocks of the device that fit in the region are erased whole,
+ * the sectors at the edges of the region one by one.
  *
  * @param fa         The flash_area containing the region to erase.
  * @param off        The offset within the flash area to start the erase.
@@ -119,6 +121,20 @@ int boot_trailer_scramble_offset(const struct flash_area *fa, size_t alignment,
  */
 int boot_erase_region(const struct flash_area *fap, uint32_t off, uint32_t sz, bool backwards);
 
+/**
+ * Starts erasing a region of device that requires erase prior to write, and
+ * returns without waiting for the erase to complete when the backend can
+ * (MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC); the next operation on the device
+ * waits for it. Erases the region as boot_erase_region() otherwise.
+ *
+ * @param fa         The flash_area containing the region to erase.
+ * @param off        The offset within the flash area to start the erase.
+ * @param size       The number of bytes to erase.
+ *
+ * @return 0 on success; nonzero on failure.
+ */
+int boot_erase_region_start(const struct flash_area *fa, uint32_t off, uint32_t size);
+
 /**
  * Removes data from specified region either by writing erase value in place of data or by doing
  * erase, if device has such hardware requirement.
@@ -53,7 +53,7 @@ BOOT_LOG_MODULE_DECLARE(mcuboot);
 /* Find functions are only needed when key is checked first */
 #if !defined(MCUBOOT_BUILTIN_KEY)
 #if !defined(MCUBOOT_HW_KEY)
-int bootutil_find_key(uint8_t *keyhash, uint8_t keyhash_len)
+int bootutil_find_key(const uint8_t *keyhash, uint8_t keyhash_len)
 {
     bootutil_sha_context sha_ctx;
     int i;
@@ -121,7 +121,7 @@ int bootutil_find_key(uint8_t image_index, uint8_t *key, uint16_t key_len)
 
 #else /* !MCUBOOT_BYPASS_KEY_MATCH */
 #if !defined(MCUBOOT_HW_KEY)
-int bootutil_find_key(uint8_t *key, uint8_t key_len)
+int bootutil_find_key(const uint8_t *key, uint8_t key_len)
 {
     (void)key;
     (void)key_len;
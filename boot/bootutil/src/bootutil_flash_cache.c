@@ -0,0 +1,233 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "mcuboot_config/mcuboot_config.h"
+
+#if defined(MCUBOOT_FLASH_READ_CACHE) || defined(MCUBOOT_METADATA_PREFETCH)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* The backend functions are called directly from here. */
+#define BOOTUTIL_FLASH_CACHE_BACKEND
+
+#include <inttypes.h>
+#include <flash_map_backend/flash_map_backend.h>
+#include "bootutil/bootutil_log.h"
+#include "bootutil_priv.h"
+
+BOOT_LOG_MODULE_DECLARE(mcuboot);
+
+#if defined(MCUBOOT_FLASH_READ_CACHE)
+
+#define LINE_SIZE MCUBOOT_FLASH_READ_CACHE_LINE_SIZE
+
+/*
+ * Lines are tagged with the flash area they were read from, which avoids
+ * asking the backend for device IDs; flash areas do not overlap.
+ */
+struct boot_flash_cache_line {
+    const struct flash_area *fa;
+    /* Offset of the line within the area, aligned to LINE_SIZE */
+    uint32_t off;
+    /* Value of cache_tick at the last use, to replace the oldest line */
+    uint32_t used;
+    bool valid;
+    uint8_t data[LINE_SIZE];
+};
+
+BOOT_FLASH_CACHE_STATE struct boot_flash_cache_line cache_lines[MCUBOOT_FLASH_READ_CACHE_LINES];
+BOOT_FLASH_CACHE_STATE uint32_t cache_tick;
+BOOT_FLASH_CACHE_STATE uint32_t cache_hits;
+BOOT_FLASH_CACHE_STATE uint32_t cache_misses;
+
+static struct boot_flash_cache_line *
+cache_lookup(const struct flash_area *fa, uint32_t line_off)
+{
+    size_t i;
+
+    for (i = 0; i < MCUBOOT_FLASH_READ_CACHE_LINES; i++) {
+        if (cache_lines[i].valid && cache_lines[i].fa == fa &&
+            cache_lines[i].off == line_off) {
+            return &cache_lines[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Reads the line at line_off, which is within fa, into a free or the least
+ * recently used line.
+ */
+static struct boot_flash_cache_line *
+cache_fill(const struct flash_area *fa, uint32_t line_off)
+{
+    struct boot_flash_cache_line *line = &cache_lines[0];
+    size_t i;
+
+    for (i = 0; i < MCUBOOT_FLASH_READ_CACHE_LINES; i++) {
+        if (!cache_lines[i].valid) {
+            line = &cache_lines[i];
+            break;
+        }
+        if (cache_lines[i].used < line->used) {
+            line = &cache_lines[i];
+        }
+    }
+
+    line->valid = false;
+    if (flash_area_read(fa, line_off, line->data, LINE_SIZE) != 0) {
+        return NULL;
+    }
+
+    line->fa = fa;
+    line->off = line_off;
+    line->valid = true;
+
+    return line;
+}
+
+/* Drops the lines of fa overlapping [off, off + len). */
+static void
+cache_invalidate_range(const struct flash_area *fa, uint32_t off, uint32_t len)
+{
+    size_t i;
+
+    for (i = 0; i < MCUBOOT_FLASH_READ_CACHE_LINES; i++) {
+        if (cache_lines[i].valid && cache_lines[i].fa == fa &&
+            cache_lines[i].off < off + len && off < cache_lines[i].off + LINE_SIZE) {
+            cache_lines[i].valid = false;
+        }
+    }
+}
+
+static int
+cache_read(const struct flash_area *fa, uint32_t off, void *dst, uint32_t len)
+{
+    struct boot_flash_cache_line *line;
+    uint8_t *out = dst;
+    uint32_t size = flash_area_get_size(fa);
+    uint32_t line_off;
+    uint32_t chunk;
+
+    /* Bulk reads gain nothing from the cache, and out of range ones are
+     * left to the backend to refuse.
+     */
+    if (len == 0 || len > LINE_SIZE || off > size || len > size - off) {
+        return flash_area_read(fa, off, dst, len);
+    }
+
+    while (len > 0) {
+        line_off = off & ~(uint32_t)(LINE_SIZE - 1);
+
+        line = NULL;
+        if (size >= LINE_SIZE && line_off <= size - LINE_SIZE) {
+            line = cache_lookup(fa, line_off);
+            if (line != NULL) {
+                cache_hits++;
+            } else {
+                cache_misses++;
+                line = cache_fill(fa, line_off);
+            }
+        }
+
+        if (line == NULL) {
+            /* The line runs past the end of the area or could not be read
+             * as a whole; read what is left directly.
+             */
+            return flash_area_read(fa, off, out, len);
+        }
+
+        line->used = ++cache_tick;
+
+        chunk = line_off + LINE_SIZE - off;
+        if (chunk > len) {
+            chunk = len;
+        }
+
+        memcpy(out, &line->data[off - line_off], chunk);
+        out += chunk;
+        off += chunk;
+        len -= chunk;
+    }
+
+    return 0;
+}
+
+void
+boot_flash_cache_stats(uint32_t *hits, uint32_t *misses)
+{
+    *hits = cache_hits;
+    *misses = cache_misses;
+}
+
+void
+boot_flash_cache_report(void)
+{
+    BOOT_LOG_DBG("flash read cache: %" PRIu32 " hits, %" PRIu32 " misses",
+                 cache_hits, cache_misses);
+}
+
+#endif /* MCUBOOT_FLASH_READ_CACHE */
+
+int
+boot_flash_cache_read(const struct flash_area *fa, uint32_t off, void *dst, uint32_t len)
+{
+#if defined(MCUBOOT_METADATA_PREFETCH)
+    if (boot_metadata_read(fa, off, dst, len)) {
+        return 0;
+    }
+#endif
+
+#if defined(MCUBOOT_FLASH_READ_CACHE)
+    return cache_read(fa, off, dst, len);
+#else
+    return flash_area_read(fa, off, dst, len);
+#endif
+}
+
+int
+boot_flash_cache_write(const struct flash_area *fa, uint32_t off, const void *src,
+                       uint32_t len)
+{
+#if defined(MCUBOOT_METADATA_PREFETCH)
+    boot_metadata_invalidate(fa, off, len);
+#endif
+#if defined(MCUBOOT_FLASH_READ_CACHE)
+    cache_invalidate_range(fa, off, len);
+#endif
+
+    return flash_area_write(fa, off, src, len);
+}
+
+int
+boot_flash_cache_erase(const struct flash_area *fa, uint32_t off, uint32_t len)
+{
+#if defined(MCUBOOT_METADATA_PREFETCH)
+    boot_metadata_invalidate(fa, off, len);
+#endif
+#if defined(MCUBOOT_FLASH_READ_CACHE)
+    cache_invalidate_range(fa, off, len);
+#endif
+
+    return flash_area_erase(fa, off, len);
+}
+
+void
+boot_flash_cache_invalidate(void)
+{
+#if defined(MCUBOOT_FLASH_READ_CACHE)
+    size_t i;
+
+    for (i = 0; i < MCUBOOT_FLASH_READ_CACHE_LINES; i++) {
+        cache_lines[i].valid = false;
+    }
+#endif
+
+    boot_metadata_drop();
+}
+
+#endif /* MCUBOOT_FLASH_READ_CACHE || MCUBOOT_METADATA_PREFETCH */
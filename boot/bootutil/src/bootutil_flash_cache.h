@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Optional read cache between bootutil and the flash map backend.
+ *
+ * With MCUBOOT_FLASH_READ_CACHE, small flash_area_read() calls made by
+ * bootutil are served from a few cache lines of
+ * MCUBOOT_FLASH_READ_CACHE_LINE_SIZE bytes, filled with a single backend
+ * read each; reads larger than a line go to the backend directly. Writes
+ * and erases made through bootutil invalidate the lines they overlap.
+ *
+ * The cache is put in place by redirecting flash_area_read(),
+ * flash_area_write() and flash_area_erase() in the files that include
+ * bootutil_priv.h, so backends need no change. Files that implement these
+ * functions and include bootutil headers must define
+ * BOOTUTIL_FLASH_CACHE_BACKEND first. Code writing to flash behind the
+ * back of bootutil during boot, for example in hooks, has to call
+ * boot_flash_cache_invalidate().
+ *
+ * MCUBOOT_METADATA_PREFETCH uses the same redirection to serve reads from
+ * the table of headers and trailers read at the start of the boot, see
+ * bootutil_metadata.c.
+ */
+
+#ifndef H_BOOTUTIL_FLASH_CACHE_
+#define H_BOOTUTIL_FLASH_CACHE_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <flash_map_backend/flash_map_backend.h>
+#include "mcuboot_config/mcuboot_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MCUBOOT_FLASH_READ_CACHE) || defined(MCUBOOT_METADATA_PREFETCH)
+
+int boot_flash_cache_read(const struct flash_area *fa, uint32_t off, void *dst,
+                          uint32_t len);
+int boot_flash_cache_write(const struct flash_area *fa, uint32_t off,
+                           const void *src, uint32_t len);
+int boot_flash_cache_erase(const struct flash_area *fa, uint32_t off, uint32_t len);
+
+#if !defined(BOOTUTIL_FLASH_CACHE_BACKEND)
+#define flash_area_read(fa, off, dst, len)  boot_flash_cache_read((fa), (off), (dst), (len))
+#define flash_area_write(fa, off, src, len) boot_flash_cache_write((fa), (off), (src), (len))
+#define flash_area_erase(fa, off, len)      boot_flash_cache_erase((fa), (off), (len))
+#endif
+
+/* Drops all cached data and the metadata table; the hit and miss counters
+ * are kept.
+ */
+void boot_flash_cache_invalidate(void);
+
+#else /* MCUBOOT_FLASH_READ_CACHE || MCUBOOT_METADATA_PREFETCH */
+
+#define boot_flash_cache_invalidate() do { } while (0)
+
+#endif /* MCUBOOT_FLASH_READ_CACHE || MCUBOOT_METADATA_PREFETCH */
+
+#if defined(MCUBOOT_METADATA_PREFETCH)
+
+/* Copies [off, off + len) of fa to dst and returns true if it lies within a
+ * range of the metadata table, see boot_metadata_prefetch().
+ */
+bool boot_metadata_read(const struct flash_area *fa, uint32_t off, void *dst,
+                        uint32_t len);
+
+/* Drops the ranges of the metadata table overlapping [off, off + len). */
+void boot_metadata_invalidate(const struct flash_area *fa, uint32_t off, uint32_t len);
+
+/* Drops the whole metadata table. */
+void boot_metadata_drop(void);
+
+#else /* MCUBOOT_METADATA_PREFETCH */
+
+#define boot_metadata_drop() do { } while (0)
+
+#endif /* MCUBOOT_METADATA_PREFETCH */
+
+#if defined(MCUBOOT_FLASH_READ_CACHE)
+
+#ifndef MCUBOOT_FLASH_READ_CACHE_LINES
+#define MCUBOOT_FLASH_READ_CACHE_LINES 8
+#endif
+
+#ifndef MCUBOOT_FLASH_READ_CACHE_LINE_SIZE
+#define MCUBOOT_FLASH_READ_CACHE_LINE_SIZE 64
+#endif
+
+#if (MCUBOOT_FLASH_READ_CACHE_LINE_SIZE & (MCUBOOT_FLASH_READ_CACHE_LINE_SIZE - 1)) != 0
+#error "MCUBOOT_FLASH_READ_CACHE_LINE_SIZE must be a power of two"
+#endif
+
+/* Number of line lookups served from the cache and from flash so far. */
+void boot_flash_cache_stats(uint32_t *hits, uint32_t *misses);
+
+/* Logs the counters of boot_flash_cache_stats(). */
+void boot_flash_cache_report(void);
+
+#else /* MCUBOOT_FLASH_READ_CACHE */
+
+#define boot_flash_cache_report()     do { } while (0)
+
+#endif /* MCUBOOT_FLASH_READ_CACHE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_BOOTUTIL_FLASH_CACHE_ */
@@ -60,6 +60,12 @@ bootutil_img_hash(struct boot_loader_state *state,
     int rc;
     uint32_t off;
     uint32_t blk_sz;
+    /* Bytes hashed in place, without going through tmp_buf */
+    uint32_t hashed = 0;
+#endif
+#if defined(MCUBOOT_USE_FLASH_AREA_MAP) && !defined(MCUBOOT_HASH_STORAGE_DIRECTLY) && \
+    !defined(MCUBOOT_RAM_LOAD)
+    const void *mapped;
 #endif
 #ifdef MCUBOOT_HASH_STORAGE_DIRECTLY
     uintptr_t base = 0;
@@ -81,6 +87,7 @@ bootutil_img_hash(struct boot_loader_state *state,
 #ifdef MCUBOOT_RAM_LOAD
     (void)blk_sz;
     (void)off;
+    (void)hashed;
     (void)rc;
     (void)fap;
     (void)tmp_buf;
@@ -139,11 +146,39 @@ bootutil_img_hash(struct boot_loader_state *state,
     bootutil_sha_update(&sha_ctx, (void *)(base + flash_area_get_off(fap)), size);
 #else /* MCUBOOT_HASH_STORAGE_DIRECTLY */
 #ifdef MCUBOOT_RAM_LOAD
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    /* Digest computed over the image as it was copied to RAM */
+    if ((seed == NULL || seed_len == 0) &&
+        boot_ram_load_hash(state, hdr, fap, size, hash_result) == 0) {
+        bootutil_sha_drop(&sha_ctx);
+        return 0;
+    }
+#endif
     bootutil_sha_update(&sha_ctx,
                         (void*)(IMAGE_RAM_BASE + hdr->ih_load_addr),
                         size);
 #else
-    for (off = 0; off < size; off += blk_sz) {
+#if defined(MCUBOOT_USE_FLASH_AREA_MAP)
+    /* Hash the image where it is stored if the area can be mapped; the
+     * payload of an encrypted image still has to be decrypted in tmp_buf.
+     */
+#ifdef MCUBOOT_ENC_IMAGES
+    if (!MUST_DECRYPT(fap, image_index, hdr))
+#endif
+    {
+#if defined(MCUBOOT_SWAP_USING_OFFSET)
+        rc = flash_area_map(fap, sector_off, size, &mapped);
+#else
+        rc = flash_area_map(fap, 0, size, &mapped);
+#endif
+        if (rc == 0) {
+            bootutil_sha_update(&sha_ctx, mapped, size);
+            flash_area_unmap(fap, mapped, size);
+            hashed = size;
+        }
+    }
+#endif
+    for (off = hashed; off < size; off += blk_sz) {
         blk_sz = size - off;
         if (blk_sz > tmp_buf_sz) {
             blk_sz = tmp_buf_sz;
@@ -0,0 +1,279 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Metadata prefetch.
+ *
+ * Right after the flash areas are opened, the header and the trailer of
+ * every slot of every image, and the scratch trailer, are read into a table
+ * in one pass, in flash address order. The trailer fields up to the magic
+ * (swap size, swap info, copy done, image ok, magic) are adjacent and are
+ * read as one range. Reads made by bootutil that fall within a range of the
+ * table are then served from it, through the same redirection of
+ * flash_area_read() as the read cache, and writes and erases drop the
+ * ranges they overlap. The table is dropped at the end of the boot.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "mcuboot_config/mcuboot_config.h"
+
+#if defined(MCUBOOT_METADATA_PREFETCH)
+
+/* The table is filled with direct backend reads. */
+#define BOOTUTIL_FLASH_CACHE_BACKEND
+
+#include "bootutil/bootutil_log.h"
+#include "bootutil/image.h"
+#include "bootutil_priv.h"
+#include "bootutil_misc.h"
+
+BOOT_LOG_MODULE_DECLARE(mcuboot);
+
+/* From the swap size field to the end of the area, with room for the
+ * alignment of the image ok field.
+ */
+#if defined(MCUBOOT_SWAP_USING_OFFSET)
+#define BOOT_METADATA_TRAILER_SZ (BOOT_MAGIC_SZ + BOOT_MAX_ALIGN * 6)
+#else
+#define BOOT_METADATA_TRAILER_SZ (BOOT_MAGIC_SZ + BOOT_MAX_ALIGN * 5)
+#endif
+
+struct boot_metadata_range {
+    const struct flash_area *fa;
+    uint32_t off;
+    uint32_t len;
+    bool valid;
+    uint8_t data[BOOT_METADATA_TRAILER_SZ];
+};
+
+struct boot_metadata_image {
+    struct boot_metadata_range hdr[BOOT_NUM_SLOTS];
+    struct boot_metadata_range trailer[BOOT_NUM_SLOTS];
+};
+
+#if MCUBOOT_SWAP_USING_SCRATCH
+#define BOOT_METADATA_RANGES (BOOT_IMAGE_NUMBER * BOOT_NUM_SLOTS * 2 + 1)
+#else
+#define BOOT_METADATA_RANGES (BOOT_IMAGE_NUMBER * BOOT_NUM_SLOTS * 2)
+#endif
+
+BOOT_FLASH_CACHE_STATE struct boot_metadata_image metadata_images[BOOT_IMAGE_NUMBER];
+#if MCUBOOT_SWAP_USING_SCRATCH
+BOOT_FLASH_CACHE_STATE struct boot_metadata_range metadata_scratch;
+#endif
+BOOT_FLASH_CACHE_STATE uint32_t metadata_hits;
+
+static inline uint32_t
+range_addr(const struct boot_metadata_range *range)
+{
+    return flash_area_get_off(range->fa) + range->off;
+}
+
+/* Orders by flash device, then by address on the device. */
+static bool
+range_before(const struct boot_metadata_range *a, const struct boot_metadata_range *b)
+{
+    uint8_t dev_a = flash_area_get_device_id(a->fa);
+    uint8_t dev_b = flash_area_get_device_id(b->fa);
+
+    if (dev_a != dev_b) {
+        return dev_a < dev_b;
+    }
+
+    return range_addr(a) < range_addr(b);
+}
+
+static void
+range_set(struct boot_metadata_range *range, const struct flash_area *fa,
+          uint32_t off, uint32_t len)
+{
+    range->fa = fa;
+    range->off = off;
+    range->len = len;
+    range->valid = false;
+}
+
+/* Sets range to the trailer fields of fa, or leaves it unused if fa is too
+ * small to have them.
+ */
+static void
+range_set_trailer(struct boot_metadata_range *range, const struct flash_area *fa)
+{
+    uint32_t size = flash_area_get_size(fa);
+    uint32_t off;
+
+    range->fa = NULL;
+    if (size < BOOT_METADATA_TRAILER_SZ) {
+        return;
+    }
+
+    off = boot_swap_size_off(fa);
+    assert(size - off <= BOOT_METADATA_TRAILER_SZ);
+    range_set(range, fa, off, size - off);
+}
+
+void
+boot_metadata_prefetch(struct boot_loader_state *state)
+{
+    struct boot_metadata_range *ranges[BOOT_METADATA_RANGES];
+    struct boot_metadata_range *range;
+    const struct flash_area *fa;
+    size_t count = 0;
+    size_t image;
+    size_t slot;
+    size_t i;
+    size_t j;
+
+    boot_metadata_drop();
+
+    for (image = 0; image < BOOT_IMAGE_NUMBER; image++) {
+#if BOOT_IMAGE_NUMBER > 1
+        if (state->img_mask[image]) {
+            continue;
+        }
+#endif
+        for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+            fa = state->imgs[image][slot].area;
+            if (fa == NULL) {
+                continue;
+            }
+
+            range = &metadata_images[image].hdr[slot];
+            range_set(range, fa, 0, IMAGE_HEADER_SIZE);
+            ranges[count++] = range;
+
+            range = &metadata_images[image].trailer[slot];
+            range_set_trailer(range, fa);
+            if (range->fa != NULL) {
+                ranges[count++] = range;
+            }
+        }
+    }
+
+#if MCUBOOT_SWAP_USING_SCRATCH
+    if (state->scratch.area != NULL) {
+        range_set_trailer(&metadata_scratch, state->scratch.area);
+        if (metadata_scratch.fa != NULL) {
+            ranges[count++] = &metadata_scratch;
+        }
+    }
+#endif
+
+    /* Insertion sort; there are only a few ranges. */
+    for (i = 1; i < count; i++) {
+        range = ranges[i];
+        for (j = i; j > 0 && range_before(range, ranges[j - 1]); j--) {
+            ranges[j] = ranges[j - 1];
+        }
+        ranges[j] = range;
+    }
+
+    for (i = 0; i < count; i++) {
+        range = ranges[i];
+        /* A range that cannot be read is left to be read on demand. */
+        range->valid = flash_area_read(range->fa, range->off, range->data,
+                                       range->len) == 0;
+    }
+
+    BOOT_LOG_DBG("metadata prefetch: %zu ranges read", count);
+}
+
+/* Whether [off, off + len) of fa lies within range. */
+static bool
+range_holds(const struct boot_metadata_range *range, const struct flash_area *fa,
+            uint32_t off, uint32_t len)
+{
+    return range->valid && range->fa == fa && off >= range->off &&
+           off - range->off <= range->len && len <= range->len - (off - range->off);
+}
+
+static struct boot_metadata_range *
+range_find(const struct flash_area *fa, uint32_t off, uint32_t len)
+{
+    size_t image;
+    size_t slot;
+
+    for (image = 0; image < BOOT_IMAGE_NUMBER; image++) {
+        for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+            if (range_holds(&metadata_images[image].hdr[slot], fa, off, len)) {
+                return &metadata_images[image].hdr[slot];
+            }
+            if (range_holds(&metadata_images[image].trailer[slot], fa, off, len)) {
+                return &metadata_images[image].trailer[slot];
+            }
+        }
+    }
+
+#if MCUBOOT_SWAP_USING_SCRATCH
+    if (range_holds(&metadata_scratch, fa, off, len)) {
+        return &metadata_scratch;
+    }
+#endif
+
+    return NULL;
+}
+
+bool
+boot_metadata_read(const struct flash_area *fa, uint32_t off, void *dst, uint32_t len)
+{
+    struct boot_metadata_range *range = range_find(fa, off, len);
+
+    if (range == NULL) {
+        return false;
+    }
+
+    memcpy(dst, &range->data[off - range->off], len);
+    metadata_hits++;
+
+    return true;
+}
+
+static void
+range_invalidate(struct boot_metadata_range *range, const struct flash_area *fa,
+                 uint32_t off, uint32_t len)
+{
+    if (range->valid && range->fa == fa &&
+        range->off < off + len && off < range->off + range->len) {
+        range->valid = false;
+    }
+}
+
+void
+boot_metadata_invalidate(const struct flash_area *fa, uint32_t off, uint32_t len)
+{
+    size_t image;
+    size_t slot;
+
+    for (image = 0; image < BOOT_IMAGE_NUMBER; image++) {
+        for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+            range_invalidate(&metadata_images[image].hdr[slot], fa, off, len);
+            range_invalidate(&metadata_images[image].trailer[slot], fa, off, len);
+        }
+    }
+
+#if MCUBOOT_SWAP_USING_SCRATCH
+    range_invalidate(&metadata_scratch, fa, off, len);
+#endif
+}
+
+void
+boot_metadata_drop(void)
+{
+    if (metadata_hits != 0) {
+        BOOT_LOG_DBG("metadata prefetch: %" PRIu32 " reads served", metadata_hits);
+    }
+
+    memset(metadata_images, 0, sizeof(metadata_images));
+#if MCUBOOT_SWAP_USING_SCRATCH
+    memset(&metadata_scratch, 0, sizeof(metadata_scratch));
+#endif
+    metadata_hits = 0;
+}
+
+#endif /* MCUBOOT_METADATA_PREFETCH */
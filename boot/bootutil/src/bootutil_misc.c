@@ -41,6 +41,7 @@
 #include "bootutil/fault_injection_hardening.h"
 #ifdef MCUBOOT_ENC_IMAGES
 #include "bootutil/enc_key.h"
+#include "bootutil/crypto/sha.h"
 #endif
 #if defined(MCUBOOT_SWAP_USING_MOVE) || defined(MCUBOOT_SWAP_USING_OFFSET) || \
     defined(MCUBOOT_SWAP_USING_SCRATCH)
@@ -144,6 +145,55 @@ boot_status_off(const struct flash_area *fap)
     return flash_area_get_size(fap) - off_from_end;
 }
 
+/**
+ * Reads status entry @p entry of the status area at @p off in @p fap. In
+ * the compact format each entry is a bit, and with the swap status journal
+ * entries are set in order up to the last one recorded; one that is set
+ * reads as a value other than the erased one.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_read_status_entry(struct boot_loader_state *state,
+                       const struct flash_area *fap, uint32_t off, int entry,
+                       uint8_t *status)
+{
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    int32_t last;
+    int rc;
+
+    (void)off;
+
+    rc = boot_swap_journal_last(state, &last);
+    if (rc != 0) {
+        return rc;
+    }
+
+    *status = (entry <= last) ? (uint8_t)~flash_area_erased_val(fap) :
+                                flash_area_erased_val(fap);
+
+    return 0;
+#elif defined(MCUBOOT_SWAP_STATUS_COMPACT)
+    uint8_t erased_val;
+    uint8_t byte;
+    int rc;
+
+    (void)state;
+
+    rc = flash_area_read(fap, off + entry / 8, &byte, 1);
+    if (rc != 0) {
+        return rc;
+    }
+
+    erased_val = flash_area_erased_val(fap);
+    *status = ((byte ^ erased_val) & (1 << (entry % 8))) ? (uint8_t)~erased_val : erased_val;
+
+    return 0;
+#else
+    return flash_area_read(fap, off + entry * BOOT_WRITE_SZ(state), status, 1);
+#endif
+}
+
 #ifdef MCUBOOT_ENC_IMAGES
 static inline uint32_t
 boot_enc_key_off(const struct flash_area *fap, uint8_t slot)
@@ -240,8 +290,81 @@ boot_read_unprotected_tlv_sizes(const struct flash_area *fap, uint16_t *tlv_size
 #endif
 
 #ifdef MCUBOOT_ENC_IMAGES
+/**
+ * Unwraps the image encryption key held by an encryption TLV, unless the
+ * same TLV was already unwrapped for this slot of the current image during
+ * this boot, in which case the key is taken from the cache in the boot
+ * state. Cached keys are identified by a digest of the whole TLV.
+ *
+ * @param state                 Boot loader status information.
+ * @param slot                  Slot the TLV belongs to.
+ * @param buf                   Encryption TLV, BOOT_ENC_TLV_SIZE bytes.
+ * @param enckey                Where to store the BOOT_ENC_KEY_SIZE key.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_decrypt_key_cached(struct boot_loader_state *state, int slot,
+                        const uint8_t *buf, uint8_t *enckey)
+{
+    struct boot_enc_key_cache *cache = BOOT_CURR_ENC_CACHE(state, slot);
+    bootutil_sha_context sha_ctx;
+    uint8_t digest[IMAGE_HASH_SIZE];
+    int rc;
+
+    bootutil_sha_init(&sha_ctx);
+    bootutil_sha_update(&sha_ctx, buf, BOOT_ENC_TLV_SIZE);
+    bootutil_sha_finish(&sha_ctx, digest);
+    bootutil_sha_drop(&sha_ctx);
+
+    if (cache->valid &&
+        memcmp(cache->fingerprint, digest, BOOT_ENC_CACHE_FP_SIZE) == 0) {
+        BOOT_LOG_DBG("boot_decrypt_key_cached: slot %d cached", slot);
+        memcpy(enckey, cache->key, BOOT_ENC_KEY_SIZE);
+        return 0;
+    }
+
+    cache->valid = 0;
+    rc = boot_decrypt_key(buf, enckey);
+    if (rc == 0) {
+        memcpy(cache->fingerprint, digest, BOOT_ENC_CACHE_FP_SIZE);
+        memcpy(cache->key, enckey, BOOT_ENC_KEY_SIZE);
+        cache->valid = 1;
+    }
+
+    return rc;
+}
+
+/**
+ * Wipes the keys cached by boot_decrypt_key_cached() for the current image,
+ * once nothing more is done with it. The cache is kept across the passes
+ * over the images of a boot; entries are keyed by their TLV digest, so a
+ * pass never picks up a key that belongs to another image or slot.
+ *
+ * @param state                 Boot loader status information.
+ */
+void
+boot_enc_cache_wipe(struct boot_loader_state *state)
+{
+    bootutil_wipe_memory(BOOT_CURR_ENC_CACHE(state, 0),
+                         sizeof(state->enc_cache[0]));
+}
+
+/**
+ * Wipes the keys cached by boot_decrypt_key_cached() for all images, so that
+ * none of them survives the boot.
+ *
+ * @param state                 Boot loader status information.
+ */
+void
+boot_enc_cache_wipe_all(struct boot_loader_state *state)
+{
+    bootutil_wipe_memory(state->enc_cache, sizeof(state->enc_cache));
+}
+
 bool
-boot_read_enc_key(const struct flash_area *fap, uint8_t slot, struct boot_status *bs)
+boot_read_enc_key(struct boot_loader_state *state, const struct flash_area *fap,
+                  uint8_t slot, struct boot_status *bs)
 {
     uint32_t off;
     uint32_t i;
@@ -281,7 +404,8 @@ boot_read_enc_key(const struct flash_area *fap, uint8_t slot, struct boot_status
             /* read_dst is the same as bs->enctlv[slot], and serves as a source
              * of the encrypted key.
              */
-            rc = boot_decrypt_key(bs->enctlv[slot], bs->enckey[slot]);
+            rc = boot_decrypt_key_cached(state, slot, bs->enctlv[slot],
+                                         bs->enckey[slot]);
             if (rc != 0) {
                 return false;
             }
@@ -834,6 +958,9 @@ void boot_state_clear(struct boot_loader_state *state)
             boot_enc_drop(&state->enc[image][slot]);
         }
     }
+
+    /* The unwrapped keys are not needed beyond this boot. */
+    boot_enc_cache_wipe_all(state);
 #else
     (void)state;
 #endif
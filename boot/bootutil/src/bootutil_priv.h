@@ -44,12 +44,37 @@
 #include "bootutil/enc_key.h"
 #endif
 
+/* With RAM loading, the image digest is computed while the image is copied
+ * to RAM, from the data written there, rather than in a second pass over
+ * RAM when the image is validated.
+ */
+#if defined(MCUBOOT_RAM_LOAD) && !defined(MCUBOOT_SIGN_PURE) && \
+    !defined(MCUBOOT_HASH_STORAGE_DIRECTLY)
+#define BOOTUTIL_RAM_LOAD_HASH
+#include "bootutil/crypto/sha.h"
+#endif
+
+/* Last, as it may redirect the flash_area_* calls. */
+#include "bootutil_flash_cache.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 struct flash_area;
 
+/*
+ * Storage class of the read cache and metadata prefetch tables. They are
+ * reached through the flash_area_*() redirection, which has no
+ * boot_loader_state to keep them in, so they stay at file scope; the
+ * simulator runs boots in parallel threads, each with its own flash.
+ */
+#if defined(__BOOTSIM__)
+#define BOOT_FLASH_CACHE_STATE static __thread
+#else
+#define BOOT_FLASH_CACHE_STATE static
+#endif
+
 #if defined(MCUBOOT_LOGICAL_SECTOR_SIZE) && MCUBOOT_LOGICAL_SECTOR_SIZE != 0
 /* Logical sector offsets are rounded with ALIGN_DOWN(), and the Zephyr
  * flash_area_get_sector() used when verification is disabled masks with
@@ -93,6 +118,14 @@ _Static_assert((MCUBOOT_LOGICAL_SECTOR_SIZE &
 #error "MCUBOOT_DIRECT_XIP_REVERT cannot be enabled unless MCUBOOT_DIRECT_XIP is used"
 #endif
 
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL) && defined(MCUBOOT_SWAP_STATUS_COMPACT)
+#error "MCUBOOT_SWAP_STATUS_JOURNAL and MCUBOOT_SWAP_STATUS_COMPACT are exclusive"
+#endif
+
+#if defined(MCUBOOT_SWAP_SCRATCH_RING) && MCUBOOT_SWAP_SCRATCH_RING < 2
+#error "MCUBOOT_SWAP_SCRATCH_RING must be at least 2"
+#endif
+
 #if !defined(MCUBOOT_OVERWRITE_ONLY) && \
     !defined(MCUBOOT_SWAP_USING_MOVE) && \
     !defined(MCUBOOT_SWAP_USING_OFFSET) && \
@@ -235,7 +268,27 @@ typedef struct flash_sector boot_sector_t;
 typedef struct flash_area boot_sector_t;
 #endif
 
+#if defined(MCUBOOT_ENC_IMAGES)
+/* Size of the digest of an encryption TLV kept to identify a cached key. */
+#define BOOT_ENC_CACHE_FP_SIZE 32
+#endif
+
 /** Private state maintained during boot. */
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+/* What is known of the swap status journal, see swap_journal.c. */
+struct boot_swap_journal {
+    bool loaded;
+    uint32_t sector_sz;
+    uint32_t record_sz;
+    /* Offset the next record is written at. */
+    uint32_t next_off;
+    /* Sequence number of the next record. */
+    uint32_t seq;
+    /* Last entry set of each image, -1 if none. */
+    int32_t last[BOOT_IMAGE_NUMBER];
+};
+#endif
+
 struct boot_loader_state {
     struct {
         struct image_header hdr;
@@ -256,6 +309,10 @@ struct boot_loader_state {
         boot_sector_t *sectors;
 #endif
         uint32_t num_sectors;
+#if defined(MCUBOOT_SWAP_SCRATCH_RING)
+        /* Offset of the window erased ahead, UINT32_MAX if none. */
+        uint32_t preerased_off;
+#endif
     } scratch;
 #endif
 
@@ -271,6 +328,16 @@ struct boot_loader_state {
 
 #if defined(MCUBOOT_ENC_IMAGES)
     struct enc_key_data enc[BOOT_IMAGE_NUMBER][BOOT_NUM_SLOTS];
+    /* Keys unwrapped during this boot, see boot_decrypt_key_cached(). */
+    struct boot_enc_key_cache {
+        uint8_t valid;
+        uint8_t fingerprint[BOOT_ENC_CACHE_FP_SIZE];
+        uint8_t key[BOOT_ENC_KEY_SIZE];
+    } enc_cache[BOOT_IMAGE_NUMBER][BOOT_NUM_SLOTS];
+#endif
+
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    struct boot_swap_journal swap_journal;
 #endif
 
 #if (BOOT_IMAGE_NUMBER > 1)
@@ -288,6 +355,11 @@ struct boot_loader_state {
         uint32_t img_dst;
         uint32_t img_sz;
 #endif
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+        /* Digest of the image as loaded to RAM, see boot_ram_load_hash() */
+        bool img_hash_valid;
+        uint8_t img_hash[IMAGE_HASH_SIZE];
+#endif
 #if defined(MCUBOOT_DIRECT_XIP_REVERT) || defined(MCUBOOT_RAM_LOAD_REVERT)
         /* Swap status for the active slot */
         struct boot_swap_state swap_state;
@@ -313,6 +385,27 @@ struct boot_sector_buffer {
 fih_ret bootutil_verify_sig(uint8_t *msg, uint32_t mlen, uint8_t *sig,
                             size_t slen, uint8_t key_id);
 
+/* Pure signatures are verified over image data read from flash, unless the
+ * storage is hashed directly or the crypto backend needs the whole image in
+ * memory (PSA has no multi-part pure EdDSA).
+ */
+#if defined(MCUBOOT_SIGN_PURE) && !defined(MCUBOOT_HASH_STORAGE_DIRECTLY) && \
+    !defined(MCUBOOT_USE_PSA_CRYPTO)
+#define BOOTUTIL_SIGN_PURE_READ
+
+/* Reads up to len bytes of the signed data at off into buf; returns the
+ * number of bytes read, at least one, or a negative value on error.
+ */
+typedef int bootutil_sig_read_fn(void *arg, size_t off, uint8_t *buf, size_t len);
+
+/* Same as bootutil_verify_sig() for a pure signature, with the mlen bytes
+ * of the message obtained through read, using buf as scratch space.
+ */
+fih_ret bootutil_verify_sig_read(bootutil_sig_read_fn *read, void *arg,
+                                 uint32_t mlen, uint8_t *buf, uint32_t buf_sz,
+                                 uint8_t *sig, size_t slen, uint8_t key_id);
+#endif
+
 fih_ret boot_fih_memequal(const void *s1, const void *s2, size_t n);
 
 const struct flash_area *boot_find_status(const struct boot_loader_state *state,
@@ -320,10 +413,23 @@ const struct flash_area *boot_find_status(const struct boot_loader_state *state,
 int boot_magic_compatible_check(uint8_t tbl_val, uint8_t val);
 int boot_status_entries(int image_index, const struct flash_area *fap);
 uint32_t boot_status_off(const struct flash_area *fap);
+int boot_read_status_entry(struct boot_loader_state *state,
+                           const struct flash_area *fap, uint32_t off, int entry,
+                           uint8_t *status);
 int boot_read_swap_state(const struct flash_area *fap,
                          struct boot_swap_state *state);
 int boot_write_magic(const struct flash_area *fap);
-int boot_write_status(const struct boot_loader_state *state, struct boot_status *bs);
+int boot_write_status(struct boot_loader_state *state, struct boot_status *bs);
+#if defined(MCUBOOT_SPARSE_SWAP)
+int boot_write_status_skipped(struct boot_loader_state *state, struct boot_status *bs);
+bool boot_regions_identical(struct boot_loader_state *state, uint32_t off, uint32_t sz);
+#endif
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+int boot_swap_journal_clear(struct boot_loader_state *state);
+int boot_swap_journal_write(struct boot_loader_state *state, uint32_t entry);
+int boot_swap_journal_last(struct boot_loader_state *state, int32_t *entry);
+void boot_swap_journal_reset(struct boot_loader_state *state);
+#endif
 int boot_write_copy_done(const struct flash_area *fap);
 int boot_write_image_ok(const struct flash_area *fap);
 int boot_write_swap_info(const struct flash_area *fap, uint8_t swap_type,
@@ -359,8 +465,12 @@ bool boot_status_is_reset(const struct boot_status *bs);
 
 #ifdef MCUBOOT_ENC_IMAGES
 int boot_write_enc_keys(const struct flash_area *fap, const struct boot_status *bs);
-bool boot_read_enc_key(const struct flash_area *fap, uint8_t slot,
-                       struct boot_status *bs);
+bool boot_read_enc_key(struct boot_loader_state *state, const struct flash_area *fap,
+                       uint8_t slot, struct boot_status *bs);
+int boot_decrypt_key_cached(struct boot_loader_state *state, int slot,
+                            const uint8_t *buf, uint8_t *enckey);
+void boot_enc_cache_wipe(struct boot_loader_state *state);
+void boot_enc_cache_wipe_all(struct boot_loader_state *state);
 #endif
 
 /**
@@ -452,6 +562,7 @@ static inline bool boot_u16_safe_add(uint16_t *dest, uint16_t a, uint16_t b)
 #ifdef MCUBOOT_ENC_IMAGES
 #define BOOT_CURR_ENC(state) ((state)->enc[BOOT_CURR_IMG(state)])
 #define BOOT_CURR_ENC_SLOT(state, slot) (&((state)->enc[BOOT_CURR_IMG(state)][slot]))
+#define BOOT_CURR_ENC_CACHE(state, slot) (&((state)->enc_cache[BOOT_CURR_IMG(state)][slot]))
 #else
 #define BOOT_CURR_ENC(state) NULL
 #define BOOT_CURR_ENC_SLOT(state, slot) NULL
@@ -583,6 +694,17 @@ struct bootsim_ram_info *bootsim_get_ram_info(void);
     (size)), 0)
 
 int boot_load_image_to_sram(struct boot_loader_state *state);
+
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+/* Gets the digest of the first size bytes of the image described by hdr in
+ * fap, if it was computed while loading the current image to RAM; returns
+ * non-zero if it was not.
+ */
+int boot_ram_load_hash(struct boot_loader_state *state,
+                       const struct image_header *hdr,
+                       const struct flash_area *fap, uint32_t size,
+                       uint8_t *hash_result);
+#endif
 #else
 #define IMAGE_RAM_BASE ((uintptr_t)0)
 
@@ -591,6 +713,84 @@ int boot_load_image_to_sram(struct boot_loader_state *state);
 
 #endif /* MCUBOOT_RAM_LOAD */
 
+#if defined(MCUBOOT_WARM_BOOT_CACHE)
+/* Checks whether the image in slot of the current image is the one that was
+ * booted from it last time, and so needs no validation.
+ */
+fih_ret boot_warm_boot_check(struct boot_loader_state *state, uint32_t slot);
+
+/* Records the slots booted and the images in them for the next boot. */
+void boot_warm_boot_save(struct boot_loader_state *state);
+#endif
+
+#if defined(MCUBOOT_METADATA_PREFETCH)
+/* Reads the headers and trailers of all open slots, and the scratch trailer,
+ * in flash address order into the metadata table, from which later reads
+ * of them are served. The areas must be open.
+ */
+void boot_metadata_prefetch(struct boot_loader_state *state);
+#else
+#define boot_metadata_prefetch(state) do { (void)(state); } while (0)
+#endif
+
+/*
+ * Image data shorter than this is read rather than mapped: where
+ * flash_area_map() reprograms an MMU, as on Espressif, a mapping costs more
+ * than a read of a few bytes.
+ */
+#define BOOT_MAP_IMAGE_DATA_MIN_SIZE 256
+
+/*
+ * Gives access to size bytes of image data at start through *data: in place
+ * where the image is in RAM or, for at least BOOT_MAP_IMAGE_DATA_MIN_SIZE
+ * bytes, where the flash area can be mapped; otherwise as a copy read into
+ * buf, which must hold size bytes. Returns 0 on success; the data has to be
+ * released with boot_unmap_image_data().
+ */
+static inline int
+boot_map_image_data(const struct image_header *hdr, const struct flash_area *fap,
+                    uint32_t start, void *buf, uint32_t size, const uint8_t **data)
+{
+#if defined(MCUBOOT_RAM_LOAD)
+    (void)fap;
+    (void)buf;
+    (void)size;
+
+    *data = (const uint8_t *)(IMAGE_RAM_BASE + hdr->ih_load_addr + start);
+    return 0;
+#else
+#if defined(MCUBOOT_USE_FLASH_AREA_MAP)
+    const void *mapped;
+
+    if (size >= BOOT_MAP_IMAGE_DATA_MIN_SIZE &&
+        flash_area_map(fap, start, size, &mapped) == 0) {
+        *data = mapped;
+        return 0;
+    }
+#endif
+    (void)hdr;
+
+    *data = buf;
+    return flash_area_read(fap, start, buf, size);
+#endif
+}
+
+static inline void
+boot_unmap_image_data(const struct flash_area *fap, const uint8_t *data, uint32_t size,
+                      const void *buf)
+{
+#if defined(MCUBOOT_USE_FLASH_AREA_MAP) && !defined(MCUBOOT_RAM_LOAD)
+    if (data != buf) {
+        flash_area_unmap(fap, data, size);
+    }
+#else
+    (void)fap;
+    (void)data;
+    (void)size;
+    (void)buf;
+#endif
+}
+
 uint32_t bootutil_max_image_size(struct boot_loader_state *state, const struct flash_area *fap);
 
 int boot_read_image_size(struct boot_loader_state *state, int slot,
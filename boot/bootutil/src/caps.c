@@ -83,6 +83,15 @@ uint32_t bootutil_get_caps(void)
 #if defined(MCUBOOT_HW_ROLLBACK_PROT)
     res |= BOOTUTIL_CAP_HW_ROLLBACK_PROT;
 #endif
+#if defined(MCUBOOT_SWAP_STATUS_COMPACT)
+    res |= BOOTUTIL_CAP_SWAP_STATUS_COMPACT;
+#endif
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    res |= BOOTUTIL_CAP_SWAP_STATUS_JOURNAL;
+#endif
+#if defined(MCUBOOT_SWAP_SCRATCH_RING)
+    res |= BOOTUTIL_CAP_SWAP_SCRATCH_RING;
+#endif
 
     return res;
 }
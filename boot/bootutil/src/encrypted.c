@@ -630,7 +630,7 @@ boot_enc_load(struct boot_loader_state *state, int slot,
         return -1;
     }
 
-    return boot_decrypt_key(buf, bs->enckey[slot]);
+    return boot_decrypt_key_cached(state, slot, buf, bs->enckey[slot]);
 }
 
 int
@@ -54,6 +54,10 @@ bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
     pubkey = (uint8_t *)bootutil_keys[key_id].key;
     end = pubkey + *bootutil_keys[key_id].len;
     bootutil_ecdsa_init(&ctx);
+#if defined(MCUBOOT_USE_TINYCRYPT) && defined(MCUBOOT_ECDSA_P256_KEY_COMB_TEETH) && \
+    !defined(MCUBOOT_HW_KEY)
+    ctx.key_comb = bootutil_keys[key_id].ec_comb;
+#endif
 
     rc = bootutil_ecdsa_parse_public_key(&ctx, &pubkey, end);
     if (rc) {
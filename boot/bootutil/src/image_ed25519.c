@@ -30,9 +30,40 @@ BOOT_LOG_MODULE_DECLARE(mcuboot);
 #define EDDSA_SIGNATURE_LENGTH 64
 #define NUM_ED25519_BYTES 32
 
+/* The x coordinate of the key is stored next to it in the key table, so
+ * that the key does not have to be decompressed to verify a signature.
+ */
+#if defined(MCUBOOT_ED25519_KEY_POINT) && !defined(MCUBOOT_HW_KEY) && \
+    !defined(MCUBOOT_BUILTIN_KEY)
+#define ED25519_KEY_X(key_id) (bootutil_keys[key_id].ed25519_x)
+#endif
+
+#if defined(ED25519_KEY_X)
+extern int ED25519_verify_key(const uint8_t *message, size_t message_len,
+                              const uint8_t signature[EDDSA_SIGNATURE_LENGTH],
+                              const uint8_t public_key[NUM_ED25519_BYTES],
+                              const uint8_t public_key_x[NUM_ED25519_BYTES]);
+#else
 extern int ED25519_verify(const uint8_t *message, size_t message_len,
                           const uint8_t signature[EDDSA_SIGNATURE_LENGTH],
                           const uint8_t public_key[NUM_ED25519_BYTES]);
+#endif
+#if defined(BOOTUTIL_SIGN_PURE_READ) && defined(ED25519_KEY_X)
+extern int ED25519_verify_read_key(int (*read)(void *arg, size_t off,
+                                               uint8_t *buf, size_t len),
+                                   void *arg, size_t message_len, uint8_t *buf,
+                                   size_t buf_len,
+                                   const uint8_t signature[EDDSA_SIGNATURE_LENGTH],
+                                   const uint8_t public_key[NUM_ED25519_BYTES],
+                                   const uint8_t public_key_x[NUM_ED25519_BYTES]);
+#elif defined(BOOTUTIL_SIGN_PURE_READ)
+extern int ED25519_verify_read(int (*read)(void *arg, size_t off, uint8_t *buf,
+                                           size_t len),
+                               void *arg, size_t message_len, uint8_t *buf,
+                               size_t buf_len,
+                               const uint8_t signature[EDDSA_SIGNATURE_LENGTH],
+                               const uint8_t public_key[NUM_ED25519_BYTES]);
+#endif
 
 #if !defined(MCUBOOT_BUILTIN_KEY) && !defined(MCUBOOT_KEY_IMPORT_BYPASS_ASN)
 /*
@@ -77,6 +108,48 @@ bootutil_import_key(uint8_t **cp, uint8_t *end)
 }
 #endif /* !defined(MCUBOOT_KEY_IMPORT_BYPASS_ASN) */
 
+/* Finds the public key to verify signatures with for key_id.
+ * Returns 0 on success.
+ */
+static int
+bootutil_get_pubkey(uint8_t key_id, uint8_t **pubkey)
+{
+#if !defined(MCUBOOT_BUILTIN_KEY)
+    uint8_t *end;
+#if !defined(MCUBOOT_KEY_IMPORT_BYPASS_ASN)
+    int rc;
+#endif
+
+    *pubkey = (uint8_t *)bootutil_keys[key_id].key;
+    end = *pubkey + *bootutil_keys[key_id].len;
+
+#if !defined(MCUBOOT_KEY_IMPORT_BYPASS_ASN)
+    rc = bootutil_import_key(pubkey, end);
+    if (rc) {
+        BOOT_LOG_DBG("bootutil_verify_sig: import key failed %d", rc);
+        return rc;
+    }
+#else
+    /* Directly use the key contents from the ASN stream,
+     * these are the last NUM_ED25519_BYTES.
+     * There is no check whether this is the correct key,
+     * here, by the algorithm selected.
+     */
+    BOOT_LOG_DBG("bootutil_verify_sig: bypass ASN1");
+    if (*bootutil_keys[key_id].len < NUM_ED25519_BYTES) {
+        return -1;
+    }
+
+    *pubkey = end - NUM_ED25519_BYTES;
+#endif
+#else
+    (void)key_id;
+    *pubkey = NULL;
+#endif
+
+    return 0;
+}
+
 /* Signature verification base function.
  * The function takes buffer of specified length and tries to verify
  * it against provided signature.
@@ -91,10 +164,6 @@ bootutil_verify_sig(uint8_t *msg, uint32_t mlen, uint8_t *sig, size_t slen,
     FIH_DECLARE(fih_rc, FIH_FAILURE);
     uint8_t *pubkey;
 
-#if !defined(MCUBOOT_BUILTIN_KEY)
-    uint8_t *end;
-#endif
-
     BOOT_LOG_DBG("bootutil_verify_sig: ED25519 key_id %d", (int)key_id);
 
 #if !defined(MCUBOOT_SIGN_PURE)
@@ -112,34 +181,59 @@ bootutil_verify_sig(uint8_t *msg, uint32_t mlen, uint8_t *sig, size_t slen,
         goto out;
     }
 
-#if !defined(MCUBOOT_BUILTIN_KEY)
-    pubkey = (uint8_t *)bootutil_keys[key_id].key;
-    end = pubkey + *bootutil_keys[key_id].len;
-
-#if !defined(MCUBOOT_KEY_IMPORT_BYPASS_ASN)
-    rc = bootutil_import_key(&pubkey, end);
+    rc = bootutil_get_pubkey(key_id, &pubkey);
     if (rc) {
-        BOOT_LOG_DBG("bootutil_verify_sig: import key failed %d", rc);
         FIH_SET(fih_rc, FIH_FAILURE);
         goto out;
     }
+
+#if defined(ED25519_KEY_X)
+    rc = ED25519_verify_key(msg, mlen, sig, pubkey, ED25519_KEY_X(key_id));
 #else
-    /* Directly use the key contents from the ASN stream,
-     * these are the last NUM_ED25519_BYTES.
-     * There is no check whether this is the correct key,
-     * here, by the algorithm selected.
-     */
-    BOOT_LOG_DBG("bootutil_verify_sig: bypass ASN1");
-    if (*bootutil_keys[key_id].len < NUM_ED25519_BYTES) {
+    rc = ED25519_verify(msg, mlen, sig, pubkey);
+#endif
+
+    if (rc == 0) {
+        /* if verify returns 0, there was an error. */
         FIH_SET(fih_rc, FIH_FAILURE);
         goto out;
     }
 
-    pubkey = end - NUM_ED25519_BYTES;
-#endif
-#endif
+    FIH_SET(fih_rc, FIH_SUCCESS);
+out:
 
-    rc = ED25519_verify(msg, mlen, sig, pubkey);
+    FIH_RET(fih_rc);
+}
+
+#if defined(BOOTUTIL_SIGN_PURE_READ)
+fih_ret
+bootutil_verify_sig_read(bootutil_sig_read_fn *read, void *arg, uint32_t mlen,
+                         uint8_t *buf, uint32_t buf_sz, uint8_t *sig, size_t slen,
+                         uint8_t key_id)
+{
+    int rc;
+    FIH_DECLARE(fih_rc, FIH_FAILURE);
+    uint8_t *pubkey;
+
+    BOOT_LOG_DBG("bootutil_verify_sig_read: ED25519 key_id %d", (int)key_id);
+
+    if (slen != EDDSA_SIGNATURE_LENGTH) {
+        BOOT_LOG_DBG("bootutil_verify_sig_read: expected slen %d, got %u",
+                     EDDSA_SIGNATURE_LENGTH, (unsigned int)slen);
+        goto out;
+    }
+
+    rc = bootutil_get_pubkey(key_id, &pubkey);
+    if (rc) {
+        goto out;
+    }
+
+#if defined(ED25519_KEY_X)
+    rc = ED25519_verify_read_key(read, arg, mlen, buf, buf_sz, sig, pubkey,
+                                 ED25519_KEY_X(key_id));
+#else
+    rc = ED25519_verify_read(read, arg, mlen, buf, buf_sz, sig, pubkey);
+#endif
 
     if (rc == 0) {
         /* if verify returns 0, there was an error. */
@@ -152,5 +246,6 @@ out:
 
     FIH_RET(fih_rc);
 }
+#endif /* BOOTUTIL_SIGN_PURE_READ */
 
 #endif /* MCUBOOT_SIGN_ED25519 */
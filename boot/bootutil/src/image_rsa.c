@@ -120,14 +120,15 @@ pss_mgf1(uint8_t *mask, const uint8_t *hash)
  * values. RSASSA-PSS-VERIFY RFC8017 section 8.1.2
  */
 static fih_ret
-bootutil_cmp_rsasig(bootutil_rsa_context *ctx, uint8_t *hash, uint32_t hlen,
-  uint8_t *sig, size_t slen)
+bootutil_cmp_rsasig(bootutil_rsa_context *ctx, const struct bootutil_key *key,
+  uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen)
 {
     bootutil_sha_context shactx;
     uint8_t em[MBEDTLS_MPI_MAX_SIZE];
     uint8_t db_mask[PSS_MASK_LEN];
     uint8_t h2[PSS_HLEN];
     int i;
+    int rc;
     FIH_DECLARE(fih_rc, FIH_FAILURE);
 
     /* The caller has already verified that slen == bootutil_rsa_get_len(ctx) */
@@ -141,7 +142,17 @@ bootutil_cmp_rsasig(bootutil_rsa_context *ctx, uint8_t *hash, uint32_t hlen,
     }
 
     /* Apply RSAVP1 to produce em = sig^E mod N using the public key */
-    if (bootutil_rsa_public(ctx, sig, em)) {
+#if defined(MCUBOOT_RSA_MONT_CONSTANTS)
+    if (key->rsa_rr != NULL) {
+        rc = bootutil_rsa_public_mont(ctx, key->rsa_rr, *key->rsa_n0, sig, em);
+    } else {
+        rc = bootutil_rsa_public(ctx, sig, em);
+    }
+#else
+    (void)key;
+    rc = bootutil_rsa_public(ctx, sig, em);
+#endif
+    if (rc) {
         goto out;
     }
 
@@ -241,12 +252,14 @@ out:
 #else /* MCUBOOT_USE_PSA_CRYPTO */
 
 static fih_ret
-bootutil_cmp_rsasig(bootutil_rsa_context *ctx, uint8_t *hash, uint32_t hlen,
-  uint8_t *sig, size_t slen)
+bootutil_cmp_rsasig(bootutil_rsa_context *ctx, const struct bootutil_key *key,
+  uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen)
 {
     int rc = -1;
     FIH_DECLARE(fih_rc, FIH_FAILURE);
 
+    (void)key;
+
     /* PSA Crypto APIs allow the verification in a single call */
     rc = bootutil_rsassa_pss_verify(ctx, hash, hlen, sig, slen);
 
@@ -282,7 +295,8 @@ bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
     if (rc || slen != bootutil_rsa_get_len(&ctx)) {
         goto out;
     }
-    FIH_CALL(bootutil_cmp_rsasig, fih_rc, &ctx, hash, hlen, sig, slen);
+    FIH_CALL(bootutil_cmp_rsasig, fih_rc, &ctx, &bootutil_keys[key_id], hash, hlen,
+             sig, slen);
 
 out:
     bootutil_rsa_drop(&ctx);
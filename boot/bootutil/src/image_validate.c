@@ -161,6 +161,63 @@ static int bootutil_check_for_pure(const struct image_header *hdr, const struct
 }
 #endif
 
+#if defined(BOOTUTIL_SIGN_PURE_READ)
+/* Where to read the data covered by a pure signature from. */
+struct bootutil_pure_reader {
+    struct boot_loader_state *state;
+    const struct image_header *hdr;
+    const struct flash_area *fap;
+    uint32_t start_off;
+};
+
+/*
+ * Reads the header, image and protected TLVs covered by a pure signature,
+ * decrypting the payload of encrypted images the same way bootutil_img_hash()
+ * does.
+ */
+static int
+bootutil_pure_read(void *arg, size_t off, uint8_t *buf, size_t len)
+{
+    struct bootutil_pure_reader *reader = arg;
+    int rc;
+#ifdef MCUBOOT_ENC_IMAGES
+    const struct image_header *hdr = reader->hdr;
+    uint32_t hdr_size = hdr->ih_hdr_size;
+    uint32_t tlv_off = hdr_size + hdr->ih_img_size;
+    int image_index = (reader->state == NULL ? 0 : BOOT_CURR_IMG(reader->state));
+
+    /* The only data that is encrypted in an image is the payload;
+     * both header and TLVs (when protected) are not.
+     */
+    if ((off < hdr_size) && ((off + len) > hdr_size)) {
+        len = hdr_size - off;
+    }
+    if ((off < tlv_off) && ((off + len) > tlv_off)) {
+        len = tlv_off - off;
+    }
+#endif
+
+    rc = flash_area_read(reader->fap, reader->start_off + off, buf, len);
+    if (rc) {
+        BOOT_LOG_DBG("bootutil_pure_read: error %d reading %p %lu %lu",
+                     rc, reader->fap, (unsigned long)off, (unsigned long)len);
+        return -1;
+    }
+
+#ifdef MCUBOOT_ENC_IMAGES
+    if (MUST_DECRYPT(reader->fap, image_index, hdr) && off >= hdr_size && off < tlv_off) {
+        int slot = flash_area_id_to_multi_image_slot(image_index,
+                                                     flash_area_get_id(reader->fap));
+
+        boot_enc_decrypt(BOOT_CURR_ENC_SLOT(reader->state, slot), off - hdr_size,
+                         len, (off - hdr_size) & 0xf, buf);
+    }
+#endif
+
+    return (int)len;
+}
+#endif /* BOOTUTIL_SIGN_PURE_READ */
+
 #ifdef MCUBOOT_USE_TLV_ALLOW_LIST
 /*
  * The following list of TLVs are the only entries allowed in the unprotected
@@ -172,6 +229,9 @@ static const uint16_t allowed_unprot_tlvs[] = {
      IMAGE_TLV_SHA256,
      IMAGE_TLV_SHA384,
      IMAGE_TLV_SHA512,
+#if defined(MCUBOOT_BLAKE2S)
+     IMAGE_TLV_BLAKE2S,
+#endif
      IMAGE_TLV_RSA2048_PSS,
      IMAGE_TLV_ECDSA224,
      IMAGE_TLV_ECDSA_SIG,
@@ -230,13 +290,19 @@ bootutil_img_validate(struct boot_loader_state *state,
 #endif /* EXPECTED_SIG_TLV */
     struct image_tlv_iter it;
     uint8_t buf[SIG_BUF_SIZE];
+#if (defined(EXPECTED_HASH_TLV) && !defined(MCUBOOT_SIGN_PURE)) || \
+    (defined(EXPECTED_KEY_TLV) && !defined(MCUBOOT_HW_KEY))
+    const uint8_t *tlv_data;
+#endif
 #if defined(EXPECTED_HASH_TLV) && !defined(MCUBOOT_SIGN_PURE)
     int image_hash_valid = 0;
     uint8_t hash[IMAGE_HASH_SIZE];
 #endif
     int rc = 0;
     FIH_DECLARE(fih_rc, FIH_FAILURE);
-#if defined(MCUBOOT_SIGN_PURE)
+#if defined(BOOTUTIL_SIGN_PURE_READ)
+    struct bootutil_pure_reader pure_reader;
+#elif defined(MCUBOOT_SIGN_PURE)
     uintptr_t base = 0;
 #endif
 #ifdef MCUBOOT_HW_ROLLBACK_PROT
@@ -346,12 +412,13 @@ bootutil_img_validate(struct boot_loader_state *state,
                 rc = -1;
                 goto out;
             }
-            rc = LOAD_IMAGE_DATA(hdr, fap, off, buf, sizeof(hash));
+            rc = boot_map_image_data(hdr, fap, off, buf, sizeof(hash), &tlv_data);
             if (rc) {
                 goto out;
             }
 
-            FIH_CALL(boot_fih_memequal, fih_rc, hash, buf, sizeof(hash));
+            FIH_CALL(boot_fih_memequal, fih_rc, hash, tlv_data, sizeof(hash));
+            boot_unmap_image_data(fap, tlv_data, sizeof(hash), buf);
             if (FIH_NOT_EQ(fih_rc, FIH_SUCCESS)) {
                 FIH_SET(fih_rc, FIH_FAILURE);
                 goto out;
@@ -373,11 +440,12 @@ bootutil_img_validate(struct boot_loader_state *state,
                 goto out;
             }
 #ifndef MCUBOOT_HW_KEY
-            rc = LOAD_IMAGE_DATA(hdr, fap, off, buf, len);
+            rc = boot_map_image_data(hdr, fap, off, buf, len, &tlv_data);
             if (rc) {
                 goto out;
             }
-            key_id = bootutil_find_key(buf, len);
+            key_id = bootutil_find_key(tlv_data, len);
+            boot_unmap_image_data(fap, tlv_data, len, buf);
 #else
             rc = LOAD_IMAGE_DATA(hdr, fap, off, key_buf, len);
             if (rc) {
@@ -409,9 +477,35 @@ bootutil_img_validate(struct boot_loader_state *state,
             if (rc) {
                 goto out;
             }
-#ifndef MCUBOOT_SIGN_PURE
+#if !defined(MCUBOOT_SIGN_PURE)
             FIH_CALL(bootutil_verify_sig, valid_signature, hash, sizeof(hash),
                                                            buf, len, key_id);
+#elif defined(BOOTUTIL_SIGN_PURE_READ)
+#ifdef MCUBOOT_ENC_IMAGES
+            if (MUST_DECRYPT(fap, (state == NULL ? 0 : BOOT_CURR_IMG(state)), hdr) &&
+                (state == NULL ||
+                 !boot_enc_valid(BOOT_CURR_ENC_SLOT(state, BOOT_SLOT_SECONDARY)))) {
+                BOOT_LOG_DBG("bootutil_img_validate: encrypted image without key");
+                rc = -1;
+                goto out;
+            }
+#endif
+            pure_reader.state = state;
+            pure_reader.hdr = hdr;
+            pure_reader.fap = fap;
+#if defined(MCUBOOT_SWAP_USING_OFFSET)
+            pure_reader.start_off = it.start_off;
+#else
+            pure_reader.start_off = 0;
+#endif
+
+            /* Read the signed range, header + image + protected TLVs, from
+             * the flash area in chunks of the temporary buffer.
+             */
+            FIH_CALL(bootutil_verify_sig_read, valid_signature, bootutil_pure_read,
+                     &pure_reader,
+                     hdr->ih_hdr_size + hdr->ih_img_size + hdr->ih_protect_tlv_size,
+                     tmp_buf, tmp_buf_sz, buf, len, key_id);
 #else
             rc = flash_device_base(flash_area_get_device_id(fap), &base);
             if (rc != 0) {
@@ -402,24 +402,11 @@ boot_status_is_reset(const struct boot_status *bs)
             bs->state == BOOT_STATUS_STATE_0);
 }
 
-/**
- * Writes the supplied boot status to the flash file system.  The boot status
- * contains the current state of an in-progress image copy operation.
- *
- * @param bs                    The boot status to write.
- *
- * @return                      0 on success; nonzero on failure.
- */
-int
-boot_write_status(const struct boot_loader_state *state, struct boot_status *bs)
+#if !defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+/* The area the status of bs is written to. */
+static const struct flash_area *
+boot_status_area(const struct boot_loader_state *state, const struct boot_status *bs)
 {
-    const struct flash_area *fap;
-    uint32_t off;
-    int rc = 0;
-    uint8_t buf[BOOT_MAX_ALIGN];
-    uint32_t align;
-    uint8_t erased_val;
-
     /* NOTE: The first sector copied (that is the last sector on slot) contains
      *       the trailer. Since in the last step the primary slot is erased, the
      *       first two status writes go to the scratch which will be copied to
@@ -429,21 +416,88 @@ boot_write_status(const struct boot_loader_state *state, struct boot_status *bs)
 #if MCUBOOT_SWAP_USING_SCRATCH
     if (bs->use_scratch) {
         /* Write to scratch. */
-        fap = state->scratch.area;
-    } else {
-#endif
-        /* Write to the primary slot. */
-        fap = BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY);
-#if MCUBOOT_SWAP_USING_SCRATCH
+        return state->scratch.area;
     }
+#else
+    (void)bs;
+#endif
+
+    /* Write to the primary slot. */
+    return BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY);
+}
 #endif
 
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+/* The status is recorded in the swap status journal. */
+#elif defined(MCUBOOT_SWAP_STATUS_COMPACT)
+/*
+ * Sets count status bits, from the entry of bs on. The write unit holding
+ * them is read back and written again with the bits programmed, which the
+ * flash must allow as long as bits only move away from the erased value.
+ */
+static int
+boot_write_status_bits(const struct boot_loader_state *state, struct boot_status *bs,
+                       uint32_t count)
+{
+    const struct flash_area *fap;
+    uint32_t entry;
+    uint32_t unit_off;
+    uint32_t off;
+    uint32_t i;
+    int rc = 0;
+    uint8_t buf[BOOT_MAX_ALIGN];
+    uint32_t align;
+    uint8_t erased_val;
+
+    fap = boot_status_area(state, bs);
+    entry = boot_status_internal_off(bs, 1);
+    align = flash_area_align(fap);
+    unit_off = ALIGN_DOWN(entry / 8, align);
+    assert(ALIGN_DOWN((entry + count - 1) / 8, align) == unit_off);
+    off = boot_status_off(fap) + unit_off;
+    erased_val = flash_area_erased_val(fap);
+
+    rc = flash_area_read(fap, off, buf, align);
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    for (i = entry; i < entry + count; i++) {
+        buf[i / 8 - unit_off] = erased_val ^
+                                ((buf[i / 8 - unit_off] ^ erased_val) | (1 << (i % 8)));
+    }
+
+    BOOT_LOG_DBG("writing swap status; fa_id=%d off=0x%lx (0x%lx) bit=%lu",
+                 flash_area_get_id(fap), (unsigned long)off,
+                 (unsigned long)flash_area_get_off(fap) + off, (unsigned long)entry);
+
+    rc = flash_area_write(fap, off, buf, align);
+    if (rc != 0) {
+        rc = BOOT_EFLASH;
+    }
+
+    return rc;
+}
+#else
+/* Writes value to the status entry of bs. */
+static int
+boot_write_status_entry(const struct boot_loader_state *state, struct boot_status *bs,
+                        uint8_t value)
+{
+    const struct flash_area *fap;
+    uint32_t off;
+    int rc = 0;
+    uint8_t buf[BOOT_MAX_ALIGN];
+    uint32_t align;
+    uint8_t erased_val;
+
+    fap = boot_status_area(state, bs);
     off = boot_status_off(fap) +
           boot_status_internal_off(bs, BOOT_WRITE_SZ(state));
     align = flash_area_align(fap);
     erased_val = flash_area_erased_val(fap);
     memset(buf, erased_val, BOOT_MAX_ALIGN);
-    buf[0] = bs->state;
+    buf[0] = value;
 
     BOOT_LOG_DBG("writing swap status; fa_id=%d off=0x%lx (0x%lx)",
                  flash_area_get_id(fap), (unsigned long)off,
@@ -456,6 +510,56 @@ boot_write_status(const struct boot_loader_state *state, struct boot_status *bs)
 
     return rc;
 }
+#endif
+
+/**
+ * Writes the supplied boot status to the flash file system.  The boot status
+ * contains the current state of an in-progress image copy operation.
+ *
+ * @param bs                    The boot status to write.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_write_status(struct boot_loader_state *state, struct boot_status *bs)
+{
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    return boot_swap_journal_write(state, boot_status_internal_off(bs, 1));
+#elif defined(MCUBOOT_SWAP_STATUS_COMPACT)
+    return boot_write_status_bits(state, bs, 1);
+#else
+    return boot_write_status_entry(state, bs, bs->state);
+#endif
+}
+
+#if defined(MCUBOOT_SPARSE_SWAP)
+/**
+ * Records that the swap step of bs, which must not have started, was
+ * skipped; the status then reads as if the step was complete.
+ *
+ * Only the last entry of the step is written, the others are left erased.
+ * An interrupted write leaves that entry erased or set, but never sets the
+ * first entries, so the step can not be resumed as if its sectors had been
+ * copied to scratch.
+ *
+ * @param bs                    The boot status of the skipped step.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_write_status_skipped(struct boot_loader_state *state, struct boot_status *bs)
+{
+    int rc;
+
+    assert(bs->state == BOOT_STATUS_STATE_0);
+
+    bs->state = BOOT_STATUS_STATE_2;
+    rc = boot_write_status(state, bs);
+    bs->state = BOOT_STATUS_STATE_0;
+
+    return rc;
+}
+#endif
 #endif /* !MCUBOOT_RAM_LOAD */
 #endif /* !MCUBOOT_DIRECT_XIP */
 
@@ -640,7 +744,14 @@ boot_validate_slot(struct boot_loader_state *state, int slot,
         BOOT_HOOK_CALL_FIH(boot_image_check_hook, FIH_BOOT_HOOK_REGULAR,
                            fih_rc, BOOT_CURR_IMG(state), slot);
         if (FIH_EQ(fih_rc, FIH_BOOT_HOOK_REGULAR)) {
-            FIH_CALL(boot_check_image, fih_rc, state, bs, slot);
+#if defined(MCUBOOT_WARM_BOOT_CACHE)
+            /* Skip the image check if it passed it on the previous boot. */
+            FIH_CALL(boot_warm_boot_check, fih_rc, state, slot);
+            if (FIH_NOT_EQ(fih_rc, FIH_SUCCESS))
+#endif
+            {
+                FIH_CALL(boot_check_image, fih_rc, state, bs, slot);
+            }
         }
     }
 #if defined(MCUBOOT_SWAP_USING_OFFSET)
@@ -909,76 +1020,103 @@ boot_copy_region(struct boot_loader_state *state,
     return 0;
 }
 
+#if defined(MCUBOOT_SPARSE_SWAP)
 /**
- * Overwrite primary slot with the image contained in the secondary slot.
- * If a prior copy operation was interrupted by a system reset, this function
- * redos the copy.
+ * Compares a region of the primary slot with the same region of the
+ * secondary slot, to find the sectors an upgrade would leave unchanged.
+ * Encrypted images are never identical, as copying them between the slots
+ * encrypts or decrypts them.
  *
- * @param bs                    The current boot status.  This function reads
- *                                  this struct to determine if it is resuming
- *                                  an interrupted swap operation.  This
- *                                  function writes the updated status to this
- *                                  function on return.
+ * @param off                   The offset of the region in both slots.
+ * @param sz                    The size of the region.
  *
- * @return                      0 on success; nonzero on failure.
+ * @return                      true if both slots hold the same data.
  */
+bool
+boot_regions_identical(struct boot_loader_state *state, uint32_t off, uint32_t sz)
+{
+    const struct flash_area *fap_primary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY);
+    const struct flash_area *fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_SECONDARY);
+    uint8_t primary[BOOT_TMPBUF_SZ / 2];
+    uint8_t secondary[BOOT_TMPBUF_SZ / 2];
+    uint32_t chunk_sz;
+    uint32_t pos;
+
+#ifdef MCUBOOT_ENC_IMAGES
+    if (IS_ENCRYPTED(boot_img_hdr(state, BOOT_SLOT_PRIMARY)) ||
+        IS_ENCRYPTED(boot_img_hdr(state, BOOT_SLOT_SECONDARY))) {
+        return false;
+    }
+#endif
+
+    for (pos = 0; pos < sz; pos += chunk_sz) {
+        chunk_sz = sz - pos;
+        if (chunk_sz > sizeof(primary)) {
+            chunk_sz = sizeof(primary);
+        }
+
+        if (flash_area_read(fap_primary_slot, off + pos, primary, chunk_sz) != 0 ||
+            flash_area_read(fap_secondary_slot, off + pos, secondary, chunk_sz) != 0 ||
+            memcmp(primary, secondary, chunk_sz) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
 #if defined(MCUBOOT_OVERWRITE_ONLY) || defined(MCUBOOT_BOOTSTRAP)
-static int
-boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
+/*
+ * What an overwrite of the primary slot of the current image erases and
+ * copies: sectors [0, erase_sects) of the primary slot, and with
+ * MCUBOOT_OVERWRITE_ONLY_FAST also the trailer_sz bytes at trailer_off, are
+ * erased, then the first size bytes of the secondary slot are copied.
+ */
+struct boot_copy_plan {
+    size_t erase_sects;
+    uint32_t size;
+    uint32_t trailer_off;
+    uint32_t trailer_sz;
+};
+
+static void
+boot_copy_image_plan(struct boot_loader_state *state, struct boot_copy_plan *plan)
 {
     size_t sect_count;
     size_t sect;
-    int rc;
-    size_t size;
-    size_t this_size;
-    size_t last_sector;
-    const struct flash_area *fap_primary_slot;
-    const struct flash_area *fap_secondary_slot;
-    uint8_t image_index;
-
+    uint32_t size;
 #if defined(MCUBOOT_OVERWRITE_ONLY_FAST) || defined(MCUBOOT_SWAP_USING_MOVE) || defined(MCUBOOT_SWAP_USING_OFFSET)
-    uint32_t sector;
+    uint32_t src_size = 0;
     uint32_t trailer_sz;
+    uint32_t sector;
     uint32_t off;
     uint32_t sz;
-#endif
-
-    (void)bs;
+    int rc;
 
-#if defined(MCUBOOT_OVERWRITE_ONLY_FAST) || defined(MCUBOOT_SWAP_USING_MOVE) || defined(MCUBOOT_SWAP_USING_OFFSET)
-    uint32_t src_size = 0;
     rc = boot_read_image_size(state, BOOT_SLOT_SECONDARY, &src_size);
     assert(rc == 0);
+    (void)rc;
 #endif
 
-    image_index = BOOT_CURR_IMG(state);
-
-    BOOT_LOG_INF("Image %d upgrade secondary slot -> primary slot", image_index);
-    BOOT_LOG_INF("Erasing the primary slot");
-
-    fap_primary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY);
-    assert(fap_primary_slot != NULL);
-
-    fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_SECONDARY);
-    assert(fap_secondary_slot != NULL);
-
     sect_count = boot_img_num_sectors(state, BOOT_SLOT_PRIMARY);
     for (sect = 0, size = 0; sect < sect_count; sect++) {
-        this_size = boot_img_sector_size(state, BOOT_SLOT_PRIMARY, sect);
-        rc = boot_erase_region(fap_primary_slot, size, this_size, false);
-        assert(rc == 0);
+        size += boot_img_sector_size(state, BOOT_SLOT_PRIMARY, sect);
 
 #if defined(MCUBOOT_OVERWRITE_ONLY_FAST) || defined(MCUBOOT_SWAP_USING_MOVE) || defined(MCUBOOT_SWAP_USING_OFFSET)
-        if ((size + this_size) >= src_size) {
-            size += src_size - size;
-            size += BOOT_WRITE_SZ(state) - (size % BOOT_WRITE_SZ(state));
+        if (size >= src_size) {
+            sect++;
+            size = src_size + BOOT_WRITE_SZ(state) - (src_size % BOOT_WRITE_SZ(state));
             break;
         }
 #endif
-
-        size += this_size;
     }
 
+    plan->erase_sects = sect;
+    plan->size = size;
+    plan->trailer_off = 0;
+    plan->trailer_sz = 0;
+
 #if defined(MCUBOOT_OVERWRITE_ONLY_FAST) || defined(MCUBOOT_SWAP_USING_MOVE) || defined(MCUBOOT_SWAP_USING_OFFSET)
     trailer_sz = boot_trailer_sz(BOOT_WRITE_SZ(state));
     sector = boot_img_num_sectors(state, BOOT_SLOT_PRIMARY) - 1;
@@ -989,15 +1127,47 @@ boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
         sector--;
     } while (sz < trailer_sz);
 
-    rc = boot_erase_region(fap_primary_slot, off, sz, false);
-    assert(rc == 0);
+    plan->trailer_off = off;
+    plan->trailer_sz = sz;
+#endif
+}
+
+/* Whether sector sect of the primary slot already holds what the copy of
+ * the secondary slot would write to it, so that it can be left as it is.
+ * Sectors holding part of the trailer are always rewritten.
+ */
+static bool
+boot_copy_sector_unchanged(struct boot_loader_state *state, size_t sect)
+{
+#if defined(MCUBOOT_SPARSE_SWAP) && !defined(MCUBOOT_SWAP_USING_OFFSET)
+    uint32_t off = boot_img_sector_off(state, BOOT_SLOT_PRIMARY, sect);
+    uint32_t sz = boot_img_sector_size(state, BOOT_SLOT_PRIMARY, sect);
+    uint32_t trailer_off = flash_area_get_size(BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY)) -
+                           boot_trailer_sz(BOOT_WRITE_SZ(state));
+
+    if (off + sz > trailer_off) {
+        return false;
+    }
+
+    return boot_regions_identical(state, off, sz);
+#else
+    (void)state;
+    (void)sect;
+    return false;
 #endif
+}
 
 #ifdef MCUBOOT_ENC_IMAGES
+/* Loads the key of the image in the secondary slot if it is encrypted. */
+static int
+boot_copy_image_load_key(struct boot_loader_state *state, struct boot_status *bs)
+{
+    int rc;
+
     if (IS_ENCRYPTED(boot_img_hdr(state, BOOT_SLOT_SECONDARY))) {
         rc = boot_enc_load(state, BOOT_SLOT_SECONDARY,
                 boot_img_hdr(state, BOOT_SLOT_SECONDARY),
-                fap_secondary_slot, bs);
+                BOOT_IMG_AREA(state, BOOT_SLOT_SECONDARY), bs);
 
         if (rc < 0) {
             return BOOT_EBADIMAGE;
@@ -1006,22 +1176,25 @@ boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
             return BOOT_EBADIMAGE;
         }
     }
-#endif
 
-    BOOT_LOG_INF("Image %d copying the secondary slot to the primary slot: 0x%zx bytes",
-                 image_index, size);
-#if defined(MCUBOOT_SWAP_USING_OFFSET)
-    rc = BOOT_COPY_REGION(state, fap_secondary_slot, fap_primary_slot,
-                          boot_img_sector_size(state, BOOT_SLOT_SECONDARY, 0), 0, size, 0);
-#else
-    rc = boot_copy_region(state, fap_secondary_slot, fap_primary_slot, 0, 0, size);
+    return 0;
+}
 #endif
-    if (rc != 0) {
-        return rc;
-    }
+
+/*
+ * Completes an overwrite once size bytes have been copied to the primary
+ * slot: marks the primary slot, updates the security counter and removes
+ * the image from the secondary slot.
+ */
+static int
+boot_copy_image_finish(struct boot_loader_state *state, uint32_t size)
+{
+    const struct flash_area *fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_SECONDARY);
+    size_t last_sector;
+    int rc;
 
 #if defined(MCUBOOT_OVERWRITE_ONLY_FAST) || defined(MCUBOOT_SWAP_USING_MOVE) || defined(MCUBOOT_SWAP_USING_OFFSET)
-    rc = boot_write_magic(fap_primary_slot);
+    rc = boot_write_magic(BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY));
     if (rc != 0) {
         return rc;
     }
@@ -1072,8 +1245,299 @@ boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
 
     return 0;
 }
+
+#if !defined(MCUBOOT_INTERLEAVED_UPGRADE) || (BOOT_IMAGE_NUMBER == 1)
+/**
+ * Overwrite primary slot with the image contained in the secondary slot.
+ * If a prior copy operation was interrupted by a system reset, this function
+ * redos the copy.
+ *
+ * @param bs                    The current boot status.  This function reads
+ *                                  this struct to determine if it is resuming
+ *                                  an interrupted swap operation.  This
+ *                                  function writes the updated status to this
+ *                                  function on return.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+static int
+boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
+{
+    struct boot_copy_plan plan;
+    size_t sect;
+    unsigned int skipped = 0;
+    int rc;
+    const struct flash_area *fap_primary_slot;
+    const struct flash_area *fap_secondary_slot;
+    uint8_t image_index;
+
+    (void)bs;
+
+    image_index = BOOT_CURR_IMG(state);
+
+    BOOT_LOG_INF("Image %d upgrade secondary slot -> primary slot", image_index);
+    BOOT_LOG_INF("Erasing the primary slot");
+
+    fap_primary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY);
+    assert(fap_primary_slot != NULL);
+
+    fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_SECONDARY);
+    assert(fap_secondary_slot != NULL);
+
+    boot_copy_image_plan(state, &plan);
+
+    for (sect = 0; sect < plan.erase_sects; sect++) {
+        if (boot_copy_sector_unchanged(state, sect)) {
+            skipped++;
+            continue;
+        }
+
+        rc = boot_erase_region(fap_primary_slot,
+                               boot_img_sector_off(state, BOOT_SLOT_PRIMARY, sect),
+                               boot_img_sector_size(state, BOOT_SLOT_PRIMARY, sect), false);
+        assert(rc == 0);
+    }
+
+    if (plan.trailer_sz != 0) {
+        rc = boot_erase_region(fap_primary_slot, plan.trailer_off, plan.trailer_sz, false);
+        assert(rc == 0);
+    }
+
+#ifdef MCUBOOT_ENC_IMAGES
+    rc = boot_copy_image_load_key(state, bs);
+    if (rc != 0) {
+        return rc;
+    }
+#endif
+
+    BOOT_LOG_INF("Image %d copying the secondary slot to the primary slot: 0x%" PRIx32 " bytes",
+                 image_index, plan.size);
+#if defined(MCUBOOT_SWAP_USING_OFFSET)
+    rc = BOOT_COPY_REGION(state, fap_secondary_slot, fap_primary_slot,
+                          boot_img_sector_size(state, BOOT_SLOT_SECONDARY, 0), 0, plan.size, 0);
+#elif defined(MCUBOOT_SPARSE_SWAP)
+    /* Sectors left unchanged were not erased; the trailer erase may have
+     * erased the last ones since, so look at each one again.
+     */
+    rc = 0;
+    for (sect = 0; rc == 0 && sect < boot_img_num_sectors(state, BOOT_SLOT_PRIMARY) &&
+                   boot_img_sector_off(state, BOOT_SLOT_PRIMARY, sect) < plan.size; sect++) {
+        uint32_t off = boot_img_sector_off(state, BOOT_SLOT_PRIMARY, sect);
+        uint32_t sz = boot_img_sector_size(state, BOOT_SLOT_PRIMARY, sect);
+
+        if (boot_copy_sector_unchanged(state, sect)) {
+            continue;
+        }
+        if (sz > plan.size - off) {
+            sz = plan.size - off;
+        }
+        rc = boot_copy_region(state, fap_secondary_slot, fap_primary_slot, off, off, sz);
+    }
+
+    if (skipped != 0) {
+        BOOT_LOG_INF("Image %d: %u unchanged sectors skipped", image_index, skipped);
+    }
+#else
+    rc = boot_copy_region(state, fap_secondary_slot, fap_primary_slot, 0, 0, plan.size);
+#endif
+    if (rc != 0) {
+        return rc;
+    }
+
+    return boot_copy_image_finish(state, plan.size);
+}
+#endif /* !MCUBOOT_INTERLEAVED_UPGRADE || BOOT_IMAGE_NUMBER == 1 */
+#endif
+
+#if defined(MCUBOOT_INTERLEAVED_UPGRADE) && !defined(MCUBOOT_OVERWRITE_ONLY)
+#error "MCUBOOT_INTERLEAVED_UPGRADE requires MCUBOOT_OVERWRITE_ONLY"
+#endif
+
+#if defined(MCUBOOT_INTERLEAVED_UPGRADE) && (BOOT_IMAGE_NUMBER > 1)
+
+/*
+ * Interleaved overwrite of several images.
+ *
+ * The overwrite of each image is split in steps: the erase of one sector of
+ * its primary slot, the erase of the trailer, the copy of one sector, and
+ * the final step of boot_copy_image_finish(). The scheduler goes round the
+ * images and runs the next step of each image whose flash devices are not
+ * busy. With a backend that starts erases without waiting for them
+ * (MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC), one image is copied or erased while
+ * an erase is in progress on the device of another one. Each image is
+ * overwritten in the same order as by boot_copy_image(), and its secondary
+ * slot is only removed once its copy is complete, so an interrupted upgrade
+ * restarts from the secondary slot as before, independently for each image.
+ */
+enum boot_copy_step {
+    BOOT_COPY_STEP_ERASE,
+    BOOT_COPY_STEP_ERASE_TRAILER,
+    BOOT_COPY_STEP_COPY,
+    BOOT_COPY_STEP_FINISH,
+    BOOT_COPY_STEP_DONE,
+};
+
+struct boot_copy_job {
+    struct boot_copy_plan plan;
+    /* Next sector of the primary slot to erase or copy */
+    size_t sect;
+    enum boot_copy_step step;
+};
+
+/* Whether a previous erase on the device of fa is still in progress. */
+static bool
+boot_erase_busy(const struct flash_area *fa)
+{
+#if defined(MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC)
+    return flash_area_erase_busy(fa) > 0;
+#else
+    (void)fa;
+    return false;
+#endif
+}
+
+/* Runs the next step of the overwrite of the current image. */
+static int
+boot_copy_job_step(struct boot_loader_state *state, struct boot_copy_job *job,
+                   struct boot_status *bs)
+{
+    const struct flash_area *fap_primary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY);
+    const struct flash_area *fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SLOT_SECONDARY);
+    uint32_t off;
+    uint32_t sz;
+    int rc = 0;
+
+#ifndef MCUBOOT_ENC_IMAGES
+    (void)bs;
+#endif
+
+    switch (job->step) {
+    case BOOT_COPY_STEP_ERASE:
+        if (job->sect < job->plan.erase_sects) {
+            if (!boot_copy_sector_unchanged(state, job->sect)) {
+                rc = boot_erase_region_start(fap_primary_slot,
+                                      boot_img_sector_off(state, BOOT_SLOT_PRIMARY, job->sect),
+                                      boot_img_sector_size(state, BOOT_SLOT_PRIMARY, job->sect));
+            }
+            job->sect++;
+            break;
+        }
+        job->step = BOOT_COPY_STEP_ERASE_TRAILER;
+        /* fallthrough */
+    case BOOT_COPY_STEP_ERASE_TRAILER:
+        job->step = BOOT_COPY_STEP_COPY;
+        job->sect = 0;
+        if (job->plan.trailer_sz != 0) {
+            rc = boot_erase_region_start(fap_primary_slot, job->plan.trailer_off,
+                                  job->plan.trailer_sz);
+            break;
+        }
+        /* fallthrough */
+    case BOOT_COPY_STEP_COPY:
+        if (job->sect == 0) {
+#ifdef MCUBOOT_ENC_IMAGES
+            rc = boot_copy_image_load_key(state, bs);
+            if (rc != 0) {
+                break;
+            }
+#endif
+            BOOT_LOG_INF("Image %d copying the secondary slot to the primary slot: 0x%" PRIx32
+                         " bytes", BOOT_CURR_IMG(state), job->plan.size);
+        }
+
+        if (job->sect < boot_img_num_sectors(state, BOOT_SLOT_PRIMARY) &&
+            boot_img_sector_off(state, BOOT_SLOT_PRIMARY, job->sect) < job->plan.size) {
+            off = boot_img_sector_off(state, BOOT_SLOT_PRIMARY, job->sect);
+            sz = boot_img_sector_size(state, BOOT_SLOT_PRIMARY, job->sect);
+            if (sz > job->plan.size - off) {
+                sz = job->plan.size - off;
+            }
+            if (!boot_copy_sector_unchanged(state, job->sect)) {
+                rc = boot_copy_region(state, fap_secondary_slot, fap_primary_slot,
+                                      off, off, sz);
+            }
+            job->sect++;
+            break;
+        }
+        job->step = BOOT_COPY_STEP_FINISH;
+        /* fallthrough */
+    case BOOT_COPY_STEP_FINISH:
+        rc = boot_copy_image_finish(state, job->plan.size);
+        job->step = BOOT_COPY_STEP_DONE;
+        break;
+    case BOOT_COPY_STEP_DONE:
+        break;
+    }
+
+    return rc;
+}
+
+/**
+ * Overwrites the primary slot of each image set in upgrade with its
+ * secondary slot, interleaving the steps of images on different flash
+ * devices.
+ *
+ * @param upgrade               Images to overwrite, by image index.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+static int
+boot_copy_images_interleaved(struct boot_loader_state *state, const bool *upgrade)
+{
+    struct boot_copy_job jobs[BOOT_IMAGE_NUMBER];
+    struct boot_status bs[BOOT_IMAGE_NUMBER];
+    bool pending;
+    int rc = 0;
+
+    IMAGES_ITER(BOOT_CURR_IMG(state)) {
+        if (!upgrade[BOOT_CURR_IMG(state)]) {
+            jobs[BOOT_CURR_IMG(state)].step = BOOT_COPY_STEP_DONE;
+            continue;
+        }
+
+        BOOT_LOG_INF("Image %d upgrade secondary slot -> primary slot",
+                     BOOT_CURR_IMG(state));
+        boot_status_reset(&bs[BOOT_CURR_IMG(state)]);
+        boot_copy_image_plan(state, &jobs[BOOT_CURR_IMG(state)].plan);
+        jobs[BOOT_CURR_IMG(state)].sect = 0;
+        jobs[BOOT_CURR_IMG(state)].step = BOOT_COPY_STEP_ERASE;
+    }
+
+    do {
+        pending = false;
+
+        IMAGES_ITER(BOOT_CURR_IMG(state)) {
+            struct boot_copy_job *job = &jobs[BOOT_CURR_IMG(state)];
+
+            if (job->step == BOOT_COPY_STEP_DONE) {
+                continue;
+            }
+
+            pending = true;
+            if (boot_erase_busy(BOOT_IMG_AREA(state, BOOT_SLOT_PRIMARY)) ||
+                boot_erase_busy(BOOT_IMG_AREA(state, BOOT_SLOT_SECONDARY))) {
+                continue;
+            }
+
+            rc = boot_copy_job_step(state, job, &bs[BOOT_CURR_IMG(state)]);
+            if (rc != 0) {
+                BOOT_LOG_ERR("Image %d upgrade failed: %d", BOOT_CURR_IMG(state), rc);
+                goto out;
+            }
+        }
+
+        MCUBOOT_WATCHDOG_FEED();
+    } while (pending);
+
+out:
+#if defined(MCUBOOT_ENC_IMAGES)
+    bootutil_wipe_memory(bs, sizeof(bs));
 #endif
 
+    return rc;
+}
+#endif /* MCUBOOT_INTERLEAVED_UPGRADE && BOOT_IMAGE_NUMBER > 1 */
+
 #if !defined(MCUBOOT_OVERWRITE_ONLY)
 /**
  * Swaps the two images in flash.  If a prior copy operation was interrupted
@@ -1110,6 +1574,12 @@ boot_swap_image(struct boot_loader_state *state, struct boot_status *bs)
          * No swap ever happened, so need to find the largest image which
          * will be used to determine the amount of sectors to swap.
          */
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+        /* Entries the journal holds are from an earlier swap. */
+        rc = boot_swap_journal_clear(state);
+        assert(rc == 0);
+#endif
+
         hdr = boot_img_hdr(state, BOOT_SLOT_PRIMARY);
         if (hdr->ih_magic == IMAGE_MAGIC) {
             rc = boot_read_image_size(state, BOOT_SLOT_PRIMARY, &copy_size);
@@ -1180,7 +1650,7 @@ boot_swap_image(struct boot_loader_state *state, struct boot_status *bs)
 
             boot_enc_init(BOOT_CURR_ENC_SLOT(state, slot));
 
-            if (!boot_read_enc_key(fap, slot, bs)) {
+            if (!boot_read_enc_key(state, fap, slot, bs)) {
                 BOOT_LOG_DBG("boot_swap_image: Failed loading key (%d, %d)",
                               image_index, slot);
             } else {
@@ -1207,6 +1677,7 @@ boot_swap_image(struct boot_loader_state *state, struct boot_status *bs)
 }
 #endif
 
+#if !defined(MCUBOOT_INTERLEAVED_UPGRADE) || (BOOT_IMAGE_NUMBER == 1)
 /**
  * Performs a clean (not aborted) image update.
  *
@@ -1284,6 +1755,7 @@ boot_perform_update(struct boot_loader_state *state, struct boot_status *bs)
 
     return rc;
 }
+#endif
 
 /**
  * Completes a previously aborted image swap.
@@ -1688,9 +2160,18 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
     FIH_DECLARE(fih_rc, FIH_FAILURE);
     bool has_upgrade;
     volatile int fih_cnt;
+#if defined(MCUBOOT_INTERLEAVED_UPGRADE) && (BOOT_IMAGE_NUMBER > 1)
+    bool interleave[BOOT_IMAGE_NUMBER] = { false };
+#endif
 
     BOOT_LOG_DBG("context_boot_go");
 
+    /* Flash may have been written since the last boot attempt. */
+    boot_flash_cache_invalidate();
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    boot_swap_journal_reset(state);
+#endif
+
 #if !defined(MCUBOOT_LOGICAL_SECTOR_SIZE) || MCUBOOT_LOGICAL_SECTOR_SIZE == 0
 #if defined(__BOOTSIM__)
     struct boot_sector_buffer sector_buf;
@@ -1713,6 +2194,9 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
         FIH_PANIC;
     }
 
+    /* Read the headers and trailers of all images in one pass. */
+    boot_metadata_prefetch(state);
+
     /* Iterate over all the images. By the end of the loop the swap type has
      * to be determined for each image and all aborted swaps have to be
      * completed.
@@ -1819,7 +2303,13 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
                                 BOOT_IMG_AREA(state, BOOT_SLOT_SECONDARY));
             if (rc == BOOT_HOOK_REGULAR)
             {
+#if defined(MCUBOOT_INTERLEAVED_UPGRADE) && (BOOT_IMAGE_NUMBER > 1)
+                /* Done below, together with the other images. */
+                interleave[BOOT_CURR_IMG(state)] = true;
+                rc = 0;
+#else
                 rc = boot_perform_update(state, &bs);
+#endif
             }
             assert(rc == 0);
             break;
@@ -1851,6 +2341,17 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
         }
     }
 
+#if defined(MCUBOOT_INTERLEAVED_UPGRADE) && (BOOT_IMAGE_NUMBER > 1)
+    rc = boot_copy_images_interleaved(state, interleave);
+    if (rc != 0) {
+        BOOT_LOG_ERR("panic!");
+        assert(0);
+
+        /* Loop forever... */
+        FIH_PANIC;
+    }
+#endif
+
     /* Iterate over all the images. At this point all required update operations
      * have finished. By the end of the loop each image in the primary slot will
      * have been re-validated.
@@ -1951,7 +2452,13 @@ out:
 #else
     memset(&bs, 0, sizeof(struct boot_status));
 #endif
+#ifdef MCUBOOT_ENC_IMAGES
+    /* Same for the keys unwrapped during this call. */
+    boot_enc_cache_wipe_all(state);
+#endif
 
+    boot_flash_cache_report();
+    boot_metadata_drop();
     boot_close_all_flash_areas(state);
     FIH_RET(fih_rc);
 }
@@ -2366,11 +2873,16 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
     int rc;
     FIH_DECLARE(fih_rc, FIH_FAILURE);
 
+    /* Flash may have been written since the last boot attempt. */
+    boot_flash_cache_invalidate();
+
     rc = boot_open_all_flash_areas(state);
     if (rc != 0) {
         goto out;
     }
 
+    boot_metadata_prefetch(state);
+
     rc = boot_get_slot_usage(state);
     if (rc != 0) {
         goto close;
@@ -2423,12 +2935,22 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
     print_loaded_images(state);
 #endif
 
+#if defined(MCUBOOT_WARM_BOOT_CACHE)
+    boot_warm_boot_save(state);
+#endif
+
     fill_rsp(state, rsp);
 
 close:
+    boot_flash_cache_report();
+    boot_metadata_drop();
     boot_close_all_flash_areas(state);
 
 out:
+#ifdef MCUBOOT_ENC_IMAGES
+    /* The keys unwrapped during this call must not reach the image. */
+    boot_enc_cache_wipe_all(state);
+#endif
     if (rc != 0) {
         FIH_SET(fih_rc, FIH_FAILURE);
     }
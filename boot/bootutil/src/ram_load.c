@@ -101,6 +101,77 @@ boot_verify_ram_load_address(struct boot_loader_state *state)
     return 0;
 }
 
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+/* Size of the chunks an image is copied to RAM in, small enough for a chunk
+ * to still be in the data cache when it is hashed.
+ */
+#define BOOT_RAM_LOAD_CHUNK_SZ 4096
+
+/* Number of bytes at the start of an image covered by its digest. */
+static uint32_t
+boot_ram_load_hash_size(const struct image_header *hdr)
+{
+    return hdr->ih_hdr_size + hdr->ih_img_size + hdr->ih_protect_tlv_size;
+}
+
+/* Hashes what of [off, off + len) of the image in RAM is covered by its
+ * digest; ranges must be given in order and without gaps.
+ */
+static void
+boot_ram_load_hash_update(bootutil_sha_context *sha_ctx, const uint8_t *ram_dst,
+                          uint32_t off, uint32_t len, uint32_t hash_sz)
+{
+    if (off >= hash_sz) {
+        return;
+    }
+    if (len > hash_sz - off) {
+        len = hash_sz - off;
+    }
+
+    bootutil_sha_update(sha_ctx, ram_dst + off, len);
+}
+
+/* Keeps the digest of the image loaded for the current image, provided all
+ * of the bytes it covers were loaded.
+ */
+static void
+boot_ram_load_hash_finish(struct boot_loader_state *state,
+                          bootutil_sha_context *sha_ctx, uint32_t hash_sz,
+                          uint32_t img_sz)
+{
+    struct slot_usage_t *usage = &state->slot_usage[BOOT_CURR_IMG(state)];
+
+    if (hash_sz <= img_sz) {
+        bootutil_sha_finish(sha_ctx, usage->img_hash);
+        usage->img_hash_valid = true;
+    }
+}
+
+int
+boot_ram_load_hash(struct boot_loader_state *state,
+                   const struct image_header *hdr,
+                   const struct flash_area *fap, uint32_t size,
+                   uint8_t *hash_result)
+{
+    struct slot_usage_t *usage;
+
+    if (state == NULL) {
+        return -1;
+    }
+
+    usage = &state->slot_usage[BOOT_CURR_IMG(state)];
+    if (!usage->img_hash_valid || usage->active_slot == BOOT_SLOT_NONE ||
+        BOOT_IMG_AREA(state, usage->active_slot) != fap ||
+        hdr->ih_load_addr != usage->img_dst ||
+        boot_ram_load_hash_size(hdr) != size) {
+        return -1;
+    }
+
+    memcpy(hash_result, usage->img_hash, IMAGE_HASH_SIZE);
+    return 0;
+}
+#endif /* BOOTUTIL_RAM_LOAD_HASH */
+
 #ifdef MCUBOOT_ENC_IMAGES
 
 /**
@@ -124,7 +195,8 @@ boot_decrypt_and_copy_image_to_sram(struct boot_loader_state *state,
      * 1. The whole image is copied to the RAM (header + payload + TLV).
      * 2. The encryption key is loaded from the TLV in flash.
      * 3. The image is then decrypted chunk by chunk in RAM (1 chunk
-     * is 1024 bytes). Only the payload section is decrypted.
+     * is 1024 bytes). Only the payload section is decrypted. Each chunk
+     * is hashed once decrypted, along with the header and protected TLVs.
      * 4. The image is authenticated in RAM.
      */
     const struct flash_area *fap_src = NULL;
@@ -139,6 +211,12 @@ boot_decrypt_and_copy_image_to_sram(struct boot_loader_state *state,
     uint8_t * cur_dst;
     int rc;
     uint8_t * ram_dst = (void *)(IMAGE_RAM_BASE + img_dst);
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    bootutil_sha_context sha_ctx;
+    uint32_t hash_sz = boot_ram_load_hash_size(hdr);
+
+    bootutil_sha_init(&sha_ctx);
+#endif
 
     fap_src = BOOT_IMG_AREA(state, slot);
     assert(fap_src != NULL);
@@ -151,6 +229,10 @@ boot_decrypt_and_copy_image_to_sram(struct boot_loader_state *state,
         goto done;
     }
 
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    boot_ram_load_hash_update(&sha_ctx, ram_dst, 0, bytes_copied, hash_sz);
+#endif
+
     rc = boot_enc_load(state, slot, hdr, fap_src, &bs);
     if (rc < 0) {
         goto done;
@@ -181,11 +263,26 @@ boot_decrypt_and_copy_image_to_sram(struct boot_loader_state *state,
         boot_enc_decrypt(BOOT_CURR_ENC_SLOT(state, slot),
                 (bytes_copied + idx) - hdr->ih_hdr_size, blk_sz,
                 blk_off, cur_dst);
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+        boot_ram_load_hash_update(&sha_ctx, ram_dst, bytes_copied, chunk_sz, hash_sz);
+#endif
         bytes_copied += chunk_sz;
     }
     rc = 0;
 
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    /* Protected TLVs following the payload */
+    if (bytes_copied < src_sz) {
+        boot_ram_load_hash_update(&sha_ctx, ram_dst, bytes_copied,
+                                  src_sz - bytes_copied, hash_sz);
+    }
+    boot_ram_load_hash_finish(state, &sha_ctx, hash_sz, src_sz);
+#endif
+
 done:
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    bootutil_sha_drop(&sha_ctx);
+#endif
     return rc;
 }
 
@@ -207,6 +304,13 @@ boot_copy_image_to_sram(struct boot_loader_state *state, int slot,
 {
     int rc;
     const struct flash_area *fap_src = NULL;
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    bootutil_sha_context sha_ctx;
+    uint8_t *ram_dst = (uint8_t *)(IMAGE_RAM_BASE + img_dst);
+    uint32_t hash_sz = boot_ram_load_hash_size(boot_img_hdr(state, slot));
+    uint32_t chunk_sz;
+    uint32_t off;
+#endif
 
 #if (BOOT_IMAGE_NUMBER == 1)
     (void)state;
@@ -215,8 +319,33 @@ boot_copy_image_to_sram(struct boot_loader_state *state, int slot,
     fap_src = BOOT_IMG_AREA(state, slot);
     assert(fap_src != NULL);
 
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    /* Copy from flash to SRAM chunk by chunk, hashing each chunk where it
+     * landed while it is still in the cache.
+     */
+    rc = 0;
+    bootutil_sha_init(&sha_ctx);
+    for (off = 0; off < img_sz; off += chunk_sz) {
+        chunk_sz = img_sz - off;
+        if (chunk_sz > BOOT_RAM_LOAD_CHUNK_SZ) {
+            chunk_sz = BOOT_RAM_LOAD_CHUNK_SZ;
+        }
+
+        rc = flash_area_read(fap_src, off, ram_dst + off, chunk_sz);
+        if (rc != 0) {
+            break;
+        }
+
+        boot_ram_load_hash_update(&sha_ctx, ram_dst, off, chunk_sz, hash_sz);
+    }
+    if (rc == 0) {
+        boot_ram_load_hash_finish(state, &sha_ctx, hash_sz, img_sz);
+    }
+    bootutil_sha_drop(&sha_ctx);
+#else
     /* Direct copy from flash to its new location in SRAM. */
     rc = flash_area_read(fap_src, 0, (void *)(IMAGE_RAM_BASE + img_dst), img_sz);
+#endif
     if (rc != 0) {
         BOOT_LOG_INF("Error whilst copying image %d from Flash to SRAM: %d",
                      BOOT_CURR_IMG(state), rc);
@@ -315,6 +444,10 @@ boot_load_image_to_sram(struct boot_loader_state *state)
     active_slot = state->slot_usage[BOOT_CURR_IMG(state)].active_slot;
     hdr = boot_img_hdr(state, active_slot);
 
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    state->slot_usage[BOOT_CURR_IMG(state)].img_hash_valid = false;
+#endif
+
     if (hdr->ih_flags & IMAGE_F_RAM_LOAD) {
 
         img_dst = hdr->ih_load_addr;
@@ -369,6 +502,9 @@ boot_load_image_to_sram(struct boot_loader_state *state)
     if (rc != 0) {
         state->slot_usage[BOOT_CURR_IMG(state)].img_dst = 0;
         state->slot_usage[BOOT_CURR_IMG(state)].img_sz = 0;
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+        state->slot_usage[BOOT_CURR_IMG(state)].img_hash_valid = false;
+#endif
     }
 
     return rc;
@@ -395,6 +531,9 @@ boot_remove_image_from_sram(struct boot_loader_state *state)
 
     state->slot_usage[BOOT_CURR_IMG(state)].img_dst = 0;
     state->slot_usage[BOOT_CURR_IMG(state)].img_sz = 0;
+#if defined(BOOTUTIL_RAM_LOAD_HASH)
+    state->slot_usage[BOOT_CURR_IMG(state)].img_hash_valid = false;
+#endif
 
     return 0;
 }
@@ -0,0 +1,305 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Swap status journal.
+ *
+ * With MCUBOOT_SWAP_STATUS_JOURNAL the progress of a swap is not recorded
+ * in the trailers of the slots but in a partition of its own,
+ * FLASH_AREA_SWAP_STATUS, of at least two sectors of the same size. Each
+ * status write appends a fixed-size record holding a sequence number, the
+ * image, the last status entry set and a CRC. Records are appended to one
+ * sector after the other; when a sector is full the next one, which holds
+ * the oldest records, is erased and written from its start, so status
+ * writes are spread over the whole partition.
+ *
+ * The record with the highest sequence number of an image gives the
+ * progress of its swap: every entry up to the one it holds is set. A swap
+ * starts with a record holding no entry; the records of a completed swap
+ * are left in place until then, as the status in a trailer would be. A
+ * record that does not pass its CRC, such as one whose write was
+ * interrupted, is ignored, and the slot it occupies is skipped.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "mcuboot_config/mcuboot_config.h"
+
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+
+#include "bootutil/bootutil_log.h"
+#include "bootutil/bootutil_macros.h"
+#include "bootutil_priv.h"
+
+BOOT_LOG_MODULE_DECLARE(mcuboot);
+
+/* Entry of the record written at the start of a swap. */
+#define BOOT_SWAP_JOURNAL_NONE 0xffff
+
+struct boot_swap_journal_record {
+    uint32_t seq;
+    uint16_t entry;
+    uint8_t image;
+    uint8_t pad;
+    /* CRC-32 of the fields above. */
+    uint32_t crc;
+};
+
+#define BOOT_SWAP_JOURNAL_RECORD_BUF_SZ \
+    ALIGN_UP(sizeof(struct boot_swap_journal_record), BOOT_MAX_ALIGN)
+
+static uint32_t
+journal_crc32(const void *data, size_t len)
+{
+    const uint8_t *p = data;
+    uint32_t crc = 0xffffffff;
+    int i;
+
+    while (len-- > 0) {
+        crc ^= *p++;
+        for (i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+
+    return ~crc;
+}
+
+/* Whether rec is a record this journal wrote. */
+static bool
+journal_record_valid(const struct boot_swap_journal_record *rec)
+{
+    return rec->image < BOOT_IMAGE_NUMBER &&
+           rec->crc == journal_crc32(rec, offsetof(struct boot_swap_journal_record, crc));
+}
+
+/* Offset of the slot following the one at off, moving to the start of the
+ * next sector, or of the partition, when the sector has no room left.
+ */
+static uint32_t
+journal_next_slot(const struct boot_swap_journal *journal, const struct flash_area *fap,
+                  uint32_t off)
+{
+    off += journal->record_sz;
+    if (off % journal->sector_sz + journal->record_sz > journal->sector_sz) {
+        off = ALIGN_DOWN(off, journal->sector_sz) + journal->sector_sz;
+    }
+    if (off >= flash_area_get_size(fap)) {
+        off = 0;
+    }
+
+    return off;
+}
+
+static int
+journal_load(struct boot_swap_journal *journal, const struct flash_area *fap)
+{
+    uint8_t buf[BOOT_SWAP_JOURNAL_RECORD_BUF_SZ];
+    struct boot_swap_journal_record rec;
+    uint32_t image_seq[BOOT_IMAGE_NUMBER];
+    struct flash_sector sector;
+    uint32_t last_off = 0;
+    uint32_t size;
+    uint32_t off;
+    bool found = false;
+    size_t i;
+    int rc;
+
+    if (journal->loaded) {
+        return 0;
+    }
+
+    rc = flash_area_get_sector(fap, 0, &sector);
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    size = flash_area_get_size(fap);
+    journal->sector_sz = flash_sector_get_size(&sector);
+    journal->record_sz = ALIGN_UP(sizeof(rec), flash_area_align(fap));
+    if (journal->record_sz > sizeof(buf) || journal->record_sz > journal->sector_sz ||
+        size % journal->sector_sz != 0 || size / journal->sector_sz < 2) {
+        BOOT_LOG_ERR("swap status journal: unsupported partition layout");
+        return BOOT_EBADARGS;
+    }
+
+    journal->seq = 0;
+    for (i = 0; i < BOOT_IMAGE_NUMBER; i++) {
+        journal->last[i] = -1;
+        image_seq[i] = 0;
+    }
+
+    off = 0;
+    do {
+        rc = flash_area_read(fap, off, buf, journal->record_sz);
+        if (rc != 0) {
+            return BOOT_EFLASH;
+        }
+        memcpy(&rec, buf, sizeof(rec));
+
+        if (!bootutil_buffer_is_erased(fap, buf, journal->record_sz) &&
+            journal_record_valid(&rec)) {
+            if (!found || rec.seq >= journal->seq) {
+                journal->seq = rec.seq + 1;
+                last_off = off;
+                found = true;
+            }
+            if (rec.seq >= image_seq[rec.image]) {
+                image_seq[rec.image] = rec.seq + 1;
+                journal->last[rec.image] = (rec.entry == BOOT_SWAP_JOURNAL_NONE) ?
+                                          -1 : rec.entry;
+            }
+        }
+
+        off = journal_next_slot(journal, fap, off);
+    } while (off != 0);
+
+    journal->next_off = found ? journal_next_slot(journal, fap, last_off) : 0;
+    journal->loaded = true;
+
+    BOOT_LOG_DBG("swap status journal: next record %" PRIu32 " at 0x%" PRIx32,
+                 journal->seq, journal->next_off);
+
+    return 0;
+}
+
+static int
+journal_append(struct boot_loader_state *state, int32_t entry)
+{
+    struct boot_swap_journal *journal = &state->swap_journal;
+    uint8_t buf[BOOT_SWAP_JOURNAL_RECORD_BUF_SZ];
+    struct boot_swap_journal_record rec;
+    const struct flash_area *fap;
+    uint32_t off;
+    int rc;
+
+    rc = flash_area_open(FLASH_AREA_SWAP_STATUS, &fap);
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    rc = journal_load(journal, fap);
+    if (rc != 0) {
+        goto out;
+    }
+
+    /* Skip the slots left dirty by an interrupted write. A sector is
+     * erased when its first slot is reached.
+     */
+    off = journal->next_off;
+    while (true) {
+        if (off % journal->sector_sz == 0) {
+            rc = flash_area_erase(fap, off, journal->sector_sz);
+            if (rc != 0) {
+                rc = BOOT_EFLASH;
+                goto out;
+            }
+            break;
+        }
+
+        rc = flash_area_read(fap, off, buf, journal->record_sz);
+        if (rc != 0) {
+            rc = BOOT_EFLASH;
+            goto out;
+        }
+        if (bootutil_buffer_is_erased(fap, buf, journal->record_sz)) {
+            break;
+        }
+        off = journal_next_slot(journal, fap, off);
+    }
+
+    memset(&rec, 0, sizeof(rec));
+    rec.seq = journal->seq;
+    rec.entry = (entry < 0) ? BOOT_SWAP_JOURNAL_NONE : (uint16_t)entry;
+    rec.image = BOOT_CURR_IMG(state);
+    rec.crc = journal_crc32(&rec, offsetof(struct boot_swap_journal_record, crc));
+
+    memset(buf, flash_area_erased_val(fap), sizeof(buf));
+    memcpy(buf, &rec, sizeof(rec));
+
+    rc = flash_area_write(fap, off, buf, journal->record_sz);
+    if (rc != 0) {
+        rc = BOOT_EFLASH;
+        goto out;
+    }
+
+    journal->seq++;
+    journal->next_off = journal_next_slot(journal, fap, off);
+    journal->last[BOOT_CURR_IMG(state)] = entry;
+
+out:
+    flash_area_close(fap);
+    return rc;
+}
+
+/**
+ * Starts the swap of the current image: its status then reads as erased.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_swap_journal_clear(struct boot_loader_state *state)
+{
+    return journal_append(state, -1);
+}
+
+/**
+ * Records that every status entry of the current image up to @p entry is
+ * set.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_swap_journal_write(struct boot_loader_state *state, uint32_t entry)
+{
+    assert(entry < BOOT_SWAP_JOURNAL_NONE);
+
+    return journal_append(state, (int32_t)entry);
+}
+
+/**
+ * Reads the last status entry set of the current image into @p entry, -1
+ * if none is.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_swap_journal_last(struct boot_loader_state *state, int32_t *entry)
+{
+    struct boot_swap_journal *journal = &state->swap_journal;
+    const struct flash_area *fap;
+    int rc;
+
+    if (!journal->loaded) {
+        rc = flash_area_open(FLASH_AREA_SWAP_STATUS, &fap);
+        if (rc != 0) {
+            return BOOT_EFLASH;
+        }
+
+        rc = journal_load(journal, fap);
+        flash_area_close(fap);
+        if (rc != 0) {
+            return rc;
+        }
+    }
+
+    *entry = journal->last[BOOT_CURR_IMG(state)];
+
+    return 0;
+}
+
+/* Drops what is known of the journal; flash may have changed since the
+ * last boot attempt.
+ */
+void
+boot_swap_journal_reset(struct boot_loader_state *state)
+{
+    state->swap_journal.loaded = false;
+}
+
+#endif /* MCUBOOT_SWAP_STATUS_JOURNAL */
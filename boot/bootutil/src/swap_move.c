@@ -142,7 +142,6 @@ swap_read_status_bytes(const struct flash_area *fap,
     uint8_t status;
     int max_entries;
     int found_idx;
-    uint8_t write_sz;
     int move_entries;
     int rc;
     int last_rc;
@@ -158,10 +157,9 @@ swap_read_status_bytes(const struct flash_area *fap,
     found_idx = -1;
     /* skip erased sectors at the end */
     last_rc = 1;
-    write_sz = BOOT_WRITE_SZ(state);
     off = boot_status_off(fap);
     for (i = max_entries; i > 0; i--) {
-        rc = flash_area_read(fap, off + (i - 1) * write_sz, &status, 1);
+        rc = boot_read_status_entry(state, fap, off, i - 1, &status);
         if (rc < 0) {
             return BOOT_EFLASH;
         }
@@ -227,7 +227,6 @@ int swap_read_status_bytes(const struct flash_area *fap, struct boot_loader_stat
     uint8_t status;
     int max_entries;
     int found_idx;
-    uint8_t write_sz;
     int rc;
     int last_rc;
     int erased_sections;
@@ -243,10 +242,9 @@ int swap_read_status_bytes(const struct flash_area *fap, struct boot_loader_stat
     found_idx = -1;
     /* Skip erased sectors at the end */
     last_rc = 1;
-    write_sz = BOOT_WRITE_SZ(state);
     off = boot_status_off(fap);
     for (i = max_entries; i > 0; i--) {
-        rc = flash_area_read(fap, off + (i - 1) * write_sz, &status, 1);
+        rc = boot_read_status_entry(state, fap, off, i - 1, &status);
         if (rc < 0) {
             return BOOT_EFLASH;
         }
@@ -104,9 +104,16 @@ void swap_run(struct boot_loader_state *state,
 #if MCUBOOT_SWAP_USING_SCRATCH
 #define BOOT_SCRATCH_AREA(state) ((state)->scratch.area)
 
+/* The size of the scratch area a swap step can use: the whole area, or one
+ * window of it with MCUBOOT_SWAP_SCRATCH_RING.
+ */
 static inline size_t boot_scratch_area_size(const struct boot_loader_state *state)
 {
+#if defined(MCUBOOT_SWAP_SCRATCH_RING)
+    return flash_area_get_size(BOOT_SCRATCH_AREA(state)) / MCUBOOT_SWAP_SCRATCH_RING;
+#else
     return flash_area_get_size(BOOT_SCRATCH_AREA(state));
+#endif
 }
 #endif
 
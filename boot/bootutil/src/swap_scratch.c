@@ -175,9 +175,170 @@ static size_t app_max_size_adjust_to_trailer(struct boot_loader_state *state, si
 
     return slot_trailer_off - trailer_padding;
 }
+
+#if defined(MCUBOOT_SWAP_SCRATCH_RING)
+/**
+ * Checks that the scratch area splits into MCUBOOT_SWAP_SCRATCH_RING windows
+ * that can be erased on their own and have room for the scratch trailer.
+ *
+ * @param state     Current bootloader's state.
+ *
+ * @return          true if the scratch area can be used as a ring.
+ */
+static bool
+boot_scratch_ring_valid(const struct boot_loader_state *state)
+{
+    const struct flash_area *fap = BOOT_SCRATCH_AREA(state);
+    uint32_t window_sz = boot_scratch_area_size(state);
+    struct flash_sector sector;
+    uint32_t off;
+
+    if (window_sz * MCUBOOT_SWAP_SCRATCH_RING != flash_area_get_size(fap) ||
+        window_sz <= boot_scratch_trailer_sz(BOOT_WRITE_SZ(state))) {
+        return false;
+    }
+
+    for (off = window_sz; off < flash_area_get_size(fap); off += window_sz) {
+        if (flash_area_get_sector(fap, off, &sector) != 0 ||
+            flash_sector_get_off(&sector) != off) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
+/**
+ * Returns the offset in the scratch area of the window a swap step goes
+ * through. With MCUBOOT_SWAP_SCRATCH_RING the steps go round the windows of
+ * the ring, so each one is erased once every MCUBOOT_SWAP_SCRATCH_RING
+ * steps. The first step, which may keep the status and trailer in the
+ * scratch area, uses the last window, which ends with the scratch trailer.
+ *
+ * @param state     Current bootloader's state.
+ * @param swap_idx  The index of the swap step, 0 for the first one.
+ *
+ * @return          The offset of the window from the start of the scratch area.
+ */
+static uint32_t
+boot_scratch_window_off(const struct boot_loader_state *state, uint32_t swap_idx)
+{
+#if defined(MCUBOOT_SWAP_SCRATCH_RING)
+    return ((swap_idx + MCUBOOT_SWAP_SCRATCH_RING - 1) % MCUBOOT_SWAP_SCRATCH_RING) *
+           boot_scratch_area_size(state);
+#else
+    (void)state;
+    (void)swap_idx;
+
+    return 0;
+#endif
+}
+
+#if defined(MCUBOOT_SWAP_SCRATCH_RING) && defined(MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC) && \
+    !defined(MCUBOOT_SPARSE_SWAP)
+/*
+ * The window of the next swap step is erased in the background while the
+ * current step works on the slots. A step of sparse swap is only known to
+ * be skipped when it starts, so with it no window is erased ahead.
+ */
+#define BOOT_SCRATCH_PREERASE
+#endif
+
+/**
+ * Starts erasing the scratch window of the swap step following the current
+ * one, if there is such a step and windows are erased ahead.
+ *
+ * @param state     Current bootloader's state.
+ * @param bs        The status of the current step.
+ * @param idx       The index of the first sector of the current step.
+ */
+static void
+boot_scratch_preerase(struct boot_loader_state *state, const struct boot_status *bs, int idx)
+{
+#if defined(BOOT_SCRATCH_PREERASE)
+    uint32_t off;
+
+    /* The step at the start of the slots is the last one. */
+    if (idx == 0) {
+        return;
+    }
+
+    off = boot_scratch_window_off(state, bs->idx - BOOT_STATUS_IDX_0 + 1);
+    if (boot_erase_region_start(BOOT_SCRATCH_AREA(state), off,
+                                boot_scratch_area_size(state)) == 0) {
+        state->scratch.preerased_off = off;
+    }
+#else
+    (void)state;
+    (void)bs;
+    (void)idx;
+#endif
+}
+
+/**
+ * Checks whether the scratch window at off was erased ahead for the swap
+ * step about to write to it.
+ *
+ * @param state     Current bootloader's state.
+ * @param off       The offset of the window in the scratch area.
+ *
+ * @return          true if the window does not need to be erased.
+ */
+static bool
+boot_scratch_take_preerased(struct boot_loader_state *state, uint32_t off)
+{
+#if defined(BOOT_SCRATCH_PREERASE)
+    bool erased = (off == state->scratch.preerased_off);
+
+    state->scratch.preerased_off = UINT32_MAX;
+    return erased;
+#else
+    (void)state;
+    (void)off;
+
+    return false;
+#endif
+}
 #endif /* MCUBOOT_SWAP_USING_SCRATCH */
 
 #if !defined(MCUBOOT_DIRECT_XIP) && !defined(MCUBOOT_RAM_LOAD)
+#if defined(MCUBOOT_SPARSE_SWAP)
+/*
+ * Whether the step whose first status entry, at entry, is erased was
+ * skipped: its second entry is erased too and its last one is set. On a
+ * skip, the last entry is read into status.
+ *
+ * Returns 1 if the step was skipped, 0 if not, and a negative value on a
+ * flash error.
+ */
+static int
+swap_read_skipped_step(struct boot_loader_state *state, const struct flash_area *fap,
+                       uint32_t off, int entry, uint8_t *status)
+{
+    uint8_t second;
+    uint8_t last;
+    int rc;
+
+    rc = boot_read_status_entry(state, fap, off, entry + 1, &second);
+    if (rc < 0) {
+        return rc;
+    }
+    rc = boot_read_status_entry(state, fap, off, entry + 2, &last);
+    if (rc < 0) {
+        return rc;
+    }
+
+    if (!bootutil_buffer_is_erased(fap, &second, 1) ||
+        bootutil_buffer_is_erased(fap, &last, 1)) {
+        return 0;
+    }
+
+    *status = last;
+    return 1;
+}
+#endif
+
 /**
  * Reads the status of a partially-completed swap, if any.  This is necessary
  * to recover in case the boot lodaer was reset in the middle of a swap
@@ -206,12 +367,25 @@ swap_read_status_bytes(const struct flash_area *fap,
     found_idx = 0;
     invalid = 0;
     for (i = 0; i < max_entries; i++) {
-        rc = flash_area_read(fap, off + i * BOOT_WRITE_SZ(state),
-                &status, 1);
+        rc = boot_read_status_entry(state, fap, off, i, &status);
         if (rc < 0) {
             return BOOT_EFLASH;
         }
 
+#if defined(MCUBOOT_SPARSE_SWAP)
+        /* A skipped step only has its last entry set; it reads as a
+         * completed step.
+         */
+        if ((i % BOOT_STATUS_STATE_COUNT) == 0 && bootutil_buffer_is_erased(fap, &status, 1)) {
+            rc = swap_read_skipped_step(state, fap, off, i, &status);
+            if (rc < 0) {
+                return BOOT_EFLASH;
+            } else if (rc > 0) {
+                i += BOOT_STATUS_STATE_COUNT - 1;
+            }
+        }
+#endif
+
         if (bootutil_buffer_is_erased(fap, &status, 1)) {
             if (found && !found_idx) {
                 found_idx = i;
@@ -291,6 +465,14 @@ boot_slots_compatible(struct boot_loader_state *state)
 
 #ifndef MCUBOOT_OVERWRITE_ONLY
     scratch_sz = boot_scratch_area_size(state);
+
+#if defined(MCUBOOT_SWAP_SCRATCH_RING)
+    if (!boot_scratch_ring_valid(state)) {
+        BOOT_LOG_WRN("Cannot upgrade: scratch area does not split into %d windows",
+                     MCUBOOT_SWAP_SCRATCH_RING);
+        return 0;
+    }
+#endif
 #endif
 
     /*
@@ -686,6 +868,8 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
     uint32_t trailer_sz;
     uint32_t img_off;
     uint32_t scratch_trailer_off;
+    uint32_t scratch_off;
+    uint32_t scratch_sz;
     struct boot_swap_state swap_state;
     size_t first_trailer_sector_primary;
     bool erase_scratch;
@@ -703,6 +887,10 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
     fap_scratch = state->scratch.area;
     assert(fap_scratch != NULL);
 
+    /* The part of the scratch area this step goes through. */
+    scratch_off = boot_scratch_window_off(state, bs->idx - BOOT_STATUS_IDX_0);
+    scratch_sz = boot_scratch_area_size(state);
+
     /* Calculate offset from start of image area. */
     img_off = boot_img_sector_off(state, BOOT_SLOT_PRIMARY, idx);
 
@@ -738,17 +926,34 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
          */
         scratch_trailer_off = boot_status_off(fap_scratch);
 
-        if (copy_sz > scratch_trailer_off) {
-            copy_sz = scratch_trailer_off;
+        if (scratch_off + copy_sz > scratch_trailer_off) {
+            copy_sz = scratch_trailer_off - scratch_off;
         }
     }
 
     bs->use_scratch = (bs->idx == BOOT_STATUS_IDX_0 && copy_sz != sz);
 
+#if defined(MCUBOOT_SPARSE_SWAP)
+    /* Swapping identical sectors would leave them as they are. The first
+     * step also sets up the trailers and is always run; the others are
+     * skipped before they start, so their sectors are still in place.
+     */
+    if (bs->idx != BOOT_STATUS_IDX_0 && bs->state == BOOT_STATUS_STATE_0 &&
+        copy_sz == sz && boot_regions_identical(state, img_off, sz)) {
+        BOOT_LOG_DBG("skipping unchanged sectors at 0x%" PRIx32, img_off);
+        rc = boot_write_status_skipped(state, bs);
+        bs->idx++;
+        BOOT_STATUS_ASSERT(rc == 0);
+        return;
+    }
+#endif
+
     if (bs->state == BOOT_STATUS_STATE_0) {
-        BOOT_LOG_DBG("erasing scratch area");
-        rc = boot_erase_region(fap_scratch, 0, flash_area_get_size(fap_scratch), false);
-        assert(rc == 0);
+        if (!boot_scratch_take_preerased(state, scratch_off)) {
+            BOOT_LOG_DBG("erasing scratch area");
+            rc = boot_erase_region(fap_scratch, scratch_off, scratch_sz, false);
+            assert(rc == 0);
+        }
 
         if (bs->idx == BOOT_STATUS_IDX_0) {
             /* Write a trailer to the scratch area, even if we don't need the
@@ -770,14 +975,13 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
                 assert(rc == 0);
 
                 /* Erase the temporary trailer from the scratch area. */
-                rc = boot_erase_region(fap_scratch, 0,
-                        flash_area_get_size(fap_scratch), false);
+                rc = boot_erase_region(fap_scratch, scratch_off, scratch_sz, false);
                 assert(rc == 0);
             }
         }
 
         rc = boot_copy_region(state, fap_secondary_slot, fap_scratch,
-                              img_off, 0, copy_sz);
+                              img_off, scratch_off, copy_sz);
         assert(rc == 0);
 
         rc = boot_write_status(state, bs);
@@ -788,6 +992,9 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
     if (bs->state == BOOT_STATUS_STATE_1) {
         uint32_t erase_sz = sz;
 
+        /* The scratch window of the next step is not in use. */
+        boot_scratch_preerase(state, bs, idx);
+
         if (bs->idx == BOOT_STATUS_IDX_0) {
             /* Guarantee here that only the primary slot will have the state.
              *
@@ -854,17 +1061,26 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
          * this copy (copy_sz was truncated earlier).
          */
         rc = boot_copy_region(state, fap_scratch, fap_primary_slot,
-                              0, img_off, copy_sz);
+                              scratch_off, img_off, copy_sz);
         assert(rc == 0);
 
         if (bs->use_scratch) {
+#if !defined(MCUBOOT_SWAP_STATUS_JOURNAL)
             scratch_trailer_off = boot_status_off(fap_scratch);
 
             /* copy current status that is being maintained in scratch */
+#if defined(MCUBOOT_SWAP_STATUS_COMPACT)
+            /* All of it is in the first write unit. */
+            rc = boot_copy_region(state, fap_scratch, fap_primary_slot,
+                        scratch_trailer_off, img_off + copy_sz,
+                        BOOT_WRITE_SZ(state));
+#else
             rc = boot_copy_region(state, fap_scratch, fap_primary_slot,
                         scratch_trailer_off, img_off + copy_sz,
                         (BOOT_STATUS_STATE_COUNT - 1) * BOOT_WRITE_SZ(state));
+#endif
             BOOT_STATUS_ASSERT(rc == 0);
+#endif
 
             rc = boot_read_swap_state(fap_scratch, &swap_state);
             assert(rc == 0);
@@ -909,7 +1125,7 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
             * happens then the scratch which is partially erased would be wrote back to the
             * primary slot, causing a corrupt unbootable image
             */
-            rc = boot_scramble_region(fap_scratch, 0, flash_area_get_size(fap_scratch), true);
+            rc = boot_scramble_region(fap_scratch, scratch_off, scratch_sz, true);
             assert(rc == 0);
         }
     }
@@ -926,6 +1142,11 @@ swap_run(struct boot_loader_state *state, struct boot_status *bs,
 
     BOOT_LOG_INF("Starting swap using scratch algorithm.");
 
+#if defined(BOOT_SCRATCH_PREERASE)
+    /* A window erased ahead in an earlier boot may not have been erased in full. */
+    state->scratch.preerased_off = UINT32_MAX;
+#endif
+
     last_sector_idx = find_last_sector_idx(state, copy_size);
 
     swap_idx = 0;
@@ -1063,6 +1284,7 @@ boot_read_image_header(struct boot_loader_state *state, int slot,
     uint32_t swap_count;
     uint32_t swap_size;
 #endif
+    uint32_t hdr_off = 0;
     int hdr_slot;
     int rc = 0;
 
@@ -1111,6 +1333,7 @@ boot_read_image_header(struct boot_loader_state *state, int slot,
                  * scratch area.
                  */
                 hdr_slot = BOOT_NUM_SLOTS;
+                hdr_off = boot_scratch_window_off(state, swap_count - 1);
             } else if (slot == BOOT_SLOT_PRIMARY && bs->state >= BOOT_STATUS_STATE_2) {
                 /* After BOOT_STATUS_STATE_2, the primary image's header has been moved to the
                  * secondary slot.
@@ -1130,7 +1353,7 @@ boot_read_image_header(struct boot_loader_state *state, int slot,
 #endif
     assert(fap != NULL);
 
-    rc = flash_area_read(fap, 0, out_hdr, sizeof *out_hdr);
+    rc = flash_area_read(fap, hdr_off, out_hdr, sizeof *out_hdr);
 
     if (rc != 0) {
         rc = BOOT_EFLASH;
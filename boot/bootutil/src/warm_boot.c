@@ -0,0 +1,262 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Warm boot cache for the direct-XIP and RAM-load strategies.
+ *
+ * After a successful boot, the slot chosen for each image is recorded with
+ * a fingerprint of the headers and trailers of all slots of the image and
+ * the digest of the image that was validated. On the next boot, an image
+ * whose slot, fingerprint and hash TLV still match the record is not
+ * validated again; with RAM loading, the digest computed while copying the
+ * image to RAM must also match, so what runs is still what was validated.
+ * Anything else goes through the full validation.
+ *
+ * The record is authenticated with HMAC-SHA256 under a key only MCUboot
+ * knows, so that code able to write the storage can not forge a record to
+ * have an image it placed in flash booted without validation.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "mcuboot_config/mcuboot_config.h"
+
+#if defined(MCUBOOT_WARM_BOOT_CACHE)
+
+#include "bootutil/bootutil_log.h"
+#include "bootutil/crypto/hmac_sha256.h"
+#include "bootutil/crypto/sha.h"
+#include "bootutil/fault_injection_hardening.h"
+#include "bootutil/image.h"
+#include "bootutil/warm_boot.h"
+#include "bootutil_priv.h"
+
+BOOT_LOG_MODULE_DECLARE(mcuboot);
+
+#if !defined(MCUBOOT_DIRECT_XIP) && !defined(MCUBOOT_RAM_LOAD)
+#error "MCUBOOT_WARM_BOOT_CACHE requires MCUBOOT_DIRECT_XIP or MCUBOOT_RAM_LOAD"
+#endif
+
+#if defined(MCUBOOT_SIGN_PURE)
+#error "MCUBOOT_WARM_BOOT_CACHE is not supported with MCUBOOT_SIGN_PURE"
+#endif
+
+#if defined(MCUBOOT_HW_ROLLBACK_PROT)
+#error "MCUBOOT_WARM_BOOT_CACHE is not supported with MCUBOOT_HW_ROLLBACK_PROT"
+#endif
+
+#if !defined(MCUBOOT_USE_MBED_TLS) && !defined(MCUBOOT_USE_TINYCRYPT)
+#error "MCUBOOT_WARM_BOOT_CACHE requires HMAC-SHA256 from Mbed TLS or TinyCrypt"
+#endif
+
+#if defined(MCUBOOT_RAM_LOAD) && !defined(BOOTUTIL_RAM_LOAD_HASH)
+#error "MCUBOOT_WARM_BOOT_CACHE with MCUBOOT_RAM_LOAD requires the image digest computed while loading"
+#endif
+
+#define BOOT_WARM_BOOT_MAGIC 0x57424332 /* "WBC2" */
+#define BOOT_WARM_BOOT_TAG_SIZE 32
+
+struct boot_warm_boot_record {
+    uint32_t magic;
+    struct {
+        uint32_t active_slot;
+        uint8_t fingerprint[IMAGE_HASH_SIZE];
+        uint8_t digest[IMAGE_HASH_SIZE];
+    } images[BOOT_IMAGE_NUMBER];
+    /* HMAC of all of the above, to reject torn, stale or forged contents */
+    uint8_t tag[BOOT_WARM_BOOT_TAG_SIZE];
+};
+
+static int
+boot_warm_boot_tag(const struct boot_warm_boot_record *record, uint8_t *out)
+{
+    bootutil_hmac_sha256_context hmac;
+    uint8_t key[BOOT_WARM_BOOT_KEY_SIZE];
+    int rc;
+
+    rc = boot_warm_boot_key(key);
+    if (rc != 0) {
+        return -1;
+    }
+
+    bootutil_hmac_sha256_init(&hmac);
+    rc = bootutil_hmac_sha256_set_key(&hmac, key, sizeof(key));
+    memset(key, 0, sizeof(key));
+    if (rc == 0) {
+        rc = bootutil_hmac_sha256_update(&hmac, record,
+                                         offsetof(struct boot_warm_boot_record, tag));
+    }
+    if (rc == 0) {
+        rc = bootutil_hmac_sha256_finish(&hmac, out, BOOT_WARM_BOOT_TAG_SIZE);
+    }
+    bootutil_hmac_sha256_drop(&hmac);
+
+    return rc;
+}
+
+/* Fingerprint of what slot selection is based on for the current image: the
+ * headers and trailers read from its slots.
+ */
+static int
+boot_warm_boot_fingerprint(struct boot_loader_state *state, uint8_t *out)
+{
+    bootutil_sha_context sha_ctx;
+    struct boot_swap_state swap_state;
+    uint32_t slot;
+    int rc;
+
+    bootutil_sha_init(&sha_ctx);
+    for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+        bootutil_sha_update(&sha_ctx, boot_img_hdr(state, slot),
+                            sizeof(struct image_header));
+
+        memset(&swap_state, 0, sizeof(swap_state));
+        rc = boot_read_swap_state(BOOT_IMG_AREA(state, slot), &swap_state);
+        if (rc != 0) {
+            bootutil_sha_drop(&sha_ctx);
+            return rc;
+        }
+        bootutil_sha_update(&sha_ctx, &swap_state, sizeof(swap_state));
+    }
+    bootutil_sha_finish(&sha_ctx, out);
+    bootutil_sha_drop(&sha_ctx);
+
+    return 0;
+}
+
+/* Reads the image digest from the hash TLV of the image in slot. */
+static int
+boot_warm_boot_read_digest(struct boot_loader_state *state, uint32_t slot,
+                           uint8_t *out)
+{
+    const struct flash_area *fap = BOOT_IMG_AREA(state, slot);
+    struct image_header *hdr = boot_img_hdr(state, slot);
+    struct image_tlv_iter it;
+    uint32_t off;
+    uint16_t len;
+    int rc;
+
+    rc = bootutil_tlv_iter_begin(&it, hdr, fap, EXPECTED_HASH_TLV, false);
+    if (rc != 0) {
+        return rc;
+    }
+
+    rc = bootutil_tlv_iter_next(&it, &off, &len, NULL);
+    if (rc != 0 || len != IMAGE_HASH_SIZE) {
+        return -1;
+    }
+
+    return LOAD_IMAGE_DATA(hdr, fap, off, out, IMAGE_HASH_SIZE);
+}
+
+static fih_ret
+boot_warm_boot_read(struct boot_warm_boot_record *record)
+{
+    uint8_t tag[BOOT_WARM_BOOT_TAG_SIZE];
+    FIH_DECLARE(fih_rc, FIH_FAILURE);
+
+    if (boot_warm_boot_record_read(record, sizeof(*record)) != 0 ||
+        record->magic != BOOT_WARM_BOOT_MAGIC ||
+        boot_warm_boot_tag(record, tag) != 0) {
+        FIH_RET(FIH_FAILURE);
+    }
+
+    FIH_CALL(boot_fih_memequal, fih_rc, tag, record->tag, sizeof(tag));
+
+    FIH_RET(fih_rc);
+}
+
+fih_ret
+boot_warm_boot_check(struct boot_loader_state *state, uint32_t slot)
+{
+    struct boot_warm_boot_record record;
+    uint8_t fingerprint[IMAGE_HASH_SIZE];
+    uint8_t digest[IMAGE_HASH_SIZE];
+    size_t image_index = BOOT_CURR_IMG(state);
+    FIH_DECLARE(fih_rc, FIH_FAILURE);
+
+    FIH_CALL(boot_warm_boot_read, fih_rc, &record);
+    if (FIH_NOT_EQ(fih_rc, FIH_SUCCESS) ||
+        record.images[image_index].active_slot != slot) {
+        FIH_RET(FIH_FAILURE);
+    }
+
+    if (boot_warm_boot_fingerprint(state, fingerprint) != 0 ||
+        memcmp(fingerprint, record.images[image_index].fingerprint,
+               sizeof(fingerprint)) != 0) {
+        FIH_RET(FIH_FAILURE);
+    }
+
+    if (boot_warm_boot_read_digest(state, slot, digest) != 0) {
+        FIH_RET(FIH_FAILURE);
+    }
+    FIH_CALL(boot_fih_memequal, fih_rc, digest, record.images[image_index].digest,
+             IMAGE_HASH_SIZE);
+    if (FIH_NOT_EQ(fih_rc, FIH_SUCCESS)) {
+        FIH_RET(FIH_FAILURE);
+    }
+
+#if defined(MCUBOOT_RAM_LOAD)
+    /* The image in RAM must be the one validated before. */
+    if (!state->slot_usage[image_index].img_hash_valid) {
+        FIH_RET(FIH_FAILURE);
+    }
+    FIH_CALL(boot_fih_memequal, fih_rc, state->slot_usage[image_index].img_hash,
+             record.images[image_index].digest, IMAGE_HASH_SIZE);
+#endif
+
+    if (FIH_EQ(fih_rc, FIH_SUCCESS)) {
+        BOOT_LOG_INF("Image %d: %s slot validated on a previous boot",
+                     BOOT_CURR_IMG(state),
+                     (slot == BOOT_SLOT_PRIMARY) ? "primary" : "secondary");
+    }
+
+    FIH_RET(fih_rc);
+}
+
+void
+boot_warm_boot_save(struct boot_loader_state *state)
+{
+    struct boot_warm_boot_record record;
+    struct boot_warm_boot_record stored;
+    uint32_t slot;
+
+    memset(&record, 0, sizeof(record));
+    record.magic = BOOT_WARM_BOOT_MAGIC;
+
+    IMAGES_ITER(BOOT_CURR_IMG(state)) {
+#if BOOT_IMAGE_NUMBER > 1
+        if (state->img_mask[BOOT_CURR_IMG(state)]) {
+            record.images[BOOT_CURR_IMG(state)].active_slot = BOOT_SLOT_NONE;
+            continue;
+        }
+#endif
+        slot = state->slot_usage[BOOT_CURR_IMG(state)].active_slot;
+        record.images[BOOT_CURR_IMG(state)].active_slot = slot;
+        if (boot_warm_boot_fingerprint(state,
+                                       record.images[BOOT_CURR_IMG(state)].fingerprint) != 0 ||
+            boot_warm_boot_read_digest(state, slot,
+                                       record.images[BOOT_CURR_IMG(state)].digest) != 0) {
+            return;
+        }
+    }
+
+    if (boot_warm_boot_tag(&record, record.tag) != 0) {
+        return;
+    }
+
+    /* Rewrite the record only when the decisions changed. */
+    if (boot_warm_boot_record_read(&stored, sizeof(stored)) == 0 &&
+        memcmp(&stored, &record, sizeof(record)) == 0) {
+        return;
+    }
+
+    if (boot_warm_boot_record_write(&record, sizeof(record)) != 0) {
+        BOOT_LOG_WRN("Failed to record the boot decisions");
+    }
+}
+
+#endif /* MCUBOOT_WARM_BOOT_CACHE */
@@ -139,8 +139,25 @@
  * See the flash APIs for more details. */
 #define MCUBOOT_USE_FLASH_AREA_GET_SECTORS
 
+/* Read image headers, TLVs and the hashed range through MMU mappings
+ * instead of copying them out of flash. */
+#define MCUBOOT_USE_FLASH_AREA_MAP
+
 #define MCUBOOT_DEV_WITH_ERASE
 
+/* Serve small metadata reads from a read cache in front of the flash; the
+ * geometry defaults to that of bootutil_flash_cache.h unless configured.
+ */
+#if defined(CONFIG_ESP_FLASH_READ_CACHE)
+#define MCUBOOT_FLASH_READ_CACHE
+#ifdef CONFIG_ESP_FLASH_READ_CACHE_LINES
+#define MCUBOOT_FLASH_READ_CACHE_LINES CONFIG_ESP_FLASH_READ_CACHE_LINES
+#endif
+#ifdef CONFIG_ESP_FLASH_READ_CACHE_LINE_SIZE
+#define MCUBOOT_FLASH_READ_CACHE_LINE_SIZE CONFIG_ESP_FLASH_READ_CACHE_LINE_SIZE
+#endif
+#endif
+
 /* Enable non-protected TLV check against allow list */
 #define MCUBOOT_USE_TLV_ALLOW_LIST 1
 
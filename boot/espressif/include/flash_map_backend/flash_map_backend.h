@@ -67,6 +67,12 @@ int flash_area_write(const struct flash_area *fa, uint32_t off,
 //! Erases `len` bytes of flash memory at `off`
 int flash_area_erase(const struct flash_area *fa,
                      uint32_t off, uint32_t len);
+//! Maps `len` bytes of flash memory at `off` into the address space, at `*ptr`
+int flash_area_map(const struct flash_area *fa, uint32_t off,
+                   uint32_t len, const void **ptr);
+//! Releases a mapping obtained with flash_area_map()
+void flash_area_unmap(const struct flash_area *fa, const void *ptr,
+                      uint32_t len);
 
 //! Returns this `flash_area`s alignment
 uint32_t flash_area_align(const struct flash_area *area);
@@ -138,6 +138,10 @@ static const struct flash_area *prv_lookup_flash_area(uint8_t id) {
     return NULL;
 }
 
+#ifdef CONFIG_ESP_FLASH_WRITE_COMBINE
+static bool write_combine_flush(void);
+#endif
+
 int flash_area_open(uint8_t id, const struct flash_area **area_outp)
 {
     BOOT_LOG_DBG("%s: ID=%d", __func__, (int)id);
@@ -148,7 +152,11 @@ int flash_area_open(uint8_t id, const struct flash_area **area_outp)
 
 void flash_area_close(const struct flash_area *area)
 {
-
+#ifdef CONFIG_ESP_FLASH_WRITE_COMBINE
+    if (!write_combine_flush()) {
+        BOOT_LOG_ERR("%s: Pending flash write failed", __func__);
+    }
+#endif
 }
 
 static void flush_cache(size_t start_addr, size_t length)
@@ -167,6 +175,82 @@ static void flush_cache(size_t start_addr, size_t length)
 #endif
 }
 
+#ifdef CONFIG_ESP_FLASH_WRITE_COMBINE
+/* With flash encryption, a write not covering whole sectors reads, erases
+ * and rewrites each sector it touches. Such writes are gathered here
+ * instead, in a copy of their sector that is written back with a single
+ * erase and program when a write is made to another sector, when flash is
+ * erased, when the sector is read or mapped, or when a flash area is
+ * closed. Writes therefore still reach flash in the order they were made.
+ */
+static struct {
+    bool valid;                 /* buf holds a sector with writes pending */
+    size_t addr;                /* Flash address of the sector */
+    uint8_t buf[FLASH_SECTOR_SIZE] __attribute__((aligned(32)));
+} s_write_combine;
+
+static bool write_combine_flush(void)
+{
+    const size_t addr = s_write_combine.addr;
+
+    if (!s_write_combine.valid) {
+        return true;
+    }
+    s_write_combine.valid = false;
+
+    if (bootloader_flash_erase_range(addr, FLASH_SECTOR_SIZE) != ESP_OK) {
+        BOOT_LOG_ERR("%s: Flash erase failed at 0x%08x", __func__, (uint32_t)addr);
+        return false;
+    }
+    flush_cache(addr, FLASH_SECTOR_SIZE);
+
+    if (bootloader_flash_write(addr, s_write_combine.buf, FLASH_SECTOR_SIZE, true) != ESP_OK) {
+        BOOT_LOG_ERR("%s: Flash write failed at 0x%08x", __func__, (uint32_t)addr);
+        return false;
+    }
+    flush_cache(addr, FLASH_SECTOR_SIZE);
+
+    return true;
+}
+
+/* Writes the pending sector back if it overlaps [addr, addr + size). */
+static bool write_combine_flush_range(size_t addr, size_t size)
+{
+    if (s_write_combine.valid && addr < s_write_combine.addr + FLASH_SECTOR_SIZE &&
+        s_write_combine.addr < addr + size) {
+        return write_combine_flush();
+    }
+
+    return true;
+}
+
+/* Adds a write of less than a whole sector to the pending sector. */
+static bool write_combine_add(size_t dest_addr, const void *src, size_t size)
+{
+    const size_t sector_addr = ALIGN_DOWN(dest_addr, FLASH_SECTOR_SIZE);
+
+    if (s_write_combine.valid && s_write_combine.addr != sector_addr) {
+        if (!write_combine_flush()) {
+            return false;
+        }
+    }
+
+    if (!s_write_combine.valid) {
+        if (bootloader_flash_read(sector_addr, s_write_combine.buf, FLASH_SECTOR_SIZE,
+                                  true) != ESP_OK) {
+            BOOT_LOG_ERR("%s: Flash read failed at 0x%08x", __func__, (uint32_t)sector_addr);
+            return false;
+        }
+        s_write_combine.addr = sector_addr;
+        s_write_combine.valid = true;
+    }
+
+    memcpy(&s_write_combine.buf[dest_addr - sector_addr], src, size);
+
+    return true;
+}
+#endif
+
 static bool aligned_flash_read(uintptr_t addr, void *dest, size_t size)
 {
     if (IS_ALIGNED(addr, 4) && IS_ALIGNED((uintptr_t)dest, 4) && IS_ALIGNED(size, 4)) {
@@ -227,6 +311,12 @@ int flash_area_read(const struct flash_area *fa, uint32_t off, void *dst,
         return -1;
     }
 
+#ifdef CONFIG_ESP_FLASH_WRITE_COMBINE
+    if (!write_combine_flush_range(fa->fa_off + off, len)) {
+        return -1;
+    }
+#endif
+
     bool success = aligned_flash_read(fa->fa_off + off, dst, len);
     if (!success) {
         BOOT_LOG_ERR("%s: Flash read failed", __func__);
@@ -237,6 +327,46 @@ int flash_area_read(const struct flash_area *fa, uint32_t off, void *dst,
     return 0;
 }
 
+int flash_area_map(const struct flash_area *fa, uint32_t off, uint32_t len,
+                   const void **ptr)
+{
+    if (fa->fa_device_id != FLASH_DEVICE_INTERNAL_FLASH) {
+        return -1;
+    }
+
+    if (off > fa->fa_size || len > fa->fa_size - off) {
+        return -1;
+    }
+
+    /* bootloader_mmap() maps whole MMU pages; leave the reads that would
+     * not fit in the free ones to flash_area_read() rather than fail there.
+     */
+    const uint32_t addr = fa->fa_off + off;
+    const uint32_t pages = (ALIGN_OFFSET(addr, CONFIG_MMU_PAGE_SIZE) + len +
+                            CONFIG_MMU_PAGE_SIZE - 1) / CONFIG_MMU_PAGE_SIZE;
+    if (pages > bootloader_mmap_get_free_pages()) {
+        return -1;
+    }
+
+#ifdef CONFIG_ESP_FLASH_WRITE_COMBINE
+    if (!write_combine_flush_range(addr, len)) {
+        return -1;
+    }
+#endif
+
+    *ptr = bootloader_mmap(addr, len);
+
+    return (*ptr != NULL) ? 0 : -1;
+}
+
+void flash_area_unmap(const struct flash_area *fa, const void *ptr, uint32_t len)
+{
+    (void)fa;
+    (void)len;
+
+    bootloader_munmap(ptr);
+}
+
 static bool aligned_flash_write(size_t dest_addr, const void *src, size_t size, bool erase)
 {
 #ifdef CONFIG_SECURE_FLASH_ENC_ENABLED
@@ -436,6 +566,40 @@ int flash_area_write(const struct flash_area *fa, uint32_t off, const void *src,
     }
 #endif
 
+#ifdef CONFIG_ESP_FLASH_WRITE_COMBINE
+    if (erase) {
+        /* Whole sectors are written directly, the rest is combined. */
+        uint32_t addr = start_addr;
+        uint32_t remaining = len;
+        const uint8_t *data = src;
+
+        while (remaining > 0) {
+            uint32_t chunk = MIN(remaining, FLASH_SECTOR_SIZE - ALIGN_OFFSET(addr, FLASH_SECTOR_SIZE));
+            bool success;
+
+            if (chunk == FLASH_SECTOR_SIZE) {
+                success = write_combine_flush() && aligned_flash_write(addr, data, chunk, true);
+            } else {
+                success = write_combine_add(addr, data, chunk);
+            }
+            if (!success) {
+                BOOT_LOG_ERR("%s: Flash write failed", __func__);
+                return -1;
+            }
+
+            addr += chunk;
+            data += chunk;
+            remaining -= chunk;
+        }
+
+        return 0;
+    }
+
+    if (!write_combine_flush()) {
+        return -1;
+    }
+#endif
+
     if (!aligned_flash_write(start_addr, src, len, erase)) {
         BOOT_LOG_ERR("%s: Flash write failed", __func__);
         return -1;
@@ -453,6 +617,12 @@ int flash_area_erase(const struct flash_area *fa, uint32_t off, uint32_t len)
     const uint32_t start_addr = fa->fa_off + off;
     BOOT_LOG_DBG("%s: Addr: 0x%08x Length: %d (0x%x)", __func__, (int)start_addr, (int)len, (int)len);
 
+#ifdef CONFIG_ESP_FLASH_WRITE_COMBINE
+    if (!write_combine_flush()) {
+        return -1;
+    }
+#endif
+
     if (!aligned_flash_erase(start_addr, len)) {
         BOOT_LOG_ERR("%s: Flash erase failed", __func__);
         return -1;
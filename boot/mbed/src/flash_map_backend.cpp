@@ -28,6 +28,8 @@
 
 #include "mcuboot_config/mcuboot_logging.h"
 
+/* This is the flash backend, bootutil's read cache must not redirect it. */
+#define BOOTUTIL_FLASH_CACHE_BACKEND
 #include "bootutil_priv.h"
 
 #define FLASH_DEVICE_INTERNAL_FLASH 0
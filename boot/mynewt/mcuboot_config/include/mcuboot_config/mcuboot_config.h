@@ -133,6 +133,12 @@
 
 #define MCUBOOT_MAX_IMG_SECTORS       MYNEWT_VAL(BOOTUTIL_MAX_IMG_SECTORS)
 
+#if MYNEWT_VAL(BOOTUTIL_FLASH_READ_CACHE)
+#define MCUBOOT_FLASH_READ_CACHE
+#define MCUBOOT_FLASH_READ_CACHE_LINES MYNEWT_VAL(BOOTUTIL_FLASH_READ_CACHE_LINES)
+#define MCUBOOT_FLASH_READ_CACHE_LINE_SIZE MYNEWT_VAL(BOOTUTIL_FLASH_READ_CACHE_LINE_SIZE)
+#endif
+
 #if MYNEWT_VAL(MCU_FLASH_MIN_WRITE_SIZE) > 8
 #define MCUBOOT_BOOT_MAX_ALIGN  MYNEWT_VAL(MCU_FLASH_MIN_WRITE_SIZE)
 #endif
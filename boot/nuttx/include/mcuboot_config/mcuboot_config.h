@@ -102,6 +102,52 @@
 #  define MCUBOOT_BOOTSTRAP
 #endif
 
+/* Leave the sectors holding the same data in both slots as they are
+ * during an upgrade.
+ */
+
+#ifdef CONFIG_MCUBOOT_SPARSE_SWAP
+#  define MCUBOOT_SPARSE_SWAP
+#endif
+
+/* Record the swap status as bits, several entries per write unit; the
+ * flash must accept reprogramming of written units.
+ */
+
+#ifdef CONFIG_MCUBOOT_SWAP_STATUS_COMPACT
+#  define MCUBOOT_SWAP_STATUS_COMPACT
+#endif
+
+/* Record the swap status in the journal partition at
+ * CONFIG_MCUBOOT_SWAP_STATUS_PATH instead of the slot trailers.
+ */
+
+#ifdef CONFIG_MCUBOOT_SWAP_STATUS_JOURNAL
+#  define MCUBOOT_SWAP_STATUS_JOURNAL
+#endif
+
+/* Use the scratch partition as a ring of
+ * CONFIG_MCUBOOT_SWAP_SCRATCH_RING_WINDOWS windows.
+ */
+
+#ifdef CONFIG_MCUBOOT_SWAP_SCRATCH_RING
+#  define MCUBOOT_SWAP_SCRATCH_RING CONFIG_MCUBOOT_SWAP_SCRATCH_RING_WINDOWS
+#endif
+
+/* Serve small metadata reads from a read cache in front of the MTD. */
+
+#ifdef CONFIG_MCUBOOT_FLASH_READ_CACHE
+#  define MCUBOOT_FLASH_READ_CACHE
+#  define MCUBOOT_FLASH_READ_CACHE_LINES CONFIG_MCUBOOT_FLASH_READ_CACHE_LINES
+#  define MCUBOOT_FLASH_READ_CACHE_LINE_SIZE CONFIG_MCUBOOT_FLASH_READ_CACHE_LINE_SIZE
+#endif
+
+/* Read the headers and trailers of all images in one pass at boot. */
+
+#ifdef CONFIG_MCUBOOT_METADATA_PREFETCH
+#  define MCUBOOT_METADATA_PREFETCH
+#endif
+
 /* Cryptographic settings
  *
  * You must choose between mbedTLS and Tinycrypt as source of
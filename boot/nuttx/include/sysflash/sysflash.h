@@ -27,6 +27,7 @@
 #define PRIMARY_ID      0
 #define SECONDARY_ID    1
 #define SCRATCH_ID      2
+#define SWAP_STATUS_ID  3
 
 #define FLASH_AREA_IMAGE_PRIMARY(x)    (((x) == 0) ?        \
                                          PRIMARY_ID :       \
@@ -35,5 +36,6 @@
                                          SECONDARY_ID :     \
                                          SECONDARY_ID)
 #define FLASH_AREA_IMAGE_SCRATCH       SCRATCH_ID
+#define FLASH_AREA_SWAP_STATUS         SWAP_STATUS_ID
 
 #endif /* __BOOT_NUTTX_INCLUDE_SYSFLASH_SYSFLASH_H */
@@ -52,9 +52,12 @@
 
 struct flash_device_s
 {
-  /* Reference to the flash area configuration parameters */
+  /* Flash area configuration parameters. The flash area is the first
+   * member, so that the flash areas handed out to MCUboot convert back to
+   * their device without a lookup.
+   */
 
-  struct flash_area *fa_cfg;
+  struct flash_area fa;
 
   /* Geometry characteristics of the underlying MTD device */
 
@@ -67,24 +70,30 @@ struct flash_device_s
   int      fd;          /* File descriptor for an open flash area */
   uint32_t refs;        /* Reference counter */
   uint8_t  erase_state; /* Byte value of the flash erased state */
+
+#ifdef CONFIG_MCUBOOT_FLASH_READ_AHEAD
+  /* Data read ahead of the last small read, for the next ones */
+
+  uint32_t ra_off;      /* Offset of ra_buf within the flash area */
+  uint32_t ra_len;      /* Number of valid bytes in ra_buf, 0 if none */
+  uint8_t  ra_buf[CONFIG_MCUBOOT_FLASH_READ_AHEAD_SIZE];
+#endif
 };
 
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
-static struct flash_area g_primary_img0 =
-{
-  .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
-  .fa_device_id = 0,
-  .fa_off = 0,
-  .fa_size = 0,
-  .fa_mtd_path = CONFIG_MCUBOOT_PRIMARY_SLOT_PATH
-};
-
 static struct flash_device_s g_primary_priv =
 {
-  .fa_cfg = &g_primary_img0,
+  .fa =
+        {
+          .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
+          .fa_device_id = 0,
+          .fa_off = 0,
+          .fa_size = 0,
+          .fa_mtd_path = CONFIG_MCUBOOT_PRIMARY_SLOT_PATH
+        },
   .mtdgeo =
             {
               0
@@ -98,18 +107,16 @@ static struct flash_device_s g_primary_priv =
   .erase_state = CONFIG_MCUBOOT_DEFAULT_FLASH_ERASE_STATE
 };
 
-static struct flash_area g_secondary_img0 =
-{
-  .fa_id = FLASH_AREA_IMAGE_SECONDARY(0),
-  .fa_device_id = 0,
-  .fa_off = 0,
-  .fa_size = 0,
-  .fa_mtd_path = CONFIG_MCUBOOT_SECONDARY_SLOT_PATH
-};
-
 static struct flash_device_s g_secondary_priv =
 {
-  .fa_cfg = &g_secondary_img0,
+  .fa =
+        {
+          .fa_id = FLASH_AREA_IMAGE_SECONDARY(0),
+          .fa_device_id = 0,
+          .fa_off = 0,
+          .fa_size = 0,
+          .fa_mtd_path = CONFIG_MCUBOOT_SECONDARY_SLOT_PATH
+        },
   .mtdgeo =
             {
               0
@@ -123,18 +130,40 @@ static struct flash_device_s g_secondary_priv =
   .erase_state = CONFIG_MCUBOOT_DEFAULT_FLASH_ERASE_STATE
 };
 
-static struct flash_area g_scratch_img0 =
+static struct flash_device_s g_scratch_priv =
 {
-  .fa_id = FLASH_AREA_IMAGE_SCRATCH,
-  .fa_device_id = 0,
-  .fa_off = 0,
-  .fa_size = 0,
-  .fa_mtd_path = CONFIG_MCUBOOT_SCRATCH_PATH
+  .fa =
+        {
+          .fa_id = FLASH_AREA_IMAGE_SCRATCH,
+          .fa_device_id = 0,
+          .fa_off = 0,
+          .fa_size = 0,
+          .fa_mtd_path = CONFIG_MCUBOOT_SCRATCH_PATH
+        },
+  .mtdgeo =
+            {
+              0
+            },
+  .partinfo =
+              {
+                0
+              },
+  .fd = -1,
+  .refs = 0,
+  .erase_state = CONFIG_MCUBOOT_DEFAULT_FLASH_ERASE_STATE
 };
 
-static struct flash_device_s g_scratch_priv =
+#ifdef CONFIG_MCUBOOT_SWAP_STATUS_JOURNAL
+static struct flash_device_s g_swap_status_priv =
 {
-  .fa_cfg = &g_scratch_img0,
+  .fa =
+        {
+          .fa_id = FLASH_AREA_SWAP_STATUS,
+          .fa_device_id = 0,
+          .fa_off = 0,
+          .fa_size = 0,
+          .fa_mtd_path = CONFIG_MCUBOOT_SWAP_STATUS_PATH
+        },
   .mtdgeo =
             {
               0
@@ -147,14 +176,31 @@ static struct flash_device_s g_scratch_priv =
   .refs = 0,
   .erase_state = CONFIG_MCUBOOT_DEFAULT_FLASH_ERASE_STATE
 };
+#endif
 
 static struct flash_device_s *g_flash_devices[] =
 {
   &g_primary_priv,
   &g_secondary_priv,
   &g_scratch_priv,
+#ifdef CONFIG_MCUBOOT_SWAP_STATUS_JOURNAL
+  &g_swap_status_priv,
+#endif
 };
 
+#ifdef CONFIG_MCUBOOT_FLASH_WRITE_BATCH
+/* Contiguous writes not yet passed to the MTD. Only one device at a time
+ * has writes pending, and they are written before anything else is written
+ * or erased, so that the MTD sees the writes in the order MCUboot issued
+ * them.
+ */
+
+static struct flash_device_s *g_wb_dev;  /* Device the writes are for */
+static uint32_t g_wb_off;                /* Offset of g_wb_buf in the area */
+static uint32_t g_wb_len;                /* Number of bytes pending */
+static uint8_t  g_wb_buf[CONFIG_MCUBOOT_FLASH_WRITE_BATCH_SIZE];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -181,7 +227,7 @@ static struct flash_device_s *lookup_flash_device_by_id(uint8_t fa_id)
     {
       struct flash_device_s *dev = g_flash_devices[i];
 
-      if (fa_id == dev->fa_cfg->fa_id)
+      if (fa_id == dev->fa.fa_id)
         {
           return dev;
         }
@@ -212,7 +258,7 @@ static struct flash_device_s *lookup_flash_device_by_offset(uint32_t offset)
     {
       struct flash_device_s *dev = g_flash_devices[i];
 
-      if (offset == dev->fa_cfg->fa_off)
+      if (offset == dev->fa.fa_off)
         {
           return dev;
         }
@@ -221,6 +267,239 @@ static struct flash_device_s *lookup_flash_device_by_offset(uint32_t offset)
   return NULL;
 }
 
+/****************************************************************************
+ * Name: flash_device
+ *
+ * Description:
+ *   Retrieve the flash device of a flash area returned by flash_area_open().
+ *
+ * Input Parameters:
+ *   fa - Flash area.
+ *
+ * Returned Value:
+ *   Reference to the flash device.
+ *
+ ****************************************************************************/
+
+static inline struct flash_device_s *flash_device(const struct flash_area *fa)
+{
+  return (struct flash_device_s *)fa;
+}
+
+/****************************************************************************
+ * Name: flash_device_read
+ *
+ * Description:
+ *   Read data from the MTD of a flash device, at an offset relative from
+ *   the beginning of its flash area.
+ *
+ * Input Parameters:
+ *   dev - Flash device to be read.
+ *   off - Offset relative from beginning of flash area to be read.
+ *   len - Number of bytes to read.
+ *
+ * Output Parameters:
+ *   dst - Buffer to store read data.
+ *
+ * Returned Value:
+ *   Zero on success, or negative value in case of error.
+ *
+ ****************************************************************************/
+
+static int flash_device_read(struct flash_device_s *dev, uint32_t off,
+                             void *dst, uint32_t len)
+{
+  uint8_t *buf = dst;
+  ssize_t nbytes;
+
+  while (len > 0)
+    {
+      nbytes = pread(dev->fd, buf, len, (off_t)off);
+      if (nbytes <= 0)
+        {
+          int errcode = nbytes < 0 ? errno : EIO;
+
+          if (errcode == EINTR)
+            {
+              continue;
+            }
+
+          BOOT_LOG_ERR("Read from %s failed: %d", dev->fa.fa_mtd_path,
+                       errcode);
+
+          return ERROR;
+        }
+
+      buf += nbytes;
+      off += nbytes;
+      len -= nbytes;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: flash_device_write
+ *
+ * Description:
+ *   Write data to the MTD of a flash device, at an offset relative from
+ *   the beginning of its flash area.
+ *
+ * Input Parameters:
+ *   dev - Flash device to be written.
+ *   off - Offset relative from beginning of flash area to be written.
+ *   src - Buffer with data to be written.
+ *   len - Number of bytes to write.
+ *
+ * Returned Value:
+ *   Zero on success, or negative value in case of error.
+ *
+ ****************************************************************************/
+
+static int flash_device_write(struct flash_device_s *dev, uint32_t off,
+                              const void *src, uint32_t len)
+{
+  const uint8_t *buf = src;
+  ssize_t nbytes;
+
+  while (len > 0)
+    {
+      nbytes = pwrite(dev->fd, buf, len, (off_t)off);
+      if (nbytes <= 0)
+        {
+          int errcode = nbytes < 0 ? errno : EIO;
+
+          if (errcode == EINTR)
+            {
+              continue;
+            }
+
+          BOOT_LOG_ERR("Write to %s failed: %d", dev->fa.fa_mtd_path,
+                       errcode);
+
+          return ERROR;
+        }
+
+      buf += nbytes;
+      off += nbytes;
+      len -= nbytes;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: flash_device_flush
+ *
+ * Description:
+ *   Write the pending writes, if any, to their MTD.
+ *
+ * Returned Value:
+ *   Zero on success, or negative value in case of error.
+ *
+ ****************************************************************************/
+
+static int flash_device_flush(void)
+{
+#ifdef CONFIG_MCUBOOT_FLASH_WRITE_BATCH
+  uint32_t len = g_wb_len;
+
+  if (len == 0)
+    {
+      return OK;
+    }
+
+  g_wb_len = 0;
+
+  return flash_device_write(g_wb_dev, g_wb_off, g_wb_buf, len);
+#else
+  return OK;
+#endif
+}
+
+/****************************************************************************
+ * Name: flash_device_program
+ *
+ * Description:
+ *   Write data to a flash device, adding it to the pending writes if write
+ *   batching is enabled.
+ *
+ * Input Parameters:
+ *   dev - Flash device to be written.
+ *   off - Offset relative from beginning of flash area to be written.
+ *   src - Buffer with data to be written.
+ *   len - Number of bytes to write.
+ *
+ * Returned Value:
+ *   Zero on success, or negative value in case of error.
+ *
+ ****************************************************************************/
+
+static int flash_device_program(struct flash_device_s *dev, uint32_t off,
+                                const void *src, uint32_t len)
+{
+#ifdef CONFIG_MCUBOOT_FLASH_WRITE_BATCH
+  const uint8_t *buf = src;
+  uint32_t chunk;
+#endif
+
+#ifdef CONFIG_MCUBOOT_FLASH_READ_AHEAD
+  if (dev->ra_len > 0 && off < dev->ra_off + dev->ra_len &&
+      dev->ra_off < off + len)
+    {
+      dev->ra_len = 0;
+    }
+#endif
+
+#ifdef CONFIG_MCUBOOT_FLASH_WRITE_BATCH
+  if (g_wb_len > 0 && (g_wb_dev != dev || off != g_wb_off + g_wb_len))
+    {
+      if (flash_device_flush() != OK)
+        {
+          return ERROR;
+        }
+    }
+
+  while (len > 0)
+    {
+      if (g_wb_len == 0 && len >= CONFIG_MCUBOOT_FLASH_WRITE_BATCH_SIZE)
+        {
+          /* Nothing to batch this with */
+
+          return flash_device_write(dev, off, buf, len);
+        }
+
+      if (g_wb_len == 0)
+        {
+          g_wb_dev = dev;
+          g_wb_off = off;
+        }
+
+      chunk = CONFIG_MCUBOOT_FLASH_WRITE_BATCH_SIZE - g_wb_len;
+      if (chunk > len)
+        {
+          chunk = len;
+        }
+
+      memcpy(&g_wb_buf[g_wb_len], buf, chunk);
+      g_wb_len += chunk;
+      buf += chunk;
+      off += chunk;
+      len -= chunk;
+
+      if (g_wb_len == CONFIG_MCUBOOT_FLASH_WRITE_BATCH_SIZE &&
+          flash_device_flush() != OK)
+        {
+          return ERROR;
+        }
+    }
+
+  return OK;
+#else
+  return flash_device_write(dev, off, src, len);
+#endif
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -249,8 +528,6 @@ int flash_area_open(uint8_t id, const struct flash_area **fa)
   int fd;
   int ret;
 
-  BOOT_LOG_INF("ID:%" PRIu8, id);
-
   dev = lookup_flash_device_by_id(id);
   if (dev == NULL)
     {
@@ -259,17 +536,14 @@ int flash_area_open(uint8_t id, const struct flash_area **fa)
       return ERROR;
     }
 
-  *fa = dev->fa_cfg;
+  *fa = &dev->fa;
 
   if (dev->refs++ > 0)
     {
-      BOOT_LOG_INF("Flash area ID %" PRIu8 " already open, count: %" PRIu32 " (+)",
-                   id, dev->refs);
-
       return OK;
     }
 
-  fd = open(dev->fa_cfg->fa_mtd_path, O_RDWR);
+  fd = open(dev->fa.fa_mtd_path, O_RDWR);
   if (fd < 0)
     {
       int errcode = errno;
@@ -310,16 +584,17 @@ int flash_area_open(uint8_t id, const struct flash_area **fa)
       goto errout_with_fd;
     }
 
-  dev->fa_cfg->fa_off = dev->partinfo.startsector * dev->partinfo.sectorsize;
-  dev->fa_cfg->fa_size = dev->partinfo.numsectors * dev->partinfo.sectorsize;
+  dev->fa.fa_off = dev->partinfo.startsector * dev->partinfo.sectorsize;
+  dev->fa.fa_size = dev->partinfo.numsectors * dev->partinfo.sectorsize;
 
-  BOOT_LOG_INF("Flash area offset: 0x%" PRIx32, dev->fa_cfg->fa_off);
-  BOOT_LOG_INF("Flash area size: %" PRIu32, dev->fa_cfg->fa_size);
-  BOOT_LOG_INF("MTD erase state: 0x%" PRIx8, dev->erase_state);
+  BOOT_LOG_DBG("Flash area %" PRIu8 " open, offset: 0x%" PRIx32
+               ", size: %" PRIu32 ", erase state: 0x%" PRIx8,
+               id, dev->fa.fa_off, dev->fa.fa_size, dev->erase_state);
 
   dev->fd = fd;
-
-  BOOT_LOG_INF("Flash area %" PRIu8 " open, count: %" PRIu32 " (+)", id, dev->refs);
+#ifdef CONFIG_MCUBOOT_FLASH_READ_AHEAD
+  dev->ra_len = 0;
+#endif
 
   return OK;
 
@@ -337,6 +612,7 @@ errout:
  *
  * Description:
  *   Close a given flash area.
+ *   Any writes still pending are written to the MTD first.
  *
  * Input Parameters:
  *   fa - Flash area to be closed.
@@ -348,11 +624,7 @@ errout:
 
 void flash_area_close(const struct flash_area *fa)
 {
-  BOOT_LOG_INF("ID:%" PRIu8, fa->fa_id);
-
-  struct flash_device_s *dev = lookup_flash_device_by_id(fa->fa_id);
-
-  DEBUGASSERT(dev != NULL);
+  struct flash_device_s *dev = flash_device(fa);
 
   if (dev->refs == 0)
     {
@@ -363,15 +635,22 @@ void flash_area_close(const struct flash_area *fa)
       return;
     }
 
-  BOOT_LOG_INF("Close request for flash area %" PRIu8 ", count: %" PRIu32 " (-)",
-               fa->fa_id, dev->refs);
+  /* Whatever is written is on the MTD once the area is closed, as it was
+   * when writes were not batched.
+   */
+
+  if (flash_device_flush() != OK)
+    {
+      BOOT_LOG_ERR("Pending writes to flash area %" PRIu8 " failed",
+                   fa->fa_id);
+    }
 
   if (--dev->refs == 0)
     {
       close(dev->fd);
       dev->fd = -1;
 
-      BOOT_LOG_INF("Flash area %" PRIu8 " closed", fa->fa_id);
+      BOOT_LOG_DBG("Flash area %" PRIu8 " closed", fa->fa_id);
     }
 }
 
@@ -383,6 +662,8 @@ void flash_area_close(const struct flash_area *fa)
  *   Area readout boundaries are asserted before read request. API has the
  *   same limitation regarding read-block alignment and size as the
  *   underlying flash driver.
+ *   With CONFIG_MCUBOOT_FLASH_READ_AHEAD, reads smaller than the read-ahead
+ *   buffer read a whole buffer, from which the next small reads are served.
  *
  * Input Parameters:
  *   fa  - Flash area to be read.
@@ -400,49 +681,67 @@ void flash_area_close(const struct flash_area *fa)
 int flash_area_read(const struct flash_area *fa, uint32_t off,
                     void *dst, uint32_t len)
 {
-  struct flash_device_s *dev;
-  off_t seekpos;
-  ssize_t nbytes;
-
-  BOOT_LOG_INF("ID:%" PRIu8 " offset:%" PRIu32 " length:%" PRIu32,
-               fa->fa_id, off, len);
-
-  dev = lookup_flash_device_by_id(fa->fa_id);
+  struct flash_device_s *dev = flash_device(fa);
 
-  DEBUGASSERT(dev != NULL);
-
-  if (off + len > fa->fa_size)
+  if (off > fa->fa_size || len > fa->fa_size - off)
     {
       BOOT_LOG_ERR("Attempt to read out of flash area bounds");
 
       return ERROR;
     }
 
-  /* Reposition the file offset from the beginning of the flash area */
+#ifdef CONFIG_MCUBOOT_FLASH_WRITE_BATCH
+  /* Reads see what was written before */
 
-  seekpos = lseek(dev->fd, (off_t)off, SEEK_SET);
-  if (seekpos != (off_t)off)
+  if (g_wb_len > 0 && g_wb_dev == dev && flash_device_flush() != OK)
     {
-      int errcode = errno;
-
-      BOOT_LOG_ERR("Seek to offset %" PRIu32 " failed: %d", off, errcode);
-
       return ERROR;
     }
+#endif
 
-  /* Read the flash block into memory */
-
-  nbytes = read(dev->fd, dst, len);
-  if (nbytes < 0)
+#ifdef CONFIG_MCUBOOT_FLASH_READ_AHEAD
+  if (len < CONFIG_MCUBOOT_FLASH_READ_AHEAD_SIZE)
     {
-      int errcode = errno;
+      uint32_t ra_off;
+      uint32_t ra_len;
+
+      if (dev->ra_len == 0 || off < dev->ra_off ||
+          off + len > dev->ra_off + dev->ra_len)
+        {
+          /* Read the aligned block holding the data, which serves reads
+           * walking backwards as well as forwards, or from the data on if
+           * it crosses the end of that block.
+           */
 
-      BOOT_LOG_ERR("Read from %s failed: %d", fa->fa_mtd_path, errcode);
+          ra_off = off - off % CONFIG_MCUBOOT_FLASH_READ_AHEAD_SIZE;
+          if (off + len > ra_off + CONFIG_MCUBOOT_FLASH_READ_AHEAD_SIZE)
+            {
+              ra_off = off;
+            }
 
-      return ERROR;
+          ra_len = fa->fa_size - ra_off;
+          if (ra_len > CONFIG_MCUBOOT_FLASH_READ_AHEAD_SIZE)
+            {
+              ra_len = CONFIG_MCUBOOT_FLASH_READ_AHEAD_SIZE;
+            }
+
+          dev->ra_len = 0;
+          if (flash_device_read(dev, ra_off, dev->ra_buf, ra_len) != OK)
+            {
+              return ERROR;
+            }
+
+          dev->ra_off = ra_off;
+          dev->ra_len = ra_len;
+        }
+
+      memcpy(dst, &dev->ra_buf[off - dev->ra_off], len);
+
+      return OK;
     }
+#endif
 
-  return OK;
+  return flash_device_read(dev, off, dst, len);
 }
 
 /****************************************************************************
@@ -453,6 +752,10 @@ int flash_area_read(const struct flash_area *fa, uint32_t off,
  *   Area write boundaries are asserted before write request. API has the
  *   same limitation regarding write-block alignment and size as the
  *   underlying flash driver.
+ *   With CONFIG_MCUBOOT_FLASH_WRITE_BATCH, contiguous writes are combined
+ *   and passed to the MTD together, before the flash area is read, closed,
+ *   or another write or erase is made elsewhere. Errors of the combined
+ *   write are returned by the call that passes it to the MTD.
  *
  * Input Parameters:
  *   fa  - Flash area to be written.
@@ -468,49 +771,14 @@ int flash_area_read(const struct flash_area *fa, uint32_t off,
 int flash_area_write(const struct flash_area *fa, uint32_t off,
                      const void *src, uint32_t len)
 {
-  struct flash_device_s *dev;
-  off_t seekpos;
-  ssize_t nbytes;
-
-  BOOT_LOG_INF("ID:%" PRIu8 " offset:%" PRIu32 " length:%" PRIu32,
-               fa->fa_id, off, len);
-
-  dev = lookup_flash_device_by_id(fa->fa_id);
-
-  DEBUGASSERT(dev != NULL);
-
-  if (off + len > fa->fa_size)
+  if (off > fa->fa_size || len > fa->fa_size - off)
     {
       BOOT_LOG_ERR("Attempt to write out of flash area bounds");
 
       return ERROR;
     }
 
-  /* Reposition the file offset from the beginning of the flash area */
-
-  seekpos = lseek(dev->fd, (off_t)off, SEEK_SET);
-  if (seekpos != (off_t)off)
-    {
-      int errcode = errno;
-
-      BOOT_LOG_ERR("Seek to offset %" PRIu32 " failed: %d", off, errcode);
-
-      return ERROR;
-    }
-
-  /* Write the buffer to the flash block */
-
-  nbytes = write(dev->fd, src, len);
-  if (nbytes < 0)
-    {
-      int errcode = errno;
-
-      BOOT_LOG_ERR("Write to %s failed: %d", fa->fa_mtd_path, errcode);
-
-      return ERROR;
-    }
-
-  return OK;
+  return flash_device_program(flash_device(fa), off, src, len);
 }
 
 /****************************************************************************
@@ -521,6 +789,8 @@ int flash_area_write(const struct flash_area *fa, uint32_t off,
  *   Area boundaries are asserted before erase request. API has the same
  *   limitation regarding erase-block alignment and size as the underlying
  *   flash driver.
+ *   The range is written with the erased value one sector at a time, which
+ *   CONFIG_MCUBOOT_FLASH_WRITE_BATCH combines into larger writes.
  *
  * Input Parameters:
  *   fa  - Flash area to be erased.
@@ -534,15 +804,19 @@ int flash_area_write(const struct flash_area *fa, uint32_t off,
 
 int flash_area_erase(const struct flash_area *fa, uint32_t off, uint32_t len)
 {
-  int ret;
+  int ret = OK;
   void *buffer;
-  size_t i;
-  struct flash_device_s *dev = lookup_flash_device_by_id(fa->fa_id);
-  const size_t sector_size = dev->mtdgeo.erasesize;
-  const uint8_t erase_val = dev->erase_state;
+  uint32_t i;
+  uint32_t chunk;
+  struct flash_device_s *dev = flash_device(fa);
+  const uint32_t sector_size = dev->mtdgeo.erasesize;
 
-  BOOT_LOG_INF("ID:%" PRIu8 " offset:%" PRIu32 " length:%" PRIu32,
-               fa->fa_id, off, len);
+  if (off > fa->fa_size || len > fa->fa_size - off)
+    {
+      BOOT_LOG_ERR("Attempt to erase out of flash area bounds");
+
+      return ERROR;
+    }
 
   buffer = malloc(sector_size);
   if (buffer == NULL)
@@ -552,26 +826,17 @@ int flash_area_erase(const struct flash_area *fa, uint32_t off, uint32_t len)
       return ERROR;
     }
 
-  memset(buffer, erase_val, sector_size);
-
-  i = 0;
-
-  do
-    {
-      BOOT_LOG_DBG("Erasing %zu bytes at offset %" PRIu32,
-                   sector_size, off + i);
-
-      ret = flash_area_write(fa, off + i, buffer, sector_size);
-      i += sector_size;
-    }
-  while (ret == OK && i < (len - sector_size));
+  memset(buffer, dev->erase_state, sector_size);
 
-  if (ret == OK)
+  for (i = 0; ret == OK && i < len; i += chunk)
     {
-      BOOT_LOG_DBG("Erasing %" PRIu32 " bytes at offset %" PRIu32,
-                   len - i, off + i);
+      chunk = len - i;
+      if (chunk > sector_size)
+        {
+          chunk = sector_size;
+        }
 
-      ret = flash_area_write(fa, off + i, buffer, len - i);
+      ret = flash_device_program(dev, off + i, buffer, chunk);
     }
 
   free(buffer);
@@ -603,9 +868,6 @@ uint32_t flash_area_align(const struct flash_area *fa)
 
   const uint32_t minimum_write_length = 1;
 
-  BOOT_LOG_INF("ID:%" PRIu8 " align:%" PRIu32,
-               fa->fa_id, minimum_write_length);
-
   return minimum_write_length;
 }
 
@@ -626,18 +888,7 @@ uint32_t flash_area_align(const struct flash_area *fa)
 
 uint8_t flash_area_erased_val(const struct flash_area *fa)
 {
-  struct flash_device_s *dev;
-  uint8_t erased_val;
-
-  dev = lookup_flash_device_by_id(fa->fa_id);
-
-  DEBUGASSERT(dev != NULL);
-
-  erased_val = dev->erase_state;
-
-  BOOT_LOG_INF("ID:%" PRIu8 " erased_val:0x%" PRIx8, fa->fa_id, erased_val);
-
-  return erased_val;
+  return flash_device(fa)->erase_state;
 }
 
 /****************************************************************************
@@ -666,7 +917,7 @@ int flash_area_get_sectors(int fa_id, uint32_t *count,
   uint32_t total_count = 0;
   struct flash_device_s *dev = lookup_flash_device_by_id(fa_id);
   const size_t sector_size = dev->mtdgeo.erasesize;
-  const struct flash_area *fa = fa = dev->fa_cfg;
+  const struct flash_area *fa = &dev->fa;
 
   for (off = 0; off < fa->fa_size; off += sector_size)
     {
@@ -681,7 +932,7 @@ int flash_area_get_sectors(int fa_id, uint32_t *count,
 
   DEBUGASSERT(total_count == dev->mtdgeo.neraseblocks);
 
-  BOOT_LOG_INF("ID:%d count:%" PRIu32, fa_id, *count);
+  BOOT_LOG_DBG("ID:%d count:%" PRIu32, fa_id, *count);
 
   return OK;
 }
@@ -705,7 +956,7 @@ int flash_area_get_sectors(int fa_id, uint32_t *count,
 
 int flash_area_id_from_multi_image_slot(int image_index, int slot)
 {
-  BOOT_LOG_INF("image_index:%d slot:%d", image_index, slot);
+  BOOT_LOG_DBG("image_index:%d slot:%d", image_index, slot);
 
   switch (slot)
     {
@@ -738,7 +989,7 @@ int flash_area_id_from_multi_image_slot(int image_index, int slot)
 
 int flash_area_id_from_image_slot(int slot)
 {
-  BOOT_LOG_INF("slot:%d", slot);
+  BOOT_LOG_DBG("slot:%d", slot);
 
   return flash_area_id_from_multi_image_slot(0, slot);
 }
@@ -762,7 +1013,7 @@ int flash_area_id_from_image_slot(int slot)
 
 int flash_area_id_to_multi_image_slot(int image_index, int area_id)
 {
-  BOOT_LOG_INF("image_index:%d area_id:%d", image_index, area_id);
+  BOOT_LOG_DBG("image_index:%d area_id:%d", image_index, area_id);
 
   if (area_id == FLASH_AREA_IMAGE_PRIMARY(image_index))
     {
@@ -799,11 +1050,11 @@ int flash_area_id_from_image_offset(uint32_t offset)
 {
   struct flash_device_s *dev = lookup_flash_device_by_offset(offset);
 
-  BOOT_LOG_INF("offset:%" PRIu32, offset);
+  BOOT_LOG_DBG("offset:%" PRIu32, offset);
 
   if (dev != NULL)
     {
-      return dev->fa_cfg->fa_id;
+      return dev->fa.fa_id;
     }
 
   BOOT_LOG_ERR("Unexpected Request: offset:%" PRIu32, offset);
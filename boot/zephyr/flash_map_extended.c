@@ -294,6 +294,42 @@ __weak uint8_t flash_area_erased_val(const struct flash_area *fap)
     return ERASED_VAL;
 }
 
+#if defined(CONFIG_BOOT_FLASH_AREA_MAP)
+int flash_area_map(const struct flash_area *fap, uint32_t off, uint32_t len,
+                   const void **ptr)
+{
+    uintptr_t base;
+
+    if (off > fap->fa_size || len > fap->fa_size - off) {
+        return -ERANGE;
+    }
+
+    if (flash_device_base(flash_area_get_device_id(fap), &base) != 0) {
+        return -ENOTSUP;
+    }
+
+    *ptr = (const void *)(base + fap->fa_off + off);
+
+    return 0;
+}
+
+void flash_area_unmap(const struct flash_area *fap, const void *ptr, uint32_t len)
+{
+    /* Storage is permanently mapped */
+    (void)fap;
+    (void)ptr;
+    (void)len;
+}
+#endif
+
+#if defined(CONFIG_MCUBOOT_STORAGE_ERASE_BLOCKS) && (CONFIG_MCUBOOT_STORAGE_ERASE_BLOCKS != 0)
+__weak uint32_t flash_area_erase_blocks(const struct flash_area *fap)
+{
+    (void)fap;
+    return CONFIG_MCUBOOT_STORAGE_ERASE_BLOCKS;
+}
+#endif
+
 #if (CONFIG_MCUBOOT_LOGICAL_SECTOR_SIZE == 0 || defined(CONFIG_MCUBOOT_VERIFY_LOGICAL_SECTORS))
 int flash_area_get_sector(const struct flash_area *fap, off_t off,
                           struct flash_sector *fsp)
@@ -101,6 +101,35 @@ static inline uint32_t flash_sector_get_size(const struct flash_sector *fs)
 int flash_area_get_sector(const struct flash_area *fa, off_t off,
                           struct flash_sector *fs);
 
+#if defined(CONFIG_BOOT_FLASH_AREA_MAP)
+/* Map a range of a flash area into the address space, for reading in place.
+ *
+ * @param fa        flash area to map.
+ * @param off       offset within flash area.
+ * @param len       length of the range.
+ * @param ptr       set to the address of the range.
+ * Returns 0 on success, negative errno code if the range can not be mapped.
+ */
+int flash_area_map(const struct flash_area *fa, uint32_t off, uint32_t len,
+                   const void **ptr);
+
+/* Release a range mapped with flash_area_map(). */
+void flash_area_unmap(const struct flash_area *fa, const void *ptr, uint32_t len);
+#endif
+
+#if defined(CONFIG_MCUBOOT_STORAGE_ERASE_BLOCKS) && (CONFIG_MCUBOOT_STORAGE_ERASE_BLOCKS != 0)
+/* Retrieve the erase blocks, larger than a sector, that flash_area_erase()
+ * erases with a single command when given a range aligned to and as large
+ * as one of them.
+ *
+ * @param fa        flash area the blocks apply to.
+ * Returns a mask with a bit set for the size of each block (e.g. 0x18000
+ *         for 32 KiB and 64 KiB blocks); blocks are aligned to their size
+ *         on the device.
+ */
+uint32_t flash_area_erase_blocks(const struct flash_area *fa);
+#endif
+
 
 #if defined(CONFIG_MCUBOOT)
 static inline bool flash_area_erase_required(const struct flash_area *fa)
@@ -21,10 +21,19 @@
 #  else
 #    define MCUBOOT_SIGN_RSA_LEN CONFIG_BOOT_SIGNATURE_TYPE_RSA_LEN
 #  endif
+#  ifdef CONFIG_BOOT_RSA_MONT_CONSTANTS
+#    define MCUBOOT_RSA_MONT_CONSTANTS
+#  endif
 #elif defined(CONFIG_BOOT_SIGNATURE_TYPE_ECDSA_P256)
 #define MCUBOOT_SIGN_EC256
 #elif defined(CONFIG_BOOT_SIGNATURE_TYPE_ED25519)
 #define MCUBOOT_SIGN_ED25519
+#ifdef CONFIG_BOOT_ED25519_BASE_WINDOW
+#define MCUBOOT_ED25519_BASE_WINDOW CONFIG_BOOT_ED25519_BASE_WINDOW
+#endif
+#ifdef CONFIG_BOOT_ED25519_KEY_POINT
+#define MCUBOOT_ED25519_KEY_POINT
+#endif
 #endif
 
 #if defined(CONFIG_BOOT_USE_TINYCRYPT)
@@ -43,6 +52,12 @@
 #define MCUBOOT_USE_MBED_TLS
 #elif defined(CONFIG_BOOT_USE_TINYCRYPT)
 #define MCUBOOT_USE_TINYCRYPT
+#if defined(CONFIG_BOOT_ECDSA_TINYCRYPT_COMB_TEETH) && CONFIG_BOOT_ECDSA_TINYCRYPT_COMB_TEETH > 0
+#define MCUBOOT_ECDSA_P256_COMB_TEETH CONFIG_BOOT_ECDSA_TINYCRYPT_COMB_TEETH
+#endif
+#if defined(CONFIG_BOOT_ECDSA_TINYCRYPT_KEY_COMB_TEETH) && CONFIG_BOOT_ECDSA_TINYCRYPT_KEY_COMB_TEETH > 0
+#define MCUBOOT_ECDSA_P256_KEY_COMB_TEETH CONFIG_BOOT_ECDSA_TINYCRYPT_KEY_COMB_TEETH
+#endif
 #elif defined(CONFIG_BOOT_USE_CC310)
 #define MCUBOOT_USE_CC310
 #ifdef CONFIG_BOOT_USE_NRF_CC310_BL
@@ -60,6 +75,10 @@
 #define MCUBOOT_SHA256
 #endif
 
+#ifdef CONFIG_BOOT_IMG_HASH_ALG_BLAKE2S
+#define MCUBOOT_BLAKE2S
+#endif
+
 /* Zephyr, regardless of C library used, provides snprintf */
 #define MCUBOOT_USE_SNPRINTF 1
 
@@ -109,6 +128,10 @@
 #define MCUBOOT_RAM_LOAD_REVERT
 #endif
 
+#ifdef CONFIG_BOOT_WARM_BOOT_CACHE
+#define MCUBOOT_WARM_BOOT_CACHE
+#endif
+
 #ifdef CONFIG_BOOT_RAM_LOAD
 #define MCUBOOT_RAM_LOAD 1
 #define IMAGE_EXECUTABLE_RAM_START CONFIG_BOOT_IMAGE_EXECUTABLE_RAM_START
@@ -206,6 +229,27 @@
 #define MCUBOOT_HASH_STORAGE_DIRECTLY
 #endif
 
+/* Serve small metadata reads from a read cache in front of the flash
+ * driver.
+ */
+#ifdef CONFIG_BOOT_FLASH_READ_CACHE
+#define MCUBOOT_FLASH_READ_CACHE
+#define MCUBOOT_FLASH_READ_CACHE_LINES CONFIG_BOOT_FLASH_READ_CACHE_LINES
+#define MCUBOOT_FLASH_READ_CACHE_LINE_SIZE CONFIG_BOOT_FLASH_READ_CACHE_LINE_SIZE
+#endif
+
+/* Read the headers and trailers of all images in one pass at boot. */
+#ifdef CONFIG_BOOT_METADATA_PREFETCH
+#define MCUBOOT_METADATA_PREFETCH
+#endif
+
+/* Read image data in place from storage mapped to the address space,
+ * rather than copying it out.
+ */
+#ifdef CONFIG_BOOT_FLASH_AREA_MAP
+#define MCUBOOT_USE_FLASH_AREA_MAP
+#endif
+
 #ifdef CONFIG_BOOT_SIGNATURE_TYPE_PURE
 #define MCUBOOT_SIGN_PURE
 #endif
@@ -214,6 +258,22 @@
 #define MCUBOOT_BOOTSTRAP 1
 #endif
 
+#ifdef CONFIG_BOOT_SPARSE_SWAP
+#define MCUBOOT_SPARSE_SWAP
+#endif
+
+#ifdef CONFIG_BOOT_SWAP_STATUS_COMPACT
+#define MCUBOOT_SWAP_STATUS_COMPACT
+#endif
+
+#ifdef CONFIG_BOOT_SWAP_STATUS_JOURNAL
+#define MCUBOOT_SWAP_STATUS_JOURNAL
+#endif
+
+#ifdef CONFIG_BOOT_SWAP_SCRATCH_RING
+#define MCUBOOT_SWAP_SCRATCH_RING CONFIG_BOOT_SWAP_SCRATCH_RING_WINDOWS
+#endif
+
 #ifdef CONFIG_BOOT_USE_BENCH
 #define MCUBOOT_USE_BENCH 1
 #endif
@@ -383,6 +443,14 @@
 #define MCUBOOT_ERASE_PROGRESSIVELY
 #endif
 
+#ifdef CONFIG_BOOT_SERIAL_ERASE_AHEAD_SECTORS
+#define MCUBOOT_SERIAL_ERASE_AHEAD_SECTORS CONFIG_BOOT_SERIAL_ERASE_AHEAD_SECTORS
+#endif
+
+#ifdef CONFIG_BOOT_SERIAL_CACHE_VALIDATION
+#define MCUBOOT_SERIAL_CACHE_VALIDATION
+#endif
+
 /*
  * Devices that do not require erase prior to write or do not support
  * erase should avoid emulation of erase by additional write.
@@ -397,6 +465,14 @@
 #define MCUBOOT_SUPPORT_DEV_WITH_ERASE
 #endif
 
+/*
+ * Erase ranges with the large erase blocks of the device, where they fit,
+ * rather than sector by sector.
+ */
+#if defined(CONFIG_MCUBOOT_STORAGE_ERASE_BLOCKS) && (CONFIG_MCUBOOT_STORAGE_ERASE_BLOCKS != 0)
+#define MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS
+#endif
+
 /*
  * MCUboot often calls erase on device just to remove data or make application
  * image not recognizable. In such instances it may be faster to just remove
@@ -459,10 +535,18 @@
 #define MCUBOOT_SERIAL_MAX_RECEIVE_SIZE CONFIG_BOOT_SERIAL_MAX_RECEIVE_SIZE
 #endif
 
+#ifdef CONFIG_BOOT_MAX_LINE_INPUT_LEN
+#define MCUBOOT_SERIAL_MAX_LINE_INPUT_LEN CONFIG_BOOT_MAX_LINE_INPUT_LEN
+#endif
+
 #ifdef CONFIG_BOOT_SERIAL_UNALIGNED_BUFFER_SIZE
 #define MCUBOOT_SERIAL_UNALIGNED_BUFFER_SIZE CONFIG_BOOT_SERIAL_UNALIGNED_BUFFER_SIZE
 #endif
 
+#ifdef CONFIG_BOOT_SERIAL_WRITE_COMBINE_SIZE
+#define MCUBOOT_SERIAL_WRITE_COMBINE_SIZE CONFIG_BOOT_SERIAL_WRITE_COMBINE_SIZE
+#endif
+
 #if defined(MCUBOOT_DATA_SHARING) && defined(ZEPHYR_VER_INCLUDE)
 #include <zephyr/app_version.h>
 
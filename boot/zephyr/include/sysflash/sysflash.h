@@ -96,6 +96,10 @@ static inline uint32_t __flash_area_ids_for_slot(int img, int slot)
 #define FLASH_AREA_IMAGE_SCRATCH    PARTITION_ID(scratch_partition)
 #endif
 
+#if defined(CONFIG_BOOT_SWAP_STATUS_JOURNAL)
+#define FLASH_AREA_SWAP_STATUS      PARTITION_ID(swap_status_partition)
+#endif
+
 #else /* !CONFIG_SINGLE_APPLICATION_SLOT && !CONFIG_MCUBOOT_BOOTLOADER_MODE_SINGLE_APP */
 
 #define FLASH_AREA_IMAGE_PRIMARY(x)	PARTITION_ID(slot0_partition)
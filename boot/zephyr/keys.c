@@ -50,16 +50,62 @@
 
 #define BOOT_KEY_NAME(N) BOOT_KEY_CAT(BOOT_KEY_PRIMARY, BOOT_KEY_CAT(_, N))
 
+/* RSA Montgomery constants, emitted by imgtool getpub next to each key. */
+#if defined(MCUBOOT_RSA_MONT_CONSTANTS)
+#define BOOT_KEY_MONT_DECL(name) \
+    extern const unsigned char BOOT_KEY_CAT(name, _rr)[]; \
+    extern const unsigned int BOOT_KEY_CAT(name, _n0);
+#define BOOT_KEY_MONT_ENTRY(name) \
+    .rsa_rr = BOOT_KEY_CAT(name, _rr), \
+    .rsa_n0 = &BOOT_KEY_CAT(name, _n0),
+#else
+#define BOOT_KEY_MONT_DECL(name)
+#define BOOT_KEY_MONT_ENTRY(name)
+#endif
+
+/* ECDSA P-256 key comb tables, emitted by imgtool getpub --comb-teeth. */
+#if defined(MCUBOOT_SIGN_EC256) && defined(MCUBOOT_ECDSA_P256_KEY_COMB_TEETH)
+#define BOOT_KEY_COMB(name) \
+    BOOT_KEY_CAT(name, BOOT_KEY_CAT(_comb, MCUBOOT_ECDSA_P256_KEY_COMB_TEETH))
+#define BOOT_KEY_COMB_DECL(name) \
+    extern const unsigned int BOOT_KEY_COMB(name)[];
+#define BOOT_KEY_COMB_ENTRY(name) \
+    .ec_comb = BOOT_KEY_COMB(name),
+#else
+#define BOOT_KEY_COMB_DECL(name)
+#define BOOT_KEY_COMB_ENTRY(name)
+#endif
+
+/* Ed25519 key x coordinates, emitted by imgtool getpub next to each key. */
+#if defined(MCUBOOT_SIGN_ED25519) && defined(MCUBOOT_ED25519_KEY_POINT)
+#define BOOT_KEY_POINT_DECL(name) \
+    extern const unsigned char BOOT_KEY_CAT(name, _x)[];
+#define BOOT_KEY_POINT_ENTRY(name) \
+    .ed25519_x = BOOT_KEY_CAT(name, _x),
+#else
+#define BOOT_KEY_POINT_DECL(name)
+#define BOOT_KEY_POINT_ENTRY(name)
+#endif
+
 #define BOOT_KEY_DECL_AT(i, _) \
     extern const unsigned char BOOT_KEY_NAME(UTIL_INC(i))[]; \
-    extern unsigned int BOOT_KEY_CAT(BOOT_KEY_NAME(UTIL_INC(i)), _len);
+    extern unsigned int BOOT_KEY_CAT(BOOT_KEY_NAME(UTIL_INC(i)), _len); \
+    BOOT_KEY_MONT_DECL(BOOT_KEY_NAME(UTIL_INC(i))) \
+    BOOT_KEY_COMB_DECL(BOOT_KEY_NAME(UTIL_INC(i))) \
+    BOOT_KEY_POINT_DECL(BOOT_KEY_NAME(UTIL_INC(i)))
 
 #define BOOT_KEY_ENTRY_AT(i, _) \
     { .key = BOOT_KEY_NAME(UTIL_INC(i)), \
-      .len = &BOOT_KEY_CAT(BOOT_KEY_NAME(UTIL_INC(i)), _len) },
+      .len = &BOOT_KEY_CAT(BOOT_KEY_NAME(UTIL_INC(i)), _len), \
+      BOOT_KEY_MONT_ENTRY(BOOT_KEY_NAME(UTIL_INC(i))) \
+      BOOT_KEY_COMB_ENTRY(BOOT_KEY_NAME(UTIL_INC(i))) \
+      BOOT_KEY_POINT_ENTRY(BOOT_KEY_NAME(UTIL_INC(i))) },
 
 extern const unsigned char BOOT_KEY_PRIMARY[];
 extern unsigned int BOOT_KEY_CAT(BOOT_KEY_PRIMARY, _len);
+BOOT_KEY_MONT_DECL(BOOT_KEY_PRIMARY)
+BOOT_KEY_COMB_DECL(BOOT_KEY_PRIMARY)
+BOOT_KEY_POINT_DECL(BOOT_KEY_PRIMARY)
 LISTIFY(UTIL_DEC(MCUBOOT_SIGN_KEY_COUNT), BOOT_KEY_DECL_AT, ())
 #endif
 
@@ -73,6 +119,9 @@ const struct bootutil_key bootutil_keys[] = {
     {
         .key = BOOT_KEY_PRIMARY,
         .len = &BOOT_KEY_CAT(BOOT_KEY_PRIMARY, _len),
+        BOOT_KEY_MONT_ENTRY(BOOT_KEY_PRIMARY)
+        BOOT_KEY_COMB_ENTRY(BOOT_KEY_PRIMARY)
+        BOOT_KEY_POINT_ENTRY(BOOT_KEY_PRIMARY)
     },
     LISTIFY(UTIL_DEC(MCUBOOT_SIGN_KEY_COUNT), BOOT_KEY_ENTRY_AT, ())
 };
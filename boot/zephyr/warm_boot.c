@@ -0,0 +1,45 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/retention/retention.h>
+#include <bootutil/warm_boot.h>
+
+static const struct device *warm_boot_dev =
+                                    DEVICE_DT_GET(DT_CHOSEN(mcuboot_warm_boot_info));
+
+/* From CONFIG_BOOT_WARM_BOOT_CACHE_KEY_FILE */
+static const uint8_t warm_boot_key[] = {
+#include "warm_boot_key.inc"
+};
+
+BUILD_ASSERT(sizeof(warm_boot_key) == BOOT_WARM_BOOT_KEY_SIZE,
+             "The warm boot key must hold BOOT_WARM_BOOT_KEY_SIZE bytes");
+
+int boot_warm_boot_key(uint8_t key[BOOT_WARM_BOOT_KEY_SIZE])
+{
+    memcpy(key, warm_boot_key, BOOT_WARM_BOOT_KEY_SIZE);
+    return 0;
+}
+
+int boot_warm_boot_record_read(void *data, size_t len)
+{
+    if (!device_is_ready(warm_boot_dev) || retention_is_valid(warm_boot_dev) != 1 ||
+        retention_size(warm_boot_dev) < len) {
+        return -1;
+    }
+
+    return retention_read(warm_boot_dev, 0, data, len);
+}
+
+int boot_warm_boot_record_write(const void *data, size_t len)
+{
+    if (!device_is_ready(warm_boot_dev) || retention_size(warm_boot_dev) < len) {
+        return -1;
+    }
+
+    return retention_write(warm_boot_dev, 0, data, len);
+}
@@ -49,6 +49,20 @@
 // Various pre-computed constants.
 #include "curve25519_tables.h"
 
+// The base point side of signature verification uses a sliding window of
+// ED25519_BASE_WINDOW bits, that is odd multiples of B up to
+// (2^(ED25519_BASE_WINDOW - 1) - 1)B. The built-in Bi table is the one for
+// a 5 bit window; MCUBOOT_ED25519_BASE_WINDOW selects a wider one, which
+// takes fewer additions at the cost of 120 bytes of flash per entry.
+#if defined(MCUBOOT_ED25519_BASE_WINDOW) && MCUBOOT_ED25519_BASE_WINDOW > 5
+#include "curve25519_base_tables.h"
+#define ED25519_BASE_WINDOW MCUBOOT_ED25519_BASE_WINDOW
+#define ED25519_BASE_TABLE Bi_wide
+#else
+#define ED25519_BASE_WINDOW 5
+#define ED25519_BASE_TABLE Bi
+#endif
+
 #define SHA512_DIGEST_LENGTH 64
 
 // Low-level intrinsic operations
@@ -593,7 +607,10 @@ void x25519_ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q) {
   fe_add(&r->T, &trZ, &trT);
 }
 
-static void slide(signed char *r, const uint8_t *a) {
+// slide recodes a into signed odd digits of at most 2^(window - 1) - 1 in
+// magnitude, at least window bits apart.
+static void slide(signed char *r, const uint8_t *a, int window) {
+  const int max_digit = (1 << (window - 1)) - 1;
   int i;
   int b;
   int k;
@@ -604,12 +621,12 @@ static void slide(signed char *r, const uint8_t *a) {
 
   for (i = 0; i < 256; ++i) {
     if (r[i]) {
-      for (b = 1; b <= 6 && i + b < 256; ++b) {
+      for (b = 1; b <= window + 1 && i + b < 256; ++b) {
         if (r[i + b]) {
-          if (r[i] + (r[i + b] << b) <= 15) {
+          if (r[i] + (r[i + b] << b) <= max_digit) {
             r[i] += r[i + b] << b;
             r[i + b] = 0;
-          } else if (r[i] - (r[i + b] << b) >= -15) {
+          } else if (r[i] - (r[i + b] << b) >= -max_digit) {
             r[i] -= r[i + b] << b;
             for (k = i + b; k < 256; ++k) {
               if (!r[k]) {
@@ -641,8 +658,8 @@ static void ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
   ge_p3 A2;
   int i;
 
-  slide(aslide, a);
-  slide(bslide, b);
+  slide(aslide, a, 5);
+  slide(bslide, b, ED25519_BASE_WINDOW);
 
   x25519_ge_p3_to_cached(&Ai[0], A);
   ge_p3_dbl(&t, A);
@@ -690,10 +707,10 @@ static void ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
 
     if (bslide[i] > 0) {
       x25519_ge_p1p1_to_p3(&u, &t);
-      ge_madd(&t, &u, &Bi[bslide[i] / 2]);
+      ge_madd(&t, &u, &ED25519_BASE_TABLE[bslide[i] / 2]);
     } else if (bslide[i] < 0) {
       x25519_ge_p1p1_to_p3(&u, &t);
-      ge_msub(&t, &u, &Bi[(-bslide[i]) / 2]);
+      ge_msub(&t, &u, &ED25519_BASE_TABLE[(-bslide[i]) / 2]);
     }
 
     x25519_ge_p1p1_to_p2(r, &t);
@@ -1049,24 +1066,139 @@ void x25519_sc_reduce(uint8_t s[64]) {
   s[31] = s11 >> 17;
 }
 
-int ED25519_verify(const uint8_t *message, size_t message_len,
-                   const uint8_t signature[64], const uint8_t public_key[32]) {
-  ge_p3 A;
-  if ((signature[63] & 224) != 0 ||
-      !x25519_ge_frombytes_vartime(&A, public_key)) {
+// ed25519_point_from_x sets h to the point of public_key, whose x
+// coordinate x was computed ahead of time (see imgtool getpub), returning
+// zero unless x is the one public_key decompresses to. This only costs a
+// few multiplications, where decompressing the key takes a square root.
+static int ed25519_point_from_x(ge_p3 *h, const uint8_t public_key[32],
+                                const uint8_t x[32]) {
+  fe x2;
+  fe y2;
+  fe dx2y2;
+  fe u;
+  fe v;
+  fe_loose t;
+  fe_loose check;
+
+  if ((x[31] & 0x80) != 0) {
+    return 0;
+  }
+  fe_frombytes_strict(&h->X, x);
+  fe_frombytes(&h->Y, public_key);
+  fe_1(&h->Z);
+
+  // -x^2 + y^2 = 1 + dx^2y^2
+  fe_sq_tt(&x2, &h->X);
+  fe_sq_tt(&y2, &h->Y);
+  fe_mul_ttt(&dx2y2, &x2, &y2);
+  fe_mul_ttt(&dx2y2, &dx2y2, &d);
+  fe_sub(&t, &y2, &x2);
+  fe_carry(&u, &t);
+  fe_add(&t, &dx2y2, &h->Z);
+  fe_carry(&v, &t);
+  fe_sub(&check, &u, &v);
+  if (fe_isnonzero(&check) || fe_isnegative(&h->X) != (public_key[31] >> 7)) {
+    return 0;
+  }
+
+  fe_mul_ttt(&h->T, &h->X, &h->Y);
+  return 1;
+}
+
+// ed25519_load_key sets A to the negated point of public_key, returning
+// zero if public_key is not a valid point. public_key_x is the x coordinate
+// of the key if it is known, or NULL to decompress the key.
+static int ed25519_load_key(ge_p3 *A, const uint8_t public_key[32],
+                            const uint8_t *public_key_x) {
+  if (public_key_x != NULL) {
+    if (!ed25519_point_from_x(A, public_key, public_key_x)) {
+      return 0;
+    }
+  } else if (!x25519_ge_frombytes_vartime(A, public_key)) {
     return 0;
   }
 
   fe_loose t;
-  fe_neg(&t, &A.X);
-  fe_carry(&A.X, &t);
-  fe_neg(&t, &A.T);
-  fe_carry(&A.T, &t);
-
-  uint8_t pkcopy[32];
-  memcpy(pkcopy, public_key, 32);
-  uint8_t rcopy[32];
-  memcpy(rcopy, signature, 32);
+  fe_neg(&t, &A->X);
+  fe_carry(&A->X, &t);
+  fe_neg(&t, &A->T);
+  fe_carry(&A->T, &t);
+
+  return 1;
+}
+
+#if defined(MCUBOOT_USE_MBED_TLS)
+typedef mbedtls_sha512_context ed25519_sha512_ctx;
+
+static void ed25519_sha512_init(ed25519_sha512_ctx *ctx) {
+  int ret;
+
+  mbedtls_sha512_init(ctx);
+  ret = mbedtls_sha512_starts_ret(ctx, 0);
+  assert(ret == 0);
+  (void)ret;
+}
+
+static void ed25519_sha512_update(ed25519_sha512_ctx *ctx, const uint8_t *data,
+                                  size_t len) {
+  int ret;
+
+  ret = mbedtls_sha512_update_ret(ctx, data, len);
+  assert(ret == 0);
+  (void)ret;
+}
+
+static void ed25519_sha512_final(ed25519_sha512_ctx *ctx,
+                                 uint8_t h[SHA512_DIGEST_LENGTH]) {
+  int ret;
+
+  ret = mbedtls_sha512_finish_ret(ctx, h);
+  assert(ret == 0);
+  (void)ret;
+  mbedtls_sha512_free(ctx);
+}
+#else
+typedef struct tc_sha512_state_struct ed25519_sha512_ctx;
+
+static void ed25519_sha512_init(ed25519_sha512_ctx *ctx) {
+  int rc;
+
+  rc = tc_sha512_init(ctx);
+  assert(rc == TC_CRYPTO_SUCCESS);
+  (void)rc;
+}
+
+static void ed25519_sha512_update(ed25519_sha512_ctx *ctx, const uint8_t *data,
+                                  size_t len) {
+  int rc;
+
+  rc = tc_sha512_update(ctx, data, len);
+  assert(rc == TC_CRYPTO_SUCCESS);
+  (void)rc;
+}
+
+static void ed25519_sha512_final(ed25519_sha512_ctx *ctx,
+                                 uint8_t h[SHA512_DIGEST_LENGTH]) {
+  int rc;
+
+  rc = tc_sha512_final(h, ctx);
+  assert(rc == TC_CRYPTO_SUCCESS);
+  (void)rc;
+}
+#endif
+
+// ed25519_verify_start checks the signature and public key encodings and
+// starts the SHA-512 hash of R || A || M, that the caller completes with
+// the message. It returns zero if the signature can be rejected right away.
+static int ed25519_verify_start(ge_p3 *A, uint8_t s[32], ed25519_sha512_ctx *ctx,
+                                const uint8_t signature[64],
+                                const uint8_t public_key[32],
+                                const uint8_t *public_key_x) {
+  if ((signature[63] & 224) != 0 ||
+      !ed25519_load_key(A, public_key, public_key_x)) {
+    return 0;
+  }
+
   union {
     uint64_t u64[4];
     uint8_t u8[32];
@@ -1092,59 +1224,107 @@ int ED25519_verify(const uint8_t *message, size_t message_len,
       return 0;
     }
   }
+  memcpy(s, scopy.u8, 32);
 
-#if defined(MCUBOOT_USE_MBED_TLS)
+  ed25519_sha512_init(ctx);
+  ed25519_sha512_update(ctx, signature, 32);
+  ed25519_sha512_update(ctx, public_key, 32);
 
-  mbedtls_sha512_context ctx;
-  int ret;
+  return 1;
+}
 
-  mbedtls_sha512_init(&ctx);
+// ed25519_verify_finish completes the verification once the whole message
+// has been hashed into ctx.
+static int ed25519_verify_finish(ed25519_sha512_ctx *ctx, const ge_p3 *A,
+                                 const uint8_t s[32], const uint8_t signature[64]) {
+  uint8_t h[SHA512_DIGEST_LENGTH];
+  ed25519_sha512_final(ctx, h);
 
-  ret = mbedtls_sha512_starts_ret(&ctx, 0);
-  assert(ret == 0);
+  x25519_sc_reduce(h);
 
-  ret = mbedtls_sha512_update_ret(&ctx, signature, 32);
-  assert(ret == 0);
-  ret = mbedtls_sha512_update_ret(&ctx, public_key, 32);
-  assert(ret == 0);
-  ret = mbedtls_sha512_update_ret(&ctx, message, message_len);
-  assert(ret == 0);
+  ge_p2 R;
+  ge_double_scalarmult_vartime(&R, h, A, s);
 
-  uint8_t h[SHA512_DIGEST_LENGTH];
-  ret = mbedtls_sha512_finish_ret(&ctx, h);
-  assert(ret == 0);
-  mbedtls_sha512_free(&ctx);
+  uint8_t rcheck[32];
+  x25519_ge_tobytes(rcheck, &R);
 
-#else
+  return CRYPTO_memcmp(rcheck, signature, sizeof(rcheck)) == 0;
+}
 
-  struct tc_sha512_state_struct s;
-  int rc;
+// ED25519_verify_key is ED25519_verify for a public key whose x coordinate
+// public_key_x is known, so that it does not have to be decompressed.
+int ED25519_verify_key(const uint8_t *message, size_t message_len,
+                       const uint8_t signature[64], const uint8_t public_key[32],
+                       const uint8_t public_key_x[32]) {
+  ed25519_sha512_ctx ctx;
+  uint8_t s[32];
+  ge_p3 A;
 
-  rc = tc_sha512_init(&s);
-  assert(rc == TC_CRYPTO_SUCCESS);
+  if (!ed25519_verify_start(&A, s, &ctx, signature, public_key, public_key_x)) {
+    return 0;
+  }
 
-  rc = tc_sha512_update(&s, signature, 32);
-  assert(rc == TC_CRYPTO_SUCCESS);
-  rc = tc_sha512_update(&s, public_key, 32);
-  assert(rc == TC_CRYPTO_SUCCESS);
-  rc = tc_sha512_update(&s, message, message_len);
-  assert(rc == TC_CRYPTO_SUCCESS);
+  ed25519_sha512_update(&ctx, message, message_len);
 
-  uint8_t h[TC_SHA512_DIGEST_SIZE];
-  rc = tc_sha512_final(h, &s);
-  assert(rc == TC_CRYPTO_SUCCESS);
+  return ed25519_verify_finish(&ctx, &A, s, signature);
+}
 
-#endif
+int ED25519_verify(const uint8_t *message, size_t message_len,
+                   const uint8_t signature[64], const uint8_t public_key[32]) {
+  return ED25519_verify_key(message, message_len, signature, public_key, NULL);
+}
 
-  x25519_sc_reduce(h);
+// ED25519_verify_read_key is ED25519_verify_key for a message that is not
+// in memory as a whole: read(arg, off, buf, len) is called to get the next
+// bytes of the message at off, up to len, into buf, and returns the number
+// of bytes it got (at least one) or a negative value on error. buf_len is
+// the size of buf, which is only used as scratch space.
+int ED25519_verify_read_key(int (*read)(void *arg, size_t off, uint8_t *buf,
+                                        size_t len),
+                            void *arg, size_t message_len, uint8_t *buf,
+                            size_t buf_len, const uint8_t signature[64],
+                            const uint8_t public_key[32],
+                            const uint8_t public_key_x[32]) {
+  ed25519_sha512_ctx ctx;
+  uint8_t s[32];
+  ge_p3 A;
+  size_t off;
 
-  ge_p2 R;
-  ge_double_scalarmult_vartime(&R, h, &A, scopy.u8);
+  if (buf_len == 0 ||
+      !ed25519_verify_start(&A, s, &ctx, signature, public_key, public_key_x)) {
+    return 0;
+  }
 
-  uint8_t rcheck[32];
-  x25519_ge_tobytes(rcheck, &R);
+  for (off = 0; off < message_len;) {
+    size_t len = message_len - off;
+    int got;
+
+    if (len > buf_len) {
+      len = buf_len;
+    }
+    got = read(arg, off, buf, len);
+    if (got <= 0 || (size_t)got > len) {
+      // Release the hash context.
+      uint8_t h[SHA512_DIGEST_LENGTH];
+      ed25519_sha512_final(&ctx, h);
+      return 0;
+    }
+    ed25519_sha512_update(&ctx, buf, (size_t)got);
+    off += (size_t)got;
+  }
+
+  return ed25519_verify_finish(&ctx, &A, s, signature);
+}
 
-  return CRYPTO_memcmp(rcheck, rcopy, sizeof(rcheck)) == 0;
+// ED25519_verify_read is ED25519_verify_read_key for a public key that has
+// to be decompressed.
+int ED25519_verify_read(int (*read)(void *arg, size_t off, uint8_t *buf,
+                                    size_t len),
+                        void *arg, size_t message_len, uint8_t *buf,
+                        size_t buf_len, const uint8_t signature[64],
+                        const uint8_t public_key[32]) {
+  return ED25519_verify_read_key(read, arg, message_len, buf, buf_len,
+                                 signature, public_key, NULL);
 }
 
 static void fe_cswap(fe *f, fe *g, fe_limb_t b) {
@@ -0,0 +1,920 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Wide window tables of the Ed25519 base point, selected by
+// MCUBOOT_ED25519_BASE_WINDOW.
+//
+// This file is generated by scripts/ed25519_base_table.py, do not edit.
+
+#if MCUBOOT_ED25519_BASE_WINDOW == 6
+// Bi_wide[i] = (2*i+1)*B
+static const ge_precomp Bi_wide[16] = {
+    {
+        {{25967493, 19198397, 29566455, 3660896, 54414519, 4014786, 27544626,
+          21800161, 61029707, 2047604}},
+        {{54563134, 934261, 64385954, 3049989, 66381436, 9406985, 12720692,
+          5043384, 19500929, 18085054}},
+        {{58370664, 4489569, 9688441, 18769238, 10184608, 21191052, 29287918,
+          11864899, 42594502, 29115885}},
+    },
+    {
+        {{15636272, 23865875, 24204772, 25642034, 616976, 16869170, 27787599,
+          18782243, 28944399, 32004408}},
+        {{16568933, 4717097, 55552716, 32452109, 15682895, 21747389, 16354576,
+          21778470, 7689661, 11199574}},
+        {{30464137, 27578307, 55329429, 17883566, 23220364, 15915852, 7512774,
+          10017326, 49359771, 23634074}},
+    },
+    {
+        {{10861363, 11473154, 27284546, 1981175, 37044515, 12577860, 32867885,
+          14515107, 51670560, 10819379}},
+        {{4708026, 6336745, 20377586, 9066809, 55836755, 6594695, 41455196,
+          12483687, 54440373, 5581305}},
+        {{19563141, 16186464, 37722007, 4097518, 10237984, 29206317, 28542349,
+          13850243, 43430843, 17738489}},
+    },
+    {
+        {{5153727, 9909285, 1723747, 30776558, 30523604, 5516873, 19480852,
+          5230134, 43156425, 18378665}},
+        {{36839857, 30090922, 7665485, 10083793, 28475525, 1649722, 20654025,
+          16520125, 30598449, 7715701}},
+        {{28881826, 14381568, 9657904, 3680757, 46927229, 7843315, 35708204,
+          1370707, 29794553, 32145132}},
+    },
+    {
+        {{44589871, 26862249, 14201701, 24808930, 43598457, 8844725, 18474211,
+          32192982, 54046167, 13821876}},
+        {{60653668, 25714560, 3374701, 28813570, 40010246, 22982724, 31655027,
+          26342105, 18853321, 19333481}},
+        {{4566811, 20590564, 38133974, 21313742, 59506191, 30723862, 58594505,
+          23123294, 2207752, 30344648}},
+    },
+    {
+        {{41954014, 29368610, 29681143, 7868801, 60254203, 24130566, 54671499,
+          32891431, 35997400, 17421995}},
+        {{25576264, 30851218, 7349803, 21739588, 16472781, 9300885, 3844789,
+          15725684, 171356, 6466918}},
+        {{23103977, 13316479, 9739013, 17404951, 817874, 18515490, 8965338,
+          19466374, 36393951, 16193876}},
+    },
+    {
+        {{33587053, 3180712, 64714734, 14003686, 50205390, 17283591, 17238397,
+          4729455, 49034351, 9256799}},
+        {{41926547, 29380300, 32336397, 5036987, 45872047, 11360616, 22616405,
+          9761698, 47281666, 630304}},
+        {{53388152, 2639452, 42871404, 26147950, 9494426, 27780403, 60554312,
+          17593437, 64659607, 19263131}},
+    },
+    {
+        {{63957664, 28508356, 9282713, 6866145, 35201802, 32691408, 48168288,
+          15033783, 25105118, 25659556}},
+        {{42782475, 15950225, 35307649, 18961608, 55446126, 28463506, 1573891,
+          30928545, 2198789, 17749813}},
+        {{64009494, 10324966, 64867251, 7453182, 61661885, 30818928, 53296841,
+          17317989, 34647629, 21263748}},
+    },
+    {
+        {{17735041, 27114469, 9040472, 7210680, 43325571, 26153544, 26948151,
+          12350803, 38656901, 28625252}},
+        {{2154119, 14782993, 28737794, 11906199, 36205504, 26488101, 19338132,
+          16910143, 50209922, 29794297}},
+        {{29935700, 6336041, 20999566, 30405369, 13628497, 24612108, 61639745,
+          22359641, 56973806, 18684690}},
+    },
+    {
+        {{29792811, 31379227, 46332526, 20675663, 58452680, 20584117, 42892250,
+          32958636, 31674345, 24275271}},
+        {{7606599, 22131225, 17376912, 15235046, 32822971, 7512882, 30227203,
+          14344178, 9952094, 8804749}},
+        {{32575079, 3961822, 36404898, 17773250, 67073898, 1319543, 30641032,
+          7823672, 63309858, 18878784}},
+    },
+    {
+        {{10715079, 19379211, 26572932, 18690221, 42034819, 23989795, 12020708,
+          19771669, 38888710, 22335074}},
+        {{37146997, 554126, 63326061, 20925660, 49205290, 8620615, 53375504,
+          25938867, 8752612, 31225894}},
+        {{4529887, 12416158, 60388162, 30157900, 15427957, 27628808, 61150927,
+          12724463, 23658330, 23690055}},
+    },
+    {
+        {{34934403, 21269183, 45810226, 19657305, 54297192, 7413280, 66851983,
+          6164080, 25005049, 18002658}},
+        {{5403481, 24654166, 61855580, 13522652, 14989680, 1879017, 43913069,
+          25724172, 20315901, 421248}},
+        {{34818947, 1705239, 25347020, 7938434, 51632025, 1720023, 54809726,
+          32655885, 64907986, 5517607}},
+    },
+    {
+        {{21434680, 16557378, 13251023, 30047149, 24494012, 27723949, 62710290,
+          19153429, 7715737, 28093800}},
+        {{14461032, 6393639, 22681353, 14533514, 52493587, 3544717, 57780998,
+          24657863, 59891807, 31628125}},
+        {{60864886, 31199953, 18524951, 11247802, 43517645, 21165456, 26204394,
+          27268421, 63221077, 29979135}},
+    },
+    {
+        {{30382514, 10077556, 27696264, 8918288, 30231380, 17961119, 9092549,
+          7627898, 41405215, 31798052}},
+        {{13670592, 720327, 7131696, 19360499, 66651570, 16947532, 3061924,
+          22871019, 39814495, 20141336}},
+        {{44847187, 28379568, 38472030, 23697331, 49441718, 3215393, 1669253,
+          30451034, 62323912, 29368533}},
+    },
+    {
+        {{7814913, 1690062, 27222385, 30715870, 48444195, 28125622, 48943580,
+          32330149, 25500368, 1818106}},
+        {{39340596, 15199968, 52787715, 18781603, 18787729, 5464578, 11652644,
+          8722118, 57056621, 5153960}},
+        {{5733861, 14534448, 59480402, 15892910, 30737296, 188529, 491756,
+          17646733, 33071791, 15771063}},
+    },
+    {
+        {{18130707, 21331574, 52581845, 30172287, 44350959, 22271792, 1149903,
+          16209407, 20222151, 32139086}},
+        {{52372801, 13847470, 52690845, 3802477, 48387139, 10595589, 13745896,
+          3112846, 50361463, 2761905}},
+        {{45982696, 12273933, 15897066, 704320, 31367969, 3120352, 11710867,
+          16405685, 19410991, 10591627}},
+    },
+};
+#elif MCUBOOT_ED25519_BASE_WINDOW == 7
+// Bi_wide[i] = (2*i+1)*B
+static const ge_precomp Bi_wide[32] = {
+    {
+        {{25967493, 19198397, 29566455, 3660896, 54414519, 4014786, 27544626,
+          21800161, 61029707, 2047604}},
+        {{54563134, 934261, 64385954, 3049989, 66381436, 9406985, 12720692,
+          5043384, 19500929, 18085054}},
+        {{58370664, 4489569, 9688441, 18769238, 10184608, 21191052, 29287918,
+          11864899, 42594502, 29115885}},
+    },
+    {
+        {{15636272, 23865875, 24204772, 25642034, 616976, 16869170, 27787599,
+          18782243, 28944399, 32004408}},
+        {{16568933, 4717097, 55552716, 32452109, 15682895, 21747389, 16354576,
+          21778470, 7689661, 11199574}},
+        {{30464137, 27578307, 55329429, 17883566, 23220364, 15915852, 7512774,
+          10017326, 49359771, 23634074}},
+    },
+    {
+        {{10861363, 11473154, 27284546, 1981175, 37044515, 12577860, 32867885,
+          14515107, 51670560, 10819379}},
+        {{4708026, 6336745, 20377586, 9066809, 55836755, 6594695, 41455196,
+          12483687, 54440373, 5581305}},
+        {{19563141, 16186464, 37722007, 4097518, 10237984, 29206317, 28542349,
+          13850243, 43430843, 17738489}},
+    },
+    {
+        {{5153727, 9909285, 1723747, 30776558, 30523604, 5516873, 19480852,
+          5230134, 43156425, 18378665}},
+        {{36839857, 30090922, 7665485, 10083793, 28475525, 1649722, 20654025,
+          16520125, 30598449, 7715701}},
+        {{28881826, 14381568, 9657904, 3680757, 46927229, 7843315, 35708204,
+          1370707, 29794553, 32145132}},
+    },
+    {
+        {{44589871, 26862249, 14201701, 24808930, 43598457, 8844725, 18474211,
+          32192982, 54046167, 13821876}},
+        {{60653668, 25714560, 3374701, 28813570, 40010246, 22982724, 31655027,
+          26342105, 18853321, 19333481}},
+        {{4566811, 20590564, 38133974, 21313742, 59506191, 30723862, 58594505,
+          23123294, 2207752, 30344648}},
+    },
+    {
+        {{41954014, 29368610, 29681143, 7868801, 60254203, 24130566, 54671499,
+          32891431, 35997400, 17421995}},
+        {{25576264, 30851218, 7349803, 21739588, 16472781, 9300885, 3844789,
+          15725684, 171356, 6466918}},
+        {{23103977, 13316479, 9739013, 17404951, 817874, 18515490, 8965338,
+          19466374, 36393951, 16193876}},
+    },
+    {
+        {{33587053, 3180712, 64714734, 14003686, 50205390, 17283591, 17238397,
+          4729455, 49034351, 9256799}},
+        {{41926547, 29380300, 32336397, 5036987, 45872047, 11360616, 22616405,
+          9761698, 47281666, 630304}},
+        {{53388152, 2639452, 42871404, 26147950, 9494426, 27780403, 60554312,
+          17593437, 64659607, 19263131}},
+    },
+    {
+        {{63957664, 28508356, 9282713, 6866145, 35201802, 32691408, 48168288,
+          15033783, 25105118, 25659556}},
+        {{42782475, 15950225, 35307649, 18961608, 55446126, 28463506, 1573891,
+          30928545, 2198789, 17749813}},
+        {{64009494, 10324966, 64867251, 7453182, 61661885, 30818928, 53296841,
+          17317989, 34647629, 21263748}},
+    },
+    {
+        {{17735041, 27114469, 9040472, 7210680, 43325571, 26153544, 26948151,
+          12350803, 38656901, 28625252}},
+        {{2154119, 14782993, 28737794, 11906199, 36205504, 26488101, 19338132,
+          16910143, 50209922, 29794297}},
+        {{29935700, 6336041, 20999566, 30405369, 13628497, 24612108, 61639745,
+          22359641, 56973806, 18684690}},
+    },
+    {
+        {{29792811, 31379227, 46332526, 20675663, 58452680, 20584117, 42892250,
+          32958636, 31674345, 24275271}},
+        {{7606599, 22131225, 17376912, 15235046, 32822971, 7512882, 30227203,
+          14344178, 9952094, 8804749}},
+        {{32575079, 3961822, 36404898, 17773250, 67073898, 1319543, 30641032,
+          7823672, 63309858, 18878784}},
+    },
+    {
+        {{10715079, 19379211, 26572932, 18690221, 42034819, 23989795, 12020708,
+          19771669, 38888710, 22335074}},
+        {{37146997, 554126, 63326061, 20925660, 49205290, 8620615, 53375504,
+          25938867, 8752612, 31225894}},
+        {{4529887, 12416158, 60388162, 30157900, 15427957, 27628808, 61150927,
+          12724463, 23658330, 23690055}},
+    },
+    {
+        {{34934403, 21269183, 45810226, 19657305, 54297192, 7413280, 66851983,
+          6164080, 25005049, 18002658}},
+        {{5403481, 24654166, 61855580, 13522652, 14989680, 1879017, 43913069,
+          25724172, 20315901, 421248}},
+        {{34818947, 1705239, 25347020, 7938434, 51632025, 1720023, 54809726,
+          32655885, 64907986, 5517607}},
+    },
+    {
+        {{21434680, 16557378, 13251023, 30047149, 24494012, 27723949, 62710290,
+          19153429, 7715737, 28093800}},
+        {{14461032, 6393639, 22681353, 14533514, 52493587, 3544717, 57780998,
+          24657863, 59891807, 31628125}},
+        {{60864886, 31199953, 18524951, 11247802, 43517645, 21165456, 26204394,
+          27268421, 63221077, 29979135}},
+    },
+    {
+        {{30382514, 10077556, 27696264, 8918288, 30231380, 17961119, 9092549,
+          7627898, 41405215, 31798052}},
+        {{13670592, 720327, 7131696, 19360499, 66651570, 16947532, 3061924,
+          22871019, 39814495, 20141336}},
+        {{44847187, 28379568, 38472030, 23697331, 49441718, 3215393, 1669253,
+          30451034, 62323912, 29368533}},
+    },
+    {
+        {{7814913, 1690062, 27222385, 30715870, 48444195, 28125622, 48943580,
+          32330149, 25500368, 1818106}},
+        {{39340596, 15199968, 52787715, 18781603, 18787729, 5464578, 11652644,
+          8722118, 57056621, 5153960}},
+        {{5733861, 14534448, 59480402, 15892910, 30737296, 188529, 491756,
+          17646733, 33071791, 15771063}},
+    },
+    {
+        {{18130707, 21331574, 52581845, 30172287, 44350959, 22271792, 1149903,
+          16209407, 20222151, 32139086}},
+        {{52372801, 13847470, 52690845, 3802477, 48387139, 10595589, 13745896,
+          3112846, 50361463, 2761905}},
+        {{45982696, 12273933, 15897066, 704320, 31367969, 3120352, 11710867,
+          16405685, 19410991, 10591627}},
+    },
+    {
+        {{14900005, 885327, 22211023, 15569757, 34309216, 29866047, 13199845,
+          27738520, 4631001, 13354856}},
+        {{36631997, 23300851, 59535242, 27474493, 59924914, 29067704, 17551261,
+          13583017, 37580567, 31071178}},
+        {{22641770, 21277083, 10843473, 1582748, 37504588, 634914, 15612385,
+          18139122, 59415250, 22563863}},
+    },
+    {
+        {{9613009, 19260283, 41722369, 1731435, 53022549, 4700744, 26055020,
+          27627618, 20854228, 175025}},
+        {{61915349, 11733561, 59403492, 31381562, 29521830, 16845409, 54973419,
+          26057054, 49464700, 796779}},
+        {{3855018, 8248512, 12652406, 88331, 2948262, 971326, 15614761,
+          9441028, 29507685, 8583792}},
+    },
+    {
+        {{9860006, 14808585, 9600042, 24095287, 23400176, 24077237, 63783137,
+          3916687, 56750252, 30681804}},
+        {{33709664, 3740344, 52888604, 25059045, 46197996, 22678812, 45207164,
+          6431243, 21300862, 27646257}},
+        {{49811511, 9216232, 25043921, 18738174, 29145960, 3024227, 65580502,
+          530149, 66809973, 22275500}},
+    },
+    {
+        {{23499385, 24936714, 38355445, 2354155, 15431304, 5726449, 46809414,
+          7589351, 5421941, 16121767}},
+        {{45162189, 23851397, 9380591, 15192763, 36034862, 15525765, 5277811,
+          25040629, 33286237, 31693326}},
+        {{62424427, 13336013, 49368582, 1581264, 30884213, 15048226, 66823504,
+          4736577, 53805192, 29608355}},
+    },
+    {
+        {{25190215, 26304748, 58928336, 9111275, 64280343, 5025798, 61299599,
+          20659504, 30387592, 32519377}},
+        {{14480213, 17057820, 2286692, 32980967, 14693157, 22197912, 49247898,
+          9909859, 236428, 16857435}},
+        {{7877514, 29872867, 45886243, 25902853, 41998762, 6241604, 35694938,
+          15657879, 56797932, 8609105}},
+    },
+    {
+        {{54245208, 32562161, 57887697, 19509733, 45323534, 3918114, 27606728,
+          25974066, 7290094, 11418745}},
+        {{28964163, 20950093, 44929966, 26145892, 34786807, 18058153, 18187179,
+          27016486, 42438836, 14869174}},
+        {{55703901, 1222455, 64329400, 24533246, 11330890, 9135834, 3589529,
+          19555234, 53275553, 1207212}},
+    },
+    {
+        {{33323313, 2048733, 12219722, 6017849, 4177481, 23804208, 19535260,
+          10453936, 55775079, 31816581}},
+        {{64814718, 27217688, 29891310, 4504619, 8548709, 21986323, 62140656,
+          12555980, 34377058, 21436823}},
+        {{49069441, 9880212, 33350825, 24576421, 24446077, 15616561, 19302117,
+          9370836, 55172180, 28526191}},
+    },
+    {
+        {{28296070, 26757209, 56755199, 4572840, 2140330, 10029994, 53559056,
+          8187614, 41167332, 24643278}},
+        {{35101859, 30958612, 66105296, 3168612, 22836264, 10055966, 22893634,
+          13045780, 28576558, 30704591}},
+        {{59987873, 21166324, 43296694, 15387892, 39447987, 19996270, 5059183,
+          19972934, 30207804, 29631666}},
+    },
+    {
+        {{335311, 16132893, 21221549, 4369853, 1038992, 24394987, 24372708,
+          24889161, 62329722, 17157782}},
+        {{56922508, 1347520, 23300731, 27393371, 42651667, 8512932, 27610931,
+          24436993, 3998295, 3835244}},
+        {{16327050, 22776956, 14746360, 22599650, 23700920, 11727222, 25900154,
+          21823218, 34907363, 25105813}},
+    },
+    {
+        {{59807886, 12089757, 48515346, 7922406, 480852, 26361581, 4246898,
+          10714230, 644198, 13128477}},
+        {{7174885, 26592113, 59892333, 6465478, 4145835, 17673606, 38764952,
+          22293290, 1360980, 25805937}},
+        {{40179568, 6331649, 42386021, 20205884, 15635073, 6103612, 56391180,
+          6789942, 7597240, 24095312}},
+    },
+    {
+        {{54776568, 3381500, 18757262, 7875103, 106218, 1145711, 19452113,
+          27649723, 26496795, 19612129}},
+        {{46701540, 24101444, 49515651, 25946994, 45338156, 9941093, 55509371,
+          31298943, 1347425, 15381335}},
+        {{53576449, 26135856, 17092785, 3684747, 57829121, 27109516, 2987881,
+          10987137, 52269096, 15465522}},
+    },
+    {
+        {{12924165, 26264317, 5272132, 10039545, 27497072, 30615494, 60406855,
+          30400829, 53656985, 11746941}},
+        {{35668062, 24246990, 47788280, 25128298, 37456967, 19518969, 43459670,
+          10724644, 7294162, 4471290}},
+        {{33813988, 3549109, 101112, 21464449, 4858392, 3029943, 59999440,
+          21424738, 34313875, 1512799}},
+    },
+    {
+        {{29494960, 28240930, 51093230, 28823678, 25682287, 21242363, 10463025,
+          4241111, 8656993, 10649532}},
+        {{63536751, 7572551, 62249759, 25202639, 32046232, 32318941, 29315141,
+          15424555, 24706712, 28857648}},
+        {{47618751, 5819839, 19528172, 20715950, 40655763, 20611047, 4960954,
+          6496879, 2790858, 28045273}},
+    },
+    {
+        {{18065612, 22289470, 44837820, 31021159, 32797785, 15389833, 11230024,
+          31144773, 15579137, 4915791}},
+        {{49664705, 3638040, 57888693, 19234931, 40104182, 28143840, 28667142,
+          18386877, 18584835, 3592929}},
+        {{12065039, 18867394, 6430594, 17107159, 1727094, 13096957, 61520237,
+          27056604, 27026997, 13543966}},
+    },
+    {
+        {{1404081, 4022847, 27586665, 14209107, 28740330, 30038710, 51818051,
+          20241476, 1871192, 8696643}},
+        {{17325298, 33376175, 65271265, 4931225, 31708266, 6292284, 23064744,
+          22072792, 43945505, 9236924}},
+        {{51955585, 20268063, 61151838, 26383348, 4766519, 20788033, 21173534,
+          27030753, 9509140, 7790046}},
+    },
+    {
+        {{24124086, 5364343, 28620391, 10538620, 59433851, 19581010, 60862718,
+          9945787, 10491858, 32213802}},
+        {{7062127, 13930079, 2259902, 6463144, 32137099, 24748848, 41557343,
+          29331342, 47345194, 13022814}},
+        {{18921826, 392002, 55817981, 6420686, 8000611, 22415972, 14722962,
+          26246290, 20604450, 8079345}},
+    },
+};
+#elif MCUBOOT_ED25519_BASE_WINDOW == 8
+// Bi_wide[i] = (2*i+1)*B
+static const ge_precomp Bi_wide[64] = {
+    {
+        {{25967493, 19198397, 29566455, 3660896, 54414519, 4014786, 27544626,
+          21800161, 61029707, 2047604}},
+        {{54563134, 934261, 64385954, 3049989, 66381436, 9406985, 12720692,
+          5043384, 19500929, 18085054}},
+        {{58370664, 4489569, 9688441, 18769238, 10184608, 21191052, 29287918,
+          11864899, 42594502, 29115885}},
+    },
+    {
+        {{15636272, 23865875, 24204772, 25642034, 616976, 16869170, 27787599,
+          18782243, 28944399, 32004408}},
+        {{16568933, 4717097, 55552716, 32452109, 15682895, 21747389, 16354576,
+          21778470, 7689661, 11199574}},
+        {{30464137, 27578307, 55329429, 17883566, 23220364, 15915852, 7512774,
+          10017326, 49359771, 23634074}},
+    },
+    {
+        {{10861363, 11473154, 27284546, 1981175, 37044515, 12577860, 32867885,
+          14515107, 51670560, 10819379}},
+        {{4708026, 6336745, 20377586, 9066809, 55836755, 6594695, 41455196,
+          12483687, 54440373, 5581305}},
+        {{19563141, 16186464, 37722007, 4097518, 10237984, 29206317, 28542349,
+          13850243, 43430843, 17738489}},
+    },
+    {
+        {{5153727, 9909285, 1723747, 30776558, 30523604, 5516873, 19480852,
+          5230134, 43156425, 18378665}},
+        {{36839857, 30090922, 7665485, 10083793, 28475525, 1649722, 20654025,
+          16520125, 30598449, 7715701}},
+        {{28881826, 14381568, 9657904, 3680757, 46927229, 7843315, 35708204,
+          1370707, 29794553, 32145132}},
+    },
+    {
+        {{44589871, 26862249, 14201701, 24808930, 43598457, 8844725, 18474211,
+          32192982, 54046167, 13821876}},
+        {{60653668, 25714560, 3374701, 28813570, 40010246, 22982724, 31655027,
+          26342105, 18853321, 19333481}},
+        {{4566811, 20590564, 38133974, 21313742, 59506191, 30723862, 58594505,
+          23123294, 2207752, 30344648}},
+    },
+    {
+        {{41954014, 29368610, 29681143, 7868801, 60254203, 24130566, 54671499,
+          32891431, 35997400, 17421995}},
+        {{25576264, 30851218, 7349803, 21739588, 16472781, 9300885, 3844789,
+          15725684, 171356, 6466918}},
+        {{23103977, 13316479, 9739013, 17404951, 817874, 18515490, 8965338,
+          19466374, 36393951, 16193876}},
+    },
+    {
+        {{33587053, 3180712, 64714734, 14003686, 50205390, 17283591, 17238397,
+          4729455, 49034351, 9256799}},
+        {{41926547, 29380300, 32336397, 5036987, 45872047, 11360616, 22616405,
+          9761698, 47281666, 630304}},
+        {{53388152, 2639452, 42871404, 26147950, 9494426, 27780403, 60554312,
+          17593437, 64659607, 19263131}},
+    },
+    {
+        {{63957664, 28508356, 9282713, 6866145, 35201802, 32691408, 48168288,
+          15033783, 25105118, 25659556}},
+        {{42782475, 15950225, 35307649, 18961608, 55446126, 28463506, 1573891,
+          30928545, 2198789, 17749813}},
+        {{64009494, 10324966, 64867251, 7453182, 61661885, 30818928, 53296841,
+          17317989, 34647629, 21263748}},
+    },
+    {
+        {{17735041, 27114469, 9040472, 7210680, 43325571, 26153544, 26948151,
+          12350803, 38656901, 28625252}},
+        {{2154119, 14782993, 28737794, 11906199, 36205504, 26488101, 19338132,
+          16910143, 50209922, 29794297}},
+        {{29935700, 6336041, 20999566, 30405369, 13628497, 24612108, 61639745,
+          22359641, 56973806, 18684690}},
+    },
+    {
+        {{29792811, 31379227, 46332526, 20675663, 58452680, 20584117, 42892250,
+          32958636, 31674345, 24275271}},
+        {{7606599, 22131225, 17376912, 15235046, 32822971, 7512882, 30227203,
+          14344178, 9952094, 8804749}},
+        {{32575079, 3961822, 36404898, 17773250, 67073898, 1319543, 30641032,
+          7823672, 63309858, 18878784}},
+    },
+    {
+        {{10715079, 19379211, 26572932, 18690221, 42034819, 23989795, 12020708,
+          19771669, 38888710, 22335074}},
+        {{37146997, 554126, 63326061, 20925660, 49205290, 8620615, 53375504,
+          25938867, 8752612, 31225894}},
+        {{4529887, 12416158, 60388162, 30157900, 15427957, 27628808, 61150927,
+          12724463, 23658330, 23690055}},
+    },
+    {
+        {{34934403, 21269183, 45810226, 19657305, 54297192, 7413280, 66851983,
+          6164080, 25005049, 18002658}},
+        {{5403481, 24654166, 61855580, 13522652, 14989680, 1879017, 43913069,
+          25724172, 20315901, 421248}},
+        {{34818947, 1705239, 25347020, 7938434, 51632025, 1720023, 54809726,
+          32655885, 64907986, 5517607}},
+    },
+    {
+        {{21434680, 16557378, 13251023, 30047149, 24494012, 27723949, 62710290,
+          19153429, 7715737, 28093800}},
+        {{14461032, 6393639, 22681353, 14533514, 52493587, 3544717, 57780998,
+          24657863, 59891807, 31628125}},
+        {{60864886, 31199953, 18524951, 11247802, 43517645, 21165456, 26204394,
+          27268421, 63221077, 29979135}},
+    },
+    {
+        {{30382514, 10077556, 27696264, 8918288, 30231380, 17961119, 9092549,
+          7627898, 41405215, 31798052}},
+        {{13670592, 720327, 7131696, 19360499, 66651570, 16947532, 3061924,
+          22871019, 39814495, 20141336}},
+        {{44847187, 28379568, 38472030, 23697331, 49441718, 3215393, 1669253,
+          30451034, 62323912, 29368533}},
+    },
+    {
+        {{7814913, 1690062, 27222385, 30715870, 48444195, 28125622, 48943580,
+          32330149, 25500368, 1818106}},
+        {{39340596, 15199968, 52787715, 18781603, 18787729, 5464578, 11652644,
+          8722118, 57056621, 5153960}},
+        {{5733861, 14534448, 59480402, 15892910, 30737296, 188529, 491756,
+          17646733, 33071791, 15771063}},
+    },
+    {
+        {{18130707, 21331574, 52581845, 30172287, 44350959, 22271792, 1149903,
+          16209407, 20222151, 32139086}},
+        {{52372801, 13847470, 52690845, 3802477, 48387139, 10595589, 13745896,
+          3112846, 50361463, 2761905}},
+        {{45982696, 12273933, 15897066, 704320, 31367969, 3120352, 11710867,
+          16405685, 19410991, 10591627}},
+    },
+    {
+        {{14900005, 885327, 22211023, 15569757, 34309216, 29866047, 13199845,
+          27738520, 4631001, 13354856}},
+        {{36631997, 23300851, 59535242, 27474493, 59924914, 29067704, 17551261,
+          13583017, 37580567, 31071178}},
+        {{22641770, 21277083, 10843473, 1582748, 37504588, 634914, 15612385,
+          18139122, 59415250, 22563863}},
+    },
+    {
+        {{9613009, 19260283, 41722369, 1731435, 53022549, 4700744, 26055020,
+          27627618, 20854228, 175025}},
+        {{61915349, 11733561, 59403492, 31381562, 29521830, 16845409, 54973419,
+          26057054, 49464700, 796779}},
+        {{3855018, 8248512, 12652406, 88331, 2948262, 971326, 15614761,
+          9441028, 29507685, 8583792}},
+    },
+    {
+        {{9860006, 14808585, 9600042, 24095287, 23400176, 24077237, 63783137,
+          3916687, 56750252, 30681804}},
+        {{33709664, 3740344, 52888604, 25059045, 46197996, 22678812, 45207164,
+          6431243, 21300862, 27646257}},
+        {{49811511, 9216232, 25043921, 18738174, 29145960, 3024227, 65580502,
+          530149, 66809973, 22275500}},
+    },
+    {
+        {{23499385, 24936714, 38355445, 2354155, 15431304, 5726449, 46809414,
+          7589351, 5421941, 16121767}},
+        {{45162189, 23851397, 9380591, 15192763, 36034862, 15525765, 5277811,
+          25040629, 33286237, 31693326}},
+        {{62424427, 13336013, 49368582, 1581264, 30884213, 15048226, 66823504,
+          4736577, 53805192, 29608355}},
+    },
+    {
+        {{25190215, 26304748, 58928336, 9111275, 64280343, 5025798, 61299599,
+          20659504, 30387592, 32519377}},
+        {{14480213, 17057820, 2286692, 32980967, 14693157, 22197912, 49247898,
+          9909859, 236428, 16857435}},
+        {{7877514, 29872867, 45886243, 25902853, 41998762, 6241604, 35694938,
+          15657879, 56797932, 8609105}},
+    },
+    {
+        {{54245208, 32562161, 57887697, 19509733, 45323534, 3918114, 27606728,
+          25974066, 7290094, 11418745}},
+        {{28964163, 20950093, 44929966, 26145892, 34786807, 18058153, 18187179,
+          27016486, 42438836, 14869174}},
+        {{55703901, 1222455, 64329400, 24533246, 11330890, 9135834, 3589529,
+          19555234, 53275553, 1207212}},
+    },
+    {
+        {{33323313, 2048733, 12219722, 6017849, 4177481, 23804208, 19535260,
+          10453936, 55775079, 31816581}},
+        {{64814718, 27217688, 29891310, 4504619, 8548709, 21986323, 62140656,
+          12555980, 34377058, 21436823}},
+        {{49069441, 9880212, 33350825, 24576421, 24446077, 15616561, 19302117,
+          9370836, 55172180, 28526191}},
+    },
+    {
+        {{28296070, 26757209, 56755199, 4572840, 2140330, 10029994, 53559056,
+          8187614, 41167332, 24643278}},
+        {{35101859, 30958612, 66105296, 3168612, 22836264, 10055966, 22893634,
+          13045780, 28576558, 30704591}},
+        {{59987873, 21166324, 43296694, 15387892, 39447987, 19996270, 5059183,
+          19972934, 30207804, 29631666}},
+    },
+    {
+        {{335311, 16132893, 21221549, 4369853, 1038992, 24394987, 24372708,
+          24889161, 62329722, 17157782}},
+        {{56922508, 1347520, 23300731, 27393371, 42651667, 8512932, 27610931,
+          24436993, 3998295, 3835244}},
+        {{16327050, 22776956, 14746360, 22599650, 23700920, 11727222, 25900154,
+          21823218, 34907363, 25105813}},
+    },
+    {
+        {{59807886, 12089757, 48515346, 7922406, 480852, 26361581, 4246898,
+          10714230, 644198, 13128477}},
+        {{7174885, 26592113, 59892333, 6465478, 4145835, 17673606, 38764952,
+          22293290, 1360980, 25805937}},
+        {{40179568, 6331649, 42386021, 20205884, 15635073, 6103612, 56391180,
+          6789942, 7597240, 24095312}},
+    },
+    {
+        {{54776568, 3381500, 18757262, 7875103, 106218, 1145711, 19452113,
+          27649723, 26496795, 19612129}},
+        {{46701540, 24101444, 49515651, 25946994, 45338156, 9941093, 55509371,
+          31298943, 1347425, 15381335}},
+        {{53576449, 26135856, 17092785, 3684747, 57829121, 27109516, 2987881,
+          10987137, 52269096, 15465522}},
+    },
+    {
+        {{12924165, 26264317, 5272132, 10039545, 27497072, 30615494, 60406855,
+          30400829, 53656985, 11746941}},
+        {{35668062, 24246990, 47788280, 25128298, 37456967, 19518969, 43459670,
+          10724644, 7294162, 4471290}},
+        {{33813988, 3549109, 101112, 21464449, 4858392, 3029943, 59999440,
+          21424738, 34313875, 1512799}},
+    },
+    {
+        {{29494960, 28240930, 51093230, 28823678, 25682287, 21242363, 10463025,
+          4241111, 8656993, 10649532}},
+        {{63536751, 7572551, 62249759, 25202639, 32046232, 32318941, 29315141,
+          15424555, 24706712, 28857648}},
+        {{47618751, 5819839, 19528172, 20715950, 40655763, 20611047, 4960954,
+          6496879, 2790858, 28045273}},
+    },
+    {
+        {{18065612, 22289470, 44837820, 31021159, 32797785, 15389833, 11230024,
+          31144773, 15579137, 4915791}},
+        {{49664705, 3638040, 57888693, 19234931, 40104182, 28143840, 28667142,
+          18386877, 18584835, 3592929}},
+        {{12065039, 18867394, 6430594, 17107159, 1727094, 13096957, 61520237,
+          27056604, 27026997, 13543966}},
+    },
+    {
+        {{1404081, 4022847, 27586665, 14209107, 28740330, 30038710, 51818051,
+          20241476, 1871192, 8696643}},
+        {{17325298, 33376175, 65271265, 4931225, 31708266, 6292284, 23064744,
+          22072792, 43945505, 9236924}},
+        {{51955585, 20268063, 61151838, 26383348, 4766519, 20788033, 21173534,
+          27030753, 9509140, 7790046}},
+    },
+    {
+        {{24124086, 5364343, 28620391, 10538620, 59433851, 19581010, 60862718,
+          9945787, 10491858, 32213802}},
+        {{7062127, 13930079, 2259902, 6463144, 32137099, 24748848, 41557343,
+          29331342, 47345194, 13022814}},
+        {{18921826, 392002, 55817981, 6420686, 8000611, 22415972, 14722962,
+          26246290, 20604450, 8079345}},
+    },
+    {
+        {{601389, 26257799, 51499391, 12996089, 30228770, 20386555, 9125343,
+          9807811, 10844834, 21034393}},
+        {{25817710, 8020883, 50134679, 21244805, 47057788, 8766556, 29308546,
+          22307963, 49449920, 23874253}},
+        {{11081015, 13522660, 12474691, 29260223, 48687631, 9341946, 16850694,
+          18637605, 6199839, 14303642}},
+    },
+    {
+        {{64518173, 19894035, 50104969, 9477210, 12532855, 5979449, 66531935,
+          7650660, 50626652, 13989683}},
+        {{6921800, 4421166, 59739491, 30510778, 43106355, 30941531, 9363541,
+          3394240, 50874187, 23872585}},
+        {{54293979, 23466866, 47184247, 20627378, 8313211, 5865878, 5948507,
+          32290343, 52583140, 23139870}},
+    },
+    {
+        {{44465878, 24134617, 49842442, 23485580, 34844037, 11673995, 67103168,
+          25858409, 38508586, 1542638}},
+        {{19879846, 15259900, 25020018, 14261729, 22075205, 25189303, 787540,
+          31325033, 62422289, 16131171}},
+        {{39487053, 27893575, 34654176, 25620816, 60209846, 23603919, 8931189,
+          12275052, 38626469, 33438928}},
+    },
+    {
+        {{38307503, 9568748, 62672739, 16130583, 39134132, 4547919, 18403901,
+          5027306, 60829967, 33150322}},
+        {{7950033, 25841033, 47276506, 3884935, 62418883, 2342083, 50269031,
+          14194015, 27013685, 3320257}},
+        {{35270691, 18076829, 46994271, 4273335, 43595882, 31742297, 58328702,
+          4594760, 49180851, 18144010}},
+    },
+    {
+        {{30194115, 16514248, 49746332, 27470090, 40428285, 23271051, 3143303,
+          16153484, 56403017, 27809603}},
+        {{27113466, 6865046, 4512771, 29327742, 29021084, 7405965, 33302911,
+          9322435, 4307527, 32438240}},
+        {{29337813, 24673346, 10359233, 30347534, 57709483, 9930840, 60607771,
+          24076133, 20985293, 22480923}},
+    },
+    {
+        {{14579237, 33467236, 18637124, 15769998, 34119494, 21649867, 15576592,
+          25469427, 19066481, 24337102}},
+        {{4472119, 14702190, 10432042, 22460027, 708461, 18783996, 34234374,
+          30870323, 63796457, 10370850}},
+        {{36957127, 19555637, 16244231, 24367549, 58999881, 13440043, 35147632,
+          8718974, 43101064, 18487380}},
+    },
+    {
+        {{21818223, 922741, 23913864, 22441963, 62163111, 14842155, 43035020,
+          9485973, 53819529, 22318987}},
+        {{10874834, 4351765, 66252340, 17269436, 64427034, 30735311, 5883785,
+          28998531, 44403022, 26064601}},
+        {{64017630, 9755550, 37507935, 22752543, 4031638, 29903925, 47267417,
+          32706846, 39147952, 21635901}},
+    },
+    {
+        {{14256156, 11373180, 30286322, 10431160, 66242540, 4963067, 52937892,
+          3820541, 6243620, 4922418}},
+        {{43460763, 24260930, 21493330, 30888969, 23329454, 24545577, 58286855,
+          12750266, 22391140, 26198125}},
+        {{20477567, 24078713, 1674568, 4102219, 25208396, 13972305, 30389482,
+          19572626, 1485666, 17679765}},
+    },
+    {
+        {{33402246, 23887607, 49396794, 30877107, 45483774, 25222431, 822476,
+          3599727, 32618866, 18610785}},
+        {{48647066, 166413, 55454758, 8889513, 21027475, 32728181, 43100067,
+          4690060, 7520989, 16421303}},
+        {{14868391, 20996450, 64836606, 1042490, 27060176, 10253541, 53431276,
+          19516737, 41808946, 2239538}},
+    },
+    {
+        {{50228416, 29594943, 62030348, 10307368, 3862133, 20292575, 59183610,
+          17989459, 718318, 15848796}},
+        {{5548701, 17911007, 33137864, 32764443, 31146554, 17931096, 64023370,
+          7290289, 6361313, 32861205}},
+        {{63374742, 30320053, 4091667, 30955480, 44819449, 2212055, 52638826,
+          22391938, 38484599, 7051029}},
+    },
+    {
+        {{50485579, 7033600, 57711425, 10740562, 5238683, 8774308, 7593988,
+          13396128, 18451858, 8415632}},
+        {{40930651, 3776911, 39108529, 2508077, 19371703, 7626128, 4092943,
+          15778278, 42044145, 24540103}},
+        {{44128555, 8867576, 8645499, 22222278, 11497130, 4344907, 10788462,
+          23382703, 3547104, 15368835}},
+    },
+    {
+        {{14677651, 18348354, 7451267, 22753404, 52379722, 7841092, 57994926,
+          6818020, 57707296, 16352835}},
+        {{21622574, 18581624, 36511951, 1212467, 36930308, 7910192, 20622927,
+          2438677, 52628762, 29068327}},
+        {{6797431, 2854059, 4269865, 8037366, 32016522, 15223213, 34765784,
+          15297582, 3559197, 26425254}},
+    },
+    {
+        {{40652794, 28205229, 12126303, 8794360, 48418924, 26557199, 20753347,
+          58788, 1327619, 6674931}},
+        {{52388944, 32880897, 37676257, 8253690, 32826330, 2707379, 25088512,
+          17182878, 15053907, 11601568}},
+        {{43894091, 25425955, 50962615, 28097648, 30129084, 13258436, 39364589,
+          8197601, 58181660, 15003422}},
+    },
+    {
+        {{13470741, 14281242, 31012391, 30525035, 22680655, 17158836, 39648036,
+          13815677, 26919891, 29027670}},
+        {{54478677, 14782829, 56712503, 7094748, 41775828, 29409658, 9084386,
+          30179063, 64014926, 32519086}},
+        {{6314429, 20018828, 12535891, 19610611, 10074031, 28087963, 50489447,
+          26314252, 24553876, 32746308}},
+    },
+    {
+        {{38659618, 13074993, 36310083, 32234596, 18656492, 28316168, 56299027,
+          22780838, 55567568, 32376205}},
+        {{5654403, 26425050, 39347935, 963424, 5032477, 19850195, 30011537,
+          11153401, 63182039, 13343989}},
+        {{1130444, 29814849, 40569426, 8144467, 24179188, 6267924, 63847147,
+          2912740, 63870704, 29186744}},
+    },
+    {
+        {{49722553, 11073633, 52865263, 17275179, 33921406, 5060287, 32360243,
+          1910958, 50107051, 11480869}},
+        {{2003571, 2472803, 46902183, 1716406, 58609069, 15922982, 43766122,
+          27456369, 33468339, 29346282}},
+        {{18834217, 8245144, 29896065, 3490830, 62967493, 7220277, 146130,
+          18459164, 57533060, 30070422}},
+    },
+    {
+        {{10696643, 4919690, 6350734, 18553341, 40399454, 19151223, 33655874,
+          27331956, 44498407, 13768350}},
+        {{23652128, 27647291, 43351590, 13262712, 65238054, 26296349, 11902126,
+          2949002, 34445239, 25602117}},
+        {{55906958, 19046111, 28501158, 28224561, 14495533, 14714956, 32929972,
+          2643566, 17034893, 11645825}},
+    },
+    {
+        {{38181658, 29751709, 6541609, 17760527, 13644723, 17992259, 5561345,
+          7659996, 20415289, 4075693}},
+        {{6498441, 12053607, 10375600, 14764370, 24795955, 16159258, 57849421,
+          16071837, 31008329, 3792564}},
+        {{47930485, 9176956, 54248931, 8732776, 58000258, 10333519, 96092,
+          29273884, 13051277, 20121493}},
+    },
+    {
+        {{54190492, 16283162, 61282067, 10734597, 817822, 3412985, 48353279,
+          30339272, 37200685, 30036936}},
+        {{21193614, 19929501, 18841215, 29565554, 64002173, 11123558, 14111648,
+          6069945, 30307604, 25935103}},
+        {{58539773, 2098685, 38301131, 15844175, 41633654, 16934366, 15145895,
+          5543861, 64050790, 6595361}},
+    },
+    {
+        {{34107945, 1176921, 51956039, 5614778, 11970187, 30288155, 47460410,
+          22186730, 30689695, 19628976}},
+        {{25043248, 19224237, 46048097, 32289319, 29339134, 12397721, 37385860,
+          12978240, 57951631, 31419653}},
+        {{46038439, 28501736, 62566522, 12609283, 35236982, 30457796, 64113609,
+          14800343, 6412849, 6276813}},
+    },
+    {
+        {{57419910, 5951296, 15941940, 7806759, 48962933, 4291328, 61633482,
+          4830584, 4146237, 31629489}},
+        {{249426, 17196749, 35434953, 13884216, 11701636, 24553269, 51821986,
+          12900910, 34844073, 16150118}},
+        {{2520516, 14697628, 15319213, 22684490, 62866663, 29666431, 13872507,
+          7473319, 12419515, 2958466}},
+    },
+    {
+        {{34408322, 22298306, 31113343, 25916615, 61547445, 16816136, 30002231,
+          8984620, 14298449, 16319129}},
+        {{19427905, 12004555, 9971383, 28189868, 32306269, 23648270, 34176633,
+          10760437, 53354280, 5634974}},
+        {{30044319, 23677863, 60273406, 14563839, 9734978, 19808149, 30899064,
+          30835691, 22828539, 23633348}},
+    },
+    {
+        {{25513045, 3557497, 37113704, 29589233, 10285548, 1191534, 28780583,
+          28212332, 25767379, 4012132}},
+        {{42139852, 9176396, 16274786, 33467453, 52558621, 7190768, 1490604,
+          31312359, 44767199, 18491072}},
+        {{4272877, 21431483, 45594743, 13027605, 59232641, 24151956, 38390319,
+          12906718, 45915869, 15503563}},
+    },
+    {
+        {{29874415, 2254304, 25494240, 4422092, 43036008, 3589679, 18198812,
+          1586820, 53490317, 14188356}},
+        {{59518553, 28520621, 59946871, 29462027, 3630300, 29398589, 60425462,
+          24588735, 53129947, 28399367}},
+        {{18192774, 12787801, 32021061, 9158184, 48389348, 16385092, 11799402,
+          9492011, 43154220, 15950102}},
+    },
+    {
+        {{1659359, 21083595, 33464926, 19875777, 66037965, 1805941, 22565156,
+          5614253, 46605439, 18343522}},
+        {{57660336, 29715319, 64414626, 32753338, 16894121, 935644, 53848937,
+          22684138, 10541713, 14174330}},
+        {{22888141, 12700209, 40301697, 6435658, 56329485, 5524686, 56715961,
+          6520808, 15754965, 9355803}},
+    },
+    {
+        {{12440975, 26746925, 54931884, 4993445, 49672848, 19708985, 52599424,
+          12757151, 26219761, 5969896}},
+        {{33888606, 13911610, 18921581, 1162763, 46616901, 13799218, 29525142,
+          21929286, 59295464, 503508}},
+        {{57865531, 22043577, 17998312, 3038439, 52838371, 9832208, 43311531,
+          660991, 25265267, 18977724}},
+    },
+    {
+        {{64010288, 23727746, 42277281, 14534881, 35208110, 1392372, 60771714,
+          4857037, 47707836, 10158315}},
+        {{56859315, 32558245, 41017090, 22610758, 13704990, 23215119, 2475037,
+          32344984, 12799418, 11135856}},
+        {{1867214, 27167702, 19772099, 16925005, 15366693, 25797692, 10829276,
+          15372827, 26582557, 31642714}},
+    },
+    {
+        {{57265216, 20059797, 40206123, 30587502, 60553812, 25602102, 29690666,
+          3572665, 35962066, 18217728}},
+        {{56432653, 6329655, 42770975, 4187982, 30677076, 9335071, 60103332,
+          14755050, 9451294, 574767}},
+        {{52859018, 2867107, 56258365, 15719081, 5959372, 8703738, 29137781,
+          21575537, 20249840, 31808689}},
+    },
+    {
+        {{7640471, 13680696, 9995911, 18645792, 24960152, 8964516, 33248715,
+          21201554, 57573145, 31605506}},
+        {{56307055, 23891752, 3613811, 30787942, 49031222, 26667524, 26985478,
+          31973510, 26785294, 29587427}},
+        {{30891460, 5254655, 47414930, 12769216, 42912782, 11830405, 7411958,
+          1394027, 18778535, 18209370}},
+    },
+    {
+        {{61227949, 26179350, 57501473, 13585864, 35746811, 6790544, 54134827,
+          26153333, 7013831, 12256220}},
+        {{5975515, 16302413, 24341148, 28270615, 18786096, 22405501, 28243950,
+          28328004, 53412289, 4381960}},
+        {{9394648, 8758552, 26189703, 16642536, 35993528, 5117040, 5977877,
+          13955594, 19244020, 24493735}},
+    },
+    {
+        {{44279517, 18268076, 30193029, 3993472, 43627444, 10460333, 40237836,
+          14909641, 25722014, 22888080}},
+        {{7236795, 30433657, 63588571, 620817, 11118384, 24979014, 66780154,
+          19877679, 16217590, 26311105}},
+        {{42540794, 21657271, 16455973, 23630199, 3992015, 21894417, 44876052,
+          19291718, 55429803, 30442389}},
+    },
+    {
+        {{2312988, 26972133, 58859271, 20240912, 52555143, 29643941, 26859593,
+          960681, 43793628, 11442238}},
+        {{3428668, 27807272, 41139948, 24786894, 4167808, 21423270, 52199622,
+          8021269, 53172251, 18070808}},
+        {{30631113, 26363656, 21279866, 23275794, 18311406, 466071, 42527968,
+          7989982, 29641567, 29446694}},
+    },
+};
+#else
+#error "Unsupported MCUBOOT_ED25519_BASE_WINDOW"
+#endif
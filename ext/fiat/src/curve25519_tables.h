@@ -38,6 +38,7 @@ static const fe d2 = {{
     54557047, 27058993, 29715967, 9444199
 }};
 
+#if !defined(MCUBOOT_ED25519_BASE_WINDOW) || MCUBOOT_ED25519_BASE_WINDOW <= 5
 // Bi[i] = (2*i+1)*B
 static const ge_precomp Bi[8] = {
     {
@@ -105,3 +106,4 @@ static const ge_precomp Bi[8] = {
           17317989, 34647629, 21263748}},
     },
 };
+#endif
@@ -132,6 +132,56 @@ int uECC_sign_with_k(const uint8_t *private_key, const uint8_t *message_hash,
 int uECC_verify(const uint8_t *p_public_key, const uint8_t *p_message_hash,
 		unsigned int p_hash_size, const uint8_t *p_signature, uECC_Curve curve);
 
+/* Largest number of teeth supported for a comb table. */
+#define uECC_COMB_MAX_TEETH 8
+
+/* Number of words in a comb table with the given number of teeth. */
+#define uECC_COMB_TABLE_WORDS(teeth) \
+	(((1u << (teeth)) - 1) * 2 * NUM_ECC_WORDS)
+
+/**
+ * @brief Compute a fixed-base comb table for a point.
+ * @return returns TC_SUCCESS (1) if the table has been computed
+ * 	   returns TC_FAIL (0) if the number of teeth is not supported.
+ *
+ * @param table OUT -- The table, uECC_COMB_TABLE_WORDS(teeth) words long.
+ * @param point IN -- The point, as native x and y coordinates.
+ * @param teeth IN -- The number of teeth, 1 to uECC_COMB_MAX_TEETH.
+ *
+ * @note Entry b - 1 of the table is the affine point
+ * sum(2^(j * d) * point) over the bits j set in b, where
+ * d = ceil(num_n_bits / teeth) is the number of columns of the comb. A
+ * single-tooth table is the point itself.
+ */
+int uECC_comb_table(uECC_word_t *table, const uECC_word_t *point,
+		    unsigned teeth, uECC_Curve curve);
+
+/**
+ * @brief Verify an ECDSA signature using fixed-base comb tables.
+ * @return returns TC_SUCCESS (1) if the signature is valid
+ * 	   returns TC_FAIL (0) if the signature is invalid.
+ *
+ * @param p_public_key IN -- The signer's public key.
+ * @param p_message_hash IN -- The hash of the signed data.
+ * @param p_hash_size IN -- The size of p_message_hash in bytes.
+ * @param p_signature IN -- The signature values.
+ * @param g_table IN -- Comb table of the curve generator, or NULL.
+ * @param g_teeth IN -- The number of teeth of g_table.
+ * @param q_table IN -- Comb table of the public key, or NULL.
+ * @param q_teeth IN -- The number of teeth of q_table.
+ *
+ * @note Same as uECC_verify(), but u1*G + u2*Q is computed with one doubling
+ * per column of the wider comb and one addition per non-zero column of each,
+ * instead of one doubling per bit. The tables must have been computed by
+ * uECC_comb_table() (or be constant copies of its output) for the curve
+ * generator and for p_public_key respectively.
+ */
+int uECC_verify_comb(const uint8_t *p_public_key, const uint8_t *p_message_hash,
+		     unsigned p_hash_size, const uint8_t *p_signature,
+		     const uECC_word_t *g_table, unsigned g_teeth,
+		     const uECC_word_t *q_table, unsigned q_teeth,
+		     uECC_Curve curve);
+
 #ifdef __cplusplus
 }
 #endif
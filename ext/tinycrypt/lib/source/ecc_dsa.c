@@ -189,30 +189,22 @@ static bitcount_t smax(bitcount_t a, bitcount_t b)
 	return (a > b ? a : b);
 }
 
-int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
-		unsigned hash_size, const uint8_t *signature,
-	        uECC_Curve curve)
+/*
+ * Checks r and s of a signature and computes u1 = e/s and u2 = r/s from them,
+ * loading the public key and r into native form on the way. Returns 0 if the
+ * signature can be rejected right away.
+ */
+static int verify_scalars(uECC_word_t *_public, uECC_word_t *r,
+			  uECC_word_t *u1, uECC_word_t *u2,
+			  const uint8_t *public_key, const uint8_t *message_hash,
+			  unsigned hash_size, const uint8_t *signature,
+			  uECC_Curve curve)
 {
-
-	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
+	uECC_word_t s[NUM_ECC_WORDS];
 	uECC_word_t z[NUM_ECC_WORDS];
-	uECC_word_t sum[NUM_ECC_WORDS * 2];
-	uECC_word_t rx[NUM_ECC_WORDS];
-	uECC_word_t ry[NUM_ECC_WORDS];
-	uECC_word_t tx[NUM_ECC_WORDS];
-	uECC_word_t ty[NUM_ECC_WORDS];
-	uECC_word_t tz[NUM_ECC_WORDS];
-	const uECC_word_t *points[4];
-	const uECC_word_t *point;
-	bitcount_t num_bits;
-	bitcount_t i;
-
-	uECC_word_t _public[NUM_ECC_WORDS * 2];
-	uECC_word_t r[NUM_ECC_WORDS], s[NUM_ECC_WORDS];
 	wordcount_t num_words = curve->num_words;
 	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
 
-	rx[num_n_words - 1] = 0;
 	r[num_n_words - 1] = 0;
 	s[num_n_words - 1] = 0;
 
@@ -240,6 +232,56 @@ int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
 	uECC_vli_modMult(u1, u1, z, curve->n, num_n_words); /* u1 = e/s */
 	uECC_vli_modMult(u2, r, z, curve->n, num_n_words); /* u2 = r/s */
 
+	return 1;
+}
+
+/*
+ * Checks that the affine point (rx, ry), the x coordinate of u1*G + u2*Q,
+ * matches r mod n.
+ */
+static int verify_x(uECC_word_t *rx, const uECC_word_t *r, uECC_Curve curve)
+{
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+	/* v = x1 (mod n) */
+	if (uECC_vli_cmp_unsafe(curve->n, rx, num_n_words) != 1) {
+		uECC_vli_sub(rx, rx, curve->n, num_n_words);
+	}
+
+	/* Accept only if v == r. */
+	return (int)(uECC_vli_equal(rx, r, curve->num_words) == 0);
+}
+
+int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
+		unsigned hash_size, const uint8_t *signature,
+	        uECC_Curve curve)
+{
+
+	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t sum[NUM_ECC_WORDS * 2];
+	uECC_word_t rx[NUM_ECC_WORDS];
+	uECC_word_t ry[NUM_ECC_WORDS];
+	uECC_word_t tx[NUM_ECC_WORDS];
+	uECC_word_t ty[NUM_ECC_WORDS];
+	uECC_word_t tz[NUM_ECC_WORDS];
+	const uECC_word_t *points[4];
+	const uECC_word_t *point;
+	bitcount_t num_bits;
+	bitcount_t i;
+
+	uECC_word_t _public[NUM_ECC_WORDS * 2];
+	uECC_word_t r[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+	rx[num_n_words - 1] = 0;
+
+	if (!verify_scalars(_public, r, u1, u2, public_key, message_hash,
+			    hash_size, signature, curve)) {
+		return 0;
+	}
+
 	/* Calculate sum = G + Q. */
 	uECC_vli_set(sum, _public, num_words);
 	uECC_vli_set(sum + num_words, _public + num_words, num_words);
@@ -284,12 +326,208 @@ int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
 	uECC_vli_modInv(z, z, curve->p, num_words); /* Z = 1/Z */
 	apply_z(rx, ry, z, curve);
 
-	/* v = x1 (mod n) */
-	if (uECC_vli_cmp_unsafe(curve->n, rx, num_n_words) != 1) {
-		uECC_vli_sub(rx, rx, curve->n, num_n_words);
+	return verify_x(rx, r, curve);
+}
+
+/*
+ * Returns the number of columns of a comb with the given number of teeth.
+ */
+static bitcount_t comb_columns(unsigned teeth, uECC_Curve curve)
+{
+	return (curve->num_n_bits + teeth - 1) / teeth;
+}
+
+/*
+ * Adds the affine point 'point' to the Jacobian point (X1, Y1, Z1); the
+ * sum must not be a doubling.
+ */
+static void add_affine(uECC_word_t *X1, uECC_word_t *Y1, uECC_word_t *Z1,
+		       const uECC_word_t *point, uECC_Curve curve)
+{
+	uECC_word_t tx[NUM_ECC_WORDS];
+	uECC_word_t ty[NUM_ECC_WORDS];
+	uECC_word_t tz[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+
+	uECC_vli_set(tx, point, num_words);
+	uECC_vli_set(ty, point + num_words, num_words);
+	apply_z(tx, ty, Z1, curve);
+	uECC_vli_modSub(tz, X1, tx, curve->p, num_words); /* Z = x2 - x1 */
+	XYcZ_add(tx, ty, X1, Y1, curve);
+	uECC_vli_modMult_fast(Z1, Z1, tz, curve);
+}
+
+int uECC_comb_table(uECC_word_t *table, const uECC_word_t *point,
+		    unsigned teeth, uECC_Curve curve)
+{
+	uECC_word_t x[NUM_ECC_WORDS];
+	uECC_word_t y[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	bitcount_t columns;
+	bitcount_t i;
+	unsigned entry;
+	unsigned top;
+
+	if (teeth < 1 || teeth > uECC_COMB_MAX_TEETH) {
+		return 0;
 	}
+	columns = comb_columns(teeth, curve);
+
+	/* The entry for a single tooth j is 2^(j * columns) * point. */
+	uECC_vli_set(table, point, 2 * num_words);
+	for (top = 1; top < teeth; ++top) {
+		uECC_word_t *prev = table + ((1u << (top - 1)) - 1) * 2 * num_words;
+
+		uECC_vli_set(x, prev, num_words);
+		uECC_vli_set(y, prev + num_words, num_words);
+		uECC_vli_clear(z, num_words);
+		z[0] = 1;
+		for (i = 0; i < columns; ++i) {
+			curve->double_jacobian(x, y, z, curve);
+		}
+		uECC_vli_modInv(z, z, curve->p, num_words);
+		apply_z(x, y, z, curve);
 
-	/* Accept only if v == r. */
-	return (int)(uECC_vli_equal(rx, r, num_words) == 0);
+		uECC_vli_set(table + ((1u << top) - 1) * 2 * num_words, x, num_words);
+		uECC_vli_set(table + ((1u << top) - 1) * 2 * num_words + num_words,
+			     y, num_words);
+	}
+
+	/*
+	 * Every other entry is the entry without its highest tooth plus the
+	 * entry of that tooth alone; these are distinct multiples of the point
+	 * below its order, so the addition is never a doubling.
+	 */
+	for (entry = 3; entry < (1u << teeth); ++entry) {
+		unsigned high = 1;
+		uECC_word_t *out = table + (entry - 1) * 2 * num_words;
+
+		while ((high << 1) <= entry) {
+			high <<= 1;
+		}
+		if (entry == high) {
+			continue;
+		}
+		uECC_vli_set(x, table + (entry - high - 1) * 2 * num_words, num_words);
+		uECC_vli_set(y, table + (entry - high - 1) * 2 * num_words + num_words,
+			     num_words);
+		uECC_vli_clear(z, num_words);
+		z[0] = 1;
+		add_affine(x, y, z, table + (high - 1) * 2 * num_words, curve);
+		uECC_vli_modInv(z, z, curve->p, num_words);
+		apply_z(x, y, z, curve);
+
+		uECC_vli_set(out, x, num_words);
+		uECC_vli_set(out + num_words, y, num_words);
+	}
+
+	return 1;
+}
+
+/*
+ * Adds column 'column' of the comb over 'table' for scalar 'u' to the
+ * accumulator (rx, ry, z); '*have' tracks whether the accumulator holds a
+ * point yet.
+ */
+static void comb_add_column(uECC_word_t *rx, uECC_word_t *ry, uECC_word_t *z,
+			    int *have, const uECC_word_t *table, unsigned teeth,
+			    bitcount_t columns, const uECC_word_t *u,
+			    bitcount_t column, uECC_Curve curve)
+{
+	wordcount_t num_words = curve->num_words;
+	const uECC_word_t *point;
+	bitcount_t bit;
+	unsigned entry = 0;
+	unsigned j;
+
+	for (j = 0; j < teeth; ++j) {
+		bit = column + (bitcount_t)j * columns;
+		if (bit < curve->num_n_bits && uECC_vli_testBit(u, bit)) {
+			entry |= 1u << j;
+		}
+	}
+	if (!entry) {
+		return;
+	}
+
+	point = table + (entry - 1) * 2 * num_words;
+	if (!*have) {
+		uECC_vli_set(rx, point, num_words);
+		uECC_vli_set(ry, point + num_words, num_words);
+		uECC_vli_clear(z, num_words);
+		z[0] = 1;
+		*have = 1;
+	} else {
+		add_affine(rx, ry, z, point, curve);
+	}
+}
+
+int uECC_verify_comb(const uint8_t *public_key, const uint8_t *message_hash,
+		     unsigned hash_size, const uint8_t *signature,
+		     const uECC_word_t *g_table, unsigned g_teeth,
+		     const uECC_word_t *q_table, unsigned q_teeth,
+		     uECC_Curve curve)
+{
+	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t rx[NUM_ECC_WORDS];
+	uECC_word_t ry[NUM_ECC_WORDS];
+	uECC_word_t _public[NUM_ECC_WORDS * 2];
+	uECC_word_t r[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+	bitcount_t g_columns;
+	bitcount_t q_columns;
+	bitcount_t i;
+	int have = 0;
+
+	rx[num_n_words - 1] = 0;
+
+	if (!verify_scalars(_public, r, u1, u2, public_key, message_hash,
+			    hash_size, signature, curve)) {
+		return 0;
+	}
+
+	/* Without a table, a point is its own single-tooth comb. */
+	if (!g_table) {
+		g_table = curve->G;
+		g_teeth = 1;
+	}
+	if (!q_table) {
+		q_table = _public;
+		q_teeth = 1;
+	}
+	if (g_teeth < 1 || g_teeth > uECC_COMB_MAX_TEETH ||
+	    q_teeth < 1 || q_teeth > uECC_COMB_MAX_TEETH) {
+		return 0;
+	}
+	g_columns = comb_columns(g_teeth, curve);
+	q_columns = comb_columns(q_teeth, curve);
+
+	/* Both combs share the doublings, one per column of the wider one. */
+	for (i = smax(g_columns, q_columns) - 1; i >= 0; --i) {
+		if (have) {
+			curve->double_jacobian(rx, ry, z, curve);
+		}
+		if (i < g_columns) {
+			comb_add_column(rx, ry, z, &have, g_table, g_teeth,
+					g_columns, u1, i, curve);
+		}
+		if (i < q_columns) {
+			comb_add_column(rx, ry, z, &have, q_table, q_teeth,
+					q_columns, u2, i, curve);
+		}
+	}
+
+	/* u1*G + u2*Q would be the point at infinity. */
+	if (!have || uECC_vli_isZero(z, num_words)) {
+		return 0;
+	}
+
+	uECC_vli_modInv(z, z, curve->p, num_words); /* Z = 1/Z */
+	apply_z(rx, ry, z, curve);
+
+	return verify_x(rx, r, curve);
 }
 
@@ -65,8 +65,35 @@
 /* Uncomment to only erase and overwrite those primary slot sectors needed
  * to install the new image, rather than the entire image slot. */
 /* #define MCUBOOT_OVERWRITE_ONLY_FAST */
+/* Uncomment to overwrite several images in turn, sector by sector, so that
+ * images on different flash devices are erased and written in parallel.
+ * Useful with a backend that can start an erase without waiting for it,
+ * see MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC below. */
+/* #define MCUBOOT_INTERLEAVED_UPGRADE */
 #endif
 
+/* Uncomment to leave the sectors holding the same data in both slots as
+ * they are during an upgrade, with swap using scratch or overwrite-only. */
+/* #define MCUBOOT_SPARSE_SWAP */
+
+/* Uncomment to record the swap status as one bit per entry instead of one
+ * write unit per entry. The flash must accept writing a unit again as long
+ * as bits only move away from the erased value. */
+/* #define MCUBOOT_SWAP_STATUS_COMPACT */
+
+/* Uncomment to record the swap status in a journal partition,
+ * FLASH_AREA_SWAP_STATUS, instead of the trailers of the slots. The
+ * partition needs at least two sectors of the same size and must be erased
+ * when the slots are programmed by other means than MCUboot. */
+/* #define MCUBOOT_SWAP_STATUS_JOURNAL */
+
+/* Uncomment to use the scratch area, with swap using scratch, as a ring of
+ * this many windows, each step of a swap going through the next one, so
+ * that erases are spread over the whole area. With
+ * MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC the next window is erased while the
+ * current step is written. The windows must start on sector boundaries. */
+/* #define MCUBOOT_SWAP_SCRATCH_RING 2 */
+
 /* Uncomment to enable the direct-xip code path. */
 /* #define MCUBOOT_DIRECT_XIP */
 /* Uncomment to enable the revert mechanism in direct-xip mode. */
@@ -75,6 +102,12 @@
 /* Uncomment to enable the ram-load code path. */
 /* #define MCUBOOT_RAM_LOAD */
 
+/* Uncomment to skip validating, in direct-xip or ram-load mode, the images
+ * booted on the previous boot; the platform must provide
+ * boot_warm_boot_record_read(), boot_warm_boot_record_write() and
+ * boot_warm_boot_key(), see bootutil/warm_boot.h. */
+/* #define MCUBOOT_WARM_BOOT_CACHE */
+
 /*
  * Cryptographic settings
  *
@@ -130,6 +163,28 @@
  * See the flash APIs for more details. */
 /* #define MCUBOOT_USE_FLASH_AREA_GET_SECTORS */
 
+/* Uncomment if your flash map API provides flash_area_erase_blocks(), to
+ * erase ranges with the device's large erase blocks where they fit. */
+/* #define MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS */
+
+/* Uncomment if your flash map API provides flash_area_erase_start() and
+ * flash_area_erase_busy(), to start erases without waiting for them. */
+/* #define MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC */
+
+/* Uncomment if your flash map API provides flash_area_map() and
+ * flash_area_unmap(), to read image data in place. */
+/* #define MCUBOOT_USE_FLASH_AREA_MAP */
+
+/* Uncomment to serve small flash reads from a read cache, for flash where
+ * each read has a large fixed cost. */
+/* #define MCUBOOT_FLASH_READ_CACHE */
+/* #define MCUBOOT_FLASH_READ_CACHE_LINES 8 */
+/* #define MCUBOOT_FLASH_READ_CACHE_LINE_SIZE 64 */
+
+/* Uncomment to read the headers and trailers of all images in one pass,
+ * in flash address order, at the start of a boot. */
+/* #define MCUBOOT_METADATA_PREFETCH */
+
 /* Default maximum number of flash sectors per image slot; change
  * as desirable. */
 #define MCUBOOT_MAX_IMG_SECTORS 128
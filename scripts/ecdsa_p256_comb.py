@@ -0,0 +1,118 @@
+#! /usr/bin/env python3
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Generate the fixed-base comb tables of the NIST P-256 generator used by the
+tinycrypt ECDSA verification (boot/bootutil/include/bootutil/crypto/
+ecdsa_p256_comb.h).
+
+Entry b - 1 of a table with w teeth is the affine point
+sum(2^(j * d) * G) over the bits j set in b, with d = ceil(256 / w), stored
+as the x and y coordinates in tinycrypt's native form: eight little-endian
+ordered 32-bit words each. This matches uECC_comb_table().
+"""
+
+import argparse
+import sys
+
+P = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+GX = 0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296
+GY = 0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5
+BITS = 256
+WORDS = 8
+
+
+def add(a, b):
+    if a is None:
+        return b
+    if b is None:
+        return a
+    if a[0] == b[0]:
+        if (a[1] + b[1]) % P == 0:
+            return None
+        lam = 3 * (a[0] * a[0] - 1) * pow(2 * a[1], -1, P) % P
+    else:
+        lam = (b[1] - a[1]) * pow(b[0] - a[0], -1, P) % P
+    x = (lam * lam - a[0] - b[0]) % P
+    return (x, (lam * (a[0] - x) - a[1]) % P)
+
+
+def double_n(a, n):
+    for _ in range(n):
+        a = add(a, a)
+    return a
+
+
+def comb_table(teeth):
+    columns = (BITS + teeth - 1) // teeth
+    teeth_points = [(GX, GY)]
+    for _ in range(1, teeth):
+        teeth_points.append(double_n(teeth_points[-1], columns))
+    table = []
+    for entry in range(1, 1 << teeth):
+        point = None
+        for j in range(teeth):
+            if entry & (1 << j):
+                point = add(point, teeth_points[j])
+        table.append(point)
+    return table
+
+
+def words(value):
+    return [(value >> (32 * i)) & 0xffffffff for i in range(WORDS)]
+
+
+def emit(out, min_teeth, max_teeth):
+    out.write("""/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Fixed-base comb tables of the NIST P-256 generator for
+ * uECC_verify_comb(), selected by MCUBOOT_ECDSA_P256_COMB_TEETH.
+ *
+ * Generated by scripts/ecdsa_p256_comb.py, do not edit.
+ */
+
+#ifndef __BOOTUTIL_CRYPTO_ECDSA_P256_COMB_H_
+#define __BOOTUTIL_CRYPTO_ECDSA_P256_COMB_H_
+
+#include <tinycrypt/ecc.h>
+
+""")
+    for teeth in range(min_teeth, max_teeth + 1):
+        out.write("%s MCUBOOT_ECDSA_P256_COMB_TEETH == %d\n" %
+                  ("#if" if teeth == min_teeth else "#elif", teeth))
+        out.write("static const uECC_word_t "
+                  "bootutil_ecdsa_p256_g_comb[%d] = {\n" %
+                  (((1 << teeth) - 1) * 2 * WORDS))
+        for x, y in comb_table(teeth):
+            for coord in (x, y):
+                w = words(coord)
+                for half in (w[:4], w[4:]):
+                    out.write("    " +
+                              ", ".join("0x%08x" % v for v in half) + ",\n")
+        out.write("};\n")
+    out.write("""#else
+#error "Unsupported MCUBOOT_ECDSA_P256_COMB_TEETH"
+#endif
+
+#endif /* __BOOTUTIL_CRYPTO_ECDSA_P256_COMB_H_ */
+""")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--min-teeth", type=int, default=1)
+    parser.add_argument("--max-teeth", type=int, default=8)
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout)
+    args = parser.parse_args()
+    if not 1 <= args.min_teeth <= args.max_teeth <= 8:
+        parser.error("teeth must be between 1 and 8")
+    emit(args.output, args.min_teeth, args.max_teeth)
+
+
+if __name__ == "__main__":
+    main()
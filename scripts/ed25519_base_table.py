@@ -0,0 +1,109 @@
+#! /usr/bin/env python3
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Generate the wide window tables of the Ed25519 base point used by the fiat
+Ed25519 verification (ext/fiat/src/curve25519_base_tables.h).
+
+A table for a window of w bits holds the odd multiples B, 3B, ...,
+(2^(w-1) - 1)B of the base point, in the ge_precomp form (y+x, y-x, 2dxy)
+and the 32-bit fiat field element layout used by curve25519_tables.h,
+whose Bi table is the one for a 5 bit window.
+"""
+
+import argparse
+import sys
+
+P = 2**255 - 19
+D = -121665 * pow(121666, -1, P) % P
+LIMB_BITS = [26, 25, 26, 25, 26, 25, 26, 25, 26, 25]
+
+
+def recover_x(y):
+    xx = (y * y - 1) * pow(D * y * y + 1, -1, P) % P
+    x = pow(xx, (P + 3) // 8, P)
+    if (x * x - xx) % P != 0:
+        x = x * pow(2, (P - 1) // 4, P) % P
+    if x & 1:
+        x = P - x
+    return x
+
+
+BY = 4 * pow(5, -1, P) % P
+B = (recover_x(BY), BY)
+
+
+def add(a, b):
+    t = D * a[0] * b[0] * a[1] * b[1] % P
+    x = (a[0] * b[1] + a[1] * b[0]) * pow(1 + t, -1, P) % P
+    y = (a[1] * b[1] + a[0] * b[0]) * pow(1 - t, -1, P) % P
+    return (x, y)
+
+
+def limbs(value):
+    out = []
+    for bits in LIMB_BITS:
+        out.append(value & ((1 << bits) - 1))
+        value >>= bits
+    return out
+
+
+def odd_multiples(count):
+    twice = add(B, B)
+    point = B
+    for _ in range(count):
+        yield point
+        point = add(point, twice)
+
+
+def fe_text(value):
+    v = [str(x) for x in limbs(value)]
+    return ("        {{%s,\n          %s}},\n" %
+            (", ".join(v[:7]), ", ".join(v[7:])))
+
+
+def emit(out, min_window, max_window):
+    out.write("""/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Wide window tables of the Ed25519 base point, selected by
+// MCUBOOT_ED25519_BASE_WINDOW.
+//
+// This file is generated by scripts/ed25519_base_table.py, do not edit.
+
+""")
+    for window in range(min_window, max_window + 1):
+        count = 1 << (window - 2)
+        out.write("%s MCUBOOT_ED25519_BASE_WINDOW == %d\n" %
+                  ("#if" if window == min_window else "#elif", window))
+        out.write("// Bi_wide[i] = (2*i+1)*B\n")
+        out.write("static const ge_precomp Bi_wide[%d] = {\n" % count)
+        for x, y in odd_multiples(count):
+            out.write("    {\n")
+            out.write(fe_text((y + x) % P))
+            out.write(fe_text((y - x) % P))
+            out.write(fe_text(2 * D * x * y % P))
+            out.write("    },\n")
+        out.write("};\n")
+    out.write("""#else
+#error "Unsupported MCUBOOT_ED25519_BASE_WINDOW"
+#endif
+""")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--min-window", type=int, default=6)
+    parser.add_argument("--max-window", type=int, default=8)
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout)
+    args = parser.parse_args()
+    if not 5 <= args.min_window <= args.max_window <= 8:
+        parser.error("window must be between 5 and 8")
+    emit(args.output, args.min_window, args.max_window)
+
+
+if __name__ == "__main__":
+    main()
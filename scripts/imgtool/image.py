@@ -74,6 +74,7 @@ TLV_VALUES = {
         'SHA256': 0x10,
         'SHA384': 0x11,
         'SHA512': 0x12,
+        'BLAKE2S': 0x13,
         'RSA2048': 0x20,
         'ECDSASIG': 0x22,
         'RSA3072': 0x23,
@@ -165,6 +166,7 @@ TLV_SHA_TO_SHA_AND_ALG = {
     TLV_VALUES['SHA256'] : SHAAndAlgT('256', hashlib.sha256),
     TLV_VALUES['SHA384'] : SHAAndAlgT('384', hashlib.sha384),
     TLV_VALUES['SHA512'] : SHAAndAlgT('512', hashlib.sha512),
+    TLV_VALUES['BLAKE2S'] : SHAAndAlgT('blake2s', hashlib.blake2s),
 }
 
 
@@ -172,7 +174,8 @@ USER_SHA_TO_ALG_AND_TLV = {
     'auto'   : (hashlib.sha256, 'SHA256'),
     '256'    : (hashlib.sha256, 'SHA256'),
     '384'    : (hashlib.sha384, 'SHA384'),
-    '512'    : (hashlib.sha512, 'SHA512')
+    '512'    : (hashlib.sha512, 'SHA512'),
+    'blake2s': (hashlib.blake2s, 'BLAKE2S')
 }
 
 
@@ -193,8 +196,9 @@ ALLOWED_KEY_SHA = {
     keys.RSA                : ['256'],
     keys.RSAPublic          : ['256'],
     # This two are set to 256 for compatibility, the right would be 512
-    keys.Ed25519            : ['256', '512'],
-    keys.Ed25519Public      : ['256', '512'],
+    # The digest is signed as a message, so any hash can be used
+    keys.Ed25519            : ['256', '512', 'blake2s'],
+    keys.Ed25519Public      : ['256', '512', 'blake2s'],
     keys.X25519             : ['256', '512']
 }
 
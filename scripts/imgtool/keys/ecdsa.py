@@ -7,13 +7,14 @@ ECDSA key management
 from __future__ import annotations
 
 import os.path
+import sys
 
 from cryptography.hazmat.backends import default_backend
 from cryptography.hazmat.primitives import serialization
 from cryptography.hazmat.primitives.asymmetric import ec
 from cryptography.hazmat.primitives.hashes import SHA256, SHA384
 
-from .general import KeyClass, PayloadSigner, override
+from .general import FileHandler, KeyClass, PayloadSigner, override
 from .privatebytes import PrivateBytesMixin
 
 
@@ -21,6 +22,56 @@ class ECDSAUsageError(Exception):
     pass
 
 
+# NIST P-256 field prime, for the comb tables below.
+_P256_P = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+_P256_BITS = 256
+_P256_WORDS = 8
+
+
+def _p256_add(a, b):
+    """Affine point addition on P-256, None being the point at infinity."""
+    if a is None:
+        return b
+    if b is None:
+        return a
+    if a[0] == b[0]:
+        if (a[1] + b[1]) % _P256_P == 0:
+            return None
+        lam = 3 * (a[0] * a[0] - 1) * pow(2 * a[1], -1, _P256_P) % _P256_P
+    else:
+        lam = (b[1] - a[1]) * pow(b[0] - a[0], -1, _P256_P) % _P256_P
+    x = (lam * lam - a[0] - b[0]) % _P256_P
+    return (x, (lam * (a[0] - x) - a[1]) % _P256_P)
+
+
+def p256_comb_table(point, teeth):
+    """Fixed-base comb table of a P-256 point, as computed by tinycrypt's
+    uECC_comb_table(): entry b - 1 is the affine point
+    sum(2^(j * d) * point) over the bits j set in b, with
+    d = ceil(256 / teeth). Returns the x and y coordinates of every entry as
+    tinycrypt native words: eight 32-bit words each, least significant
+    first."""
+    if not 1 <= teeth <= 8:
+        raise ECDSAUsageError("Comb tables have 1 to 8 teeth")
+    columns = (_P256_BITS + teeth - 1) // teeth
+    teeth_points = [point]
+    for _ in range(1, teeth):
+        p = teeth_points[-1]
+        for _ in range(columns):
+            p = _p256_add(p, p)
+        teeth_points.append(p)
+    words = []
+    for entry in range(1, 1 << teeth):
+        p = None
+        for j in range(teeth):
+            if entry & (1 << j):
+                p = _p256_add(p, teeth_points[j])
+        for coord in p:
+            words += [(coord >> (32 * i)) & 0xffffffff
+                      for i in range(_P256_WORDS)]
+    return words
+
+
 class ECDSAPublicKey(KeyClass):
     """
     Wrapper around an ECDSA public key.
@@ -154,6 +205,32 @@ class ECDSA256P1Public(ECDSAPublicKey):
     def shortname(self):
         return "ecdsa"
 
+    def comb_table(self, teeth):
+        """Comb table of the public key, see p256_comb_table()."""
+        numbers = self._get_public().public_numbers()
+        return p256_comb_table((numbers.x, numbers.y), teeth)
+
+    @override
+    def emit_c_public(self, file=sys.stdout, name_suffix: str = "",
+                      comb_teeth: int = 0):
+        # With comb_teeth, the comb table of the key follows it, so that the
+        # bootloader does not have to compute it
+        # (MCUBOOT_ECDSA_P256_KEY_COMB_TEETH). The number of teeth is part
+        # of the name, so that a table of the wrong size does not link.
+        if not comb_teeth:
+            super().emit_c_public(file=file, name_suffix=name_suffix)
+            return
+        name = f"{self.shortname()}_pub_key{name_suffix}"
+        words = self.comb_table(comb_teeth)
+        with FileHandler(file, 'w') as file:
+            super().emit_c_public(file=file, name_suffix=name_suffix)
+            print(f"const unsigned int {name}_comb{comb_teeth}[] = {{",
+                  file=file)
+            for i in range(0, len(words), 4):
+                print("    " + ", ".join(f"0x{w:08x}" for w in words[i:i + 4]) +
+                      ",", file=file)
+            print("};", file=file)
+
     def sig_type(self):
         return "ECDSA256_SHA256"
 
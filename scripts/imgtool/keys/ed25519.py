@@ -6,16 +6,45 @@ ED25519 key management
 
 from __future__ import annotations
 
+import sys
+
 from cryptography.hazmat.primitives import serialization
 from cryptography.hazmat.primitives.asymmetric import ed25519
 
-from .general import DigestSigner, KeyClass, override
+from .general import DigestSigner, FileHandler, KeyClass, override
 
 
 class Ed25519UsageError(Exception):
     pass
 
 
+# Curve25519 field prime and twisted Edwards curve constant.
+_ED25519_P = 2**255 - 19
+_ED25519_D = -121665 * pow(121666, -1, _ED25519_P) % _ED25519_P
+
+
+def ed25519_recover_x(public_bytes):
+    """
+    Decompress the 32 byte encoding of a public key, returning the x
+    coordinate of the point (RFC 8032, section 5.1.3).
+    """
+    p = _ED25519_P
+    y = int.from_bytes(public_bytes, 'little')
+    sign = y >> 255
+    y &= (1 << 255) - 1
+    if y >= p:
+        raise Ed25519UsageError("Public key is not a valid point")
+    xx = (y * y - 1) * pow(_ED25519_D * y * y + 1, -1, p) % p
+    x = pow(xx, (p + 3) // 8, p)
+    if (x * x - xx) % p != 0:
+        x = x * pow(2, (p - 1) // 4, p) % p
+    if (x * x - xx) % p != 0 or (x == 0 and sign):
+        raise Ed25519UsageError("Public key is not a valid point")
+    if x & 1 != sign:
+        x = p - x
+    return x
+
+
 class Ed25519Public(KeyClass):
     def __init__(self, key):
         self.key = key
@@ -40,6 +69,30 @@ class Ed25519Public(KeyClass):
             encoding=serialization.Encoding.PEM,
             format=serialization.PublicFormat.SubjectPublicKeyInfo)
 
+    def public_x(self):
+        """x coordinate of the public key, see ed25519_recover_x()."""
+        raw = self._get_public().public_bytes(
+                encoding=serialization.Encoding.Raw,
+                format=serialization.PublicFormat.Raw)
+        return ed25519_recover_x(raw)
+
+    @override
+    def emit_c_public(self, file=sys.stdout, name_suffix: str = ""):
+        # The x coordinate of the key follows it, so that the bootloader
+        # does not have to decompress the key at every boot
+        # (MCUBOOT_ED25519_KEY_POINT).
+        x = self.public_x().to_bytes(32, 'little')
+        name = f"{self.shortname()}_pub_key{name_suffix}"
+        with FileHandler(file, 'w') as file:
+            super().emit_c_public(file=file, name_suffix=name_suffix)
+            self._emit_array(
+                    header=f"const unsigned char {name}_x[] = {{",
+                    trailer="};",
+                    encoded_bytes=x,
+                    indent="    ",
+                    file=file,
+                    len_format=None)
+
     def get_private_bytes(self, minimal, format):
         self._unsupported('get_private_bytes')
 
@@ -65,6 +65,11 @@ class KeyClass:
     def _emit_to_output(self, header, trailer, encoded_bytes, indent, file,
                         len_format):
         print(AUTOGEN_MESSAGE, file=file)
+        self._emit_array(header, trailer, encoded_bytes, indent, file,
+                         len_format)
+
+    def _emit_array(self, header, trailer, encoded_bytes, indent, file,
+                    len_format):
         print(header, end='', file=file)
         for count, b in enumerate(encoded_bytes):
             if count % 8 == 0:
@@ -6,13 +6,15 @@ RSA Key management
 
 from __future__ import annotations
 
+import sys
+
 from cryptography.hazmat.backends import default_backend
 from cryptography.hazmat.primitives import serialization
 from cryptography.hazmat.primitives.asymmetric import rsa
 from cryptography.hazmat.primitives.asymmetric.padding import MGF1, PSS
 from cryptography.hazmat.primitives.hashes import SHA256
 
-from .general import KeyClass, PayloadSigner, override
+from .general import FileHandler, KeyClass, PayloadSigner, override
 from .privatebytes import PrivateBytesMixin
 
 # Sizes that bootutil will recognize
@@ -51,6 +53,33 @@ class RSAPublic(KeyClass):
                 encoding=serialization.Encoding.PEM,
                 format=serialization.PublicFormat.SubjectPublicKeyInfo)
 
+    def mont_constants(self):
+        """Montgomery constants of the modulus N, as used by bootutil:
+        R^2 mod N, big endian and as long as N, with R = 2^(8 * len(N)),
+        and -N^-1 mod 2^32."""
+        n = self._get_public().public_numbers().n
+        n_len = (n.bit_length() + 7) // 8
+        rr = pow(2, 16 * n_len, n).to_bytes(n_len, byteorder='big')
+        n0 = -pow(n, -1, 1 << 32) % (1 << 32)
+        return rr, n0
+
+    @override
+    def emit_c_public(self, file=sys.stdout, name_suffix: str = ""):
+        # The Montgomery constants follow the key, so that the bootloader
+        # does not have to derive them from the modulus at every boot
+        # (MCUBOOT_RSA_MONT_CONSTANTS).
+        rr, n0 = self.mont_constants()
+        name = f"{self.shortname()}_pub_key{name_suffix}"
+        with FileHandler(file, 'w') as file:
+            super().emit_c_public(file=file, name_suffix=name_suffix)
+            self._emit_array(
+                    header=f"const unsigned char {name}_rr[] = {{",
+                    trailer="};",
+                    encoded_bytes=rr,
+                    indent="    ",
+                    file=file,
+                    len_format=f"const unsigned int {name}_n0 = 0x{n0:08x};")
+
     def get_private_bytes(self, minimal, format):
         self._unsupported('get_private_bytes')
 
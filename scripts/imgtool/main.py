@@ -94,7 +94,7 @@ keygens = {
     'x25519':     gen_x25519,
 }
 valid_formats = ['openssl', 'pkcs8']
-valid_sha = [ 'auto', '256', '384', '512' ]
+valid_sha = [ 'auto', '256', '384', '512', 'blake2s' ]
 valid_hmac_sha = [ 'auto', '256', '512' ]
 
 
@@ -159,12 +159,17 @@ def keygen(type, key, password):
                    '`rsa_pub_key_2_len`). Useful when embedding multiple '
                    'signing keys in the same image. Ignored for PEM/raw '
                    'encodings (those emit no identifiers).')
+@click.option('--comb-teeth', 'comb_teeth', type=click.IntRange(0, 8),
+              default=0,
+              help='For ECDSA P-256 keys in C, also emit the fixed-base comb '
+                   'table of the key with this many teeth, for '
+                   'MCUBOOT_ECDSA_P256_KEY_COMB_TEETH.')
 @click.option('-k', '--key', metavar='filename', required=True)
 @click.option('-o', '--output', metavar='output', required=False,
               help='Specify the output file\'s name. \
                     The stdout is used if it is not provided.')
 @click.command(help='Dump public key from keypair')
-def getpub(key, encoding, lang, output, name_suffix):
+def getpub(key, encoding, lang, output, name_suffix, comb_teeth):
     if encoding and lang:
         raise click.UsageError('Please use only one of `--encoding/-e` or `--lang/-l`')
     elif not encoding and not lang:
@@ -174,12 +179,21 @@ def getpub(key, encoding, lang, output, name_suffix):
     if name_suffix and (encoding in ('pem', 'raw')):
         raise click.UsageError(
             '`--name-suffix` is only meaningful for lang-c / lang-rust encodings')
+    if comb_teeth and not (lang == 'c' or encoding == 'lang-c'):
+        raise click.UsageError(
+            '`--comb-teeth` is only meaningful for the lang-c encoding')
     key = load_key(key)
 
     if not output:
         output = sys.stdout
     if key is None:
         print("Invalid passphrase")
+    elif comb_teeth:
+        if not isinstance(key, keys.ECDSA256P1Public):
+            raise click.UsageError(
+                '`--comb-teeth` is only supported for ECDSA P-256 keys')
+        key.emit_c_public(file=output, name_suffix=name_suffix,
+                          comb_teeth=comb_teeth)
     elif lang == 'c' or encoding == 'lang-c':
         key.emit_c_public(file=output, name_suffix=name_suffix)
     elif lang == 'rust' or encoding == 'lang-rust':
@@ -98,6 +98,35 @@ class EcKeyGeneration(unittest.TestCase):
         k2.emit_rust_public(rustcode)
         self.assertIn("ECDSA_PUB_KEY", rustcode.getvalue())
 
+    def test_emit_comb(self):
+        """The key comb table holds the multiples of the key it is made of."""
+        k = ECDSA256P1.generate()
+        teeth = 3
+        columns = (256 + teeth - 1) // teeth
+        words = k.comb_table(teeth)
+        self.assertEqual(len(words), ((1 << teeth) - 1) * 16)
+
+        # The public key is d * G, so entry b - 1 must be s * d * G.
+        d = k.key.private_numbers().private_value
+        n = 0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551
+        for b in range(1, 1 << teeth):
+            s = sum(1 << (j * columns) for j in range(teeth) if b & (1 << j))
+            expected = ec.derive_private_key(s * d % n, ec.SECP256R1()) \
+                .public_key().public_numbers()
+            entry = words[(b - 1) * 16:b * 16]
+            x = sum(w << (32 * i) for i, w in enumerate(entry[:8]))
+            y = sum(w << (32 * i) for i, w in enumerate(entry[8:]))
+            self.assertEqual((x, y), (expected.x, expected.y))
+
+        ccode = io.StringIO()
+        k.emit_c_public(ccode, name_suffix="_1", comb_teeth=teeth)
+        self.assertIn("ecdsa_pub_key_1_len", ccode.getvalue())
+        self.assertIn("ecdsa_pub_key_1_comb3[]", ccode.getvalue())
+        self.assertIn(f"0x{words[0]:08x}", ccode.getvalue())
+
+        self.assertRaises(ECDSAUsageError, k.comb_table, 0)
+        self.assertRaises(ECDSAUsageError, k.comb_table, 9)
+
     def test_sig(self):
         k = ECDSA256P1.generate()
         buf = b'This is the message'
@@ -12,10 +12,12 @@ import tempfile
 import unittest
 
 from cryptography.exceptions import InvalidSignature
+from cryptography.hazmat.primitives import serialization
 
 sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__), '../..')))
 
 from imgtool.keys import Ed25519, Ed25519UsageError, load
+from imgtool.keys.ed25519 import ed25519_recover_x
 
 
 class Ed25519KeyGeneration(unittest.TestCase):
@@ -97,6 +99,31 @@ class Ed25519KeyGeneration(unittest.TestCase):
         k2.emit_rust_public(rustcode)
         self.assertIn("ED25519_PUB_KEY", rustcode.getvalue())
 
+    def test_emit_x(self):
+        """The x coordinate follows the key and is on the curve."""
+        k = Ed25519.generate()
+        raw = k.key.public_key().public_bytes(
+                encoding=serialization.Encoding.Raw,
+                format=serialization.PublicFormat.Raw)
+        p = 2**255 - 19
+        d = -121665 * pow(121666, -1, p) % p
+        y = int.from_bytes(raw, 'little') & ((1 << 255) - 1)
+        x = k.public_x()
+        self.assertEqual((y * y - x * x) % p, (1 + d * x * x * y * y) % p)
+        self.assertEqual(x & 1, raw[31] >> 7)
+
+        ccode = io.StringIO()
+        k.emit_c_public(ccode, name_suffix="_1")
+        self.assertIn("ed25519_pub_key_1_len", ccode.getvalue())
+        self.assertIn("ed25519_pub_key_1_x[]", ccode.getvalue())
+        self.assertIn(f"0x{x & 0xff:02x}", ccode.getvalue())
+
+        # RFC 8032, section 7.1, test 1.
+        x = ed25519_recover_x(bytes.fromhex(
+            "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a"))
+        self.assertEqual(x.to_bytes(32, 'little').hex(),
+            "ce457677bd8627b1247c185372d413c520f6d0608de0972229349d2b9ae0d055")
+
     def test_sig(self):
         k = Ed25519.generate()
         buf = b'This is the message'
@@ -109,6 +109,26 @@ class KeyGeneration(unittest.TestCase):
             k2.emit_rust_public(rustcode)
             self.assertIn("RSA_PUB_KEY", rustcode.getvalue())
 
+    def test_emit_mont(self):
+        """The Montgomery constants of a known key."""
+        k = load(os.path.join(os.path.dirname(__file__), '../../..',
+                              'root-rsa-2048.pem'))
+        n = k.key.public_key().public_numbers().n
+
+        rr, n0 = k.mont_constants()
+        self.assertEqual(len(rr), 256)
+        self.assertEqual(int.from_bytes(rr, byteorder='big'),
+                         pow(2, 2 * 2048, n))
+        self.assertEqual(rr[:4], bytes.fromhex('a920a3e8'))
+        self.assertEqual(n0, 0x80aee787)
+        self.assertEqual((n * n0 + 1) % (1 << 32), 0)
+
+        ccode = io.StringIO()
+        k.emit_c_public(ccode)
+        self.assertIn("rsa_pub_key_rr[] = {\n    0xa9, 0x20, 0xa3, 0xe8,",
+                      ccode.getvalue())
+        self.assertIn("rsa_pub_key_n0 = 0x80aee787;", ccode.getvalue())
+
     def test_sig(self):
         for key_size in RSA_KEY_SIZES:
             k = RSA.generate(key_size=key_size)
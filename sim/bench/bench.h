@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef H_SIM_BENCH_H__
+#define H_SIM_BENCH_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Helpers shared by the host benchmarks. Every benchmark reports one line
+ * per measurement, as a tab separated table with a single header line:
+ *
+ *   benchmark  variant  ops  ns_per_op  mib_per_s
+ *
+ * "mib_per_s" is 0 for measurements that do not process a byte stream.
+ */
+
+/* Number of iterations, reduced when running under CTest ("-q"). */
+static inline unsigned
+bench_iterations(int argc, char **argv, unsigned full)
+{
+    if (argc > 1 && strcmp(argv[1], "-q") == 0) {
+        return full / 100 ? full / 100 : 1;
+    }
+
+    return full;
+}
+
+static inline uint64_t
+bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static inline void
+bench_header(void)
+{
+    printf("benchmark\tvariant\tops\tns_per_op\tmib_per_s\n");
+}
+
+/*
+ * Reports "ops" operations, each processing "bytes_per_op" bytes, that
+ * took "ns" nanoseconds in total.
+ */
+static inline void
+bench_report(const char *name, const char *variant, uint64_t ops,
+             uint64_t bytes_per_op, uint64_t ns)
+{
+    double ns_per_op = ops ? (double)ns / (double)ops : 0.0;
+    double mib_per_s = 0.0;
+
+    if (ns != 0 && bytes_per_op != 0) {
+        mib_per_s = ((double)ops * (double)bytes_per_op / (1024.0 * 1024.0)) /
+                    ((double)ns / 1e9);
+    }
+
+    printf("%s\t%s\t%llu\t%.1f\t%.2f\n", name, variant,
+           (unsigned long long)ops, ns_per_op, mib_per_s);
+}
+
+#endif /* H_SIM_BENCH_H__ */
@@ -0,0 +1,333 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The flash_area_*() backend of the benchmarks, over the RAM backed devices
+ * described in bench_flash.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bench_flash.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+uint64_t bench_flash_ns;
+unsigned bench_flash_reads;
+unsigned bench_flash_erases;
+unsigned bench_flash_erased_sectors;
+
+static const struct bench_flash_device *bench_devices;
+static const struct flash_area *bench_areas;
+static size_t bench_area_count;
+static bench_flash_hook *bench_hook;
+static uint64_t bench_busy_until[BENCH_FLASH_MAX_DEVICES];
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s: %s\n", BENCH_VARIANT, what);
+    exit(1);
+}
+
+void
+bench_flash_init(const struct bench_flash_device *devices, size_t device_count,
+                 const struct flash_area *areas, size_t area_count,
+                 bench_flash_hook *hook)
+{
+    size_t i;
+
+    if (device_count > BENCH_FLASH_MAX_DEVICES) {
+        fail("too many flash devices");
+    }
+    for (i = 0; i < area_count; i++) {
+        if (areas[i].fa_device_id >= device_count ||
+            areas[i].fa_off > devices[areas[i].fa_device_id].size ||
+            areas[i].fa_size > devices[areas[i].fa_device_id].size - areas[i].fa_off) {
+            fail("flash area out of its device");
+        }
+    }
+
+    bench_devices = devices;
+    bench_areas = areas;
+    bench_area_count = area_count;
+    bench_hook = hook;
+    bench_flash_clear();
+}
+
+void
+bench_flash_clear(void)
+{
+    bench_flash_ns = 0;
+    bench_flash_reads = 0;
+    bench_flash_erases = 0;
+    bench_flash_erased_sectors = 0;
+    memset(bench_busy_until, 0, sizeof(bench_busy_until));
+}
+
+uint8_t *
+bench_flash_data(const struct flash_area *fa, uint32_t off, uint32_t len)
+{
+    if (fa < &bench_areas[0] || fa >= &bench_areas[bench_area_count] ||
+        off > fa->fa_size || len > fa->fa_size - off) {
+        return NULL;
+    }
+
+    return &bench_devices[fa->fa_device_id].data[fa->fa_off + off];
+}
+
+static const struct bench_flash_device *
+bench_device(const struct flash_area *fa)
+{
+    return &bench_devices[fa->fa_device_id];
+}
+
+/* An operation on the device of fa waits for a started erase to complete. */
+static void
+bench_wait(const struct flash_area *fa)
+{
+    if (bench_flash_ns < bench_busy_until[fa->fa_device_id]) {
+        bench_flash_ns = bench_busy_until[fa->fa_device_id];
+    }
+}
+
+int
+flash_area_id_from_multi_image_slot(int image_index, int slot)
+{
+    switch (slot) {
+    case 0: return FLASH_AREA_IMAGE_PRIMARY(image_index);
+    case 1: return FLASH_AREA_IMAGE_SECONDARY(image_index);
+    }
+
+    return -1;
+}
+
+int
+flash_area_id_to_multi_image_slot(int image_index, int area_id)
+{
+    if (area_id == FLASH_AREA_IMAGE_PRIMARY(image_index)) {
+        return 0;
+    }
+    if (area_id == FLASH_AREA_IMAGE_SECONDARY(image_index)) {
+        return 1;
+    }
+
+    return -1;
+}
+
+int
+flash_area_open(uint8_t id, const struct flash_area **area)
+{
+    size_t i;
+
+    for (i = 0; i < bench_area_count; i++) {
+        if (bench_areas[i].fa_id == id) {
+            *area = &bench_areas[i];
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+void
+flash_area_close(const struct flash_area *area)
+{
+    (void)area;
+}
+
+int
+flash_area_read(const struct flash_area *fa, uint32_t off, void *dst,
+                uint32_t len)
+{
+    uint8_t *src = bench_flash_data(fa, off, len);
+
+    if (src == NULL) {
+        return -1;
+    }
+
+    bench_wait(fa);
+    bench_flash_ns += bench_device(fa)->read_cmd_ns +
+                      bench_device(fa)->read_byte_ns * len;
+    bench_flash_reads++;
+    memcpy(dst, src, len);
+    return 0;
+}
+
+#ifdef MCUBOOT_USE_FLASH_AREA_MAP
+/* A mapping is accounted as the read of the mapped bytes. */
+int
+flash_area_map(const struct flash_area *fa, uint32_t off, uint32_t len,
+               const void **ptr)
+{
+    uint8_t *src = bench_flash_data(fa, off, len);
+
+    if (src == NULL) {
+        return -1;
+    }
+
+    bench_wait(fa);
+    bench_flash_ns += bench_device(fa)->read_cmd_ns +
+                      bench_device(fa)->read_byte_ns * len;
+    bench_flash_reads++;
+    *ptr = src;
+    return 0;
+}
+
+void
+flash_area_unmap(const struct flash_area *fa, const void *ptr, uint32_t len)
+{
+    (void)fa;
+    (void)ptr;
+    (void)len;
+}
+#endif
+
+int
+flash_area_write(const struct flash_area *fa, uint32_t off, const void *src,
+                 uint32_t len)
+{
+    uint8_t *dst = bench_flash_data(fa, off, len);
+    uint32_t i;
+
+    if (dst == NULL) {
+        return -1;
+    }
+
+    if (bench_hook != NULL) {
+        bench_hook(fa, off, dst, src, len);
+    }
+    bench_wait(fa);
+    bench_flash_ns += bench_device(fa)->prog_byte_ns * len;
+    for (i = 0; i < len; i++) {
+        if (bench_device(fa)->reprogram) {
+            if (((const uint8_t *)src)[i] & ~dst[i]) {
+                fail("write setting bits that are not erased");
+            }
+        } else if (dst[i] != 0xff) {
+            fail("write to flash that is not erased");
+        }
+    }
+    memcpy(dst, src, len);
+    return 0;
+}
+
+static int
+bench_erase(const struct flash_area *fa, uint32_t off, uint32_t len, bool async)
+{
+    const struct bench_flash_device *dev = bench_device(fa);
+    uint8_t *dst = bench_flash_data(fa, off, len);
+    uint64_t erase_ns;
+
+    if (dst == NULL) {
+        return -1;
+    }
+
+    if (dev->erase_cmd_ns != NULL) {
+        erase_ns = dev->erase_cmd_ns(fa->fa_off + off, len);
+        if (erase_ns == 0) {
+            fail("erase not matching a device command");
+        }
+    } else if ((fa->fa_off + off) % dev->sector_size != 0 ||
+               len % dev->sector_size != 0) {
+        return -1;
+    } else {
+        erase_ns = dev->erase_ns * (len / dev->sector_size);
+    }
+
+    if (bench_hook != NULL) {
+        bench_hook(fa, off, dst, NULL, len);
+    }
+    bench_wait(fa);
+    if (async) {
+        bench_busy_until[fa->fa_device_id] = bench_flash_ns + erase_ns;
+        bench_flash_ns += BENCH_FLASH_ERASE_CMD_NS;
+    } else {
+        bench_flash_ns += erase_ns;
+    }
+    bench_flash_erases++;
+    bench_flash_erased_sectors += len / dev->sector_size;
+    memset(dst, 0xff, len);
+    return 0;
+}
+
+int
+flash_area_erase(const struct flash_area *fa, uint32_t off, uint32_t len)
+{
+    return bench_erase(fa, off, len, false);
+}
+
+int
+flash_area_erase_start(const struct flash_area *fa, uint32_t off, uint32_t len)
+{
+    return bench_erase(fa, off, len, true);
+}
+
+int
+flash_area_erase_busy(const struct flash_area *fa)
+{
+    bench_flash_ns += BENCH_FLASH_POLL_NS;
+    return bench_flash_ns < bench_busy_until[fa->fa_device_id];
+}
+
+uint32_t
+flash_area_align(const struct flash_area *fa)
+{
+    (void)fa;
+    return 8;
+}
+
+uint8_t
+flash_area_erased_val(const struct flash_area *fa)
+{
+    (void)fa;
+    return 0xff;
+}
+
+int
+flash_area_get_sectors(int fa_id, uint32_t *count, struct flash_sector *sectors)
+{
+    const struct flash_area *fa;
+    uint32_t sector_size;
+    uint32_t i;
+
+    if (flash_area_open((uint8_t)fa_id, &fa) != 0) {
+        return -1;
+    }
+
+    sector_size = bench_device(fa)->sector_size;
+    if (*count < fa->fa_size / sector_size) {
+        return -1;
+    }
+
+    *count = fa->fa_size / sector_size;
+    for (i = 0; i < *count; i++) {
+        sectors[i].fs_off = i * sector_size;
+        sectors[i].fs_size = sector_size;
+    }
+
+    return 0;
+}
+
+int
+flash_area_get_sector(const struct flash_area *fa, uint32_t off,
+                      struct flash_sector *sector)
+{
+    uint32_t sector_size = bench_device(fa)->sector_size;
+
+    if (off >= fa->fa_size) {
+        return -1;
+    }
+
+    sector->fs_off = off & ~(sector_size - 1);
+    sector->fs_size = sector_size;
+    return 0;
+}
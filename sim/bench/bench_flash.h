@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef H_SIM_BENCH_FLASH_H__
+#define H_SIM_BENCH_FLASH_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <flash_map_backend/flash_map_backend.h>
+
+/*
+ * RAM backed flash devices with a timing model, shared by the benchmarks
+ * running bootutil against flash. A benchmark describes its devices and
+ * the flash areas on them with bench_flash_init(), and bench_flash.c
+ * provides the flash_area_*() backend bootutil is linked with.
+ *
+ * The model keeps a virtual clock, bench_flash_ns: reads, programs and
+ * erases wait for their device and then advance the clock by their typical
+ * duration. flash_area_erase_start() only marks the device busy until the
+ * erase would complete, and the clock moves on.
+ *
+ * With MCUBOOT_USE_FLASH_AREA_MAP, flash_area_map() hands out the RAM
+ * behind an area, accounted as a read of the mapped bytes.
+ */
+
+#define BENCH_FLASH_MAX_DEVICES 4
+
+/* Cost of starting an erase and of polling a device for completion. */
+#define BENCH_FLASH_ERASE_CMD_NS 1000ull
+#define BENCH_FLASH_POLL_NS      1000ull
+
+struct bench_flash_device {
+    uint8_t *data;
+    uint32_t size;
+    uint32_t sector_size;
+
+    /* Typical durations of a read command, of reading and programming a
+     * byte, and of erasing a sector.
+     */
+    uint64_t read_cmd_ns;
+    uint64_t read_byte_ns;
+    uint64_t prog_byte_ns;
+    uint64_t erase_ns;
+
+    /* If not NULL, the duration of the erase command for len bytes at off
+     * of the device, or 0 if the device has no such command. Otherwise any
+     * whole sectors are erased, erase_ns each.
+     */
+    uint64_t (*erase_cmd_ns)(uint32_t off, uint32_t len);
+
+    /* Whether written bytes can be programmed again, clearing more bits;
+     * otherwise only erased bytes can be written.
+     */
+    bool reprogram;
+};
+
+/*
+ * Called before a write (src not NULL) or an erase (src NULL) of len bytes
+ * at off of fa changes dst; it can longjmp() out of the operation.
+ */
+typedef void bench_flash_hook(const struct flash_area *fa, uint32_t off,
+                              uint8_t *dst, const void *src, uint32_t len);
+
+/* The modelled time, and the reads, erase commands and erased sectors. */
+extern uint64_t bench_flash_ns;
+extern unsigned bench_flash_reads;
+extern unsigned bench_flash_erases;
+extern unsigned bench_flash_erased_sectors;
+
+/*
+ * Sets up the flash: the fa_device_id of each area is its index in devices,
+ * fa_off its offset in the device. hook is optional.
+ */
+void bench_flash_init(const struct bench_flash_device *devices, size_t device_count,
+                      const struct flash_area *areas, size_t area_count,
+                      bench_flash_hook *hook);
+
+/* Clears the clock, the counters and the busy state of the devices. */
+void bench_flash_clear(void);
+
+/* The contents of len bytes at off of fa, or NULL if out of the area. */
+uint8_t *bench_flash_data(const struct flash_area *fa, uint32_t off, uint32_t len);
+
+#endif /* H_SIM_BENCH_FLASH_H__ */
@@ -0,0 +1,346 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Times bootutil_img_hash() and bootutil_img_validate() on a signed image
+ * held in a RAM backed flash area, and boot_enc_decrypt() on its payload
+ * when built with image encryption. Nothing of the simulator is needed: the
+ * few flash_area_*() calls bootutil makes are served by the RAM backed
+ * flash of bench_flash.c, which also hands it out through flash_area_map()
+ * in the "_map" variants.
+ *
+ * The binary is built once per crypto configuration, named by
+ * BENCH_VARIANT; see CMakeLists.txt. The image always has the same
+ * contents, so that the signatures in bootutil_bench_vectors.h apply.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bootutil/bootutil.h"
+#include "bootutil/crypto/sha.h"
+#include "bootutil/fault_injection_hardening.h"
+#include "bootutil/image.h"
+#include "bootutil/sign_key.h"
+#ifdef MCUBOOT_ENC_IMAGES
+#include "bootutil/enc_key.h"
+#endif
+
+#include "bootutil_priv.h"
+
+#include "bench.h"
+#include "bench_flash.h"
+#include "bootutil_bench_vectors.h"
+#if defined(MCUBOOT_SIGN_EC256) && defined(MCUBOOT_ECDSA_P256_KEY_COMB_TEETH)
+#include "bootutil_bench_comb.h"
+#endif
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+/* The chunk size bootutil reads the image with (BOOT_TMPBUF_SZ). */
+#define BENCH_TMPBUF_SZ 256
+
+#define BENCH_FLASH_SIZE (IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE + 4096)
+
+static uint8_t bench_flash[BENCH_FLASH_SIZE];
+
+/* Reads cost nothing; the times measured are those of bootutil itself. */
+static const struct bench_flash_device bench_device = {
+    .data = bench_flash,
+    .size = BENCH_FLASH_SIZE,
+    .sector_size = 4096,
+};
+
+static const struct flash_area bench_area = {
+    .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
+    .fa_device_id = FLASH_DEVICE_ID,
+    .fa_off = 0,
+    .fa_size = BENCH_FLASH_SIZE,
+};
+
+#if defined(MCUBOOT_SIGN_RSA) && MCUBOOT_SIGN_RSA_LEN == 2048
+#define BENCH_SIG_TLV IMAGE_TLV_RSA2048_PSS
+#define BENCH_PUB     bench_rsa2048_pub
+#define BENCH_SIG     bench_rsa2048_sig
+#elif defined(MCUBOOT_SIGN_RSA) && MCUBOOT_SIGN_RSA_LEN == 3072
+#define BENCH_SIG_TLV IMAGE_TLV_RSA3072_PSS
+#define BENCH_PUB     bench_rsa3072_pub
+#define BENCH_SIG     bench_rsa3072_sig
+#elif defined(MCUBOOT_SIGN_EC256)
+#define BENCH_SIG_TLV IMAGE_TLV_ECDSA_SIG
+#define BENCH_PUB     bench_ecdsa_p256_pub
+#define BENCH_SIG     bench_ecdsa_p256_sig
+#if defined(MCUBOOT_ECDSA_P256_KEY_COMB_TEETH)
+#if MCUBOOT_ECDSA_P256_KEY_COMB_TEETH != 6
+#error "bootutil_bench_comb.h only has a 6-tooth key comb table"
+#endif
+#define BENCH_PUB_COMB bench_ecdsa_p256_pub_comb6
+#endif
+#elif defined(MCUBOOT_SIGN_ED25519)
+#define BENCH_SIG_TLV IMAGE_TLV_ED25519
+#define BENCH_PUB     bench_ed25519_pub
+#define BENCH_SIG     bench_ed25519_sig
+#if defined(MCUBOOT_ED25519_KEY_POINT)
+#define BENCH_PUB_X   bench_ed25519_pub_x
+#endif
+#endif
+
+#ifdef BENCH_SIG_TLV
+static const unsigned int bench_pub_len = sizeof(BENCH_PUB);
+
+const struct bootutil_key bootutil_keys[] = {
+    { .key = BENCH_PUB, .len = &bench_pub_len,
+#ifdef BENCH_PUB_COMB
+      .ec_comb = BENCH_PUB_COMB,
+#endif
+#ifdef BENCH_PUB_X
+      .ed25519_x = BENCH_PUB_X,
+#endif
+    },
+};
+const int bootutil_key_cnt = 1;
+#endif
+
+#ifdef MCUBOOT_USE_MBED_TLS
+/* The simulator configurations leave Mbed TLS without an allocator, see
+ * sim/mcuboot-sys/csupport/run.c.
+ */
+int mbedtls_platform_set_calloc_free(void * (*calloc_func)(size_t, size_t),
+                                     void (*free_func)(void *));
+#endif
+
+#ifdef MCUBOOT_USE_PSA_CRYPTO
+/* From the Mbed TLS test RNG, see sim/mcuboot-sys/src/c.rs. */
+void mbedtls_test_enable_insecure_external_rng(void);
+#endif
+
+int
+sim_log_enabled(int level)
+{
+    (void)level;
+    return 0;
+}
+
+/*
+ * bootutil_misc.c is not linked, as it brings in the whole upgrade logic;
+ * these are the parts of it that validation and decryption use.
+ */
+uint32_t
+bootutil_max_image_size(struct boot_loader_state *state,
+                        const struct flash_area *fap)
+{
+    (void)state;
+    return flash_area_get_size(fap);
+}
+
+fih_ret
+boot_fih_memequal(const void *s1, const void *s2, size_t n)
+{
+    return memcmp(s1, s2, n) == 0 ? FIH_SUCCESS : FIH_FAILURE;
+}
+
+void
+bootutil_wipe_memory(void *p, size_t n)
+{
+    volatile unsigned char *v = (volatile unsigned char *)p;
+
+    while (n-- > 0) {
+        *v++ = 0;
+    }
+}
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s: %s\n", BENCH_VARIANT, what);
+    exit(1);
+}
+
+static uint8_t *
+put_tlv(uint8_t *p, uint16_t type, const uint8_t *data, uint16_t len)
+{
+    struct image_tlv tlv = { .it_type = type, .it_len = len };
+
+    memcpy(p, &tlv, sizeof(tlv));
+    memcpy(p + sizeof(tlv), data, len);
+    return p + sizeof(tlv) + len;
+}
+
+static void
+digest(const uint8_t *data, size_t len, uint8_t *out)
+{
+    bootutil_sha_context ctx;
+
+    bootutil_sha_init(&ctx);
+    bootutil_sha_update(&ctx, data, (uint32_t)len);
+    bootutil_sha_finish(&ctx, out);
+    bootutil_sha_drop(&ctx);
+}
+
+/*
+ * Writes the image: a header, BENCH_IMAGE_SIZE bytes of payload and the
+ * unprotected TLVs, hash first, then key hash and signature if signed.
+ */
+static void
+build_image(struct image_header *hdr)
+{
+    struct image_tlv_info info;
+    uint8_t hash[IMAGE_HASH_SIZE];
+    uint8_t *tlvs;
+    uint8_t *p;
+    size_t i;
+
+    memset(bench_flash, 0xff, sizeof(bench_flash));
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->ih_magic = IMAGE_MAGIC;
+    hdr->ih_hdr_size = IMAGE_HEADER_SIZE;
+    hdr->ih_img_size = BENCH_IMAGE_SIZE;
+    hdr->ih_ver.iv_major = 1;
+    memcpy(bench_flash, hdr, sizeof(*hdr));
+
+    for (i = 0; i < BENCH_IMAGE_SIZE; i++) {
+        bench_flash[IMAGE_HEADER_SIZE + i] = (uint8_t)(i * 7 + (i >> 11));
+    }
+
+    digest(bench_flash, IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE, hash);
+
+    tlvs = &bench_flash[IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE];
+    p = tlvs + sizeof(info);
+    p = put_tlv(p, EXPECTED_HASH_TLV, hash, sizeof(hash));
+
+#ifdef BENCH_SIG_TLV
+    {
+        uint8_t keyhash[IMAGE_HASH_SIZE];
+
+        if (memcmp(hash, bench_image_sha256, sizeof(hash)) != 0) {
+            fail("image does not match the signed vectors");
+        }
+
+        digest(BENCH_PUB, sizeof(BENCH_PUB), keyhash);
+        p = put_tlv(p, IMAGE_TLV_KEYHASH, keyhash, sizeof(keyhash));
+        p = put_tlv(p, BENCH_SIG_TLV, BENCH_SIG, sizeof(BENCH_SIG));
+    }
+#endif
+
+    info.it_magic = IMAGE_TLV_INFO_MAGIC;
+    info.it_tlv_tot = (uint16_t)(p - tlvs);
+    memcpy(tlvs, &info, sizeof(info));
+}
+
+static int
+validate(struct image_header *hdr)
+{
+    uint8_t tmpbuf[BENCH_TMPBUF_SZ];
+    FIH_DECLARE(fih_rc, FIH_FAILURE);
+
+    FIH_CALL(bootutil_img_validate, fih_rc, NULL, hdr, &bench_area, tmpbuf,
+             sizeof(tmpbuf), NULL, 0, NULL);
+
+    return FIH_EQ(fih_rc, FIH_SUCCESS) ? 0 : -1;
+}
+
+static void
+check(struct image_header *hdr)
+{
+    uint8_t *byte = &bench_flash[IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE / 2];
+
+    if (validate(hdr) != 0) {
+        fail("valid image rejected");
+    }
+
+    *byte ^= 1;
+    if (validate(hdr) == 0) {
+        fail("modified image accepted");
+    }
+    *byte ^= 1;
+}
+
+#ifdef MCUBOOT_ENC_IMAGES
+/*
+ * Decrypts the payload in place the way bootutil_img_hash() does, one
+ * BENCH_TMPBUF_SZ chunk at a time, with a key set directly rather than
+ * unwrapped from a TLV.
+ */
+static void
+bench_decrypt(unsigned iters)
+{
+    static const uint8_t key[BOOT_ENC_KEY_SIZE] = { 1, 2, 3, 4 };
+    struct enc_key_data enc;
+    uint8_t *payload = &bench_flash[IMAGE_HEADER_SIZE];
+    uint64_t start;
+    uint32_t off;
+    unsigned k;
+
+    boot_enc_init(&enc);
+    if (boot_enc_set_key(&enc, key) != 0) {
+        fail("setting the encryption key failed");
+    }
+
+    start = bench_now_ns();
+    for (k = 0; k < iters; k++) {
+        for (off = 0; off < BENCH_IMAGE_SIZE; off += BENCH_TMPBUF_SZ) {
+            boot_enc_decrypt(&enc, off, BENCH_TMPBUF_SZ, 0, payload + off);
+        }
+    }
+    bench_report("enc_decrypt", BENCH_VARIANT, iters, BENCH_IMAGE_SIZE,
+                 bench_now_ns() - start);
+
+    boot_enc_drop(&enc);
+}
+#endif
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 20);
+    uint8_t tmpbuf[BENCH_TMPBUF_SZ];
+    uint8_t hash[IMAGE_HASH_SIZE];
+    struct image_header hdr;
+    uint64_t start;
+    unsigned k;
+
+    bench_flash_init(&bench_device, 1, &bench_area, 1, NULL);
+#ifdef MCUBOOT_USE_MBED_TLS
+    mbedtls_platform_set_calloc_free(calloc, free);
+#endif
+#ifdef MCUBOOT_USE_PSA_CRYPTO
+    mbedtls_test_enable_insecure_external_rng();
+    if (psa_crypto_init() != PSA_SUCCESS) {
+        fail("psa_crypto_init() failed");
+    }
+#endif
+
+    build_image(&hdr);
+    check(&hdr);
+
+    bench_header();
+
+    start = bench_now_ns();
+    for (k = 0; k < iters; k++) {
+        bootutil_img_hash(NULL, &hdr, &bench_area, tmpbuf, sizeof(tmpbuf),
+                          hash, NULL, 0);
+    }
+    bench_report("img_hash", BENCH_VARIANT, iters, BENCH_IMAGE_SIZE,
+                 bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (k = 0; k < iters; k++) {
+        validate(&hdr);
+    }
+    bench_report("img_validate", BENCH_VARIANT, iters, BENCH_IMAGE_SIZE,
+                 bench_now_ns() - start);
+
+#ifdef MCUBOOT_ENC_IMAGES
+    bench_decrypt(iters);
+#endif
+
+    return 0;
+}
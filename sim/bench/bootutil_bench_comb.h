@@ -0,0 +1,271 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Generated from root-ec-p256.pem with imgtool getpub --comb-teeth 6,
+ * do not edit.
+ *
+ * The comb table of the benchmark public key, for
+ * MCUBOOT_ECDSA_P256_KEY_COMB_TEETH=6.
+ */
+
+#ifndef H_BOOTUTIL_BENCH_COMB_H__
+#define H_BOOTUTIL_BENCH_COMB_H__
+
+static const unsigned int bench_ecdsa_p256_pub_comb6[] = {
+    0x953988d9, 0x245737e5, 0xcd14fb2f, 0xdbbe1937,
+    0xa91daee8, 0xa44995a1, 0xe8feed5b, 0x2acb403c,
+    0x538efac1, 0xcc3a6afc, 0x7d8b6834, 0x810ee5f0,
+    0x48b24a6a, 0x308ad6fe, 0xebd7cdd5, 0x94b9d65a,
+    0xe3852ccc, 0x349340b5, 0x1f15b940, 0x84b0cd69,
+    0xcfa454d9, 0x4919ebb3, 0x0caa73fe, 0xf5effb46,
+    0x5fab6143, 0x81780f18, 0xe7983239, 0x9755be70,
+    0x15028e26, 0x98ada45a, 0x272c4624, 0x79f98b5f,
+    0xa9524df1, 0x3d6113e6, 0x8a2aea78, 0x39e2f0df,
+    0xe36cdc1d, 0x9e3334d2, 0xe3ec6cd2, 0x2de2ac61,
+    0x111482f0, 0x40719569, 0x433658d2, 0xc70f624b,
+    0x33856ea1, 0xda2f9320, 0x20497473, 0x2f0dae38,
+    0x3125002b, 0x28aa1eeb, 0xd7a9c380, 0xc9179516,
+    0x01f4e6fd, 0xed6b9773, 0x431fa164, 0xddbdc358,
+    0xbbc04cb1, 0x93c75dd8, 0xdc4610e2, 0xa0032f23,
+    0x346f395c, 0x47284b90, 0x19a58796, 0x780b9695,
+    0x3b6669c1, 0x3dde38ce, 0xb93214fa, 0x676045e0,
+    0x65291c9e, 0x0906ab95, 0xb6bb1ea2, 0x34d43e46,
+    0xd6d3123b, 0x7b72cbd4, 0xf3672cd5, 0x0c9933c3,
+    0x15078d73, 0x4fad4d47, 0x66843aea, 0x60bd2e48,
+    0xcbeffa87, 0x7556decd, 0x8ac62c7c, 0x1566d188,
+    0xe0375cfc, 0xc763cdde, 0x826c5a21, 0x5aff97ee,
+    0xece26039, 0xd0622684, 0xdd1ef529, 0xa26e0d0d,
+    0x9c5e20de, 0x35b5c2cf, 0x479d531c, 0xa29c3b9d,
+    0x224bae97, 0x1261ddcc, 0x6416a16a, 0x185e339d,
+    0xdf0f9c63, 0x83274ac0, 0xe9179fcf, 0x1845d3d8,
+    0xa6c78620, 0x69b7c7c8, 0x85a3656a, 0xc27972fb,
+    0xf730f99f, 0x83c32068, 0x07f7e791, 0x4f700cf1,
+    0x741c13b9, 0x0a934a1f, 0x7bd9a147, 0x3c38c8dd,
+    0xfbcd3984, 0x791cc60b, 0xbd51e280, 0x7f273b43,
+    0xa655c20c, 0x65473574, 0xef6fe354, 0xd7b217c0,
+    0xc76d0d55, 0x3fb71817, 0xefdba95f, 0x4d52f452,
+    0x5a111cf8, 0xc2dc8ed9, 0xa6b15208, 0x249b1238,
+    0x8f86a4f5, 0x7f30b387, 0x9f0eb4d6, 0x5a85f144,
+    0xce0e2a82, 0x20e5a474, 0xd01028bf, 0x27a3626e,
+    0x3e419ed2, 0x4a78f859, 0xe802be3b, 0xd9b34710,
+    0x6742db3b, 0xadc8b2a1, 0x4dcc2d59, 0x5f3aeee4,
+    0x6b6110b7, 0xa5138b87, 0x830ee885, 0xb0282172,
+    0xaf522e6a, 0x25587f27, 0x6ae6332c, 0xf63627bc,
+    0x6ddcd79d, 0xd00bdc0a, 0x856d926b, 0xad1d9f74,
+    0x76baace9, 0xcc3fe4e0, 0x627016cc, 0x591fb273,
+    0x17364e03, 0xc2429450, 0xf7eaa33c, 0xc3665f77,
+    0x5ad9fa9b, 0x8ddb85b5, 0x9d6a0a7d, 0x83b14cda,
+    0xdf9310f3, 0xae04cd37, 0x3b0e12aa, 0xd16ef021,
+    0x0e56e689, 0x005d8bfd, 0x1e8ef172, 0x0a52db5d,
+    0x21cd1643, 0x307b48b1, 0x700de159, 0x08511adb,
+    0xabd7f920, 0x5cc0a929, 0xd1a074ca, 0x90d1206b,
+    0xfafb4265, 0x2c70809a, 0xfb293a77, 0xe746e782,
+    0xb9fdb41e, 0x81b01e04, 0xb1ddb3cb, 0x20e8ccf1,
+    0xdee11359, 0xf1907319, 0x24b0a41d, 0xe22f8834,
+    0xed6575b0, 0x7e18a06c, 0xc494f6fc, 0x9a200ecb,
+    0x297f320e, 0x17c00fd0, 0xf0da4567, 0x16bea16f,
+    0x30ec4ba1, 0x390800e5, 0x9da86efd, 0xf6035277,
+    0x9fb1f638, 0x31ebd311, 0x2d6b997a, 0x0e7c43b6,
+    0xa93bac4a, 0xd72da189, 0x745ecb20, 0xf972fa6a,
+    0x03fdeff8, 0x6d892d32, 0x0baf8da7, 0xeb1756ec,
+    0x8abda2da, 0x1c5e45f2, 0xc5d1ccd5, 0xc1ae3497,
+    0x6ffb69e3, 0xadbe68ac, 0xa64ae752, 0x490e3149,
+    0xb6302092, 0x6e1a4ce2, 0xad314c8c, 0x44d201c3,
+    0xdddbd1e6, 0x76a4abb7, 0xd2ef08b9, 0x33c57865,
+    0x4579c824, 0xeb05a04f, 0xe09ad4f8, 0xd2de20cc,
+    0xe0fcd0ee, 0x41a0dc89, 0x8ea5b335, 0x121207e6,
+    0xd0dffac9, 0x75055df2, 0x59101759, 0x0f2c6a27,
+    0xfce2ddfd, 0x4efe6a0b, 0x08577284, 0x2526a8e7,
+    0x610183af, 0x152a2073, 0x94c762dd, 0x9991e4aa,
+    0x56440a7c, 0x53a545b2, 0x10c6d9c0, 0x4feb4fb8,
+    0x54a531a2, 0x48c278e7, 0xc21aa6d5, 0x9ea16e38,
+    0xa3731ed7, 0x8dd81431, 0x0515173e, 0xd2abc9a5,
+    0x75e9c8b1, 0x248f23fb, 0x4dba8458, 0xb5e900be,
+    0x9a24de92, 0x69641256, 0x22547b7e, 0x417016bf,
+    0xeaad9883, 0xd41a9b79, 0xc12420b2, 0x7cf3faee,
+    0x0d7a76fe, 0xfc2cf099, 0x96245c90, 0xc211aa00,
+    0x2c5bde05, 0x25c76df9, 0xa569fd59, 0x6d14526b,
+    0x13d3bfda, 0xd133dfeb, 0xe817f576, 0x8459c681,
+    0x6817a70f, 0xea725f8e, 0xa8c3a722, 0x9eb962b9,
+    0xf9a103e2, 0x90a734c3, 0xa8efa752, 0x60e4f458,
+    0x00b5e403, 0x28e7a6c0, 0xa6e7a6ee, 0xbb87392f,
+    0x5b0d623f, 0x0eb3150b, 0x4b52847a, 0x4c71a793,
+    0x00f19947, 0x3f05550d, 0x099800eb, 0xaacd5dae,
+    0x53ec205b, 0x51497cd4, 0xdeb2dcdb, 0x58bf5da3,
+    0x64f5d709, 0x88a33658, 0x4d175b1d, 0x08df0625,
+    0x4e065732, 0x057a659e, 0xadf9a7fd, 0xfa644606,
+    0xba80032c, 0x813be194, 0x0a8ea030, 0x0a2ae793,
+    0xe3dd3018, 0x92180aba, 0x2e7e9f0e, 0x2af46490,
+    0x67f92cdf, 0x0842425a, 0xaa2dbee5, 0x8d57697e,
+    0xb12a69e4, 0x475193c8, 0x7c58ad07, 0x1a1641c0,
+    0x9d512418, 0x7fddabc4, 0x7e0b0be6, 0xe83f1dcf,
+    0x7541d37b, 0x4641f4fe, 0xc342b2e7, 0xf82dde30,
+    0x33fc42a0, 0x1a140eb7, 0xd23ad454, 0x27ca7c2a,
+    0x5f425c60, 0x07f90dbe, 0xeff7c67b, 0x077575a1,
+    0x974924c7, 0x2812126b, 0xfdc3cac7, 0x31848034,
+    0xff850648, 0x099f4bac, 0xeb280bd2, 0xae255e3b,
+    0x2d3d97bd, 0x7d7bfc51, 0x55af7f53, 0x0ce11b52,
+    0xf2ed02bd, 0x44482d0c, 0x78e0f94f, 0x49ad83cc,
+    0x070c84a9, 0x90f55271, 0xff57ce9a, 0xaf48f269,
+    0x5df924fb, 0xf97a0e0e, 0x541ea69d, 0x47df65e3,
+    0x2af45f7e, 0x1a18da6a, 0xae2fe2de, 0x318da825,
+    0xd914afcf, 0xdc9ee35a, 0xe83211b8, 0x9f8c4782,
+    0xf7bf7611, 0xe7187581, 0x849022c0, 0x49b840b8,
+    0x6948f516, 0x1009aab3, 0x1b24f398, 0xe4ecd248,
+    0x1a02a804, 0xab2ba951, 0xcf0732c8, 0x19ca3c4f,
+    0xc8846701, 0x0aae67a2, 0x00224157, 0xd8eefa95,
+    0x389e1737, 0x723033c2, 0xefe323b0, 0xae1d0193,
+    0xa95325af, 0xfd8a0bc1, 0xa4536b58, 0x506bd0b6,
+    0xfaf4e7b2, 0x4348ebc2, 0x18b8f032, 0x68d95675,
+    0xa179fd73, 0xeb00143a, 0x55ef2e6e, 0x802347bc,
+    0x0dd9c9a1, 0x21cfeb0a, 0x319bd3e5, 0xb5ccf99d,
+    0xcb2c754a, 0x8d5ea64c, 0x3f175e85, 0xf0b99b43,
+    0x39a606f9, 0x57654db0, 0xf4956e0f, 0xf80d608f,
+    0x1e8d54ea, 0x2d974ccf, 0xcf901dd8, 0x1c635db2,
+    0x5201683e, 0xb769035a, 0xe4051512, 0xb012b054,
+    0xaff31739, 0x6c71595e, 0x74714d28, 0x57a0c1f1,
+    0xe2befca4, 0x94b5d8ec, 0xba455e60, 0x1ba778ae,
+    0x728712a9, 0xc7558a13, 0xb76aca1e, 0x264e1db2,
+    0x0b90d7cd, 0xeae6c411, 0x606dda8d, 0x0906f21b,
+    0x9788d0b1, 0xcf8958dd, 0x1743be04, 0xfbbd8478,
+    0x740d6cdb, 0xa1b83af5, 0x9643a74f, 0x6c94e8a9,
+    0x23e81729, 0x923d3995, 0xaef7303c, 0xb6916786,
+    0x69e7b9bf, 0x075d4aac, 0x8fdf3c33, 0x996a9bb6,
+    0x058cabb6, 0x7f5d6cd8, 0x7f211500, 0xe3e5672d,
+    0x43fc633f, 0x912f2263, 0xa0f53533, 0xf3af0005,
+    0xdf035ec8, 0x7dd5a802, 0x80e11bfd, 0xbf5ce877,
+    0x9f0aa06b, 0x2327d691, 0x0a9226cc, 0x82a55d03,
+    0x4d10526e, 0xbd2ad7ed, 0xc1798120, 0x6f0fcbb1,
+    0x82713933, 0xdf2343d4, 0x4a8f795f, 0xf080cedf,
+    0x19dcd55a, 0xfee885be, 0x885fff1a, 0xba177d0c,
+    0xe8e06385, 0x68c17698, 0x284fcb68, 0x785962e7,
+    0x10e9f302, 0x1f2455a2, 0xb5cf6283, 0x8ab560e2,
+    0x57bcdd05, 0x2a5ec33f, 0x85554493, 0x26bf270e,
+    0x2edb9e29, 0xc6aaee75, 0x3c99e863, 0x0f432a8a,
+    0x8d7dd809, 0xf612bedd, 0xbaa7bf9c, 0xf30e52d4,
+    0x3ea1c76f, 0x0145a8e6, 0x9a32b637, 0xcb3ff7f3,
+    0x1e4776d4, 0x6ea6c452, 0x3e4ac9c7, 0xd7bc8c04,
+    0xcd1e3017, 0x56f31698, 0x91ecc114, 0x09b37682,
+    0xfe626966, 0xa3f2e3aa, 0x493a0a08, 0x26eb9ea6,
+    0x2753659a, 0x448ba61c, 0x6e77da04, 0x1a5564c8,
+    0xa074d9cf, 0x263f2f41, 0xf7f89e6a, 0x9c808735,
+    0xe10a1896, 0x250c0526, 0xcca9a633, 0xbfe67117,
+    0x03f14699, 0xa709cfcb, 0x16737847, 0xb41ecd69,
+    0x2c07f73e, 0x9ff70103, 0x567618bf, 0x33ea6948,
+    0x6bd758ef, 0xc9dabf9e, 0xc5a46790, 0xf0b676e5,
+    0x45343f84, 0x400277c6, 0xe77fab51, 0x375d6ed4,
+    0x63aa1527, 0x96815a56, 0x7ebcbbfb, 0xc08d456d,
+    0x70879164, 0xf0560995, 0x68537762, 0x11b9769a,
+    0x0c9e0eaf, 0x52e388b3, 0x16878c8e, 0x6da4ecee,
+    0x0fcfbe67, 0x05ab81f9, 0xb68da2ab, 0x552bd6c0,
+    0x2235914e, 0xf7adb814, 0x41ee40c9, 0x29f65e40,
+    0x05c974b6, 0x725d5a27, 0x3439570f, 0xd4fb0cc9,
+    0xaf932cd1, 0xa1849b5d, 0x7e946052, 0x558d58d7,
+    0x991d99f5, 0xcc269935, 0x80ba689c, 0x3684e8da,
+    0x515fa692, 0xf9b8af03, 0xa95c5a57, 0x6496dbc7,
+    0xd3110f9f, 0xb7957d7e, 0x28e6fc48, 0x01461887,
+    0x926b8c87, 0xf33ae163, 0xc1b49a71, 0xc2a8eb10,
+    0x16542a86, 0x805d4d43, 0xd17d65ad, 0xa3ebee0f,
+    0xadadb0cf, 0x79cd8f5b, 0xb441352b, 0xd2647286,
+    0x02b2089b, 0xbf1705e6, 0x9c845032, 0x5493c162,
+    0xd2d1ef95, 0x33314cbe, 0x5dce0990, 0x8662bf0c,
+    0xab10de95, 0x3db56570, 0x34191391, 0xd971c55f,
+    0xfaecbd75, 0x20624e48, 0x8187beb2, 0x2a6217e0,
+    0x2d0e436e, 0xcdbfba7b, 0xd360eead, 0x59a86c9b,
+    0xe169fb23, 0x0d1ea1e9, 0x4840262e, 0x77524e9c,
+    0xc95593de, 0x138f6118, 0xf09b1a46, 0xb42f1a6f,
+    0xb69cb2a0, 0xb1b9b233, 0xd8af014a, 0x3537a76d,
+    0x07be79d0, 0xe7b8220e, 0x0b6f1286, 0xdae2bac2,
+    0xc27fe231, 0x2e27b8a4, 0xc521afc5, 0xd2fa742a,
+    0xabfec0a7, 0xcfb65c24, 0x14a44eeb, 0xb964398f,
+    0x0d5155ff, 0x87c77400, 0xc7e92545, 0x97772acf,
+    0x62290860, 0xf29e372b, 0xb53ea56f, 0x7648206e,
+    0x4e0639ca, 0x6b870fe6, 0x0855ab9d, 0x1f4d3918,
+    0x0861d52d, 0xc695c38c, 0x4814bc33, 0x9002dcb6,
+    0xa5294ccb, 0x0d9bb4ca, 0x23e7b7ef, 0x6bf1e994,
+    0x84d4e2e4, 0x89c2d52d, 0x5ecaf5a7, 0xba9de3f9,
+    0x4cd63336, 0xf8de82b7, 0x4b638ec7, 0xa849456f,
+    0x46ecc215, 0xe3b92015, 0xdfeba842, 0xb3437e58,
+    0xee176da1, 0xa0ee67f5, 0x42d67b97, 0x301f2349,
+    0x715295e7, 0x0890f779, 0x881caae9, 0x38602425,
+    0x08e7d179, 0x91c929ef, 0x33fe5af5, 0x4280a2a9,
+    0xf297cde2, 0x165f35f5, 0x97218223, 0xfcd632f8,
+    0x42efd256, 0xca585efe, 0x9bdc7633, 0x4c183431,
+    0x38a15bf4, 0x960071be, 0xd8806ea3, 0xcef2f475,
+    0x09670e69, 0x3f925cd3, 0xcd7dd621, 0x1205ebb7,
+    0x48470c37, 0x0ada7623, 0xdcfcdd96, 0xd5315a3c,
+    0x39cb1dd8, 0x9525b5b2, 0xc106825e, 0xf8100889,
+    0x5c6d35fa, 0xf57ea091, 0x5c206dd5, 0xea53d1c2,
+    0x2e54d834, 0x10dbba87, 0x3be37944, 0xe598c7b2,
+    0x1e1506e4, 0x9f0c965e, 0xdb0e3497, 0xbfe00f8c,
+    0x6218cded, 0x1606e715, 0x66ed0bfd, 0x7fccc6ba,
+    0x9dc86212, 0xcfc22ac3, 0x2abba0d1, 0x063b6fda,
+    0x39bc21c7, 0x8baa9139, 0xb4570b31, 0x8716cd5a,
+    0xe1e5b4da, 0xc8ba2664, 0xcc3be417, 0xef268945,
+    0xa4097224, 0xef6057f1, 0x473467d3, 0xd8c01a87,
+    0xb64b94d9, 0xba9c13c1, 0xe3b78f56, 0x6c691bb0,
+    0x89f28484, 0xa704c0cd, 0x4f6e10b5, 0xc6b7a921,
+    0x030a474c, 0xc05a909c, 0xeec0f3b3, 0xee9f09ac,
+    0xb5ad055e, 0x70890dd2, 0xfb922a6f, 0x53cca46d,
+    0x4f44fd83, 0x45a1ad4c, 0xeb502541, 0x333e4497,
+    0x2c082bb6, 0x6ef432a8, 0x76dd2996, 0x8232ffcc,
+    0xd1b31594, 0xdebdaa7e, 0x66e6ed73, 0x9f677a24,
+    0x60660070, 0xa14a316e, 0x4d236e53, 0xcf97e50f,
+    0x402d87ab, 0x061b21b7, 0xed38fe6e, 0x7de65a0d,
+    0x0bb8c7ba, 0x7df89376, 0x85a9f017, 0x242a7281,
+    0x9b61a52b, 0x679c8694, 0x61876e3f, 0xe62897aa,
+    0x3361f377, 0x0e9be741, 0x3c385090, 0x847f856a,
+    0xeaf08a94, 0x4529342e, 0x38de747f, 0x77e4511e,
+    0x3e732e06, 0xceda7b8c, 0x6d07f82d, 0xd21e91c9,
+    0x85bd8596, 0x72c3f073, 0x60d5d2b2, 0xa43ec0b3,
+    0xcccdf287, 0xe2f63573, 0x0dd4672d, 0xf6f32155,
+    0xc6ce0140, 0xdad5b63e, 0xad931459, 0x3c33fffe,
+    0xe4c592dd, 0xe5ca9355, 0xfc14d861, 0x773ee68a,
+    0x70b986ae, 0xc4e6bac4, 0x567dee26, 0x6f4c8b2e,
+    0xc4f928df, 0xd8f681d3, 0x20f3028a, 0x0e8342c7,
+    0xc8be9be2, 0x75669b5d, 0xe3057c9c, 0xcaa7eda6,
+    0x22268a65, 0x50c505d1, 0xdbe4563f, 0xc8f5122f,
+    0xc004b461, 0xbd396694, 0x8ea6ccbe, 0x707a20d2,
+    0xa5bed7f4, 0xd9870d36, 0x80ab93ac, 0xab33fe7f,
+    0x12795f2f, 0xfb2d8162, 0xcd80401d, 0x85ddc375,
+    0x6cdfdb0c, 0xbe1ced39, 0x3aade128, 0x1606356b,
+    0xebacbdb1, 0x5867851b, 0x975b8129, 0xe95a9a6e,
+    0xb0b374e2, 0x4816a089, 0x97f315f9, 0xf764d10d,
+    0xa1e81e0f, 0x13438f87, 0x5f7db2f0, 0xaca66358,
+    0x5bedbb97, 0xf3b8a01c, 0xbf458152, 0xf6cd0647,
+    0x09d63749, 0xb17b589d, 0x987a502a, 0x2a829cc5,
+    0x681ff730, 0x00a5ca88, 0x1673cc2a, 0x78813bf8,
+    0xf9772265, 0xd92bf9d7, 0x2b63dab6, 0xdb02d16e,
+    0x7f6b6389, 0xefcc8788, 0x30ccf72b, 0x8c43dc29,
+    0x18b9e803, 0xf0700503, 0x5a04d505, 0xd088a38e,
+    0xc77342b1, 0x17d6defd, 0x5ff48a91, 0x575e8960,
+    0xa6ffcf36, 0x7b036049, 0x6aa0623e, 0x86893500,
+    0xc9055334, 0xf09b7e0f, 0x539d17cb, 0xe32e2358,
+    0x0ce133c7, 0x5eca69b3, 0xe750b5c3, 0xc68026d3,
+    0xa0a4d0ac, 0x14a397b2, 0xcb025146, 0xb5071f37,
+    0x99c125c5, 0x360956ee, 0x9c5f3877, 0xed5605b2,
+    0xb5907cc3, 0x19eb7b99, 0x979870a1, 0xc78f3dcd,
+    0x95dd469e, 0x71fe7cd6, 0xa352f732, 0x22ab0b8f,
+    0xacd22b96, 0xfe450add, 0x42c83681, 0x0dd05c56,
+    0xb8acefa7, 0x893bbd54, 0x46499465, 0xa84ad9f5,
+    0xd78418ea, 0x86ccf634, 0x9d11add9, 0x6eb01d27,
+    0xdc77d339, 0x92920755, 0x5930d172, 0xfb596f61,
+    0x7847319b, 0xc78a4479, 0x0c446c42, 0x755c0579,
+    0xa6216920, 0x3a9df770, 0x0597fccc, 0xd6cb4dd9,
+    0xfa4e893a, 0xa4c08a36, 0xa382faee, 0x87d42a97,
+    0x9759ba43, 0x7fe53d61, 0x3700d3f9, 0xdf400074,
+    0x73dd75fc, 0x6f98597a, 0x6f8592a7, 0xed2cfee6,
+    0x6935b1b0, 0x1714bec8, 0x955d36a0, 0x936c5892,
+    0x7c23977f, 0x2e44f091, 0x6b48cce0, 0x9e1856b0,
+    0xb199917b, 0x171eec27, 0x047c3314, 0x3478cc55,
+    0x3f00d28f, 0x78bf4537, 0xbacd7299, 0x9a093806,
+    0x38a983e6, 0x412164e6, 0x343cba8d, 0x09765271,
+    0x8f09b46c, 0xe89dde40, 0x40d9d939, 0x8926ccba,
+    0xb15b5823, 0x4a928ce7, 0x227b9f87, 0xb5e22293,
+    0x0565f02d, 0x57c1f5ca, 0x05021b40, 0x35f70cb0,
+    0x574c4849, 0xccfbb2ea, 0x2f99fe23, 0x40f47a1d,
+};
+
+#endif /* H_BOOTUTIL_BENCH_COMB_H__ */
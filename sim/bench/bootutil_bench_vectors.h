@@ -0,0 +1,257 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Generated from root-ec-p256.pem, root-ed25519.pem, root-rsa-2048.pem and
+ * root-rsa-3072.pem, do not edit.
+ *
+ * The SHA256 of the benchmark image (see bootutil_bench.c), its signatures
+ * and the public keys in the form compiled into MCUboot.
+ */
+
+#ifndef H_BOOTUTIL_BENCH_VECTORS_H__
+#define H_BOOTUTIL_BENCH_VECTORS_H__
+
+#include <stdint.h>
+
+#define BENCH_IMAGE_SIZE (262144)
+
+static const uint8_t bench_image_sha256[] = {
+    0xa0, 0x98, 0x92, 0xdf, 0x14, 0xb2, 0xd7, 0xd7,
+    0x5a, 0x41, 0x7f, 0x6f, 0xfe, 0xb1, 0xc5, 0xa3,
+    0x0e, 0xf9, 0x02, 0xf3, 0x44, 0x30, 0x46, 0xdb,
+    0x66, 0x4b, 0x7b, 0x50, 0x05, 0xae, 0x4e, 0xb9,
+};
+
+static const uint8_t bench_ecdsa_p256_pub[] = {
+    0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2a, 0x86,
+    0x48, 0xce, 0x3d, 0x02, 0x01, 0x06, 0x08, 0x2a,
+    0x86, 0x48, 0xce, 0x3d, 0x03, 0x01, 0x07, 0x03,
+    0x42, 0x00, 0x04, 0x2a, 0xcb, 0x40, 0x3c, 0xe8,
+    0xfe, 0xed, 0x5b, 0xa4, 0x49, 0x95, 0xa1, 0xa9,
+    0x1d, 0xae, 0xe8, 0xdb, 0xbe, 0x19, 0x37, 0xcd,
+    0x14, 0xfb, 0x2f, 0x24, 0x57, 0x37, 0xe5, 0x95,
+    0x39, 0x88, 0xd9, 0x94, 0xb9, 0xd6, 0x5a, 0xeb,
+    0xd7, 0xcd, 0xd5, 0x30, 0x8a, 0xd6, 0xfe, 0x48,
+    0xb2, 0x4a, 0x6a, 0x81, 0x0e, 0xe5, 0xf0, 0x7d,
+    0x8b, 0x68, 0x34, 0xcc, 0x3a, 0x6a, 0xfc, 0x53,
+    0x8e, 0xfa, 0xc1,
+};
+
+static const uint8_t bench_ecdsa_p256_sig[] = {
+    0x30, 0x46, 0x02, 0x21, 0x00, 0x90, 0xf3, 0x2b,
+    0xd9, 0x40, 0x5e, 0x62, 0x53, 0xd4, 0x75, 0xf1,
+    0xf1, 0xaa, 0x50, 0xad, 0x62, 0x3a, 0x25, 0xea,
+    0xcc, 0x42, 0x0e, 0x1e, 0x30, 0xb8, 0x7e, 0x63,
+    0xb0, 0xe9, 0x64, 0x22, 0x00, 0x02, 0x21, 0x00,
+    0xde, 0x0b, 0xe1, 0x55, 0xb1, 0xd6, 0x5d, 0xfd,
+    0x6c, 0xde, 0xb9, 0xa9, 0x76, 0x4f, 0xf5, 0xca,
+    0x00, 0xa3, 0x2f, 0x36, 0x7f, 0x51, 0xc9, 0x1f,
+    0x4f, 0xba, 0x83, 0xac, 0x6d, 0x51, 0xa7, 0xad,
+};
+
+static const uint8_t bench_ed25519_pub[] = {
+    0x30, 0x2a, 0x30, 0x05, 0x06, 0x03, 0x2b, 0x65,
+    0x70, 0x03, 0x21, 0x00, 0xd4, 0xb3, 0x1b, 0xa4,
+    0x9a, 0x3a, 0xdd, 0x3f, 0x82, 0x5d, 0x10, 0xca,
+    0x7f, 0x31, 0xb5, 0x0b, 0x0d, 0xe8, 0x7f, 0x37,
+    0xcc, 0xc4, 0x9f, 0x1a, 0x40, 0x3a, 0x5c, 0x13,
+    0x20, 0xff, 0xb4, 0xe0,
+};
+
+static const uint8_t bench_ed25519_pub_x[] = {
+    0x77, 0xb3, 0x6c, 0xa3, 0x2d, 0x95, 0x18, 0x7a,
+    0x9e, 0x9e, 0x57, 0xc5, 0xd2, 0x71, 0xfe, 0x25,
+    0x11, 0xc9, 0x92, 0x67, 0xd6, 0x4b, 0x34, 0x66,
+    0xe4, 0x71, 0xaf, 0xcf, 0x9f, 0xb6, 0x0e, 0x7d,
+};
+
+static const uint8_t bench_ed25519_sig[] = {
+    0x12, 0x06, 0xb6, 0xfd, 0xb2, 0x1a, 0xfc, 0x39,
+    0x10, 0x5d, 0x34, 0x15, 0x63, 0xfd, 0x12, 0x4a,
+    0x81, 0x9e, 0x6f, 0x85, 0xb3, 0x4f, 0xbe, 0xbb,
+    0xf1, 0x8e, 0x27, 0x52, 0x08, 0xb7, 0xef, 0xab,
+    0x20, 0xa3, 0x11, 0x69, 0x54, 0xa7, 0x1a, 0x56,
+    0x7d, 0xa3, 0x26, 0x85, 0x10, 0x86, 0xa5, 0xb6,
+    0xfc, 0x43, 0x0d, 0xd3, 0xae, 0xab, 0x79, 0x19,
+    0x0e, 0x26, 0x51, 0x44, 0xd4, 0x43, 0x09, 0x07,
+};
+
+static const uint8_t bench_rsa2048_pub[] = {
+    0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01,
+    0x00, 0xd1, 0x06, 0x08, 0x1a, 0x18, 0x44, 0x2c,
+    0x18, 0xe8, 0xfb, 0xfd, 0xf7, 0x0d, 0xa3, 0x4f,
+    0x1f, 0xbb, 0xee, 0x5e, 0xf9, 0xaa, 0xd2, 0x4b,
+    0x18, 0xd3, 0x5a, 0xe9, 0x6d, 0x18, 0x80, 0x19,
+    0xf9, 0xf0, 0x9c, 0x34, 0x1b, 0xcb, 0xf3, 0xbc,
+    0x74, 0xdb, 0x42, 0xe7, 0x8c, 0x7f, 0x10, 0x53,
+    0x7e, 0x43, 0x5e, 0x0d, 0x57, 0x2c, 0x44, 0xd1,
+    0x67, 0x08, 0x0f, 0x0d, 0xbb, 0x5c, 0xee, 0xec,
+    0xb3, 0x99, 0xdf, 0xe0, 0x4d, 0x84, 0x0b, 0xaa,
+    0x77, 0x41, 0x60, 0xed, 0x15, 0x28, 0x49, 0xa7,
+    0x01, 0xb4, 0x3c, 0x10, 0xe6, 0x69, 0x8c, 0x2f,
+    0x5f, 0xac, 0x41, 0x4d, 0x9e, 0x5c, 0x14, 0xdf,
+    0xf2, 0xf8, 0xcf, 0x3d, 0x1e, 0x6f, 0xe7, 0x5b,
+    0xba, 0xb4, 0xa9, 0xc8, 0x88, 0x7e, 0x47, 0x3c,
+    0x94, 0xc3, 0x77, 0x67, 0x54, 0x4b, 0xaa, 0x8d,
+    0x38, 0x35, 0xca, 0x62, 0x61, 0x7e, 0xb7, 0xe1,
+    0x15, 0xdb, 0x77, 0x73, 0xd4, 0xbe, 0x7b, 0x72,
+    0x21, 0x89, 0x69, 0x24, 0xfb, 0xf8, 0x65, 0x6e,
+    0x64, 0x3e, 0xc8, 0x0e, 0xd7, 0x85, 0xd5, 0x5c,
+    0x4a, 0xe4, 0x53, 0x0d, 0x2f, 0xff, 0xb7, 0xfd,
+    0xf3, 0x13, 0x39, 0x83, 0x3f, 0xa3, 0xae, 0xd2,
+    0x0f, 0xa7, 0x6a, 0x9d, 0xf9, 0xfe, 0xb8, 0xce,
+    0xfa, 0x2a, 0xbe, 0xaf, 0xb8, 0xe0, 0xfa, 0x82,
+    0x37, 0x54, 0xf4, 0x3e, 0xe1, 0x2b, 0xd0, 0xd3,
+    0x08, 0x58, 0x18, 0xf6, 0x5e, 0x4c, 0xc8, 0x88,
+    0x81, 0x31, 0xad, 0x5f, 0xb0, 0x82, 0x17, 0xf2,
+    0x8a, 0x69, 0x27, 0x23, 0xf3, 0xab, 0x87, 0x3e,
+    0x93, 0x1a, 0x1d, 0xfe, 0xe8, 0xf8, 0x1a, 0x24,
+    0x66, 0x59, 0xf8, 0x1c, 0xab, 0xdc, 0xce, 0x68,
+    0x1b, 0x66, 0x64, 0x35, 0xec, 0xfa, 0x0d, 0x11,
+    0x9d, 0xaf, 0x5c, 0x3a, 0xa7, 0xd1, 0x67, 0xc6,
+    0x47, 0xef, 0xb1, 0x4b, 0x2c, 0x62, 0xe1, 0xd1,
+    0xc9, 0x02, 0x03, 0x01, 0x00, 0x01,
+};
+
+static const uint8_t bench_rsa2048_sig[] = {
+    0x71, 0x8d, 0xb3, 0xc9, 0x00, 0x99, 0x9c, 0xf8,
+    0x82, 0xcc, 0xd3, 0xac, 0x2e, 0x40, 0xe3, 0xd5,
+    0xef, 0xd6, 0x1e, 0x63, 0x3d, 0xd5, 0xfe, 0xc5,
+    0xaa, 0x63, 0x80, 0x3d, 0x1d, 0x53, 0x9f, 0xd5,
+    0x31, 0xf1, 0xd1, 0x54, 0xf9, 0x94, 0xe2, 0x70,
+    0x81, 0xe3, 0xa8, 0x97, 0x67, 0xfa, 0x65, 0x6b,
+    0x5d, 0xdc, 0x6a, 0x84, 0x5d, 0xf7, 0xae, 0xb6,
+    0xa6, 0x97, 0x1a, 0xd7, 0x1d, 0x15, 0xf7, 0x1d,
+    0x9c, 0x7a, 0x6a, 0x4d, 0xb1, 0x93, 0xd9, 0x4b,
+    0xc1, 0x6c, 0x18, 0x0a, 0x83, 0x58, 0x87, 0x19,
+    0x4e, 0xac, 0xae, 0x27, 0x37, 0x4a, 0xe8, 0x0a,
+    0x98, 0x45, 0x93, 0x0b, 0x69, 0x38, 0x74, 0xef,
+    0x22, 0x00, 0x28, 0xe3, 0x6b, 0x79, 0x91, 0x91,
+    0xa6, 0xab, 0x1d, 0x64, 0xfc, 0xa6, 0xc9, 0x8c,
+    0x3c, 0xf4, 0x11, 0x6a, 0x4d, 0xec, 0x21, 0xee,
+    0xe7, 0x25, 0xee, 0x81, 0xc6, 0x7b, 0x12, 0xaa,
+    0x40, 0x24, 0x20, 0x00, 0xf7, 0xb3, 0xc8, 0xdb,
+    0x17, 0x98, 0x08, 0xe2, 0x8e, 0xc4, 0x7d, 0xec,
+    0x9e, 0x58, 0x8c, 0x72, 0x35, 0x74, 0x13, 0x25,
+    0x8c, 0xe7, 0x7b, 0x5b, 0x17, 0x6c, 0x2e, 0x96,
+    0xc8, 0xc5, 0x1b, 0x66, 0x61, 0x1d, 0x6f, 0x2a,
+    0xf7, 0xe4, 0xb1, 0x27, 0x01, 0xfa, 0x69, 0x37,
+    0x14, 0xe9, 0x08, 0xc7, 0x6f, 0xf5, 0xa6, 0x14,
+    0xa2, 0xda, 0x12, 0x2e, 0x02, 0x7a, 0xb5, 0xf6,
+    0x6e, 0xc7, 0x14, 0x3b, 0x3d, 0x42, 0x66, 0xe5,
+    0xdf, 0x14, 0xda, 0xb7, 0x75, 0x11, 0x78, 0xfc,
+    0xd4, 0xed, 0x0d, 0xf2, 0x3c, 0x95, 0x62, 0x3a,
+    0xda, 0x0e, 0x21, 0xe1, 0x1f, 0xe8, 0xa0, 0xa8,
+    0x18, 0x13, 0x8e, 0x37, 0x61, 0xad, 0x28, 0xdc,
+    0x39, 0x7c, 0xe7, 0x8f, 0x7d, 0x69, 0x4f, 0xd5,
+    0xf5, 0x5f, 0x2c, 0x45, 0x48, 0xfe, 0x2f, 0xa2,
+    0xd0, 0xa2, 0xfb, 0xcd, 0x37, 0x6f, 0x20, 0x85,
+};
+
+static const uint8_t bench_rsa3072_pub[] = {
+    0x30, 0x82, 0x01, 0x8a, 0x02, 0x82, 0x01, 0x81,
+    0x00, 0xb4, 0x2c, 0x0e, 0x98, 0x58, 0x10, 0xa4,
+    0xa7, 0x58, 0x99, 0x7c, 0x01, 0xdd, 0x08, 0x2a,
+    0x28, 0x34, 0x33, 0xf8, 0x96, 0x1a, 0x34, 0x20,
+    0x5d, 0x45, 0xc8, 0x71, 0x26, 0x25, 0xe5, 0xd2,
+    0x96, 0xea, 0x7b, 0xb1, 0x15, 0xaa, 0xa6, 0x8a,
+    0x63, 0x22, 0x8b, 0x2d, 0x4e, 0x81, 0x73, 0xbf,
+    0x6e, 0x15, 0x68, 0x8c, 0x1a, 0xf4, 0xef, 0x2a,
+    0x8f, 0x8c, 0x22, 0x9e, 0x71, 0x57, 0x4b, 0xde,
+    0x0f, 0x7e, 0x72, 0xd3, 0x7a, 0xb8, 0xa7, 0x1d,
+    0x44, 0xad, 0x87, 0x00, 0x83, 0x5c, 0xfd, 0x73,
+    0x05, 0x72, 0x46, 0x3f, 0x8b, 0xf9, 0x10, 0x00,
+    0xd8, 0x6e, 0xcc, 0x85, 0xed, 0xf9, 0x49, 0xdb,
+    0x78, 0x36, 0x80, 0x49, 0x38, 0x76, 0xdd, 0x5f,
+    0x54, 0x04, 0xda, 0x8c, 0x34, 0xa7, 0x2b, 0x13,
+    0x25, 0x6f, 0xd1, 0x15, 0x4f, 0xad, 0xc2, 0xe1,
+    0xa5, 0xd2, 0x4e, 0x57, 0x0c, 0x7e, 0x9c, 0x9b,
+    0xba, 0x4e, 0x68, 0xb2, 0xe0, 0x25, 0x02, 0xaa,
+    0x00, 0xd3, 0xb4, 0xcc, 0x2f, 0x78, 0xe5, 0xbe,
+    0x47, 0x67, 0x1f, 0xc8, 0x6e, 0x22, 0x6c, 0x5e,
+    0x61, 0xb6, 0x9a, 0xcd, 0xe5, 0xa8, 0xba, 0x7a,
+    0x80, 0x13, 0x1b, 0x17, 0x2e, 0x96, 0xed, 0xcf,
+    0xb3, 0x9b, 0xe4, 0x1c, 0xe8, 0xad, 0xa7, 0xf6,
+    0x3a, 0x51, 0x66, 0x5e, 0x99, 0x8e, 0x87, 0xee,
+    0x60, 0x25, 0xf8, 0x8d, 0xbe, 0xce, 0xa4, 0xa8,
+    0xca, 0x93, 0x6c, 0xd7, 0xbf, 0xd4, 0x73, 0x33,
+    0x8d, 0x44, 0x85, 0xcc, 0x73, 0x30, 0x08, 0x9c,
+    0x4d, 0xb2, 0xaa, 0x5a, 0x6c, 0x6f, 0x7b, 0xab,
+    0xb7, 0xb3, 0x7c, 0xc3, 0xfb, 0xe7, 0xca, 0xc4,
+    0xf8, 0x9a, 0x6f, 0xcb, 0xbb, 0x5b, 0x82, 0xe7,
+    0x7a, 0xe8, 0x19, 0xfd, 0x2f, 0x11, 0x22, 0xfb,
+    0x7f, 0x76, 0x8c, 0x6b, 0x94, 0xa4, 0x09, 0x4f,
+    0xa5, 0x6a, 0x77, 0x51, 0xeb, 0xa7, 0x7e, 0xda,
+    0x87, 0x06, 0xee, 0xdc, 0xbe, 0xd1, 0xea, 0x1a,
+    0x40, 0x1d, 0x1b, 0xff, 0x1a, 0xb1, 0x51, 0x7c,
+    0x12, 0xb0, 0xf3, 0xf6, 0x83, 0x01, 0x9c, 0xe7,
+    0x0c, 0x99, 0xbf, 0xac, 0x68, 0x58, 0x72, 0xa4,
+    0xb0, 0x59, 0x85, 0xee, 0x85, 0xac, 0x2a, 0x22,
+    0xf4, 0xcf, 0x15, 0x08, 0x80, 0x1f, 0x0d, 0xd0,
+    0x1e, 0xa0, 0xa0, 0x94, 0xc8, 0xf7, 0xfa, 0x65,
+    0xdd, 0x52, 0xe8, 0x96, 0x37, 0x23, 0x30, 0x57,
+    0x36, 0xe6, 0x9d, 0xf4, 0x0c, 0x4a, 0x05, 0x75,
+    0x1f, 0xad, 0x01, 0xca, 0xb7, 0x6d, 0x8c, 0x43,
+    0x74, 0x06, 0x0a, 0x81, 0xf3, 0x01, 0x62, 0xff,
+    0xf7, 0xf5, 0x5f, 0xaf, 0xe7, 0x2b, 0x0e, 0xf8,
+    0x81, 0xb5, 0x65, 0xdd, 0x01, 0xd9, 0x9f, 0x07,
+    0x17, 0x8a, 0x18, 0xcf, 0x23, 0x6e, 0x88, 0x65,
+    0x91, 0xb5, 0x7b, 0xd3, 0xb0, 0x2d, 0xaf, 0x93,
+    0x66, 0x63, 0x74, 0xac, 0x5a, 0xe6, 0x73, 0xde,
+    0x3b, 0x02, 0x03, 0x01, 0x00, 0x01,
+};
+
+static const uint8_t bench_rsa3072_sig[] = {
+    0x45, 0x1b, 0xc8, 0x6d, 0x0e, 0x82, 0xab, 0x45,
+    0x30, 0x7d, 0x78, 0xfb, 0xb2, 0xc7, 0xb6, 0x31,
+    0xb3, 0xb6, 0x31, 0xbd, 0x90, 0x51, 0xda, 0xf0,
+    0x13, 0x18, 0x2f, 0x42, 0x3a, 0x22, 0x7f, 0xf0,
+    0x86, 0xa3, 0x7c, 0x34, 0x3a, 0xcb, 0x57, 0x4b,
+    0x15, 0x05, 0x5c, 0xc9, 0x10, 0xda, 0x8b, 0xc4,
+    0x82, 0x1f, 0x1e, 0xd9, 0xec, 0x2d, 0x23, 0x40,
+    0x73, 0x97, 0xc6, 0xd5, 0x5f, 0x72, 0x48, 0x3f,
+    0x8c, 0x51, 0xbb, 0x6e, 0x17, 0xfa, 0x4c, 0x55,
+    0x89, 0x3f, 0xea, 0x10, 0x6a, 0x38, 0x52, 0xf3,
+    0x70, 0x6a, 0xef, 0x36, 0x79, 0xf4, 0xd0, 0xa8,
+    0x72, 0x90, 0x50, 0x7b, 0xf4, 0x7e, 0x75, 0x08,
+    0xba, 0xd6, 0x84, 0x42, 0x8f, 0xc9, 0x8f, 0x20,
+    0x26, 0x4d, 0xc9, 0xad, 0xa9, 0xaf, 0x49, 0xad,
+    0x82, 0xd2, 0xe6, 0x3c, 0x52, 0x1a, 0x35, 0x50,
+    0x9f, 0x3e, 0xce, 0x6a, 0xb7, 0x0b, 0x90, 0xc6,
+    0x88, 0xf4, 0x11, 0xf1, 0x53, 0xcf, 0xa9, 0x59,
+    0xe6, 0xe3, 0x87, 0x26, 0x40, 0xdd, 0xf3, 0x95,
+    0x24, 0xa5, 0x18, 0x29, 0xd2, 0x70, 0x1c, 0x35,
+    0x6c, 0x8e, 0xe2, 0xbf, 0xc0, 0x1a, 0xaa, 0x4f,
+    0x4b, 0xd2, 0x1d, 0x7d, 0xb9, 0xb4, 0xc5, 0x48,
+    0x92, 0x16, 0xba, 0x5f, 0x59, 0xe6, 0x5f, 0x0c,
+    0xbe, 0x57, 0xdb, 0x41, 0x2c, 0xc3, 0x49, 0xf1,
+    0x4f, 0x6e, 0x78, 0x8b, 0x2e, 0x3f, 0xc7, 0xd3,
+    0x36, 0x2f, 0x40, 0x8a, 0xc8, 0x5d, 0x1d, 0x2a,
+    0x28, 0x89, 0x2f, 0x47, 0x16, 0x87, 0x13, 0xd9,
+    0xbe, 0x32, 0x76, 0xc7, 0x5e, 0x96, 0x5c, 0xa8,
+    0x91, 0xc7, 0x06, 0x70, 0xc0, 0xa5, 0x37, 0xd4,
+    0x04, 0x01, 0x55, 0x6d, 0xb0, 0xd0, 0x7b, 0x03,
+    0xd0, 0x9f, 0x93, 0xb0, 0x77, 0x6f, 0xc8, 0x8d,
+    0xb6, 0x58, 0xe1, 0x31, 0x3a, 0xb4, 0x37, 0xf2,
+    0x92, 0xca, 0x83, 0x63, 0x57, 0x7b, 0x84, 0xb0,
+    0x83, 0xcb, 0x03, 0x79, 0x30, 0x43, 0x96, 0x6e,
+    0x70, 0x8f, 0x90, 0x0e, 0x9b, 0x53, 0xb6, 0x1f,
+    0x89, 0x1f, 0xc9, 0x46, 0x43, 0x10, 0x5d, 0xbf,
+    0xde, 0xaf, 0xc9, 0xae, 0x2e, 0xa9, 0x16, 0xd3,
+    0xed, 0x30, 0x6a, 0xbf, 0x7f, 0x92, 0x4d, 0xd4,
+    0xb4, 0x31, 0xcc, 0xbd, 0x63, 0x58, 0xc1, 0x6f,
+    0xc8, 0x2c, 0x61, 0x4e, 0xcf, 0xcd, 0xe5, 0x2c,
+    0xff, 0xe7, 0xc6, 0x73, 0xb3, 0xdc, 0x64, 0xa7,
+    0x33, 0x02, 0xde, 0x41, 0x51, 0x7f, 0x2e, 0xf2,
+    0xd6, 0xde, 0x45, 0xf2, 0xbc, 0xb9, 0x7d, 0x2f,
+    0x25, 0x05, 0x52, 0xd3, 0x35, 0x72, 0x80, 0x75,
+    0xe2, 0x96, 0xa7, 0xcb, 0x32, 0x41, 0xb7, 0x2b,
+    0xe9, 0x37, 0x7d, 0x02, 0x0b, 0x57, 0x2e, 0x1e,
+    0xf7, 0x7c, 0x72, 0xf6, 0xdf, 0x0c, 0x50, 0x1f,
+    0x98, 0x23, 0xb8, 0xeb, 0x9d, 0xd3, 0xa3, 0x60,
+    0x07, 0xde, 0xd3, 0xa9, 0x45, 0x0c, 0x89, 0x2a,
+};
+
+#endif /* H_BOOTUTIL_BENCH_VECTORS_H__ */
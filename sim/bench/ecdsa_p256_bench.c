@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Verifies tinycrypt ECDSA P-256 signatures with uECC_verify() and with
+ * uECC_verify_comb() for a range of generator and public key comb table
+ * sizes, after checking that every configuration accepts a valid signature
+ * and rejects a modified one. Public key tables are emitted by imgtool
+ * getpub --comb-teeth; the one of the bootutil benchmark key is checked
+ * against uECC_comb_table() here.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tinycrypt/constants.h>
+#include <tinycrypt/ecc.h>
+#include <tinycrypt/ecc_dh.h>
+#include <tinycrypt/ecc_dsa.h>
+
+#define MCUBOOT_ECDSA_P256_COMB_TEETH 4
+#include "bootutil/crypto/ecdsa_p256_comb.h"
+
+#include "bench.h"
+#include "bootutil_bench_comb.h"
+#include "bootutil_bench_vectors.h"
+
+#define NUM_SIGS 8
+
+struct config {
+    unsigned g_teeth;   /* 0: no generator table */
+    unsigned q_teeth;   /* 0: no public key table */
+};
+
+static const struct config configs[] = {
+    { 0, 0 }, { 4, 0 }, { 6, 0 }, { 8, 0 },
+    { 0, 4 }, { 4, 4 }, { 6, 4 }, { 6, 6 }, { 8, 6 }, { 8, 8 },
+};
+
+static uint8_t public_key[2 * NUM_ECC_BYTES];
+static uint8_t hashes[NUM_SIGS][NUM_ECC_BYTES];
+static uint8_t sigs[NUM_SIGS][2 * NUM_ECC_BYTES];
+
+static uECC_word_t g_tables[uECC_COMB_MAX_TEETH + 1][uECC_COMB_TABLE_WORDS(uECC_COMB_MAX_TEETH)];
+static uECC_word_t q_tables[uECC_COMB_MAX_TEETH + 1][uECC_COMB_TABLE_WORDS(uECC_COMB_MAX_TEETH)];
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s\n", what);
+    exit(1);
+}
+
+static int
+verify(const struct config *c, const uint8_t *hash, const uint8_t *sig)
+{
+    if (c->g_teeth == 0 && c->q_teeth == 0) {
+        return uECC_verify(public_key, hash, NUM_ECC_BYTES, sig, uECC_secp256r1());
+    }
+
+    return uECC_verify_comb(public_key, hash, NUM_ECC_BYTES, sig,
+                            c->g_teeth ? g_tables[c->g_teeth] : NULL, c->g_teeth,
+                            c->q_teeth ? q_tables[c->q_teeth] : NULL, c->q_teeth,
+                            uECC_secp256r1());
+}
+
+static void
+setup(void)
+{
+    uint8_t private_key[NUM_ECC_BYTES];
+    uECC_word_t point[2 * NUM_ECC_WORDS];
+    unsigned teeth;
+    unsigned i;
+
+    if (!uECC_make_key(public_key, private_key, uECC_secp256r1())) {
+        fail("failed to make a key");
+    }
+    for (i = 0; i < NUM_SIGS; i++) {
+        memset(hashes[i], 0x5a + i, sizeof(hashes[i]));
+        hashes[i][0] = i;
+        if (!uECC_sign(private_key, hashes[i], sizeof(hashes[i]), sigs[i],
+                       uECC_secp256r1())) {
+            fail("failed to sign");
+        }
+    }
+
+    uECC_vli_bytesToNative(point, public_key, NUM_ECC_BYTES);
+    uECC_vli_bytesToNative(point + NUM_ECC_WORDS, public_key + NUM_ECC_BYTES,
+                           NUM_ECC_BYTES);
+    for (teeth = 1; teeth <= uECC_COMB_MAX_TEETH; teeth++) {
+        if (!uECC_comb_table(g_tables[teeth], uECC_secp256r1()->G, teeth,
+                             uECC_secp256r1()) ||
+            !uECC_comb_table(q_tables[teeth], point, teeth, uECC_secp256r1())) {
+            fail("failed to compute a comb table");
+        }
+    }
+
+    /* The flash tables are generated separately; they must match. */
+    if (memcmp(g_tables[MCUBOOT_ECDSA_P256_COMB_TEETH], bootutil_ecdsa_p256_g_comb,
+               sizeof(bootutil_ecdsa_p256_g_comb)) != 0) {
+        fail("generated generator table does not match uECC_comb_table()");
+    }
+
+    /* The public key is the one at the end of the DER encoded key. */
+    uECC_vli_bytesToNative(point, bench_ecdsa_p256_pub + sizeof(bench_ecdsa_p256_pub) -
+                           2 * NUM_ECC_BYTES, NUM_ECC_BYTES);
+    uECC_vli_bytesToNative(point + NUM_ECC_WORDS, bench_ecdsa_p256_pub +
+                           sizeof(bench_ecdsa_p256_pub) - NUM_ECC_BYTES, NUM_ECC_BYTES);
+    if (!uECC_comb_table(q_tables[6], point, 6, uECC_secp256r1()) ||
+        memcmp(q_tables[6], bench_ecdsa_p256_pub_comb6,
+               sizeof(bench_ecdsa_p256_pub_comb6)) != 0) {
+        fail("imgtool key table does not match uECC_comb_table()");
+    }
+    uECC_vli_bytesToNative(point, public_key, NUM_ECC_BYTES);
+    uECC_vli_bytesToNative(point + NUM_ECC_WORDS, public_key + NUM_ECC_BYTES,
+                           NUM_ECC_BYTES);
+    if (!uECC_comb_table(q_tables[6], point, 6, uECC_secp256r1())) {
+        fail("failed to compute a comb table");
+    }
+}
+
+static void
+check(const struct config *c)
+{
+    uint8_t bad[NUM_ECC_BYTES];
+    unsigned i;
+
+    for (i = 0; i < NUM_SIGS; i++) {
+        if (verify(c, hashes[i], sigs[i]) != TC_CRYPTO_SUCCESS) {
+            fail("valid signature rejected");
+        }
+        memcpy(bad, hashes[i], sizeof(bad));
+        bad[NUM_ECC_BYTES - 1] ^= 1;
+        if (verify(c, bad, sigs[i]) == TC_CRYPTO_SUCCESS) {
+            fail("invalid signature accepted");
+        }
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 400);
+    char variant[32];
+    uint64_t start;
+    uint64_t ns;
+    size_t c;
+    unsigned i;
+
+    setup();
+    bench_header();
+
+    for (c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+        check(&configs[c]);
+
+        snprintf(variant, sizeof(variant), "g%u_q%u", configs[c].g_teeth,
+                 configs[c].q_teeth);
+        start = bench_now_ns();
+        for (i = 0; i < iters; i++) {
+            if (verify(&configs[c], hashes[i % NUM_SIGS], sigs[i % NUM_SIGS]) !=
+                TC_CRYPTO_SUCCESS) {
+                fail("valid signature rejected");
+            }
+        }
+        ns = bench_now_ns() - start;
+        bench_report("ecdsa_p256_verify", variant, iters, 0, ns);
+    }
+
+    return 0;
+}
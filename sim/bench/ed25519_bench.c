@@ -0,0 +1,236 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Verifies the RFC 8032 Ed25519 test vectors with the fiat backend, after
+ * checking that they are accepted and that modified messages are rejected,
+ * also when the message is read in chunks by ED25519_verify_read().
+ * With MCUBOOT_ED25519_KEY_POINT, the keys are given with their x
+ * coordinates, as imgtool stores them in the key table.
+ * It is built once per configuration of the backend, named by
+ * BENCH_VARIANT; see CMakeLists.txt.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+extern int ED25519_verify(const uint8_t *message, size_t message_len,
+                          const uint8_t signature[64], const uint8_t public_key[32]);
+extern int ED25519_verify_read(int (*read)(void *arg, size_t off, uint8_t *buf,
+                                           size_t len),
+                               void *arg, size_t message_len, uint8_t *buf,
+                               size_t buf_len, const uint8_t signature[64],
+                               const uint8_t public_key[32]);
+extern int ED25519_verify_key(const uint8_t *message, size_t message_len,
+                              const uint8_t signature[64],
+                              const uint8_t public_key[32],
+                              const uint8_t public_key_x[32]);
+extern int ED25519_verify_read_key(int (*read)(void *arg, size_t off,
+                                               uint8_t *buf, size_t len),
+                                   void *arg, size_t message_len, uint8_t *buf,
+                                   size_t buf_len, const uint8_t signature[64],
+                                   const uint8_t public_key[32],
+                                   const uint8_t public_key_x[32]);
+
+struct vector {
+    const char *public_key;
+    const char *public_key_x;
+    const char *message;
+    const char *signature;
+};
+
+/* RFC 8032, section 7.1, tests 1 to 3. */
+static const struct vector vectors[] = {
+    {
+        "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a",
+        "ce457677bd8627b1247c185372d413c520f6d0608de0972229349d2b9ae0d055",
+        "",
+        "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e06522490155"
+        "5fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b",
+    },
+    {
+        "3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c",
+        "ae43de571ee04a246f09a5b61ff98580524e8685653e81c04b384f5b2028ad74",
+        "72",
+        "92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da"
+        "085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00",
+    },
+    {
+        "fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025",
+        "02bdcd8654ffa945b9e9e334176f23189885cf8db4d1653f83689ddca23a2161",
+        "af82",
+        "6291d657deec24024827e69c3abe01a30ce548a284743a445e3680d7db5ac3ac"
+        "18ff9b538d16f290ae67f760984dc6594a7c15e9716ed28dc027beceea1ec40a",
+    },
+};
+
+#define NUM_VECTORS (sizeof(vectors) / sizeof(vectors[0]))
+
+struct decoded {
+    uint8_t public_key[32];
+    uint8_t public_key_x[32];
+    uint8_t message[8];
+    size_t message_len;
+    uint8_t signature[64];
+};
+
+static struct decoded decoded[NUM_VECTORS];
+
+static size_t
+unhex(uint8_t *out, size_t max, const char *hex)
+{
+    size_t n = 0;
+
+    while (hex[0] && hex[1] && n < max) {
+        unsigned v;
+
+        sscanf(hex, "%2x", &v);
+        out[n++] = (uint8_t)v;
+        hex += 2;
+    }
+
+    return n;
+}
+
+#ifdef MCUBOOT_ED25519_KEY_POINT
+#define VERIFY(d, message, len) \
+    ED25519_verify_key((message), (len), (d)->signature, (d)->public_key, \
+                       (d)->public_key_x)
+#define VERIFY_READ(d, read, arg, len, buf, buf_len) \
+    ED25519_verify_read_key((read), (arg), (len), (buf), (buf_len), \
+                            (d)->signature, (d)->public_key, (d)->public_key_x)
+#else
+#define VERIFY(d, message, len) \
+    ED25519_verify((message), (len), (d)->signature, (d)->public_key)
+#define VERIFY_READ(d, read, arg, len, buf, buf_len) \
+    ED25519_verify_read((read), (arg), (len), (buf), (buf_len), \
+                        (d)->signature, (d)->public_key)
+#endif
+
+/* Hands out the message one byte short of what is asked for, if possible. */
+static int
+read_message(void *arg, size_t off, uint8_t *buf, size_t len)
+{
+    const uint8_t *message = arg;
+
+    if (len > 1) {
+        len--;
+    }
+    memcpy(buf, message + off, len);
+
+    return (int)len;
+}
+
+static int
+read_error(void *arg, size_t off, uint8_t *buf, size_t len)
+{
+    (void)arg;
+    (void)off;
+    (void)buf;
+    (void)len;
+
+    return -1;
+}
+
+#ifdef MCUBOOT_ED25519_KEY_POINT
+/* out = 2^255 - 19 - x, for x in little-endian order. */
+static void
+negate_x(uint8_t out[32], const uint8_t x[32])
+{
+    int borrow = 0;
+    int i;
+
+    for (i = 0; i < 32; i++) {
+        int p = i == 0 ? 0xed : (i == 31 ? 0x7f : 0xff);
+        int v = p - x[i] - borrow;
+
+        borrow = v < 0;
+        out[i] = (uint8_t)(v + (borrow ? 256 : 0));
+    }
+}
+#endif
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s\n", what);
+    exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 2000);
+    uint64_t start;
+    uint64_t ns;
+    unsigned i;
+
+    for (i = 0; i < NUM_VECTORS; i++) {
+        struct decoded *d = &decoded[i];
+        uint8_t bad[8];
+#ifdef MCUBOOT_ED25519_KEY_POINT
+        uint8_t neg_x[32];
+#endif
+
+        unhex(d->public_key, sizeof(d->public_key), vectors[i].public_key);
+        unhex(d->public_key_x, sizeof(d->public_key_x), vectors[i].public_key_x);
+        d->message_len = unhex(d->message, sizeof(d->message), vectors[i].message);
+        unhex(d->signature, sizeof(d->signature), vectors[i].signature);
+
+        if (!VERIFY(d, d->message, d->message_len)) {
+            fail("valid signature rejected");
+        }
+        if (!VERIFY_READ(d, read_message, d->message, d->message_len, bad, 1) ||
+            !VERIFY_READ(d, read_message, d->message, d->message_len, bad,
+                         sizeof(bad))) {
+            fail("valid signature rejected when read in chunks");
+        }
+        if (d->message_len &&
+            VERIFY_READ(d, read_error, NULL, d->message_len, bad, sizeof(bad))) {
+            fail("signature accepted despite read error");
+        }
+        memcpy(bad, d->message, sizeof(bad));
+        bad[0] ^= 1;
+        if (VERIFY(d, bad, d->message_len ? d->message_len : 1)) {
+            fail("invalid signature accepted");
+        }
+#ifdef MCUBOOT_ED25519_KEY_POINT
+        /* The negated point, which is still on the curve, and a point that
+         * is not on it must both be rejected.
+         */
+        negate_x(neg_x, d->public_key_x);
+        if (ED25519_verify_key(d->message, d->message_len, d->signature,
+                               d->public_key, neg_x)) {
+            fail("signature accepted with the negated key point");
+        }
+        memcpy(neg_x, d->public_key_x, sizeof(neg_x));
+        neg_x[0] ^= 2;
+        if (ED25519_verify_key(d->message, d->message_len, d->signature,
+                               d->public_key, neg_x)) {
+            fail("signature accepted with a key point off the curve");
+        }
+#endif
+    }
+
+    bench_header();
+
+    /* The same key over and over, as when verifying images at boot. */
+    start = bench_now_ns();
+    for (i = 0; i < iters; i++) {
+        if (!VERIFY(&decoded[0], decoded[0].message, decoded[0].message_len)) {
+            fail("valid signature rejected");
+        }
+    }
+    ns = bench_now_ns() - start;
+    bench_report("ed25519_verify", BENCH_VARIANT, iters, 0, ns);
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Erases ranges of a slot through boot_erase_region() on a modelled SPI NOR
+ * device with 4 KiB sectors and 32 KiB and 64 KiB erase blocks, and reports
+ * the device time the erase commands issued would take, from the typical
+ * timings of such parts. Built with MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS the
+ * blocks are advertised to bootutil, without it everything is erased sector
+ * by sector.
+ *
+ * Each row is one boot_erase_region() call: "ns_per_op" is the modelled
+ * erase time of the whole range, "mib_per_s" the resulting throughput.
+ * Every run also checks that exactly the sectors overlapping the range were
+ * erased.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bootutil_area.h"
+
+#include "bench.h"
+#include "bench_flash.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+#define BENCH_SECTOR_SIZE  0x1000
+#define BENCH_DEVICE_SIZE  0x100000
+
+/* Typical erase times of a 4 KiB sector and of 32 KiB and 64 KiB blocks. */
+#define BENCH_SECTOR_NS    45000000ull
+#define BENCH_BLOCK32_NS   120000000ull
+#define BENCH_BLOCK64_NS   150000000ull
+
+static uint8_t bench_flash[BENCH_DEVICE_SIZE];
+
+/* Accepts exactly the commands the modelled device has. */
+static uint64_t
+bench_erase_cmd_ns(uint32_t off, uint32_t len)
+{
+    if (len == BENCH_SECTOR_SIZE && off % BENCH_SECTOR_SIZE == 0) {
+        return BENCH_SECTOR_NS;
+    } else if (len == 0x8000 && off % 0x8000 == 0) {
+        return BENCH_BLOCK32_NS;
+    } else if (len == 0x10000 && off % 0x10000 == 0) {
+        return BENCH_BLOCK64_NS;
+    }
+
+    return 0;
+}
+
+static const struct bench_flash_device bench_device = {
+    .data = bench_flash,
+    .size = BENCH_DEVICE_SIZE,
+    .sector_size = BENCH_SECTOR_SIZE,
+    .erase_cmd_ns = bench_erase_cmd_ns,
+};
+
+/* A 448 KiB slot placed after a 68 KiB boot loader, not block aligned. */
+static const struct flash_area bench_area = {
+    .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
+    .fa_device_id = FLASH_DEVICE_ID,
+    .fa_off = 0x11000,
+    .fa_size = 0x70000,
+};
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s: %s\n", BENCH_VARIANT, what);
+    exit(1);
+}
+
+int
+sim_log_enabled(int level)
+{
+    (void)level;
+    return 0;
+}
+
+uint32_t
+flash_area_erase_blocks(const struct flash_area *fa)
+{
+    (void)fa;
+    return 0x8000 | 0x10000;
+}
+
+struct range {
+    const char *name;
+    uint32_t off;
+    uint32_t size;
+    bool backwards;
+};
+
+static const struct range ranges[] = {
+    /* Whole slot, as when it is scrambled or overwritten. */
+    { "slot", 0, 0x70000, false },
+    { "slot_backwards", 0, 0x70000, true },
+    /* An image not ending on a sector boundary. */
+    { "image", 0, 0x4c321, false },
+    /* The status area at the end of the slot. */
+    { "trailer", 0x6d000, 0x3000, true },
+};
+
+static void
+check(const struct range *r)
+{
+    uint32_t first = flash_area_get_off(&bench_area) + r->off;
+    uint32_t last = first + r->size - 1;
+    uint32_t i;
+    bool in_range;
+
+    first &= ~(uint32_t)(BENCH_SECTOR_SIZE - 1);
+    last |= BENCH_SECTOR_SIZE - 1;
+
+    for (i = 0; i < BENCH_DEVICE_SIZE; i++) {
+        in_range = i >= first && i <= last;
+        if (in_range != (bench_flash[i] == 0xff)) {
+            fail(in_range ? "range not erased" : "erased outside of the range");
+        }
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    char variant[64];
+    const struct range *r;
+    size_t i;
+
+    (void)argc;
+    (void)argv;
+
+    bench_flash_init(&bench_device, 1, &bench_area, 1, NULL);
+
+    bench_header();
+
+    for (i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+        r = &ranges[i];
+
+        memset(bench_flash, 0, sizeof(bench_flash));
+        bench_flash_clear();
+
+        if (boot_erase_region(&bench_area, r->off, r->size, r->backwards) != 0) {
+            fail("boot_erase_region failed");
+        }
+        check(r);
+
+        snprintf(variant, sizeof(variant), "%s_%s_%u_cmds", r->name,
+                 BENCH_VARIANT, bench_flash_erases);
+        bench_report("erase_region", variant, 1, r->size, bench_flash_ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Runs the small metadata reads bootutil makes while deciding what to boot,
+ * reading a slot trailer with boot_read_swap_state() and walking the TLVs
+ * of an image with bootutil_tlv_iter_next(), against a modelled external
+ * SPI NOR flash where every read command costs a fixed overhead on top of
+ * the transfer. Built with MCUBOOT_FLASH_READ_CACHE the reads go through
+ * the bootutil read cache, without it each one reaches the device.
+ *
+ * Each row is one pass over the metadata: "ns_per_op" is the modelled
+ * device time of the reads issued, whose number is part of the variant,
+ * together with the cache hits and misses when the cache is built in.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The flash functions of bench_flash.c are the backend the cache reads
+ * through.
+ */
+#define BOOTUTIL_FLASH_CACHE_BACKEND
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bootutil/bootutil_public.h"
+#include "bootutil/image.h"
+#include "bootutil_priv.h"
+
+#include "bench.h"
+#include "bench_flash.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+/* Command, address and dummy cycles of a read, and the transfer of a byte
+ * over a quad SPI bus at 40 MHz.
+ */
+#define BENCH_READ_CMD_NS  2000ull
+#define BENCH_READ_BYTE_NS 50ull
+
+#define BENCH_SLOT_SIZE    0x20000
+#define BENCH_IMAGE_SIZE   0x10000
+#define BENCH_TLV_COUNT    12
+
+static uint8_t bench_flash[BENCH_SLOT_SIZE];
+
+static const struct bench_flash_device bench_device = {
+    .data = bench_flash,
+    .size = BENCH_SLOT_SIZE,
+    .sector_size = 0x1000,
+    .read_cmd_ns = BENCH_READ_CMD_NS,
+    .read_byte_ns = BENCH_READ_BYTE_NS,
+};
+
+static const struct flash_area bench_area = {
+    .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
+    .fa_device_id = FLASH_DEVICE_ID,
+    .fa_off = 0,
+    .fa_size = BENCH_SLOT_SIZE,
+};
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s: %s\n", BENCH_VARIANT, what);
+    exit(1);
+}
+
+int
+sim_log_enabled(int level)
+{
+    (void)level;
+    return 0;
+}
+
+/*
+ * A confirmed image with BENCH_TLV_COUNT small TLVs, and a trailer holding
+ * the magic and the image-ok flag.
+ */
+static void
+build_slot(struct image_header *hdr)
+{
+    struct image_tlv_info info;
+    struct image_tlv tlv;
+    uint8_t *tlvs;
+    uint8_t *p;
+    int i;
+
+    memset(bench_flash, 0xff, sizeof(bench_flash));
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->ih_magic = IMAGE_MAGIC;
+    hdr->ih_hdr_size = IMAGE_HEADER_SIZE;
+    hdr->ih_img_size = BENCH_IMAGE_SIZE;
+    memcpy(bench_flash, hdr, sizeof(*hdr));
+
+    tlvs = &bench_flash[IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE];
+    p = tlvs + sizeof(info);
+    for (i = 0; i < BENCH_TLV_COUNT; i++) {
+        tlv.it_type = (uint16_t)(0x70 + i);
+        tlv.it_len = (uint16_t)(4 + 4 * i);
+        memcpy(p, &tlv, sizeof(tlv));
+        memset(p + sizeof(tlv), i, tlv.it_len);
+        p += sizeof(tlv) + tlv.it_len;
+    }
+    info.it_magic = IMAGE_TLV_INFO_MAGIC;
+    info.it_tlv_tot = (uint16_t)(p - tlvs);
+    memcpy(tlvs, &info, sizeof(info));
+
+    if (boot_write_magic(&bench_area) != 0 ||
+        boot_write_image_ok(&bench_area) != 0) {
+        fail("writing the trailer failed");
+    }
+}
+
+/* What bootutil reads of a slot on a plain boot: the trailer state, then
+ * the TLVs once for each kind of TLV validation looks up.
+ */
+static void
+read_metadata(const struct image_header *hdr)
+{
+    static const uint16_t types[] = { 0x70, 0x75, 0x7b };
+    struct boot_swap_state swap_state;
+    struct image_tlv_iter it;
+    uint32_t off;
+    uint16_t len;
+    uint16_t type;
+    unsigned found;
+    size_t i;
+
+    if (boot_read_swap_state(&bench_area, &swap_state) != 0 ||
+        swap_state.magic != BOOT_MAGIC_GOOD ||
+        swap_state.image_ok != BOOT_FLAG_SET) {
+        fail("trailer not read back");
+    }
+
+    for (i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+        if (bootutil_tlv_iter_begin(&it, hdr, &bench_area, types[i], false) != 0) {
+            fail("TLV area not found");
+        }
+        found = 0;
+        while (bootutil_tlv_iter_next(&it, &off, &len, &type) == 0) {
+            found++;
+        }
+        if (found != 1) {
+            fail("TLV not found");
+        }
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 1000);
+    struct image_header hdr;
+    char variant[96];
+    unsigned reads;
+    unsigned k;
+
+    bench_flash_init(&bench_device, 1, &bench_area, 1, NULL);
+    build_slot(&hdr);
+
+    bench_header();
+
+    bench_flash_clear();
+    for (k = 0; k < iters; k++) {
+        boot_flash_cache_invalidate();
+        read_metadata(&hdr);
+    }
+    reads = bench_flash_reads / iters;
+
+#if defined(MCUBOOT_FLASH_READ_CACHE)
+    {
+        uint32_t hits;
+        uint32_t misses;
+
+        boot_flash_cache_stats(&hits, &misses);
+        snprintf(variant, sizeof(variant), "%s_%u_reads_%u_hits_%u_misses",
+                 BENCH_VARIANT, reads, (unsigned)(hits / iters),
+                 (unsigned)(misses / iters));
+    }
+#else
+    snprintf(variant, sizeof(variant), "%s_%u_reads", BENCH_VARIANT, reads);
+#endif
+    bench_report("read_metadata", variant, iters, 0, bench_flash_ns);
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Hashes an image sized buffer with the tinycrypt SHA-256 and with the
+ * BLAKE2s of bootutil, fed in chunks of BOOT_TMPBUF_SZ bytes as
+ * bootutil_img_hash() reads them from flash, after checking both against
+ * known answers.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tinycrypt/sha256.h>
+
+#include "bootutil/crypto/blake2s.h"
+
+#include "bench.h"
+
+#define IMAGE_SIZE (256 * 1024)
+#define CHUNK_SIZE 256
+
+static uint8_t image[IMAGE_SIZE];
+
+/* SHA-256("abc") and BLAKE2s-256("abc"). */
+static const uint8_t sha256_abc[32] = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+    0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+    0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+    0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+};
+
+static const uint8_t blake2s_abc[32] = {
+    0x50, 0x8c, 0x5e, 0x8c, 0x32, 0x7c, 0x14, 0xe2,
+    0xe1, 0xa7, 0x2b, 0xa3, 0x4e, 0xeb, 0x45, 0x2f,
+    0x37, 0x45, 0x8b, 0x20, 0x9e, 0xd6, 0x3a, 0x29,
+    0x4d, 0x99, 0x9b, 0x4c, 0x86, 0x67, 0x59, 0x82,
+};
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s\n", what);
+    exit(1);
+}
+
+static void
+sha256(const uint8_t *data, size_t len, size_t chunk, uint8_t *out)
+{
+    struct tc_sha256_state_struct ctx;
+    size_t off;
+    size_t n;
+
+    tc_sha256_init(&ctx);
+    for (off = 0; off < len; off += n) {
+        n = len - off < chunk ? len - off : chunk;
+        tc_sha256_update(&ctx, data + off, n);
+    }
+    tc_sha256_final(out, &ctx);
+}
+
+static void
+blake2s(const uint8_t *data, size_t len, size_t chunk, uint8_t *out)
+{
+    bootutil_blake2s_context ctx;
+    size_t off;
+    size_t n;
+
+    bootutil_blake2s_init(&ctx);
+    for (off = 0; off < len; off += n) {
+        n = len - off < chunk ? len - off : chunk;
+        bootutil_blake2s_update(&ctx, data + off, (uint32_t)n);
+    }
+    bootutil_blake2s_finish(&ctx, out);
+}
+
+static void
+check(void)
+{
+    uint8_t a[32];
+    uint8_t b[32];
+    size_t chunk;
+
+    sha256((const uint8_t *)"abc", 3, 3, a);
+    blake2s((const uint8_t *)"abc", 3, 3, b);
+    if (memcmp(a, sha256_abc, 32) != 0 || memcmp(b, blake2s_abc, 32) != 0) {
+        fail("wrong digest of \"abc\"");
+    }
+
+    /* The split into updates must not change the BLAKE2s digest. */
+    blake2s(image, 4097, 4097, a);
+    for (chunk = 1; chunk <= 129; chunk++) {
+        blake2s(image, 4097, chunk, b);
+        if (memcmp(a, b, 32) != 0) {
+            fail("BLAKE2s digest depends on the update sizes");
+        }
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 20);
+    uint8_t digest[32];
+    uint64_t start;
+    size_t i;
+    unsigned k;
+
+    for (i = 0; i < IMAGE_SIZE; i++) {
+        image[i] = (uint8_t)(i * 7 + (i >> 11));
+    }
+
+    check();
+    bench_header();
+
+    start = bench_now_ns();
+    for (k = 0; k < iters; k++) {
+        sha256(image, IMAGE_SIZE, CHUNK_SIZE, digest);
+    }
+    bench_report("image_hash", "sha256_tinycrypt", iters, IMAGE_SIZE,
+                 bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (k = 0; k < iters; k++) {
+        blake2s(image, IMAGE_SIZE, CHUNK_SIZE, digest);
+    }
+    bench_report("image_hash", "blake2s", iters, IMAGE_SIZE,
+                 bench_now_ns() - start);
+
+    return 0;
+}
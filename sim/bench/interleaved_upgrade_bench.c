@@ -0,0 +1,243 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Runs boot_go() on an overwrite-only upgrade of two images against a timing
+ * model of three flash devices (see bench_flash.h): image 0 on the internal
+ * flash of the application core, image 1 on the internal flash of the
+ * network core, and both secondary slots on an external quad SPI NOR flash.
+ * With MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC, the upgrade erases through
+ * flash_area_erase_start(), which lets the clock move on while the device
+ * is busy.
+ *
+ * Built with MCUBOOT_INTERLEAVED_UPGRADE the images are overwritten by the
+ * interleaving scheduler, without it one after the other. Each row is one
+ * boot: "ns_per_op" is the modelled duration of the whole boot, upgrade
+ * included. Every run also checks that both primary slots hold the new
+ * images afterwards.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The flash functions of bench_flash.c are the backend bootutil reads
+ * through.
+ */
+#define BOOTUTIL_FLASH_CACHE_BACKEND
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bootutil/bootutil.h"
+#include "bootutil/bootutil_public.h"
+#include "bootutil/image.h"
+#include "bootutil/fault_injection_hardening.h"
+#include "bootutil/crypto/sha.h"
+#include "bootutil_priv.h"
+
+#include "bench.h"
+#include "bench_flash.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+#define BENCH_SECTOR_SIZE  0x1000
+#define BENCH_SLOT_SIZE    0x20000
+#define BENCH_IMAGE_SIZE   0x18000
+#define BENCH_DEVICES      3
+#define BENCH_DEVICE_SIZE  (2 * BENCH_SLOT_SIZE)
+
+static uint8_t bench_flash[BENCH_DEVICES][BENCH_DEVICE_SIZE];
+
+/* Typical timings: internal flash, then quad SPI NOR flash at 40 MHz. */
+static const struct bench_flash_device bench_devices[BENCH_DEVICES] = {
+    {
+        .data = bench_flash[0],
+        .size = BENCH_DEVICE_SIZE,
+        .sector_size = BENCH_SECTOR_SIZE,
+        .read_byte_ns = 20,
+        .prog_byte_ns = 2500,
+        .erase_ns = 40000000ull,
+    },
+    {
+        .data = bench_flash[1],
+        .size = BENCH_DEVICE_SIZE,
+        .sector_size = BENCH_SECTOR_SIZE,
+        .read_byte_ns = 20,
+        .prog_byte_ns = 2500,
+        .erase_ns = 40000000ull,
+    },
+    {
+        .data = bench_flash[2],
+        .size = BENCH_DEVICE_SIZE,
+        .sector_size = BENCH_SECTOR_SIZE,
+        .read_cmd_ns = 2000,
+        .read_byte_ns = 50,
+        .prog_byte_ns = 2700,
+        .erase_ns = 45000000ull,
+    },
+};
+
+static const struct flash_area bench_areas[] = {
+    {
+        .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
+        .fa_device_id = 0,
+        .fa_off = 0,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_SECONDARY(0),
+        .fa_device_id = 2,
+        .fa_off = 0,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_PRIMARY(1),
+        .fa_device_id = 1,
+        .fa_off = 0,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_SECONDARY(1),
+        .fa_device_id = 2,
+        .fa_off = BENCH_SLOT_SIZE,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+};
+
+#define BENCH_AREAS (sizeof(bench_areas) / sizeof(bench_areas[0]))
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s: %s\n", BENCH_VARIANT, what);
+    exit(1);
+}
+
+int
+sim_log_enabled(int level)
+{
+    (void)level;
+    return 0;
+}
+
+void
+sim_assert(int x, const char *assertion, const char *file, unsigned int line,
+           const char *function)
+{
+    if (!x) {
+        fprintf(stderr, "%s: assertion %s failed in %s at %s:%u\n", BENCH_VARIANT,
+                assertion, function, file, line);
+        exit(1);
+    }
+}
+
+/* An image with a SHA-256 TLV in the secondary slot of each image, marked
+ * for upgrade, and nothing in the primary slots.
+ */
+static void
+build_slots(void)
+{
+    bootutil_sha_context sha;
+    struct image_header hdr;
+    struct image_tlv_info info;
+    struct image_tlv tlv;
+    const struct flash_area *fa;
+    uint8_t *p;
+    size_t image;
+    uint32_t i;
+
+    memset(bench_flash, 0xff, sizeof(bench_flash));
+
+    for (image = 0; image < BOOT_IMAGE_NUMBER; image++) {
+        fa = &bench_areas[2 * image + 1];
+        p = bench_flash_data(fa, 0, BENCH_SLOT_SIZE);
+
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.ih_magic = IMAGE_MAGIC;
+        hdr.ih_hdr_size = IMAGE_HEADER_SIZE;
+        hdr.ih_img_size = BENCH_IMAGE_SIZE;
+        hdr.ih_ver.iv_major = 1;
+        memcpy(p, &hdr, sizeof(hdr));
+        for (i = 0; i < BENCH_IMAGE_SIZE; i++) {
+            p[IMAGE_HEADER_SIZE + i] = (uint8_t)(i * 7 + image);
+        }
+
+        p += IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE;
+        info.it_magic = IMAGE_TLV_INFO_MAGIC;
+        info.it_tlv_tot = sizeof(info) + sizeof(tlv) + 32;
+        memcpy(p, &info, sizeof(info));
+        tlv.it_type = IMAGE_TLV_SHA256;
+        tlv.it_len = 32;
+        memcpy(p + sizeof(info), &tlv, sizeof(tlv));
+
+        bootutil_sha_init(&sha);
+        bootutil_sha_update(&sha, bench_flash_data(fa, 0, 1), IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE);
+        bootutil_sha_finish(&sha, p + sizeof(info) + sizeof(tlv));
+        bootutil_sha_drop(&sha);
+
+        if (boot_write_magic(fa) != 0) {
+            fail("marking the upgrade failed");
+        }
+    }
+}
+
+/* The upgrade removes the secondary headers, so compare with the images
+ * build_slots() wrote.
+ */
+static void
+check_slots(void)
+{
+    const struct image_header *hdr;
+    const uint8_t *p;
+    size_t image;
+    uint32_t i;
+
+    for (image = 0; image < BOOT_IMAGE_NUMBER; image++) {
+        p = bench_flash_data(&bench_areas[2 * image], 0, BENCH_SLOT_SIZE);
+        hdr = (const struct image_header *)p;
+        if (hdr->ih_magic != IMAGE_MAGIC || hdr->ih_img_size != BENCH_IMAGE_SIZE) {
+            fail("image not copied to the primary slot");
+        }
+        for (i = 0; i < BENCH_IMAGE_SIZE; i++) {
+            if (p[IMAGE_HEADER_SIZE + i] != (uint8_t)(i * 7 + image)) {
+                fail("image not copied to the primary slot");
+            }
+        }
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 300);
+    struct boot_rsp rsp;
+    uint64_t total_ns = 0;
+    unsigned k;
+    FIH_DECLARE(fih_rc, FIH_FAILURE);
+
+    bench_flash_init(bench_devices, BENCH_DEVICES, bench_areas, BENCH_AREAS, NULL);
+
+    bench_header();
+
+    for (k = 0; k < iters; k++) {
+        build_slots();
+
+        bench_flash_clear();
+        FIH_CALL(boot_go, fih_rc, &rsp);
+        if (FIH_NOT_EQ(fih_rc, FIH_SUCCESS)) {
+            fail("boot_go failed");
+        }
+        total_ns += bench_flash_ns;
+
+        check_slots();
+    }
+
+    bench_report("upgrade_two_images", BENCH_VARIANT, iters, 0, total_ns);
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Runs the metadata reads of a boot deciding what to do with two images,
+ * the header and trailer state of each slot and of the scratch area, with
+ * image 0 and the scratch area on internal flash and image 1 on a modelled
+ * external SPI NOR flash. Built with MCUBOOT_METADATA_PREFETCH the reads
+ * are served from the table boot_metadata_prefetch() fills in one pass,
+ * without it each one reaches the device.
+ *
+ * Each row is one boot: "ns_per_op" is the modelled device time of the
+ * reads issued, whose number is part of the variant.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The flash functions of bench_flash.c are the backend the table is read
+ * through.
+ */
+#define BOOTUTIL_FLASH_CACHE_BACKEND
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bootutil/bootutil_public.h"
+#include "bootutil/image.h"
+#include "bootutil_priv.h"
+
+#include "bench.h"
+#include "bench_flash.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+/* Cost of a read command and of a byte transferred: a memory mapped
+ * internal flash, and an external quad SPI flash at 40 MHz.
+ */
+#define BENCH_INT_READ_CMD_NS  100ull
+#define BENCH_INT_READ_BYTE_NS 2ull
+#define BENCH_EXT_READ_CMD_NS  2000ull
+#define BENCH_EXT_READ_BYTE_NS 50ull
+
+#define BENCH_SLOT_SIZE    0x8000
+#define BENCH_DEVICES      2
+
+static uint8_t bench_flash[BENCH_DEVICES][4 * BENCH_SLOT_SIZE];
+
+static const struct bench_flash_device bench_devices[BENCH_DEVICES] = {
+    {
+        .data = bench_flash[0],
+        .size = sizeof(bench_flash[0]),
+        .sector_size = 0x1000,
+        .read_cmd_ns = BENCH_INT_READ_CMD_NS,
+        .read_byte_ns = BENCH_INT_READ_BYTE_NS,
+    },
+    {
+        .data = bench_flash[1],
+        .size = sizeof(bench_flash[1]),
+        .sector_size = 0x1000,
+        .read_cmd_ns = BENCH_EXT_READ_CMD_NS,
+        .read_byte_ns = BENCH_EXT_READ_BYTE_NS,
+    },
+};
+
+static const struct flash_area bench_areas[] = {
+    {
+        .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
+        .fa_device_id = 0,
+        .fa_off = 0,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_SECONDARY(0),
+        .fa_device_id = 0,
+        .fa_off = BENCH_SLOT_SIZE,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_PRIMARY(1),
+        .fa_device_id = 1,
+        .fa_off = 0,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_SECONDARY(1),
+        .fa_device_id = 1,
+        .fa_off = BENCH_SLOT_SIZE,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_SCRATCH,
+        .fa_device_id = 0,
+        .fa_off = 2 * BENCH_SLOT_SIZE,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+};
+
+#define BENCH_AREAS (sizeof(bench_areas) / sizeof(bench_areas[0]))
+
+/* How bootutil's flash_area_read() reads, redirected or not. */
+#if defined(MCUBOOT_METADATA_PREFETCH)
+#define bench_boot_read boot_flash_cache_read
+#else
+#define bench_boot_read flash_area_read
+#endif
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s: %s\n", BENCH_VARIANT, what);
+    exit(1);
+}
+
+int
+sim_log_enabled(int level)
+{
+    (void)level;
+    return 0;
+}
+
+/* Confirmed images in the primary slots, nothing in the secondary slots. */
+static void
+build_slots(struct boot_loader_state *state)
+{
+    struct image_header hdr;
+    size_t image;
+
+    memset(bench_flash, 0xff, sizeof(bench_flash));
+    memset(state, 0, sizeof(*state));
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.ih_magic = IMAGE_MAGIC;
+    hdr.ih_hdr_size = IMAGE_HEADER_SIZE;
+    hdr.ih_img_size = BENCH_SLOT_SIZE / 2;
+
+    for (image = 0; image < BOOT_IMAGE_NUMBER; image++) {
+        state->imgs[image][BOOT_SLOT_PRIMARY].area = &bench_areas[2 * image];
+        state->imgs[image][BOOT_SLOT_SECONDARY].area = &bench_areas[2 * image + 1];
+
+        memcpy(bench_flash_data(&bench_areas[2 * image], 0, sizeof(hdr)), &hdr, sizeof(hdr));
+        if (boot_write_magic(&bench_areas[2 * image]) != 0 ||
+            boot_write_image_ok(&bench_areas[2 * image]) != 0) {
+            fail("writing the trailer failed");
+        }
+    }
+    state->scratch.area = &bench_areas[4];
+}
+
+/* What the boot reads of each slot before an upgrade decision: the header,
+ * then the trailer state; then the scratch trailer to look for an
+ * interrupted swap.
+ */
+static void
+read_metadata(struct boot_loader_state *state)
+{
+    struct boot_swap_state swap_state;
+    struct image_header hdr;
+    const struct flash_area *fa;
+    size_t image;
+    size_t slot;
+
+    for (image = 0; image < BOOT_IMAGE_NUMBER; image++) {
+        for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+            fa = state->imgs[image][slot].area;
+
+            if (bench_boot_read(fa, 0, &hdr, sizeof(hdr)) != 0) {
+                fail("header not read");
+            }
+            if (boot_read_swap_state(fa, &swap_state) != 0) {
+                fail("trailer not read");
+            }
+            if (slot == BOOT_SLOT_PRIMARY &&
+                (hdr.ih_magic != IMAGE_MAGIC || swap_state.magic != BOOT_MAGIC_GOOD ||
+                 swap_state.image_ok != BOOT_FLAG_SET)) {
+                fail("primary slot not read back");
+            }
+        }
+    }
+
+    if (boot_read_swap_state(state->scratch.area, &swap_state) != 0 ||
+        swap_state.magic == BOOT_MAGIC_GOOD) {
+        fail("scratch trailer not read back");
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    static struct boot_loader_state state;
+    unsigned iters = bench_iterations(argc, argv, 1000);
+    char variant[96];
+    unsigned k;
+
+    bench_flash_init(bench_devices, BENCH_DEVICES, bench_areas, BENCH_AREAS, NULL);
+    build_slots(&state);
+
+    bench_header();
+
+    bench_flash_clear();
+    for (k = 0; k < iters; k++) {
+        boot_flash_cache_invalidate();
+        boot_metadata_prefetch(&state);
+        read_metadata(&state);
+        boot_metadata_drop();
+    }
+
+    snprintf(variant, sizeof(variant), "%s_%u_reads", BENCH_VARIANT,
+             bench_flash_reads / iters);
+    bench_report("boot_metadata", variant, iters, 0, bench_flash_ns);
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host stand-in for the NuttX configuration and the few definitions of the
+ * NuttX headers the MCUboot port uses, so that its flash map backend builds
+ * for nuttx_flash_bench. The slots are files on the host, see the bench.
+ */
+
+#ifndef H_SIM_BENCH_NUTTX_CONFIG_H__
+#define H_SIM_BENCH_NUTTX_CONFIG_H__
+
+#include <assert.h>
+
+extern char bench_mtd_primary[];
+extern char bench_mtd_secondary[];
+extern char bench_mtd_scratch[];
+
+#define CONFIG_MCUBOOT_PRIMARY_SLOT_PATH          bench_mtd_primary
+#define CONFIG_MCUBOOT_SECONDARY_SLOT_PATH        bench_mtd_secondary
+#define CONFIG_MCUBOOT_SCRATCH_PATH               bench_mtd_scratch
+#define CONFIG_MCUBOOT_DEFAULT_FLASH_ERASE_STATE  0xff
+
+#ifndef OK
+#define OK 0
+#endif
+#ifndef ERROR
+#define ERROR -1
+#endif
+
+#define FAR
+#define DEBUGASSERT(x) assert(x)
+
+#endif /* H_SIM_BENCH_NUTTX_CONFIG_H__ */
@@ -0,0 +1,19 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef H_SIM_BENCH_NUTTX_FS_FS_H__
+#define H_SIM_BENCH_NUTTX_FS_FS_H__
+
+#include <stddef.h>
+
+#define BIOC_PARTINFO 0x4e01
+
+struct partition_info_s
+{
+  size_t numsectors;
+  size_t sectorsize;
+  size_t startsector;
+};
+
+#endif /* H_SIM_BENCH_NUTTX_FS_FS_H__ */
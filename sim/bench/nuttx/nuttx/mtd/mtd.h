@@ -0,0 +1,20 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef H_SIM_BENCH_NUTTX_MTD_MTD_H__
+#define H_SIM_BENCH_NUTTX_MTD_MTD_H__
+
+#include <stdint.h>
+
+#define MTDIOC_GEOMETRY   0x4e02
+#define MTDIOC_ERASESTATE 0x4e03
+
+struct mtd_geometry_s
+{
+  uint32_t blocksize;
+  uint32_t erasesize;
+  uint32_t neraseblocks;
+};
+
+#endif /* H_SIM_BENCH_NUTTX_MTD_MTD_H__ */
@@ -0,0 +1,380 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Runs the NuttX flash map backend against file backed MTD stand-ins: each
+ * flash area is a file on the host, opened through the backend as the MTD
+ * character device would be. The MTD ioctls are answered for these files,
+ * and writes behave as they do through the NuttX FTL on NOR flash, each
+ * write rewriting the whole erase blocks it touches.
+ *
+ * The accesses follow those of bootutil:
+ * - "metadata": the header, trailer and TLV reads of both slots;
+ * - "image_hash": the image read in BOOT_TMPBUF_SZ chunks, as it is hashed;
+ * - "upgrade": the primary slot erased sector by sector, the image copied
+ *   from the secondary slot in 1 KiB chunks, and the trailer written.
+ *
+ * The number of reads and writes reaching the MTD, and of erase blocks
+ * rewritten, is part of the variant.
+ */
+
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <nuttx/config.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/mtd/mtd.h>
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bench.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+#define BENCH_SECTOR_SIZE 4096
+#define BENCH_SECTORS     32
+#define BENCH_SLOT_SIZE   (BENCH_SECTOR_SIZE * BENCH_SECTORS)
+#define BENCH_HDR_SIZE    32
+#define BENCH_IMAGE_SIZE  0x10000
+#define BENCH_TLV_COUNT   12
+#define BENCH_HASH_CHUNK  256
+#define BENCH_COPY_CHUNK  1024
+
+char bench_mtd_primary[64];
+char bench_mtd_secondary[64];
+char bench_mtd_scratch[64];
+
+static char *const bench_paths[] = {
+    bench_mtd_primary,
+    bench_mtd_secondary,
+    bench_mtd_scratch,
+};
+
+static ino_t bench_inodes[3];
+
+static unsigned bench_reads;
+static unsigned bench_writes;
+static unsigned bench_blocks;
+
+ssize_t __real_pread(int fd, void *buf, size_t count, off_t offset);
+ssize_t __real_pwrite(int fd, const void *buf, size_t count, off_t offset);
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s: %s\n", BENCH_VARIANT, what);
+    exit(1);
+}
+
+ssize_t
+__wrap_pread(int fd, void *buf, size_t count, off_t offset)
+{
+    bench_reads++;
+    return __real_pread(fd, buf, count, offset);
+}
+
+/* The FTL reads, erases and writes back every erase block a write touches. */
+ssize_t
+__wrap_pwrite(int fd, const void *buf, size_t count, off_t offset)
+{
+    static uint8_t block[BENCH_SECTOR_SIZE];
+    const uint8_t *src = buf;
+    off_t block_off;
+    size_t done = 0;
+    size_t chunk;
+
+    bench_writes++;
+    while (done < count) {
+        block_off = offset - offset % BENCH_SECTOR_SIZE;
+        chunk = BENCH_SECTOR_SIZE - (size_t)(offset - block_off);
+        if (chunk > count - done) {
+            chunk = count - done;
+        }
+
+        if (__real_pread(fd, block, sizeof(block), block_off) != sizeof(block)) {
+            return -1;
+        }
+        memcpy(&block[offset - block_off], src + done, chunk);
+        if (__real_pwrite(fd, block, sizeof(block), block_off) != sizeof(block)) {
+            return -1;
+        }
+
+        bench_blocks++;
+        done += chunk;
+        offset += chunk;
+    }
+
+    return (ssize_t)count;
+}
+
+int
+__wrap_ioctl(int fd, unsigned long request, ...)
+{
+    struct mtd_geometry_s *geo;
+    struct partition_info_s *part;
+    unsigned long arg;
+    struct stat st;
+    size_t i;
+    va_list ap;
+
+    va_start(ap, request);
+    arg = va_arg(ap, unsigned long);
+    va_end(ap);
+
+    if (fstat(fd, &st) != 0) {
+        return -1;
+    }
+    for (i = 0; i < 3 && bench_inodes[i] != st.st_ino; i++) {
+    }
+    if (i == 3) {
+        return -1;
+    }
+
+    switch (request) {
+    case MTDIOC_GEOMETRY:
+        geo = (struct mtd_geometry_s *)(uintptr_t)arg;
+        geo->blocksize = BENCH_SECTOR_SIZE;
+        geo->erasesize = BENCH_SECTOR_SIZE;
+        geo->neraseblocks = BENCH_SECTORS;
+        return 0;
+    case BIOC_PARTINFO:
+        part = (struct partition_info_s *)(uintptr_t)arg;
+        part->numsectors = BENCH_SECTORS;
+        part->sectorsize = BENCH_SECTOR_SIZE;
+        part->startsector = i * BENCH_SECTORS;
+        return 0;
+    case MTDIOC_ERASESTATE:
+        *(uint8_t *)(uintptr_t)arg = 0xff;
+        return 0;
+    }
+
+    return -1;
+}
+
+static void
+create_slots(void)
+{
+    static uint8_t slot[BENCH_SLOT_SIZE];
+    const char *dir = getenv("TMPDIR");
+    struct stat st;
+    uint16_t *tlv;
+    size_t i;
+    int fd;
+
+    if (dir == NULL) {
+        dir = "/tmp";
+    }
+
+    /* An image with BENCH_TLV_COUNT TLVs, and a trailer with its magic. */
+    memset(slot, 0xff, sizeof(slot));
+    for (i = 0; i < BENCH_HDR_SIZE + BENCH_IMAGE_SIZE; i++) {
+        slot[i] = (uint8_t)(i * 7);
+    }
+    tlv = (uint16_t *)&slot[BENCH_HDR_SIZE + BENCH_IMAGE_SIZE];
+    for (i = 0; i < BENCH_TLV_COUNT; i++) {
+        tlv[0] = (uint16_t)(0x70 + i);
+        tlv[1] = 32;
+        tlv += (4 + 32) / 2;
+    }
+    memset(&slot[BENCH_SLOT_SIZE - 16], 0x77, 16);
+
+    for (i = 0; i < 3; i++) {
+        snprintf(bench_paths[i], 64, "%s/nuttx_flash_bench_%d_%zu", dir,
+                 (int)getpid(), i);
+        fd = open(bench_paths[i], O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (fd < 0 || write(fd, slot, sizeof(slot)) != (ssize_t)sizeof(slot) ||
+            fstat(fd, &st) != 0) {
+            fail("creating the MTD files failed");
+        }
+        bench_inodes[i] = st.st_ino;
+        close(fd);
+    }
+}
+
+static void
+remove_slots(void)
+{
+    size_t i;
+
+    for (i = 0; i < 3; i++) {
+        unlink(bench_paths[i]);
+    }
+}
+
+static void
+read_at(const struct flash_area *fa, uint32_t off, void *dst, uint32_t len)
+{
+    if (flash_area_read(fa, off, dst, len) != 0) {
+        fail("read failed");
+    }
+}
+
+static void
+write_at(const struct flash_area *fa, uint32_t off, const void *src,
+         uint32_t len)
+{
+    if (flash_area_write(fa, off, src, len) != 0) {
+        fail("write failed");
+    }
+}
+
+/* boot_read_swap_state() and a TLV walk of each slot. */
+static void
+run_metadata(const struct flash_area *pri, const struct flash_area *sec)
+{
+    const struct flash_area *areas[] = { pri, sec };
+    uint8_t buf[BENCH_HDR_SIZE];
+    uint32_t off;
+    size_t i;
+    int t;
+
+    for (i = 0; i < 2; i++) {
+        read_at(areas[i], 0, buf, BENCH_HDR_SIZE);
+        read_at(areas[i], BENCH_SLOT_SIZE - 16, buf, 16);
+        read_at(areas[i], BENCH_SLOT_SIZE - 24, buf, 1);
+        read_at(areas[i], BENCH_SLOT_SIZE - 32, buf, 1);
+        read_at(areas[i], BENCH_SLOT_SIZE - 40, buf, 1);
+        read_at(areas[i], BENCH_SLOT_SIZE - 48, buf, 1);
+
+        off = BENCH_HDR_SIZE + BENCH_IMAGE_SIZE;
+        for (t = 0; t < BENCH_TLV_COUNT; t++) {
+            read_at(areas[i], off, buf, 4);
+            read_at(areas[i], off + 4, buf, 32);
+            off += 4 + 32;
+        }
+    }
+}
+
+/* bootutil_img_hash() reads of the image. */
+static void
+run_image_hash(const struct flash_area *pri)
+{
+    uint8_t buf[BENCH_HASH_CHUNK];
+    uint32_t off;
+
+    for (off = 0; off < BENCH_HDR_SIZE + BENCH_IMAGE_SIZE; off += BENCH_HASH_CHUNK) {
+        read_at(pri, off, buf, BENCH_HASH_CHUNK);
+    }
+}
+
+/* An overwrite upgrade: boot_erase_region() of the image sectors, then
+ * boot_copy_region() from the secondary slot, then the trailer fields.
+ */
+static void
+run_upgrade(const struct flash_area *pri, const struct flash_area *sec)
+{
+    static const uint8_t magic[16] = { 0x77 };
+    uint8_t buf[BENCH_COPY_CHUNK];
+    uint8_t flag = 1;
+    uint32_t size = BENCH_IMAGE_SIZE + BENCH_SECTOR_SIZE;
+    uint32_t off;
+
+    for (off = 0; off < size; off += BENCH_SECTOR_SIZE) {
+        if (flash_area_erase(pri, off, BENCH_SECTOR_SIZE) != 0) {
+            fail("erase failed");
+        }
+    }
+    if (flash_area_erase(pri, BENCH_SLOT_SIZE - BENCH_SECTOR_SIZE,
+                         BENCH_SECTOR_SIZE) != 0) {
+        fail("erase failed");
+    }
+
+    for (off = 0; off < size; off += BENCH_COPY_CHUNK) {
+        read_at(sec, off, buf, BENCH_COPY_CHUNK);
+        write_at(pri, off, buf, BENCH_COPY_CHUNK);
+    }
+
+    write_at(pri, BENCH_SLOT_SIZE - 40, &flag, 1);
+    write_at(pri, BENCH_SLOT_SIZE - 32, &flag, 1);
+    write_at(pri, BENCH_SLOT_SIZE - 16, magic, sizeof(magic));
+}
+
+static void
+run(const char *name, unsigned iters, uint64_t bytes,
+    void (*fn)(const struct flash_area *, const struct flash_area *))
+{
+    const struct flash_area *pri;
+    const struct flash_area *sec;
+    char variant[128];
+    uint64_t start;
+    uint64_t ns;
+    unsigned k;
+
+    bench_reads = 0;
+    bench_writes = 0;
+    bench_blocks = 0;
+
+    start = bench_now_ns();
+    for (k = 0; k < iters; k++) {
+        if (flash_area_open(FLASH_AREA_IMAGE_PRIMARY(0), &pri) != 0 ||
+            flash_area_open(FLASH_AREA_IMAGE_SECONDARY(0), &sec) != 0) {
+            fail("open failed");
+        }
+        fn(pri, sec);
+        flash_area_close(sec);
+        flash_area_close(pri);
+    }
+    ns = bench_now_ns() - start;
+
+    snprintf(variant, sizeof(variant), "%s_%u_reads_%u_writes_%u_blocks",
+             BENCH_VARIANT, bench_reads / iters, bench_writes / iters,
+             bench_blocks / iters);
+    bench_report(name, variant, iters, bytes, ns);
+}
+
+static void
+image_hash(const struct flash_area *pri, const struct flash_area *sec)
+{
+    (void)sec;
+    run_image_hash(pri);
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 1000);
+    const struct flash_area *pri;
+    uint8_t buf[BENCH_HDR_SIZE];
+    uint8_t expected[BENCH_HDR_SIZE];
+    uint32_t i;
+
+    create_slots();
+
+    bench_header();
+    run("metadata", iters, 0, run_metadata);
+    run("image_hash", iters, BENCH_HDR_SIZE + BENCH_IMAGE_SIZE, image_hash);
+    run("upgrade", iters / 10 ? iters / 10 : 1,
+        BENCH_IMAGE_SIZE + BENCH_SECTOR_SIZE, run_upgrade);
+
+    /* What the upgrade wrote is what is read back. */
+    for (i = 0; i < BENCH_HDR_SIZE; i++) {
+        expected[i] = (uint8_t)(i * 7);
+    }
+    if (flash_area_open(FLASH_AREA_IMAGE_PRIMARY(0), &pri) != 0) {
+        fail("open failed");
+    }
+    read_at(pri, 0, buf, sizeof(buf));
+    if (memcmp(buf, expected, sizeof(buf)) != 0) {
+        fail("image not copied");
+    }
+    read_at(pri, BENCH_SLOT_SIZE - 16, buf, 16);
+    if (buf[0] != 0x77 || buf[1] != 0) {
+        fail("trailer not written");
+    }
+    flash_area_close(pri);
+
+    remove_slots();
+
+    return 0;
+}
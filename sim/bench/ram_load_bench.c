@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Loads a large image from a RAM backed flash area to the RAM load region
+ * with boot_load_image_to_sram() and gets its digest with
+ * bootutil_img_hash(), as RAM loading does before validating the image.
+ * The digest is computed while the image is copied, so the image is only
+ * gone through once. The "copy_then_hash" row does what was done before:
+ * one copy of the whole image, then a second pass hashing it in RAM.
+ *
+ * Both rows check that the digest is the one of the image.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bootutil/bootutil.h"
+#include "bootutil/crypto/sha.h"
+#include "bootutil/image.h"
+
+#include "bootutil_priv.h"
+
+#include "bench.h"
+
+/* Large enough for the RAM and flash copies not to fit in the caches. */
+#define BENCH_IMAGE_SIZE  (8 * 1024 * 1024)
+#define BENCH_TLV_SIZE    64
+#define BENCH_LOAD_SIZE   (IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE + BENCH_TLV_SIZE)
+
+static uint8_t *bench_flash;
+static uint8_t *bench_ram;
+static struct bootsim_ram_info bench_ram_info;
+
+static const struct flash_area bench_area = {
+    .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
+    .fa_device_id = FLASH_DEVICE_ID,
+    .fa_off = 0,
+    .fa_size = BENCH_LOAD_SIZE,
+};
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "ram_load_bench: %s\n", what);
+    exit(1);
+}
+
+int
+sim_log_enabled(int level)
+{
+    (void)level;
+    return 0;
+}
+
+struct bootsim_ram_info *
+bootsim_get_ram_info(void)
+{
+    return &bench_ram_info;
+}
+
+int
+flash_area_read(const struct flash_area *fa, uint32_t off, void *dst,
+                uint32_t len)
+{
+    if (fa != &bench_area || off > BENCH_LOAD_SIZE ||
+        len > BENCH_LOAD_SIZE - off) {
+        return -1;
+    }
+
+    memcpy(dst, &bench_flash[off], len);
+    return 0;
+}
+
+int
+boot_read_image_size(struct boot_loader_state *state, int slot, uint32_t *size)
+{
+    (void)state;
+    (void)slot;
+    *size = BENCH_LOAD_SIZE;
+    return 0;
+}
+
+static void
+build_image(struct image_header *hdr)
+{
+    uint32_t i;
+
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->ih_magic = IMAGE_MAGIC;
+    hdr->ih_hdr_size = IMAGE_HEADER_SIZE;
+    hdr->ih_img_size = BENCH_IMAGE_SIZE;
+    hdr->ih_flags = IMAGE_F_RAM_LOAD;
+    hdr->ih_load_addr = 0;
+
+    for (i = 0; i < BENCH_LOAD_SIZE; i++) {
+        bench_flash[i] = (uint8_t)(i * 7 + (i >> 11));
+    }
+    memcpy(bench_flash, hdr, sizeof(*hdr));
+}
+
+static void
+digest(const uint8_t *data, uint32_t len, uint8_t *out)
+{
+    bootutil_sha_context ctx;
+
+    bootutil_sha_init(&ctx);
+    bootutil_sha_update(&ctx, data, len);
+    bootutil_sha_finish(&ctx, out);
+    bootutil_sha_drop(&ctx);
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 10);
+    static struct boot_loader_state state;
+    uint8_t expected[IMAGE_HASH_SIZE];
+    uint8_t hash[IMAGE_HASH_SIZE];
+    uint8_t tmpbuf[256];
+    struct image_header hdr;
+    uint64_t start;
+    unsigned k;
+
+    bench_flash = malloc(BENCH_LOAD_SIZE);
+    bench_ram = malloc(BENCH_LOAD_SIZE);
+    if (bench_flash == NULL || bench_ram == NULL) {
+        fail("out of memory");
+    }
+    bench_ram_info.start = 0;
+    bench_ram_info.size = BENCH_LOAD_SIZE;
+    bench_ram_info.base = (uintptr_t)bench_ram;
+
+    build_image(&hdr);
+    digest(bench_flash, IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE, expected);
+
+    state.imgs[0][BOOT_SLOT_PRIMARY].hdr = hdr;
+    state.imgs[0][BOOT_SLOT_PRIMARY].area = &bench_area;
+    state.slot_usage[0].active_slot = BOOT_SLOT_PRIMARY;
+
+    bench_header();
+
+    start = bench_now_ns();
+    for (k = 0; k < iters; k++) {
+        if (flash_area_read(&bench_area, 0, bench_ram, BENCH_LOAD_SIZE) != 0) {
+            fail("copy failed");
+        }
+        digest(bench_ram, IMAGE_HEADER_SIZE + BENCH_IMAGE_SIZE, hash);
+    }
+    bench_report("ram_load", "copy_then_hash", iters, BENCH_LOAD_SIZE,
+                 bench_now_ns() - start);
+    if (memcmp(hash, expected, sizeof(hash)) != 0) {
+        fail("copy_then_hash digest mismatch");
+    }
+
+    start = bench_now_ns();
+    for (k = 0; k < iters; k++) {
+        if (boot_load_image_to_sram(&state) != 0 ||
+            bootutil_img_hash(&state, &hdr, &bench_area, tmpbuf, sizeof(tmpbuf),
+                              hash, NULL, 0) != 0) {
+            fail("loading failed");
+        }
+    }
+    bench_report("ram_load", "copy_and_hash", iters, BENCH_LOAD_SIZE,
+                 bench_now_ns() - start);
+    if (!state.slot_usage[0].img_hash_valid) {
+        fail("digest not computed while loading");
+    }
+    if (memcmp(hash, expected, sizeof(hash)) != 0) {
+        fail("copy_and_hash digest mismatch");
+    }
+    if (memcmp(bench_ram, bench_flash, BENCH_LOAD_SIZE) != 0) {
+        fail("image not loaded");
+    }
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Times the RSA public key operation of image verification for 2048 and
+ * 3072 bit keys with the Montgomery constants emitted by imgtool, and with
+ * the same constants derived from the modulus first, as has to be done at
+ * every boot without them. The derivation used here (R mod n doubled and
+ * squared up to R^2 mod n) is cheaper than the division Mbed TLS uses, so
+ * the difference is a lower bound of the time saved.
+ *
+ * Built with MCUBOOT_USE_MBED_TLS, the operation is also timed through
+ * mbedtls_rsa_public() on a freshly loaded key, which is what image_rsa.c
+ * does at every boot without MCUBOOT_RSA_MONT_CONSTANTS.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bootutil/crypto/rsa_mont.h"
+#ifdef MCUBOOT_USE_MBED_TLS
+#include <mbedtls/platform.h>
+#include <mbedtls/rsa.h>
+#endif
+
+#include "bench.h"
+#include "rsa_mont_vectors.h"
+
+struct vector {
+    const char *name;
+    size_t len;
+    const uint8_t *n;
+    const uint8_t *rr;
+    uint32_t n0;
+    const uint8_t *s;
+    const uint8_t *m;
+};
+
+static const struct vector vectors[] = {
+    { "2048", sizeof(rsa2048_n), rsa2048_n, rsa2048_rr, RSA2048_N0,
+      rsa2048_s, rsa2048_m },
+    { "3072", sizeof(rsa3072_n), rsa3072_n, rsa3072_rr, RSA3072_N0,
+      rsa3072_s, rsa3072_m },
+};
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s\n", what);
+    exit(1);
+}
+
+/* Computes rr = R^2 mod n and n0 = -n^-1 mod 2^32 from the modulus. */
+static void
+derive(const uint8_t *n_be, size_t len, uint8_t *rr_be, uint32_t *n0)
+{
+    uint32_t n[BOOTUTIL_RSA_MONT_MAX_LIMBS];
+    uint32_t r[BOOTUTIL_RSA_MONT_MAX_LIMBS];
+    size_t limbs = len / 4;
+    uint64_t acc;
+    uint32_t inv;
+    uint32_t carry;
+    uint32_t borrow;
+    size_t i;
+    size_t j;
+
+    bootutil_rsa_mont_load(n, n_be, limbs);
+
+    /* Newton iteration, each step doubles the number of correct bits. */
+    inv = n[0];
+    for (i = 0; i < 4; i++) {
+        inv *= 2 - n[0] * inv;
+    }
+    *n0 = -inv;
+
+    /* r = R mod n = 2^(32 * limbs) - n, the top bit of n being set. */
+    borrow = 0;
+    for (j = 0; j < limbs; j++) {
+        acc = (uint64_t)0 - n[j] - borrow;
+        r[j] = (uint32_t)acc;
+        borrow = (uint32_t)(acc >> 32) & 1;
+    }
+
+    /* r = 2^limbs * R mod n ... */
+    for (i = 0; i < limbs; i++) {
+        carry = r[limbs - 1] >> 31;
+        for (j = limbs - 1; j > 0; j--) {
+            r[j] = (r[j] << 1) | (r[j - 1] >> 31);
+        }
+        r[0] <<= 1;
+        if (carry || bootutil_rsa_mont_ge(r, n, limbs)) {
+            borrow = 0;
+            for (j = 0; j < limbs; j++) {
+                acc = (uint64_t)r[j] - n[j] - borrow;
+                r[j] = (uint32_t)acc;
+                borrow = (uint32_t)(acc >> 32) & 1;
+            }
+        }
+    }
+
+    /* ... and five Montgomery squarings make it 2^(32 * limbs) * R. */
+    for (i = 0; i < 5; i++) {
+        bootutil_rsa_mont_mul(r, r, r, n, *n0, limbs);
+    }
+
+    bootutil_rsa_mont_store(rr_be, r, limbs);
+}
+
+#ifdef MCUBOOT_USE_MBED_TLS
+static const uint8_t rsa_e[] = { 0x01, 0x00, 0x01 };
+
+/* The public key operation of image_rsa.c, from loading the key on. */
+static int
+mbedtls_public(const struct vector *v, uint8_t *out)
+{
+    mbedtls_rsa_context ctx;
+    int rc;
+
+    mbedtls_rsa_init(&ctx);
+    rc = mbedtls_rsa_import_raw(&ctx, v->n, v->len, NULL, 0, NULL, 0, NULL, 0,
+                                rsa_e, sizeof(rsa_e));
+    if (rc == 0) {
+        rc = mbedtls_rsa_complete(&ctx);
+    }
+    if (rc == 0) {
+        rc = mbedtls_rsa_public(&ctx, v->s, out);
+    }
+    mbedtls_rsa_free(&ctx);
+
+    return rc;
+}
+#endif
+
+static void
+check(const struct vector *v)
+{
+    uint8_t rr[BOOTUTIL_RSA_MONT_MAX_LEN];
+    uint8_t out[BOOTUTIL_RSA_MONT_MAX_LEN];
+    uint32_t n0;
+
+    derive(v->n, v->len, rr, &n0);
+    if (n0 != v->n0 || memcmp(rr, v->rr, v->len) != 0) {
+        fail("derived constants differ from the precomputed ones");
+    }
+
+    if (bootutil_rsa_mont_public(v->n, v->rr, v->n0, v->s, out, v->len) != 0 ||
+        memcmp(out, v->m, v->len) != 0) {
+        fail("wrong result of the public key operation");
+    }
+
+    if (bootutil_rsa_mont_public(v->n, v->rr, v->n0, v->n, out, v->len) == 0) {
+        fail("input not smaller than the modulus accepted");
+    }
+
+#ifdef MCUBOOT_USE_MBED_TLS
+    if (mbedtls_public(v, out) != 0 || memcmp(out, v->m, v->len) != 0) {
+        fail("wrong result of the Mbed TLS public key operation");
+    }
+#endif
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 2000);
+    uint8_t rr[BOOTUTIL_RSA_MONT_MAX_LEN];
+    uint8_t out[BOOTUTIL_RSA_MONT_MAX_LEN];
+    char variant[32];
+    const struct vector *v;
+    uint64_t start;
+    uint64_t ns;
+    uint32_t n0;
+    size_t i;
+    unsigned k;
+
+#ifdef MCUBOOT_USE_MBED_TLS
+    mbedtls_platform_set_calloc_free(calloc, free);
+#endif
+
+    bench_header();
+
+    for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        v = &vectors[i];
+        check(v);
+
+        snprintf(variant, sizeof(variant), "%s_precomputed", v->name);
+        start = bench_now_ns();
+        for (k = 0; k < iters; k++) {
+            bootutil_rsa_mont_public(v->n, v->rr, v->n0, v->s, out, v->len);
+        }
+        ns = bench_now_ns() - start;
+        bench_report("rsa_public", variant, iters, 0, ns);
+
+        snprintf(variant, sizeof(variant), "%s_derived", v->name);
+        start = bench_now_ns();
+        for (k = 0; k < iters; k++) {
+            derive(v->n, v->len, rr, &n0);
+            bootutil_rsa_mont_public(v->n, rr, n0, v->s, out, v->len);
+        }
+        ns = bench_now_ns() - start;
+        bench_report("rsa_public", variant, iters, 0, ns);
+
+#ifdef MCUBOOT_USE_MBED_TLS
+        snprintf(variant, sizeof(variant), "%s_mbedtls", v->name);
+        start = bench_now_ns();
+        for (k = 0; k < iters; k++) {
+            mbedtls_public(v, out);
+        }
+        ns = bench_now_ns() - start;
+        bench_report("rsa_public", variant, iters, 0, ns);
+#endif
+    }
+
+    return 0;
+}
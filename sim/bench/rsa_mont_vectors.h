@@ -0,0 +1,256 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Generated from root-rsa-2048.pem and root-rsa-3072.pem, do not edit.
+ *
+ * For each modulus n: rr = R^2 mod n with R = 2^(8 * len), n0 = -n^-1 mod
+ * 2^32 (as emitted by "imgtool getpub"), an input s < n and the expected
+ * output m = s^65537 mod n.
+ */
+
+#ifndef H_RSA_MONT_VECTORS_H__
+#define H_RSA_MONT_VECTORS_H__
+
+#include <stdint.h>
+
+#define RSA2048_N0 0x80aee787u
+
+static const uint8_t rsa2048_n[] = {
+    0xd1, 0x06, 0x08, 0x1a, 0x18, 0x44, 0x2c, 0x18, 0xe8, 0xfb, 0xfd, 0xf7,
+    0x0d, 0xa3, 0x4f, 0x1f, 0xbb, 0xee, 0x5e, 0xf9, 0xaa, 0xd2, 0x4b, 0x18,
+    0xd3, 0x5a, 0xe9, 0x6d, 0x18, 0x80, 0x19, 0xf9, 0xf0, 0x9c, 0x34, 0x1b,
+    0xcb, 0xf3, 0xbc, 0x74, 0xdb, 0x42, 0xe7, 0x8c, 0x7f, 0x10, 0x53, 0x7e,
+    0x43, 0x5e, 0x0d, 0x57, 0x2c, 0x44, 0xd1, 0x67, 0x08, 0x0f, 0x0d, 0xbb,
+    0x5c, 0xee, 0xec, 0xb3, 0x99, 0xdf, 0xe0, 0x4d, 0x84, 0x0b, 0xaa, 0x77,
+    0x41, 0x60, 0xed, 0x15, 0x28, 0x49, 0xa7, 0x01, 0xb4, 0x3c, 0x10, 0xe6,
+    0x69, 0x8c, 0x2f, 0x5f, 0xac, 0x41, 0x4d, 0x9e, 0x5c, 0x14, 0xdf, 0xf2,
+    0xf8, 0xcf, 0x3d, 0x1e, 0x6f, 0xe7, 0x5b, 0xba, 0xb4, 0xa9, 0xc8, 0x88,
+    0x7e, 0x47, 0x3c, 0x94, 0xc3, 0x77, 0x67, 0x54, 0x4b, 0xaa, 0x8d, 0x38,
+    0x35, 0xca, 0x62, 0x61, 0x7e, 0xb7, 0xe1, 0x15, 0xdb, 0x77, 0x73, 0xd4,
+    0xbe, 0x7b, 0x72, 0x21, 0x89, 0x69, 0x24, 0xfb, 0xf8, 0x65, 0x6e, 0x64,
+    0x3e, 0xc8, 0x0e, 0xd7, 0x85, 0xd5, 0x5c, 0x4a, 0xe4, 0x53, 0x0d, 0x2f,
+    0xff, 0xb7, 0xfd, 0xf3, 0x13, 0x39, 0x83, 0x3f, 0xa3, 0xae, 0xd2, 0x0f,
+    0xa7, 0x6a, 0x9d, 0xf9, 0xfe, 0xb8, 0xce, 0xfa, 0x2a, 0xbe, 0xaf, 0xb8,
+    0xe0, 0xfa, 0x82, 0x37, 0x54, 0xf4, 0x3e, 0xe1, 0x2b, 0xd0, 0xd3, 0x08,
+    0x58, 0x18, 0xf6, 0x5e, 0x4c, 0xc8, 0x88, 0x81, 0x31, 0xad, 0x5f, 0xb0,
+    0x82, 0x17, 0xf2, 0x8a, 0x69, 0x27, 0x23, 0xf3, 0xab, 0x87, 0x3e, 0x93,
+    0x1a, 0x1d, 0xfe, 0xe8, 0xf8, 0x1a, 0x24, 0x66, 0x59, 0xf8, 0x1c, 0xab,
+    0xdc, 0xce, 0x68, 0x1b, 0x66, 0x64, 0x35, 0xec, 0xfa, 0x0d, 0x11, 0x9d,
+    0xaf, 0x5c, 0x3a, 0xa7, 0xd1, 0x67, 0xc6, 0x47, 0xef, 0xb1, 0x4b, 0x2c,
+    0x62, 0xe1, 0xd1, 0xc9,
+};
+static const uint8_t rsa2048_rr[] = {
+    0xa9, 0x20, 0xa3, 0xe8, 0xb9, 0x7f, 0x1d, 0x14, 0x00, 0x6e, 0x29, 0x8c,
+    0x1e, 0xf0, 0x51, 0xf7, 0x69, 0x6f, 0x8e, 0x30, 0xaf, 0xe3, 0xf5, 0xe1,
+    0x4f, 0xf5, 0x2c, 0xce, 0x61, 0x3d, 0x32, 0x17, 0x2e, 0x5d, 0x61, 0xf4,
+    0xa5, 0x7c, 0x2d, 0x5e, 0x15, 0xef, 0x71, 0x10, 0x44, 0x7c, 0xd5, 0xa9,
+    0xf9, 0x3f, 0x6a, 0x95, 0xa4, 0xca, 0x52, 0x44, 0xfc, 0x98, 0x16, 0x7d,
+    0xab, 0xe5, 0x0e, 0xda, 0x5e, 0xdb, 0x85, 0x06, 0x23, 0xf7, 0xbd, 0x3a,
+    0xc9, 0x7f, 0x93, 0xf7, 0x31, 0x66, 0xa9, 0x31, 0x39, 0xb5, 0x37, 0x06,
+    0xbc, 0xf6, 0xf0, 0x70, 0x79, 0x41, 0xf5, 0x44, 0x51, 0xc6, 0x6c, 0x09,
+    0xf9, 0xb8, 0xd1, 0x06, 0x35, 0x87, 0x55, 0x18, 0x05, 0x86, 0x30, 0x28,
+    0x9c, 0x26, 0x77, 0x9b, 0x65, 0x57, 0xf8, 0x7a, 0x52, 0x12, 0x46, 0x03,
+    0xef, 0x1a, 0x0c, 0x45, 0xba, 0x88, 0x10, 0x7e, 0xbb, 0x62, 0xbd, 0x84,
+    0xfc, 0x9e, 0xf7, 0x74, 0xf4, 0xc4, 0x0b, 0xbe, 0x1f, 0x61, 0x72, 0x38,
+    0x2f, 0xb5, 0x8c, 0x91, 0x93, 0x6a, 0x5c, 0xd7, 0xda, 0xe1, 0x58, 0xdc,
+    0x52, 0x49, 0xdd, 0x8c, 0xed, 0x49, 0xb3, 0x41, 0xfa, 0x31, 0x58, 0x6c,
+    0xa7, 0x1a, 0x32, 0xcb, 0xc2, 0x5d, 0x85, 0x81, 0x7e, 0xf3, 0x22, 0x96,
+    0x77, 0x60, 0xb7, 0x79, 0x9d, 0x94, 0x22, 0xc6, 0xb7, 0xee, 0x04, 0x65,
+    0xfa, 0xbd, 0xab, 0xfa, 0x05, 0xa7, 0x31, 0x4e, 0xb9, 0xc7, 0xf1, 0x22,
+    0xd7, 0x60, 0x7b, 0x1c, 0x6a, 0x3d, 0x59, 0x6a, 0xb6, 0x20, 0xcc, 0x9e,
+    0x49, 0x33, 0xb1, 0x56, 0xc1, 0x64, 0x8e, 0x24, 0x9f, 0x4c, 0xf4, 0x9b,
+    0x72, 0x3e, 0xae, 0xa3, 0x6f, 0x68, 0x95, 0xe7, 0xb8, 0xce, 0xc2, 0xe8,
+    0xa0, 0xbf, 0x6f, 0x48, 0x1a, 0xf6, 0xc6, 0x1d, 0x61, 0xd8, 0x87, 0xb3,
+    0xa4, 0x6d, 0x7e, 0x40,
+};
+static const uint8_t rsa2048_s[] = {
+    0xb2, 0xcb, 0xe4, 0xf2, 0x60, 0xb9, 0x61, 0x99, 0x6b, 0x4f, 0xa1, 0xd2,
+    0xb1, 0x05, 0x90, 0x60, 0x14, 0x6c, 0xfc, 0x2b, 0xa2, 0xeb, 0x60, 0x98,
+    0x1a, 0x9a, 0x97, 0x0f, 0xb1, 0x3b, 0x2c, 0xff, 0x05, 0x6e, 0xa2, 0x14,
+    0xfa, 0x03, 0x0c, 0x44, 0xbb, 0xa4, 0xda, 0x11, 0x96, 0x2b, 0x9e, 0xd8,
+    0x43, 0x04, 0xc2, 0xa6, 0x61, 0x59, 0x9f, 0xf0, 0xce, 0x6e, 0x57, 0x00,
+    0x44, 0xa8, 0x5d, 0x13, 0x70, 0xd6, 0xb4, 0x55, 0x06, 0x35, 0x77, 0x81,
+    0xbc, 0x6c, 0xfd, 0xfe, 0x9e, 0xaf, 0x33, 0x17, 0x83, 0x21, 0xe2, 0xaf,
+    0xdd, 0xf4, 0xc4, 0xfc, 0x58, 0xb7, 0x3a, 0xf8, 0x16, 0x2d, 0xaf, 0x66,
+    0xa0, 0xe2, 0x93, 0xd2, 0x29, 0x53, 0x36, 0x06, 0x18, 0x74, 0xb0, 0x80,
+    0x3a, 0xf2, 0x1f, 0x58, 0x65, 0x57, 0x2a, 0xd4, 0x47, 0xa0, 0x29, 0xcb,
+    0x2d, 0xed, 0x41, 0x1e, 0x17, 0x48, 0x1b, 0xb1, 0xe3, 0x41, 0x61, 0x83,
+    0xb5, 0xe8, 0xa3, 0xc6, 0x91, 0x60, 0x06, 0x4d, 0xd4, 0xf6, 0xc1, 0xa6,
+    0x8d, 0xa1, 0xa9, 0x60, 0x17, 0x6e, 0x99, 0x35, 0x35, 0xb7, 0x87, 0x6b,
+    0xdc, 0xdb, 0xfc, 0xa7, 0x72, 0x7a, 0x56, 0x20, 0x77, 0x21, 0x6d, 0x14,
+    0x3b, 0x96, 0x06, 0x25, 0x40, 0x47, 0x7b, 0xf8, 0x56, 0x05, 0x48, 0x65,
+    0x6a, 0xb5, 0x36, 0xa9, 0xb4, 0xe9, 0x23, 0x08, 0x54, 0x58, 0x84, 0x0d,
+    0xf0, 0x69, 0xd1, 0xa1, 0x8d, 0xf5, 0x61, 0xc4, 0xcb, 0x4a, 0x49, 0xd7,
+    0xc3, 0xbd, 0x98, 0x4b, 0x0f, 0x42, 0x4d, 0xc7, 0x9e, 0x46, 0x45, 0x2e,
+    0x24, 0xe0, 0x64, 0x0c, 0xdb, 0xee, 0x45, 0x6c, 0x4c, 0xa9, 0xd4, 0x1d,
+    0x06, 0x60, 0x59, 0xce, 0x31, 0x25, 0x85, 0xf7, 0x52, 0xe2, 0x0d, 0xb7,
+    0x3b, 0x5c, 0xb8, 0x38, 0x09, 0x5c, 0x28, 0xe1, 0xf8, 0x77, 0x10, 0x54,
+    0x58, 0x72, 0x4b, 0x20,
+};
+static const uint8_t rsa2048_m[] = {
+    0x8b, 0xd8, 0xfc, 0x8f, 0x9d, 0xdb, 0x1d, 0xe5, 0x12, 0x2b, 0xd3, 0xff,
+    0x99, 0x49, 0xa1, 0x85, 0x16, 0x17, 0x0b, 0xea, 0xc3, 0x84, 0x00, 0x2a,
+    0xcc, 0xc8, 0xb7, 0x31, 0x3e, 0xd7, 0x36, 0x5e, 0xa7, 0x90, 0xda, 0xd4,
+    0xcc, 0x14, 0xfc, 0x60, 0x10, 0x9a, 0x03, 0xe8, 0x4a, 0xb6, 0xa3, 0x06,
+    0x7d, 0x63, 0x9d, 0xca, 0x7f, 0xd2, 0x0d, 0x63, 0x8f, 0x58, 0x28, 0x32,
+    0x65, 0xc8, 0xef, 0x3b, 0x54, 0x1b, 0x3b, 0x7e, 0x8f, 0xf8, 0x19, 0x5a,
+    0x90, 0x6c, 0xb3, 0xc0, 0x3c, 0xbd, 0x41, 0xa9, 0x7c, 0xf9, 0xd8, 0x50,
+    0xb8, 0x67, 0xe3, 0xea, 0x07, 0xee, 0xf7, 0xe9, 0xea, 0x1e, 0x87, 0x84,
+    0xc8, 0xb0, 0x5c, 0xd7, 0x3e, 0x33, 0x95, 0x7a, 0xe5, 0xb5, 0xef, 0xf7,
+    0x3b, 0x6d, 0x32, 0xaf, 0x34, 0x0b, 0x87, 0x84, 0x1f, 0x89, 0x71, 0x32,
+    0x80, 0xf6, 0x7c, 0xcc, 0x25, 0x3c, 0x52, 0xf2, 0x50, 0xd6, 0x1f, 0x50,
+    0xbc, 0x7a, 0x5b, 0xbd, 0x1c, 0x72, 0xde, 0xf3, 0x36, 0x5d, 0xcd, 0xd7,
+    0xdc, 0x25, 0xa9, 0x4b, 0x70, 0x42, 0xf5, 0x06, 0x96, 0xd9, 0xfd, 0x6e,
+    0xe3, 0x9a, 0xd4, 0xdb, 0x0f, 0x06, 0x9a, 0xed, 0x0d, 0x60, 0x31, 0xc3,
+    0xd1, 0xff, 0x64, 0x9a, 0x4c, 0xb4, 0x02, 0x39, 0xaa, 0x43, 0x66, 0x15,
+    0x78, 0xf4, 0xb4, 0x45, 0xf5, 0xd5, 0xc9, 0xa2, 0xa7, 0x15, 0xf2, 0x4e,
+    0xc5, 0x1a, 0xb2, 0xf2, 0x30, 0xca, 0x2a, 0x3e, 0x23, 0xed, 0x2f, 0xfc,
+    0x3b, 0xe1, 0xe5, 0x44, 0x73, 0x13, 0x86, 0x17, 0x2d, 0x8d, 0x67, 0xb5,
+    0xf0, 0x56, 0x69, 0x7d, 0xf2, 0x1e, 0xa8, 0xf6, 0x54, 0xc5, 0x6c, 0x63,
+    0x74, 0xa5, 0x5a, 0x68, 0x8b, 0xda, 0x12, 0x98, 0x7f, 0x20, 0x59, 0x7f,
+    0x00, 0x21, 0x0e, 0x4f, 0xbd, 0x37, 0x22, 0x62, 0x9f, 0x39, 0xf9, 0x19,
+    0x45, 0x03, 0x13, 0x9b,
+};
+
+#define RSA3072_N0 0x8a1ab50du
+
+static const uint8_t rsa3072_n[] = {
+    0xb4, 0x2c, 0x0e, 0x98, 0x58, 0x10, 0xa4, 0xa7, 0x58, 0x99, 0x7c, 0x01,
+    0xdd, 0x08, 0x2a, 0x28, 0x34, 0x33, 0xf8, 0x96, 0x1a, 0x34, 0x20, 0x5d,
+    0x45, 0xc8, 0x71, 0x26, 0x25, 0xe5, 0xd2, 0x96, 0xea, 0x7b, 0xb1, 0x15,
+    0xaa, 0xa6, 0x8a, 0x63, 0x22, 0x8b, 0x2d, 0x4e, 0x81, 0x73, 0xbf, 0x6e,
+    0x15, 0x68, 0x8c, 0x1a, 0xf4, 0xef, 0x2a, 0x8f, 0x8c, 0x22, 0x9e, 0x71,
+    0x57, 0x4b, 0xde, 0x0f, 0x7e, 0x72, 0xd3, 0x7a, 0xb8, 0xa7, 0x1d, 0x44,
+    0xad, 0x87, 0x00, 0x83, 0x5c, 0xfd, 0x73, 0x05, 0x72, 0x46, 0x3f, 0x8b,
+    0xf9, 0x10, 0x00, 0xd8, 0x6e, 0xcc, 0x85, 0xed, 0xf9, 0x49, 0xdb, 0x78,
+    0x36, 0x80, 0x49, 0x38, 0x76, 0xdd, 0x5f, 0x54, 0x04, 0xda, 0x8c, 0x34,
+    0xa7, 0x2b, 0x13, 0x25, 0x6f, 0xd1, 0x15, 0x4f, 0xad, 0xc2, 0xe1, 0xa5,
+    0xd2, 0x4e, 0x57, 0x0c, 0x7e, 0x9c, 0x9b, 0xba, 0x4e, 0x68, 0xb2, 0xe0,
+    0x25, 0x02, 0xaa, 0x00, 0xd3, 0xb4, 0xcc, 0x2f, 0x78, 0xe5, 0xbe, 0x47,
+    0x67, 0x1f, 0xc8, 0x6e, 0x22, 0x6c, 0x5e, 0x61, 0xb6, 0x9a, 0xcd, 0xe5,
+    0xa8, 0xba, 0x7a, 0x80, 0x13, 0x1b, 0x17, 0x2e, 0x96, 0xed, 0xcf, 0xb3,
+    0x9b, 0xe4, 0x1c, 0xe8, 0xad, 0xa7, 0xf6, 0x3a, 0x51, 0x66, 0x5e, 0x99,
+    0x8e, 0x87, 0xee, 0x60, 0x25, 0xf8, 0x8d, 0xbe, 0xce, 0xa4, 0xa8, 0xca,
+    0x93, 0x6c, 0xd7, 0xbf, 0xd4, 0x73, 0x33, 0x8d, 0x44, 0x85, 0xcc, 0x73,
+    0x30, 0x08, 0x9c, 0x4d, 0xb2, 0xaa, 0x5a, 0x6c, 0x6f, 0x7b, 0xab, 0xb7,
+    0xb3, 0x7c, 0xc3, 0xfb, 0xe7, 0xca, 0xc4, 0xf8, 0x9a, 0x6f, 0xcb, 0xbb,
+    0x5b, 0x82, 0xe7, 0x7a, 0xe8, 0x19, 0xfd, 0x2f, 0x11, 0x22, 0xfb, 0x7f,
+    0x76, 0x8c, 0x6b, 0x94, 0xa4, 0x09, 0x4f, 0xa5, 0x6a, 0x77, 0x51, 0xeb,
+    0xa7, 0x7e, 0xda, 0x87, 0x06, 0xee, 0xdc, 0xbe, 0xd1, 0xea, 0x1a, 0x40,
+    0x1d, 0x1b, 0xff, 0x1a, 0xb1, 0x51, 0x7c, 0x12, 0xb0, 0xf3, 0xf6, 0x83,
+    0x01, 0x9c, 0xe7, 0x0c, 0x99, 0xbf, 0xac, 0x68, 0x58, 0x72, 0xa4, 0xb0,
+    0x59, 0x85, 0xee, 0x85, 0xac, 0x2a, 0x22, 0xf4, 0xcf, 0x15, 0x08, 0x80,
+    0x1f, 0x0d, 0xd0, 0x1e, 0xa0, 0xa0, 0x94, 0xc8, 0xf7, 0xfa, 0x65, 0xdd,
+    0x52, 0xe8, 0x96, 0x37, 0x23, 0x30, 0x57, 0x36, 0xe6, 0x9d, 0xf4, 0x0c,
+    0x4a, 0x05, 0x75, 0x1f, 0xad, 0x01, 0xca, 0xb7, 0x6d, 0x8c, 0x43, 0x74,
+    0x06, 0x0a, 0x81, 0xf3, 0x01, 0x62, 0xff, 0xf7, 0xf5, 0x5f, 0xaf, 0xe7,
+    0x2b, 0x0e, 0xf8, 0x81, 0xb5, 0x65, 0xdd, 0x01, 0xd9, 0x9f, 0x07, 0x17,
+    0x8a, 0x18, 0xcf, 0x23, 0x6e, 0x88, 0x65, 0x91, 0xb5, 0x7b, 0xd3, 0xb0,
+    0x2d, 0xaf, 0x93, 0x66, 0x63, 0x74, 0xac, 0x5a, 0xe6, 0x73, 0xde, 0x3b,
+};
+static const uint8_t rsa3072_rr[] = {
+    0x0b, 0x94, 0x00, 0x21, 0xa6, 0xd2, 0xf0, 0x92, 0x07, 0x17, 0xef, 0x99,
+    0x62, 0x86, 0x26, 0x73, 0x3d, 0x43, 0x38, 0xf5, 0x43, 0x75, 0x15, 0x95,
+    0xb1, 0xdb, 0x1f, 0xcf, 0x18, 0x4b, 0x19, 0xfc, 0x65, 0xfa, 0x9b, 0x83,
+    0x50, 0x4c, 0x87, 0x2d, 0x29, 0x59, 0x87, 0x98, 0x8a, 0x82, 0x95, 0xd9,
+    0xb2, 0x39, 0xdb, 0x53, 0xeb, 0x13, 0x28, 0xd3, 0xd3, 0x0b, 0x11, 0xc5,
+    0x2b, 0x96, 0x6e, 0x7b, 0x4a, 0x34, 0x32, 0x9a, 0xc7, 0x7b, 0xb7, 0xfe,
+    0x9d, 0xc4, 0xdb, 0x1b, 0xc3, 0xd2, 0x50, 0x6c, 0xf9, 0x91, 0xdb, 0xbc,
+    0xd6, 0x1e, 0x94, 0x16, 0x14, 0xa5, 0xc5, 0xc5, 0xaf, 0x38, 0x71, 0x0c,
+    0x85, 0xaa, 0x9f, 0x1c, 0x7e, 0x27, 0x62, 0xdf, 0x99, 0x70, 0x52, 0xd1,
+    0x82, 0xda, 0x2b, 0xec, 0xbd, 0x60, 0xe1, 0xfb, 0xd1, 0x4c, 0xbd, 0x50,
+    0x4e, 0x2c, 0x2b, 0xea, 0x47, 0x48, 0x96, 0x02, 0xf7, 0x72, 0x66, 0x75,
+    0x54, 0x71, 0x5f, 0x22, 0xbb, 0x07, 0x51, 0x58, 0x3e, 0x9d, 0x92, 0xe1,
+    0x0e, 0x49, 0x95, 0x45, 0x23, 0x87, 0x01, 0xa7, 0x07, 0xa0, 0x97, 0x92,
+    0x60, 0xf5, 0x86, 0x7d, 0x95, 0xbc, 0xfe, 0x91, 0x93, 0xc4, 0x4e, 0xee,
+    0xf0, 0x00, 0xfe, 0x77, 0xae, 0xef, 0xc4, 0x1f, 0x49, 0x8f, 0xc1, 0x66,
+    0xb0, 0x98, 0xe8, 0xd7, 0x84, 0xf4, 0xf9, 0x32, 0x79, 0x80, 0x03, 0xc8,
+    0xcd, 0x0b, 0x6e, 0x0a, 0x18, 0x68, 0xdf, 0x5b, 0xbb, 0xb2, 0x33, 0x2b,
+    0xdc, 0x80, 0x58, 0x93, 0x16, 0xd3, 0x27, 0x4a, 0x91, 0xdb, 0x40, 0xc5,
+    0xed, 0x2a, 0x7b, 0xec, 0xd5, 0xee, 0xb4, 0xd1, 0x54, 0xec, 0x83, 0x29,
+    0xd8, 0xa8, 0x3c, 0x6f, 0x1d, 0x4f, 0xed, 0xc3, 0x9a, 0xb1, 0x67, 0xb2,
+    0x7c, 0x55, 0x23, 0x0a, 0x94, 0xe7, 0x2b, 0xb3, 0x33, 0xcd, 0x40, 0x27,
+    0xd3, 0x10, 0x2d, 0xf5, 0x9d, 0x2f, 0xb3, 0xb0, 0x66, 0x55, 0xe8, 0x82,
+    0xb9, 0x73, 0x4c, 0xc0, 0xf1, 0x3c, 0x6f, 0x69, 0x9b, 0xdb, 0xaf, 0xc1,
+    0x4a, 0xf6, 0xe5, 0x91, 0x31, 0x87, 0xa3, 0x04, 0xd5, 0xbc, 0x22, 0x23,
+    0x2d, 0x60, 0x25, 0x49, 0xb7, 0x29, 0xa6, 0xa8, 0xa5, 0xa3, 0xc4, 0xa7,
+    0x03, 0x2b, 0xca, 0x90, 0x7d, 0x5a, 0x6a, 0x66, 0xfe, 0x4c, 0xab, 0x9d,
+    0x42, 0xb3, 0x32, 0xaa, 0xc5, 0x36, 0xbc, 0x01, 0x00, 0xbf, 0x7f, 0xe1,
+    0x1a, 0x3e, 0x39, 0x6d, 0xd3, 0x26, 0xe8, 0x31, 0x05, 0x08, 0xb1, 0x68,
+    0x3b, 0xc0, 0xbb, 0x80, 0xf5, 0xbd, 0x5f, 0x21, 0xfb, 0xa0, 0x82, 0xe4,
+    0x04, 0x08, 0x3d, 0xcf, 0x8a, 0x5b, 0xb3, 0x39, 0x9a, 0xc7, 0x68, 0x8c,
+    0x2e, 0xf5, 0xde, 0xec, 0x55, 0x12, 0x3f, 0xc5, 0xe0, 0xdd, 0x62, 0x59,
+    0x7c, 0xa6, 0x1b, 0x2d, 0x3a, 0x87, 0x90, 0x48, 0xa0, 0x46, 0x38, 0xd4,
+};
+static const uint8_t rsa3072_s[] = {
+    0x14, 0xfd, 0x62, 0xb3, 0xd3, 0xbd, 0xa1, 0x72, 0x48, 0xc0, 0xf5, 0xf6,
+    0x91, 0x18, 0x40, 0xd6, 0x1f, 0x37, 0x45, 0xe5, 0x87, 0x7f, 0xd6, 0xbd,
+    0x31, 0xc8, 0x06, 0x4e, 0x09, 0xe7, 0xc8, 0xe8, 0x04, 0x3a, 0x4b, 0x8e,
+    0xd5, 0x42, 0x82, 0x05, 0xef, 0x29, 0x90, 0x35, 0xf4, 0xd5, 0xef, 0xdc,
+    0xf8, 0x6e, 0x5e, 0xe1, 0xa1, 0x91, 0xc5, 0xdd, 0xff, 0x31, 0x4a, 0x50,
+    0x41, 0x71, 0x19, 0xf4, 0x2b, 0x28, 0xc1, 0xb8, 0x3d, 0xa6, 0x52, 0x63,
+    0x57, 0xcf, 0xb9, 0x26, 0xe3, 0x6e, 0x71, 0x0f, 0x8c, 0x87, 0x8d, 0x7a,
+    0x9e, 0xaa, 0xfa, 0x02, 0xc1, 0xe8, 0xab, 0x15, 0x2a, 0x9e, 0x26, 0x12,
+    0x06, 0x75, 0xee, 0xa0, 0x91, 0x09, 0x8d, 0x71, 0x48, 0xee, 0xd8, 0xa5,
+    0xdc, 0xd5, 0x9d, 0xd9, 0x36, 0x69, 0xcc, 0xde, 0x20, 0x29, 0x44, 0xeb,
+    0x72, 0xe1, 0x81, 0x27, 0x7c, 0x8d, 0x66, 0x9d, 0x35, 0x67, 0xef, 0x8c,
+    0xc2, 0x8b, 0x53, 0xbc, 0xff, 0x7d, 0x37, 0xb9, 0xdb, 0x83, 0x8b, 0x77,
+    0x64, 0x0f, 0x43, 0x12, 0xec, 0x9d, 0x5f, 0x70, 0x28, 0x92, 0xac, 0x7e,
+    0x32, 0xd5, 0xcb, 0x5b, 0xf9, 0x1e, 0xf0, 0x7c, 0xb4, 0x8b, 0x90, 0x22,
+    0xe4, 0x07, 0x14, 0x71, 0x5a, 0x37, 0xdf, 0xe4, 0xa9, 0xa5, 0x44, 0x2d,
+    0x7a, 0xb1, 0x12, 0x75, 0x73, 0xca, 0xe5, 0xaa, 0x08, 0xe4, 0x8b, 0x46,
+    0xc2, 0x91, 0x13, 0x7d, 0x34, 0x72, 0xdc, 0xdf, 0xf4, 0x8e, 0x7f, 0xca,
+    0x67, 0xbd, 0x45, 0x0d, 0x31, 0xc3, 0x2f, 0xeb, 0x76, 0xe4, 0xbc, 0xf3,
+    0x31, 0xe7, 0xfc, 0x30, 0xb3, 0x21, 0xcf, 0x1a, 0xc1, 0x87, 0xf4, 0x55,
+    0x9a, 0xb4, 0xea, 0x1b, 0x45, 0x43, 0x69, 0xa9, 0xf5, 0x7a, 0xda, 0x6f,
+    0x3b, 0xd1, 0xd5, 0x12, 0x04, 0x5b, 0xa8, 0x44, 0x59, 0xf1, 0x95, 0xab,
+    0x05, 0x46, 0xd2, 0xdd, 0xe0, 0xeb, 0x24, 0x7a, 0xbf, 0x82, 0x5c, 0xee,
+    0x8b, 0x75, 0xd0, 0x9b, 0x44, 0x0c, 0xcc, 0x69, 0xf0, 0x27, 0x6e, 0x33,
+    0x51, 0xac, 0x26, 0x79, 0xdf, 0xa6, 0xf4, 0x98, 0x78, 0xeb, 0x57, 0x06,
+    0xaa, 0x44, 0xa1, 0x5e, 0x31, 0x96, 0x21, 0xf7, 0x01, 0x33, 0x7f, 0xd8,
+    0x3b, 0xe4, 0x6e, 0x64, 0x00, 0x63, 0x5f, 0x9e, 0xda, 0x76, 0x9c, 0x23,
+    0x66, 0x07, 0x23, 0xe8, 0x96, 0xfb, 0x0f, 0xf6, 0x72, 0x79, 0x99, 0x10,
+    0x7b, 0x6d, 0xd4, 0x1b, 0xd1, 0x77, 0x43, 0x0f, 0x39, 0x4c, 0x5b, 0x13,
+    0x22, 0xc6, 0xd9, 0x85, 0xea, 0xda, 0x5c, 0xab, 0x04, 0x90, 0x7c, 0x3b,
+    0xe2, 0xee, 0xad, 0x04, 0x9e, 0xf5, 0x43, 0x65, 0x89, 0x20, 0x60, 0x2a,
+    0x30, 0xcc, 0x8c, 0xb8, 0x1e, 0xad, 0x21, 0x7d, 0x1f, 0x8a, 0xdd, 0x6c,
+    0x9c, 0x28, 0x4d, 0xc5, 0xba, 0x05, 0xa5, 0x4a, 0xaf, 0x80, 0xa3, 0xb6,
+};
+static const uint8_t rsa3072_m[] = {
+    0xa2, 0xde, 0x6d, 0x19, 0xe7, 0xc8, 0x1f, 0x08, 0xa5, 0xa2, 0x2b, 0xd2,
+    0x66, 0xc7, 0x8b, 0x46, 0xba, 0xd6, 0xaf, 0x37, 0xc7, 0x7d, 0xc3, 0xef,
+    0x7c, 0xf4, 0x02, 0xbb, 0x66, 0xf2, 0xbe, 0x16, 0x30, 0x8d, 0x59, 0x27,
+    0xcf, 0x12, 0x90, 0x05, 0xda, 0x00, 0x6f, 0x07, 0x6c, 0x13, 0x03, 0xa2,
+    0xef, 0xfc, 0x8c, 0xe8, 0xde, 0xa1, 0x76, 0x20, 0x61, 0xff, 0x0c, 0x20,
+    0x5a, 0xed, 0x16, 0xf1, 0x90, 0xeb, 0xc5, 0xe7, 0xe1, 0x8c, 0x5b, 0x6d,
+    0xe9, 0xab, 0x2a, 0x92, 0x10, 0x80, 0x56, 0x78, 0xba, 0x1e, 0x3c, 0x6d,
+    0x4f, 0xe6, 0x62, 0x7e, 0xe0, 0x89, 0x87, 0xd3, 0x95, 0x9c, 0x89, 0xd2,
+    0x9c, 0x55, 0x07, 0x83, 0xc1, 0x92, 0x7e, 0x7c, 0xec, 0xcf, 0xcb, 0x35,
+    0x72, 0xd6, 0xbf, 0xa2, 0x53, 0x12, 0xbd, 0x4e, 0xdd, 0x73, 0x12, 0xd3,
+    0x13, 0x10, 0xfa, 0x70, 0x18, 0xf2, 0x58, 0xe3, 0x19, 0x15, 0x32, 0xe0,
+    0x25, 0x05, 0x6c, 0x85, 0x7a, 0xe1, 0x61, 0xf7, 0xf4, 0x25, 0x8c, 0x7f,
+    0x2b, 0x07, 0xe7, 0xf5, 0xca, 0xe9, 0x82, 0xcf, 0x52, 0x66, 0x25, 0xc0,
+    0xae, 0x94, 0xe6, 0xed, 0x76, 0x78, 0xdf, 0x63, 0x6c, 0x3a, 0xdd, 0xfb,
+    0x99, 0x34, 0x62, 0x42, 0x68, 0x16, 0x96, 0x93, 0x36, 0xa5, 0xe0, 0xf3,
+    0xc1, 0xbe, 0x6a, 0x53, 0xce, 0x3e, 0x8d, 0x5b, 0x25, 0x86, 0xf2, 0x18,
+    0x8c, 0x95, 0x84, 0x4c, 0xeb, 0xe1, 0x5a, 0x71, 0x7f, 0x21, 0xbc, 0x23,
+    0x72, 0xb0, 0x06, 0x95, 0x26, 0x17, 0x6f, 0x96, 0xab, 0x29, 0x0f, 0x4e,
+    0x71, 0xc7, 0x79, 0xc9, 0x23, 0x64, 0x6c, 0x17, 0x1c, 0x29, 0xcc, 0x36,
+    0x8a, 0xc3, 0x6b, 0xc0, 0x97, 0xf3, 0x69, 0xc8, 0x4a, 0x00, 0x6b, 0xdb,
+    0xf7, 0xf5, 0xc0, 0x70, 0x1e, 0xb9, 0x5a, 0xe7, 0x41, 0xa5, 0x7a, 0x29,
+    0x7a, 0xa4, 0xcf, 0x1b, 0x4e, 0xbc, 0xce, 0xc8, 0xb3, 0x5f, 0xec, 0x4c,
+    0xfd, 0x23, 0x45, 0xd6, 0x5d, 0x21, 0xb6, 0x40, 0x24, 0x68, 0x5b, 0x38,
+    0xf7, 0x74, 0xd5, 0xc2, 0xdf, 0x57, 0x3c, 0x13, 0x8e, 0x4b, 0x8a, 0xe5,
+    0xb2, 0xdd, 0x02, 0xc2, 0x5d, 0xfd, 0xba, 0xdd, 0xa8, 0xad, 0xd2, 0x2c,
+    0x15, 0x98, 0x88, 0x80, 0xcf, 0xe1, 0x08, 0x50, 0xb1, 0x0c, 0xa2, 0x28,
+    0x24, 0xd0, 0xc2, 0xee, 0x46, 0x1c, 0x1e, 0x7b, 0x1b, 0x50, 0x6e, 0xd4,
+    0x59, 0xab, 0xae, 0xfe, 0x1f, 0xb3, 0x95, 0x84, 0x7f, 0x9f, 0x9e, 0x0f,
+    0x6f, 0xf5, 0x0e, 0x03, 0x91, 0x1d, 0xa4, 0x00, 0xc4, 0xe8, 0x54, 0xd4,
+    0x62, 0xd6, 0x30, 0x77, 0xdf, 0xa7, 0x72, 0x2a, 0xe3, 0xdc, 0x9a, 0xc5,
+    0xf0, 0x44, 0x9d, 0x80, 0xc8, 0x77, 0x49, 0x3d, 0x5e, 0xdf, 0x05, 0x0c,
+    0x79, 0xf6, 0x13, 0x15, 0x37, 0x85, 0xca, 0x6a, 0x19, 0xf6, 0x2b, 0xa8,
+};
+
+#endif /* H_RSA_MONT_VECTORS_H__ */
@@ -0,0 +1,440 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Runs boot_go() on the upgrade of an image to a patch release of it, which
+ * differs in its header, three sectors of code and its TLVs, against a
+ * timing model of an internal flash. Built with MCUBOOT_SPARSE_SWAP the
+ * sectors holding the same data in both slots are left as they are,
+ * without it every sector of the image is erased and written.
+ *
+ * Each row is one upgrade: "ns_per_op" is the modelled duration of the
+ * boot doing it, and the number of sector erases is part of the variant,
+ * followed by the scratch wear: the most erases of any scratch sector.
+ *
+ * Every run also interrupts the upgrade, and with swap the revert on the
+ * following boot, at evenly spaced flash writes and erases, boots again
+ * until the boot completes, and checks that the slots hold the expected
+ * images. It then interrupts each swap status write in turn, leaving it
+ * torn: only some bits of it programmed.
+ *
+ * The variants built with MCUBOOT_SWAP_STATUS_COMPACT record the swap
+ * status as bits, reprogramming written units of the trailer. Those built
+ * with MCUBOOT_SWAP_STATUS_JOURNAL record it in a journal partition of two
+ * small sectors, on a second device with such sectors, which it rotates
+ * through several times in each upgrade so that the interruptions also hit
+ * its erases.
+ * Those built with MCUBOOT_SWAP_SCRATCH_RING have a scratch area of that
+ * many windows, each the size of the scratch area of the other variants,
+ * so the swap steps are the same and only the scratch wear changes. With
+ * MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC as well, the window of the next step
+ * is erased ahead; the slots and the scratch area are on a single device,
+ * so that erase is complete before the next operation anyway.
+ */
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The flash functions of bench_flash.c are the backend bootutil reads
+ * through.
+ */
+#define BOOTUTIL_FLASH_CACHE_BACKEND
+
+#include <flash_map_backend/flash_map_backend.h>
+#include <sysflash/sysflash.h>
+
+#include "bootutil/bootutil.h"
+#include "bootutil/bootutil_public.h"
+#include "bootutil/image.h"
+#include "bootutil/fault_injection_hardening.h"
+#include "bootutil/crypto/sha.h"
+#include "bootutil_priv.h"
+#include "bootutil_misc.h"
+
+#include "bench.h"
+#include "bench_flash.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+#define BENCH_SECTOR_SIZE  0x1000
+#define BENCH_SLOT_SIZE    0x20000
+#if defined(MCUBOOT_SWAP_SCRATCH_RING)
+#define BENCH_SCRATCH_SIZE (MCUBOOT_SWAP_SCRATCH_RING * 0x4000)
+#else
+#define BENCH_SCRATCH_SIZE 0x4000
+#endif
+#define BENCH_IMAGE_SIZE   0x18000
+#define BENCH_SLOTS_SIZE   (2 * BENCH_SLOT_SIZE + BENCH_SCRATCH_SIZE)
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+#define BENCH_JOURNAL_SECTOR_SIZE 0x100
+#define BENCH_JOURNAL_SIZE (2 * BENCH_JOURNAL_SECTOR_SIZE)
+#else
+#define BENCH_JOURNAL_SIZE 0
+#endif
+
+/* Typical timings of an internal flash. */
+#define BENCH_READ_BYTE_NS 20ull
+#define BENCH_PROG_BYTE_NS 2500ull
+#define BENCH_ERASE_NS     40000000ull
+
+/* Number of interruptions of each power failure sweep. */
+#define BENCH_INTERRUPTIONS 200
+
+static uint8_t bench_flash[BENCH_SLOTS_SIZE];
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+static uint8_t bench_journal[BENCH_JOURNAL_SIZE];
+#endif
+static unsigned bench_scratch_erases[BENCH_SCRATCH_SIZE / BENCH_SECTOR_SIZE];
+
+/* The compact status programs more bits of a written unit. */
+#if defined(MCUBOOT_SWAP_STATUS_COMPACT)
+#define BENCH_REPROGRAM true
+#else
+#define BENCH_REPROGRAM false
+#endif
+
+static const struct bench_flash_device bench_devices[] = {
+    {
+        .data = bench_flash,
+        .size = BENCH_SLOTS_SIZE,
+        .sector_size = BENCH_SECTOR_SIZE,
+        .read_byte_ns = BENCH_READ_BYTE_NS,
+        .prog_byte_ns = BENCH_PROG_BYTE_NS,
+        .erase_ns = BENCH_ERASE_NS,
+        .reprogram = BENCH_REPROGRAM,
+    },
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    {
+        .data = bench_journal,
+        .size = BENCH_JOURNAL_SIZE,
+        .sector_size = BENCH_JOURNAL_SECTOR_SIZE,
+        .read_byte_ns = BENCH_READ_BYTE_NS,
+        .prog_byte_ns = BENCH_PROG_BYTE_NS,
+        .erase_ns = BENCH_ERASE_NS,
+        .reprogram = BENCH_REPROGRAM,
+    },
+#endif
+};
+
+#define BENCH_DEVICES (sizeof(bench_devices) / sizeof(bench_devices[0]))
+
+/* Flash writes and erases so far, swap status writes among them, and the
+ * one to interrupt, if not 0. With bench_torn set, the one to interrupt is
+ * a swap status write and it is left torn; the other trailer fields are
+ * assumed to be written whole, as MCUboot does.
+ */
+static unsigned bench_ops;
+static unsigned bench_status_ops;
+static unsigned bench_interrupt_at;
+static bool bench_torn;
+static jmp_buf bench_reset;
+
+static const struct flash_area bench_areas[] = {
+    {
+        .fa_id = FLASH_AREA_IMAGE_PRIMARY(0),
+        .fa_device_id = 0,
+        .fa_off = 0,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_SECONDARY(0),
+        .fa_device_id = 0,
+        .fa_off = BENCH_SLOT_SIZE,
+        .fa_size = BENCH_SLOT_SIZE,
+    },
+    {
+        .fa_id = FLASH_AREA_IMAGE_SCRATCH,
+        .fa_device_id = 0,
+        .fa_off = 2 * BENCH_SLOT_SIZE,
+        .fa_size = BENCH_SCRATCH_SIZE,
+    },
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    {
+        .fa_id = FLASH_AREA_SWAP_STATUS,
+        .fa_device_id = 1,
+        .fa_off = 0,
+        .fa_size = BENCH_JOURNAL_SIZE,
+    },
+#endif
+};
+
+#define BENCH_AREAS (sizeof(bench_areas) / sizeof(bench_areas[0]))
+
+/* Sectors of the patch release holding other code than the base release. */
+static const uint32_t bench_patched[] = { 0x5000, 0x9000, 0x11000 };
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s: %s\n", BENCH_VARIANT, what);
+    exit(1);
+}
+
+int
+sim_log_enabled(int level)
+{
+    (void)level;
+    return 0;
+}
+
+void
+sim_assert(int x, const char *assertion, const char *file, unsigned int line,
+           const char *function)
+{
+    if (!x) {
+        fprintf(stderr, "%s: assertion %s failed in %s at %s:%u\n", BENCH_VARIANT,
+                assertion, function, file, line);
+        exit(1);
+    }
+}
+
+/* Counts a write or an erase; whether it is the one to interrupt. */
+static bool
+bench_op_interrupted(bool status)
+{
+    bench_ops++;
+    if (status) {
+        bench_status_ops++;
+    }
+
+    if (bench_interrupt_at == 0 ||
+        (bench_torn ? !status || bench_status_ops != bench_interrupt_at :
+                      bench_ops != bench_interrupt_at)) {
+        return false;
+    }
+
+    bench_interrupt_at = 0;
+    return true;
+}
+
+/* Whether a write at off of fa is one of the swap status. */
+static bool
+bench_status_write(const struct flash_area *fa, uint32_t off)
+{
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    if (fa->fa_id == FLASH_AREA_SWAP_STATUS) {
+        return true;
+    }
+#endif
+    return off >= boot_status_off(fa) && off < boot_swap_size_off(fa);
+}
+
+/* Interrupts the chosen write or erase, and counts the scratch erases. */
+static void
+bench_flash_op(const struct flash_area *fa, uint32_t off, uint8_t *dst,
+               const void *src, uint32_t len)
+{
+    uint32_t i;
+
+    if (bench_op_interrupted(src != NULL && bench_status_write(fa, off))) {
+        /* A torn status write programs only some of the bits of its first
+         * bytes, leaving them with values that were never written.
+         */
+        if (bench_torn) {
+            for (i = 0; i < (len + 1) / 2; i++) {
+                dst[i] &= ((const uint8_t *)src)[i] | 0xf0;
+            }
+        }
+        longjmp(bench_reset, 1);
+    }
+
+    if (src == NULL && fa->fa_id == FLASH_AREA_IMAGE_SCRATCH) {
+        for (i = off / BENCH_SECTOR_SIZE; i < (off + len) / BENCH_SECTOR_SIZE; i++) {
+            bench_scratch_erases[i]++;
+        }
+    }
+}
+
+/* The code of the base release (version 1) or of the patch release. */
+static uint8_t
+bench_code(uint32_t off, uint8_t version)
+{
+    size_t i;
+
+    if (version > 1) {
+        for (i = 0; i < sizeof(bench_patched) / sizeof(bench_patched[0]); i++) {
+            if (off >= bench_patched[i] && off < bench_patched[i] + BENCH_SECTOR_SIZE) {
+                return (uint8_t)(off * 13 + 0x5a);
+            }
+        }
+    }
+
+    return (uint8_t)(off * 7);
+}
+
+/* Writes the image of a release, with its SHA-256 TLV, to a slot. */
+static void
+write_image(const struct flash_area *fa, uint8_t version)
+{
+    bootutil_sha_context sha;
+    struct image_header hdr;
+    struct image_tlv_info info;
+    struct image_tlv tlv;
+    uint8_t *p = bench_flash_data(fa, 0, BENCH_SLOT_SIZE);
+    uint32_t off;
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.ih_magic = IMAGE_MAGIC;
+    hdr.ih_hdr_size = IMAGE_HEADER_SIZE;
+    hdr.ih_img_size = BENCH_IMAGE_SIZE - IMAGE_HEADER_SIZE;
+    hdr.ih_ver.iv_major = 1;
+    hdr.ih_ver.iv_revision = version;
+    memcpy(p, &hdr, sizeof(hdr));
+    for (off = IMAGE_HEADER_SIZE; off < BENCH_IMAGE_SIZE; off++) {
+        p[off] = bench_code(off, version);
+    }
+
+    p += BENCH_IMAGE_SIZE;
+    info.it_magic = IMAGE_TLV_INFO_MAGIC;
+    info.it_tlv_tot = sizeof(info) + sizeof(tlv) + 32;
+    memcpy(p, &info, sizeof(info));
+    tlv.it_type = IMAGE_TLV_SHA256;
+    tlv.it_len = 32;
+    memcpy(p + sizeof(info), &tlv, sizeof(tlv));
+
+    bootutil_sha_init(&sha);
+    bootutil_sha_update(&sha, bench_flash_data(fa, 0, 1), BENCH_IMAGE_SIZE);
+    bootutil_sha_finish(&sha, p + sizeof(info) + sizeof(tlv));
+    bootutil_sha_drop(&sha);
+}
+
+/* The base release in the primary slot, and the patch release in the
+ * secondary slot, marked for a test upgrade.
+ */
+static void
+build_slots(void)
+{
+    memset(bench_flash, 0xff, sizeof(bench_flash));
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    memset(bench_journal, 0xff, sizeof(bench_journal));
+#endif
+    write_image(&bench_areas[0], 1);
+    write_image(&bench_areas[1], 2);
+    if (boot_write_magic(&bench_areas[1]) != 0) {
+        fail("marking the upgrade failed");
+    }
+}
+
+/* Whether the image of a release is in a slot. */
+static bool
+slot_holds(const struct flash_area *fa, uint8_t version)
+{
+    const uint8_t *p = bench_flash_data(fa, 0, BENCH_SLOT_SIZE);
+    const struct image_header *hdr = (const struct image_header *)p;
+    uint32_t off;
+
+    if (hdr->ih_magic != IMAGE_MAGIC || hdr->ih_ver.iv_revision != version) {
+        return false;
+    }
+    for (off = IMAGE_HEADER_SIZE; off < BENCH_IMAGE_SIZE; off++) {
+        if (p[off] != bench_code(off, version)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Boots until a boot completes, through the interruption if one is set. */
+static void
+boot_once(void)
+{
+    static struct boot_rsp rsp;
+    FIH_DECLARE(fih_rc, FIH_FAILURE);
+
+    setjmp(bench_reset);
+    FIH_CALL(boot_go, fih_rc, &rsp);
+    if (FIH_NOT_EQ(fih_rc, FIH_SUCCESS)) {
+        fail("boot_go failed");
+    }
+}
+
+/* Upgrades, and with swap reverts on the next boot, interrupting the
+ * interrupt_at'th write or erase if it is not 0.
+ */
+static void
+run(unsigned interrupt_at)
+{
+    build_slots();
+    bench_ops = 0;
+    bench_status_ops = 0;
+    bench_interrupt_at = interrupt_at;
+
+    boot_once();
+    if (!slot_holds(&bench_areas[0], 2)) {
+        fail("patch release not installed");
+    }
+
+#ifndef MCUBOOT_OVERWRITE_ONLY
+    boot_once();
+    if (!slot_holds(&bench_areas[0], 1) || !slot_holds(&bench_areas[1], 2)) {
+        fail("base release not restored");
+    }
+#endif
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iters = bench_iterations(argc, argv, 100);
+    uint64_t total_ns = 0;
+    unsigned total_ops;
+    unsigned total_status_ops;
+    unsigned erases = 0;
+    unsigned scratch_wear = 0;
+    char variant[96];
+    unsigned k;
+    size_t i;
+    FIH_DECLARE(fih_rc, FIH_FAILURE);
+    struct boot_rsp rsp;
+
+    bench_flash_init(bench_devices, BENCH_DEVICES, bench_areas, BENCH_AREAS,
+                     bench_flash_op);
+
+    for (k = 0; k < iters; k++) {
+        build_slots();
+
+        bench_flash_clear();
+        memset(bench_scratch_erases, 0, sizeof(bench_scratch_erases));
+        FIH_CALL(boot_go, fih_rc, &rsp);
+        if (FIH_NOT_EQ(fih_rc, FIH_SUCCESS) || !slot_holds(&bench_areas[0], 2)) {
+            fail("upgrade failed");
+        }
+        total_ns += bench_flash_ns;
+        erases = bench_flash_erased_sectors;
+        scratch_wear = 0;
+        for (i = 0; i < sizeof(bench_scratch_erases) / sizeof(bench_scratch_erases[0]); i++) {
+            if (bench_scratch_erases[i] > scratch_wear) {
+                scratch_wear = bench_scratch_erases[i];
+            }
+        }
+    }
+
+    run(0);
+    total_ops = bench_ops;
+    total_status_ops = bench_status_ops;
+    for (k = 1; k <= BENCH_INTERRUPTIONS; k++) {
+        run(1 + (unsigned)((uint64_t)(total_ops - 1) * k / BENCH_INTERRUPTIONS));
+    }
+
+    /* And at each swap status write, left torn. */
+    bench_torn = true;
+    for (k = 1; k <= total_status_ops; k++) {
+        run(k);
+    }
+    bench_torn = false;
+
+    bench_header();
+    snprintf(variant, sizeof(variant), "%s_%u_erases_%u_scratch_wear", BENCH_VARIANT,
+             erases, scratch_wear);
+    bench_report("upgrade_patch", variant, iters, 0, total_ns);
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Decodes serial recovery image upload requests the same way bs_upload()
+ * does, with the key table grown by a number of unused keys, to show how
+ * the per-chunk decode cost depends on the number of handled keys and on
+ * the order the keys are sent in.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zcbor_encode.h"
+#include "zcbor_bulk.h"
+
+#include "bench.h"
+
+#define CHUNK_SIZE      512
+#define MAX_EXTRA_KEYS  16
+
+static const char *extra_keys[MAX_EXTRA_KEYS] = {
+    "upgrade", "sha", "confirm", "hash", "image_id", "slot", "mode", "rc",
+    "offset", "length", "dataset", "lenient", "o", "d", "imagever", "z",
+};
+
+static uint8_t chunk[CHUNK_SIZE];
+static uint8_t frame[CHUNK_SIZE + 64];
+
+/* Encodes an upload request in the order mcumgr clients send it. */
+static size_t
+encode_upload(bool reversed)
+{
+    zcbor_state_t zse[2];
+    bool ok;
+
+    zcbor_new_encode_state(zse, ZCBOR_ARRAY_SIZE(zse), frame, sizeof(frame), 0);
+
+    ok = zcbor_map_start_encode(zse, 4);
+    if (!reversed) {
+        ok = ok && zcbor_tstr_put_lit(zse, "image") && zcbor_uint32_put(zse, 0) &&
+             zcbor_tstr_put_lit(zse, "data") && zcbor_bstr_encode_ptr(zse, (const char *)chunk, sizeof(chunk)) &&
+             zcbor_tstr_put_lit(zse, "len") && zcbor_uint32_put(zse, 0x40000) &&
+             zcbor_tstr_put_lit(zse, "off") && zcbor_uint32_put(zse, 0x1000);
+    } else {
+        ok = ok && zcbor_tstr_put_lit(zse, "off") && zcbor_uint32_put(zse, 0x1000) &&
+             zcbor_tstr_put_lit(zse, "len") && zcbor_uint32_put(zse, 0x40000) &&
+             zcbor_tstr_put_lit(zse, "data") && zcbor_bstr_encode_ptr(zse, (const char *)chunk, sizeof(chunk)) &&
+             zcbor_tstr_put_lit(zse, "image") && zcbor_uint32_put(zse, 0);
+    }
+    ok = ok && zcbor_map_end_encode(zse, 4);
+
+    if (!ok) {
+        fprintf(stderr, "failed to encode upload request\n");
+        exit(1);
+    }
+
+    return zse->payload_mut - frame;
+}
+
+static void
+run(const char *variant, size_t frame_len, int extra, unsigned iterations)
+{
+    struct zcbor_string data;
+    uint32_t img_num;
+    size_t img_size;
+    size_t img_off;
+    uint32_t unused;
+    struct zcbor_map_decode_key_val map[4 + MAX_EXTRA_KEYS] = {
+        ZCBOR_MAP_DECODE_KEY_DECODER("image", zcbor_uint32_decode, &img_num),
+        ZCBOR_MAP_DECODE_KEY_DECODER("data", zcbor_bstr_decode, &data),
+        ZCBOR_MAP_DECODE_KEY_DECODER("len", zcbor_size_decode, &img_size),
+        ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_size_decode, &img_off),
+    };
+    const int map_size = 4 + extra;
+    uint64_t start;
+    uint64_t ns;
+    size_t decoded;
+    char name[32];
+    unsigned i;
+    int k;
+
+    for (k = 0; k < extra; k++) {
+        struct zcbor_map_decode_key_val *e = &map[4 + k];
+
+        e->key.value = (const uint8_t *)extra_keys[k];
+        e->key.len = strlen(extra_keys[k]);
+        e->decoder = (zcbor_decoder_t *)zcbor_uint32_decode;
+        e->value_ptr = &unused;
+    }
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++) {
+        zcbor_state_t zsd[4];
+
+        for (k = 0; k < map_size; k++) {
+            map[k].found = false;
+        }
+
+        zcbor_new_decode_state(zsd, ZCBOR_ARRAY_SIZE(zsd), frame, frame_len, 1, NULL, 0);
+        if (zcbor_map_decode_bulk(zsd, map, map_size, &decoded) != 0 || decoded != 4 ||
+            data.len != CHUNK_SIZE) {
+            fprintf(stderr, "failed to decode upload request\n");
+            exit(1);
+        }
+    }
+    ns = bench_now_ns() - start;
+
+    snprintf(name, sizeof(name), "%s/keys=%d", variant, map_size);
+    bench_report("upload_chunk_decode", name, iterations, CHUNK_SIZE, ns);
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned iterations = bench_iterations(argc, argv, 2000000);
+    size_t len;
+    int extra;
+
+    bench_header();
+
+    for (extra = 0; extra <= MAX_EXTRA_KEYS; extra += 4) {
+        len = encode_upload(false);
+        run("in_order", len, extra, iterations);
+        len = encode_upload(true);
+        run("reversed", len, extra, iterations);
+    }
+
+    return 0;
+}
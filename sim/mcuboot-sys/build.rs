@@ -48,11 +48,21 @@ fn main() {
     let mbedtls_v4 = env::var("CARGO_FEATURE_MBEDTLS_V4").is_ok();
     let logical_sectors_4k = env::var("CARGO_FEATURE_LOGICAL_SECTORS_4K").is_ok();
     let logical_sectors_128k = env::var("CARGO_FEATURE_LOGICAL_SECTORS_128K").is_ok();
+    let hash_blake2s = env::var("CARGO_FEATURE_HASH_BLAKE2S").is_ok();
+    let flash_read_cache = env::var("CARGO_FEATURE_FLASH_READ_CACHE").is_ok();
+    let metadata_prefetch = env::var("CARGO_FEATURE_METADATA_PREFETCH").is_ok();
+    let interleaved_upgrade = env::var("CARGO_FEATURE_INTERLEAVED_UPGRADE").is_ok();
+    let sparse_swap = env::var("CARGO_FEATURE_SPARSE_SWAP").is_ok();
+    let swap_status_compact = env::var("CARGO_FEATURE_SWAP_STATUS_COMPACT").is_ok();
+    let swap_status_journal = env::var("CARGO_FEATURE_SWAP_STATUS_JOURNAL").is_ok();
+    let swap_scratch_ring = env::var("CARGO_FEATURE_SWAP_SCRATCH_RING").is_ok();
+    let warm_boot_cache = env::var("CARGO_FEATURE_WARM_BOOT_CACHE").is_ok();
 
     let mut conf = CachedBuild::new();
     conf.conf.define("__BOOTSIM__", None);
     conf.conf.define("MCUBOOT_HAVE_LOGGING", None);
     conf.conf.define("MCUBOOT_USE_FLASH_AREA_GET_SECTORS", None);
+    conf.conf.define("MCUBOOT_USE_FLASH_AREA_ERASE_BLOCKS", None);
     conf.conf.define("MCUBOOT_HAVE_ASSERT_H", None);
     conf.conf.define("MCUBOOT_MAX_IMG_SECTORS", Some("128"));
 
@@ -88,6 +98,14 @@ fn main() {
         panic!("Downgrade prevention requires overwrite only");
     }
 
+    if interleaved_upgrade && !overwrite_only {
+        panic!("Interleaved upgrade requires overwrite only");
+    }
+
+    if swap_scratch_ring && (overwrite_only || swap_move || swap_offset || ram_load || direct_xip) {
+        panic!("The scratch ring requires swap using scratch");
+    }
+
     if bootstrap {
         conf.conf.define("MCUBOOT_BOOTSTRAP", None);
 
@@ -116,6 +134,10 @@ fn main() {
         conf.conf.define("MCUBOOT_DIRECT_XIP", None);
     }
 
+    if warm_boot_cache {
+        conf.conf.define("MCUBOOT_WARM_BOOT_CACHE", None);
+    }
+
     if hw_rollback_protection {
         conf.conf.define("MCUBOOT_HW_ROLLBACK_PROT", None);
         conf.file("csupport/security_cnt.c");
@@ -141,6 +163,23 @@ fn main() {
         panic!("custom-crypto encryption only supports enc-ec256-mbedtls, enc-aes256-ec256, and custom-enc-crypto");
     }
 
+    if warm_boot_cache && !(direct_xip || ram_load) {
+        panic!("warm-boot-cache requires direct-xip or ram-load");
+    }
+
+    // The record is authenticated with HMAC-SHA256, which only the Mbed TLS
+    // build used for RSA signatures provides here.
+    if warm_boot_cache && !(sig_rsa || sig_rsa3072) {
+        panic!("warm-boot-cache requires sig-rsa or sig-rsa3072");
+    }
+
+    // The simulator can only sign a BLAKE2s digest with ed25519; ring hashes
+    // the message itself for the other signature types.
+    if hash_blake2s && (sig_rsa || sig_rsa3072 || sig_ecdsa || sig_ecdsa_mbedtls ||
+                        sig_ecdsa_psa || custom_crypto) {
+        panic!("hash-blake2s is only supported without a signature or with sig-ed25519");
+    }
+
     if mbedtls_v4 && !sig_ecdsa_psa {
         panic!("mbedtls-v4 is only supported in combination with sig-ecdsa-psa");
     }
@@ -599,6 +638,37 @@ fn main() {
     conf.file("../../boot/bootutil/src/bootutil_find_key.c");
     conf.file("../../boot/bootutil/src/bootutil_img_hash.c");
     conf.file("../../boot/bootutil/src/bootutil_img_security_cnt.c");
+    if flash_read_cache {
+        conf.conf.define("MCUBOOT_FLASH_READ_CACHE", None);
+    }
+    if metadata_prefetch {
+        conf.conf.define("MCUBOOT_METADATA_PREFETCH", None);
+    }
+    if interleaved_upgrade {
+        conf.conf.define("MCUBOOT_INTERLEAVED_UPGRADE", None);
+        conf.conf.define("MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC", None);
+    }
+    if sparse_swap {
+        conf.conf.define("MCUBOOT_SPARSE_SWAP", None);
+    }
+    if swap_status_compact {
+        conf.conf.define("MCUBOOT_SWAP_STATUS_COMPACT", None);
+    }
+    if swap_status_journal {
+        if swap_status_compact {
+            panic!("The swap-status-journal and swap-status-compact features are exclusive");
+        }
+        conf.conf.define("MCUBOOT_SWAP_STATUS_JOURNAL", None);
+    }
+    if swap_scratch_ring {
+        // Must agree with c::swap_scratch_ring().
+        conf.conf.define("MCUBOOT_SWAP_SCRATCH_RING", Some("2"));
+        conf.conf.define("MCUBOOT_USE_FLASH_AREA_ERASE_ASYNC", None);
+    }
+    if hash_blake2s {
+        conf.conf.define("MCUBOOT_BLAKE2S", None);
+        conf.file("../../boot/bootutil/src/blake2s.c");
+    }
     if sig_rsa || sig_rsa3072 {
         conf.file("../../boot/bootutil/src/image_rsa.c");
     } else if sig_ecdsa || sig_ecdsa_mbedtls || sig_ecdsa_psa || custom_crypto {
@@ -611,13 +681,17 @@ fn main() {
     if ram_load {
         conf.file("../../boot/bootutil/src/ram_load.c");
     }
+    conf.file("../../boot/bootutil/src/warm_boot.c");
     conf.file("../../boot/bootutil/src/swap_misc.c");
     conf.file("../../boot/bootutil/src/swap_scratch.c");
     conf.file("../../boot/bootutil/src/swap_move.c");
     conf.file("../../boot/bootutil/src/swap_offset.c");
+    conf.file("../../boot/bootutil/src/swap_journal.c");
     conf.file("../../boot/bootutil/src/caps.c");
     conf.file("../../boot/bootutil/src/bootutil_misc.c");
     conf.file("../../boot/bootutil/src/bootutil_area.c");
+    conf.file("../../boot/bootutil/src/bootutil_flash_cache.c");
+    conf.file("../../boot/bootutil/src/bootutil_metadata.c");
     conf.file("../../boot/bootutil/src/bootutil_loader.c");
     conf.file("../../boot/bootutil/src/bootutil_public.c");
     conf.file("../../boot/bootutil/src/tlv.c");
@@ -23,6 +23,27 @@ static inline uint32_t flash_sector_get_size(const struct flash_sector *fs)
 	return fs->fs_size;
 }
 
+/*
+ * Sizes of the erase blocks, larger than a sector, erased by a single
+ * flash_area_erase(); see run.c.
+ */
+uint32_t flash_area_erase_blocks(const struct flash_area *fa);
+
+/*
+ * Start of an erase and the busy flag of its device; the simulated flash
+ * erases at once, see run.c.
+ */
+int flash_area_erase_start(const struct flash_area *fa, uint32_t off, uint32_t len);
+int flash_area_erase_busy(const struct flash_area *fa);
+
+/*
+ * Not provided by the simulator, whose flash is not addressable; host
+ * benchmarks over RAM backed areas define them.
+ */
+int flash_area_map(const struct flash_area *fa, uint32_t off, uint32_t len,
+                   const void **ptr);
+void flash_area_unmap(const struct flash_area *fa, const void *ptr, uint32_t len);
+
 #define FLASH_DEVICE_ID 0
 
 static inline uint8_t flash_area_get_device_id(const struct flash_area *fa)
@@ -7,11 +7,17 @@
 #include <string.h>
 #include <bootutil/bootutil.h>
 #include <bootutil/image.h>
+#include <bootutil/warm_boot.h>
 #include <errno.h>
+#include <stdbool.h>
 
 #include <flash_map_backend/flash_map_backend.h>
 
+/* This is the flash backend, bootutil's read cache must not redirect it. */
+#define BOOTUTIL_FLASH_CACHE_BACKEND
+
 #include "../../../boot/bootutil/src/bootutil_priv.h"
+#include "../../../boot/bootutil/src/bootutil_misc.h"
 #include "bootsim.h"
 
 #ifdef MCUBOOT_ENCRYPT_RSA
@@ -56,6 +62,7 @@ struct sim_context {
     int jumped;
     uint8_t c_asserts;
     uint8_t c_catch_asserts;
+    uint8_t c_tear_status_writes;
     jmp_buf boot_jmpbuf;
 };
 
@@ -409,6 +416,42 @@ int flash_area_read(const struct flash_area *area, uint32_t off, void *dst,
     return sim_flash_read(area->fa_device_id, area->fa_off + off, dst, len);
 }
 
+/* Whether a write at off of area is one of the swap status. */
+static bool
+sim_is_status_write(const struct flash_area *area, uint32_t off)
+{
+#if defined(MCUBOOT_SWAP_STATUS_JOURNAL)
+    if (area->fa_id == FLASH_AREA_SWAP_STATUS) {
+        return true;
+    }
+#endif
+    return off >= boot_status_off(area) && off < boot_swap_size_off(area);
+}
+
+/*
+ * Leaves an interrupted status write torn, as a power failure while
+ * programming it would: only the low bits of its first half are
+ * programmed, so it holds values that were never written.
+ */
+static void
+sim_tear_write(const struct flash_area *area, uint32_t off, const void *src,
+               uint32_t len)
+{
+    uint8_t buf[BOOT_MAX_ALIGN * 4];
+    uint8_t erased_val = sim_flash_erased_val(area->fa_device_id);
+    uint32_t i;
+
+    if (len > sizeof(buf)) {
+        return;
+    }
+
+    memset(buf, erased_val, len);
+    for (i = 0; i < (len + 1) / 2; i++) {
+        buf[i] = erased_val ^ ((((const uint8_t *)src)[i] ^ erased_val) & 0x0f);
+    }
+    sim_flash_write(area->fa_device_id, area->fa_off + off, buf, len);
+}
+
 int flash_area_write(const struct flash_area *area, uint32_t off, const void *src,
                      uint32_t len)
 {
@@ -416,6 +459,9 @@ int flash_area_write(const struct flash_area *area, uint32_t off, const void *sr
                  area->fa_id, off, len);
     struct sim_context *ctx = sim_get_context();
     if (--(ctx->flash_counter) == 0) {
+        if (ctx->c_tear_status_writes && sim_is_status_write(area, off)) {
+            sim_tear_write(area, off, src, len);
+        }
         ctx->jumped++;
         longjmp(ctx->boot_jmpbuf, 1);
     }
@@ -434,6 +480,82 @@ int flash_area_erase(const struct flash_area *area, uint32_t off, uint32_t len)
     return sim_flash_erase(area->fa_device_id, area->fa_off + off, len);
 }
 
+/*
+ * Pretend to have the 32 KiB and 64 KiB block erase of SPI NOR devices,
+ * so that the erase planner in bootutil gets exercised; the simulated flash
+ * erases any range of whole sectors.
+ */
+uint32_t flash_area_erase_blocks(const struct flash_area *area)
+{
+    (void)area;
+    return 0x8000 | 0x10000;
+}
+
+/*
+ * The simulated flash has no erase time, so an erase is complete when it
+ * is started and the device is never busy.
+ */
+int flash_area_erase_start(const struct flash_area *area, uint32_t off, uint32_t len)
+{
+    return flash_area_erase(area, off, len);
+}
+
+int flash_area_erase_busy(const struct flash_area *area)
+{
+    (void)area;
+    return 0;
+}
+
+#ifdef MCUBOOT_WARM_BOOT_CACHE
+/*
+ * The record of the last boot, kept per test thread like retained RAM would
+ * be kept across resets. Until a test enables it, the record is lost, as on
+ * a cold boot.
+ */
+static __thread bool warm_boot_enabled;
+static __thread uint8_t warm_boot_record[1024];
+static __thread size_t warm_boot_record_len;
+static __thread uint8_t warm_boot_key_val;
+
+void sim_warm_boot_enable(bool enable)
+{
+    warm_boot_enabled = enable;
+    warm_boot_record_len = 0;
+}
+
+void sim_warm_boot_set_key(uint8_t key)
+{
+    warm_boot_key_val = key;
+}
+
+int boot_warm_boot_key(uint8_t key[BOOT_WARM_BOOT_KEY_SIZE])
+{
+    memset(key, warm_boot_key_val, BOOT_WARM_BOOT_KEY_SIZE);
+    return 0;
+}
+
+int boot_warm_boot_record_read(void *data, size_t len)
+{
+    if (!warm_boot_enabled || len != warm_boot_record_len) {
+        return -1;
+    }
+    memcpy(data, warm_boot_record, len);
+    return 0;
+}
+
+int boot_warm_boot_record_write(const void *data, size_t len)
+{
+    if (len > sizeof(warm_boot_record)) {
+        return -1;
+    }
+    if (warm_boot_enabled) {
+        memcpy(warm_boot_record, data, len);
+        warm_boot_record_len = len;
+    }
+    return 0;
+}
+#endif
+
 int flash_area_to_sectors(int idx, int *cnt, struct flash_area *ret)
 {
     int rc = 0;
@@ -96,6 +96,7 @@ pub struct CSimContext {
     pub jumped: libc::c_int,
     pub c_asserts: u8,
     pub c_catch_asserts: u8,
+    pub c_tear_status_writes: u8,
     // NOTE: Always leave boot_jmpbuf declaration at the end; this should
     // store a "jmp_buf" which is arch specific and not defined by libc crate.
     // The size below is enough to store data on a x86_64 machine.
@@ -109,6 +110,7 @@ impl Default for CSimContext {
             jumped: 0,
             c_asserts: 0,
             c_catch_asserts: 0,
+            c_tear_status_writes: 0,
             boot_jmpbuf: [0; 48],
         }
     }
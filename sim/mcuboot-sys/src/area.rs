@@ -166,6 +166,8 @@ impl AreaDesc {
         self.areas.iter()
             .filter(|area| !area.is_empty())
             .filter(move |area| with_scratch || area[0].flash_id != FlashId::ImageScratch)
+            // The swap status journal is not divided into logical sectors.
+            .filter(|area| area[0].flash_id != FlashId::SwapStatus)
     }
 
     /// Whether every checked area can be represented by logical sectors of
@@ -190,6 +192,42 @@ impl AreaDesc {
         })
     }
 
+    /// Whether the scratch area splits into `windows` windows of whole
+    /// erase sectors, each holding the largest slot sector, as
+    /// `boot_slots_compatible()` requires of MCUBOOT_SWAP_SCRATCH_RING.  With
+    /// logical sectors the windows must also be made of whole logical
+    /// sectors of `logical` bytes.
+    pub fn supports_scratch_ring(&self, windows: usize, logical: usize) -> bool {
+        let scratch = match self.get_area_sectors(FlashId::ImageScratch) {
+            Some(scratch) => scratch,
+            None => return false,
+        };
+        let size: usize = scratch.iter().map(|sector| sector.size as usize).sum();
+        if windows == 0 || size % windows != 0 {
+            return false;
+        }
+        let window = size / windows;
+        if logical != 0 && window % logical != 0 {
+            return false;
+        }
+
+        let mut offset = 0usize;
+        let on_boundaries = scratch.iter().all(|sector| {
+            let sector_size = sector.size as usize;
+            let fits = offset / window == (offset + sector_size - 1) / window;
+            offset += sector_size;
+            fits
+        });
+
+        on_boundaries && self.areas.iter()
+            .filter(|area| !area.is_empty())
+            .filter(|area| area[0].flash_id != FlashId::ImageScratch &&
+                           area[0].flash_id != FlashId::SwapStatus)
+            .all(|area| area.iter().all(|sector| {
+                (sector.size as usize).max(logical) <= window
+            }))
+    }
+
     /// Whether every checked area is already built from erase pages of
     /// exactly `size`, so logical sectors of that size change nothing about
     /// the erase units the bootloader sees.
@@ -239,6 +277,7 @@ pub enum FlashId {
     ImageScratch = 3,
     Image2 = 4,
     Image3 = 5,
+    SwapStatus = 6,
 }
 
 impl Default for FlashId {
@@ -79,10 +79,34 @@ pub const fn logical_sector_size() -> usize {
     0
 }
 
+/// The number of scratch windows compiled into MCUboot, or zero when the
+/// scratch ring is disabled.  Must agree with the MCUBOOT_SWAP_SCRATCH_RING
+/// that build.rs defines for the same features.
+pub const fn swap_scratch_ring() -> usize {
+    #[cfg(feature = "swap-scratch-ring")]
+    { return 2; }
+    #[allow(unreachable_code)]
+    0
+}
+
 /// Invoke the bootloader on this flash device.
 pub fn boot_go(multiflash: &mut SimMultiFlash, areadesc: &AreaDesc,
                counter: Option<&mut i32>, image_index: Option<i32>,
                catch_asserts: bool) -> BootGoResult {
+    boot_go_with(multiflash, areadesc, counter, image_index, catch_asserts, false)
+}
+
+/// Invoke the bootloader on this flash device, interrupting it at the
+/// flash operation the counter gives.  If that is a swap status write, it
+/// is left torn: only some of its bits are programmed.
+pub fn boot_go_tearing_status(multiflash: &mut SimMultiFlash, areadesc: &AreaDesc,
+                              counter: &mut i32) -> BootGoResult {
+    boot_go_with(multiflash, areadesc, Some(counter), None, false, true)
+}
+
+fn boot_go_with(multiflash: &mut SimMultiFlash, areadesc: &AreaDesc,
+                counter: Option<&mut i32>, image_index: Option<i32>,
+                catch_asserts: bool, tear_status_writes: bool) -> BootGoResult {
     init_crypto();
 
     for (&dev_id, flash) in multiflash.iter_mut() {
@@ -94,6 +118,7 @@ pub fn boot_go(multiflash: &mut SimMultiFlash, areadesc: &AreaDesc,
             Some(ref c) => **c as libc::c_int
         },
         c_catch_asserts: if catch_asserts { 1 } else { 0 },
+        c_tear_status_writes: if tear_status_writes { 1 } else { 0 },
         .. Default::default()
     };
     let mut rsp = api::BootRsp {
@@ -211,6 +236,20 @@ pub fn reset_security_counters() {
     api::sim_reset_nv_counters();
 }
 
+/// Enable or disable, for the current thread, the storage keeping the warm boot record across
+/// boots.  Either way, the stored record is cleared.
+#[cfg(feature = "warm-boot-cache")]
+pub fn warm_boot_enable(enable: bool) {
+    unsafe { raw::sim_warm_boot_enable(enable) }
+}
+
+/// Set the key authenticating the warm boot records of the current thread, as all bytes equal
+/// to `key`.
+#[cfg(feature = "warm-boot-cache")]
+pub fn warm_boot_set_key(key: u8) {
+    unsafe { raw::sim_warm_boot_set_key(key) }
+}
+
 mod raw {
     use crate::area::CAreaDesc;
     use crate::api::{BootRsp, CSimContext};
@@ -239,6 +278,11 @@ mod raw {
         pub fn kw_encrypt_(kek: *const u8, seckey: *const u8,
                            encbuf: *mut u8) -> libc::c_int;
 
+        #[cfg(feature = "warm-boot-cache")]
+        pub fn sim_warm_boot_enable(enable: bool);
+        #[cfg(feature = "warm-boot-cache")]
+        pub fn sim_warm_boot_set_key(key: u8);
+
         #[allow(unused)]
         pub fn psa_crypto_init() -> u32;
 
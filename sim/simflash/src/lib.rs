@@ -93,6 +93,7 @@ pub struct SimFlash {
     // Alignment required for writes.
     align: usize,
     verify_writes: bool,
+    rewrite_bits: bool,
     erased_val: u8,
 }
 
@@ -111,10 +112,18 @@ impl SimFlash {
             bad_region: Vec::new(),
             align,
             verify_writes: true,
+            rewrite_bits: false,
             erased_val,
         }
     }
 
+    /// Allow writes to locations already written, as long as they only
+    /// program more bits, moving them away from the erased value.  The
+    /// compact swap status format relies on this.
+    pub fn set_rewrite_bits(&mut self, enable: bool) {
+        self.rewrite_bits = enable;
+    }
+
     #[allow(dead_code)]
     pub fn dump(&self) {
         self.data.dump();
@@ -206,7 +215,11 @@ impl Flash for SimFlash {
 
         for (i, x) in &mut self.write_safe[offset .. offset + payload.len()].iter_mut().enumerate() {
             if self.verify_writes && !(*x) {
-                panic!("Write to unerased location at 0x{:x}", offset + i);
+                let old = self.data[offset + i] ^ self.erased_val;
+                let new = payload[i] ^ self.erased_val;
+                if !self.rewrite_bits || old & !new != 0 {
+                    panic!("Write to unerased location at 0x{:x}", offset + i);
+                }
             }
             *x = false;
         }
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+
+//! BLAKE2s (RFC 7693), unkeyed with a 32 byte digest.
+//!
+//! Used to generate images for MCUboot built with `MCUBOOT_BLAKE2S`; ring does not provide it.
+
+const IV: [u32; 8] = [
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+];
+
+const SIGMA: [[usize; 16]; 10] = [
+    [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15],
+    [14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3],
+    [11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4],
+    [7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8],
+    [9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13],
+    [2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9],
+    [12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11],
+    [13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10],
+    [6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5],
+    [10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0],
+];
+
+fn g(v: &mut [u32; 16], a: usize, b: usize, c: usize, d: usize, x: u32, y: u32) {
+    v[a] = v[a].wrapping_add(v[b]).wrapping_add(x);
+    v[d] = (v[d] ^ v[a]).rotate_right(16);
+    v[c] = v[c].wrapping_add(v[d]);
+    v[b] = (v[b] ^ v[c]).rotate_right(12);
+    v[a] = v[a].wrapping_add(v[b]).wrapping_add(y);
+    v[d] = (v[d] ^ v[a]).rotate_right(8);
+    v[c] = v[c].wrapping_add(v[d]);
+    v[b] = (v[b] ^ v[c]).rotate_right(7);
+}
+
+fn compress(h: &mut [u32; 8], block: &[u8; 64], count: u64, last: bool) {
+    let mut m = [0u32; 16];
+    for (i, word) in m.iter_mut().enumerate() {
+        *word = u32::from_le_bytes([block[4 * i], block[4 * i + 1],
+                                    block[4 * i + 2], block[4 * i + 3]]);
+    }
+
+    let mut v = [0u32; 16];
+    v[..8].copy_from_slice(h);
+    v[8..].copy_from_slice(&IV);
+    v[12] ^= count as u32;
+    v[13] ^= (count >> 32) as u32;
+    if last {
+        v[14] = !v[14];
+    }
+
+    for s in &SIGMA {
+        g(&mut v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+        g(&mut v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+        g(&mut v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+        g(&mut v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+        g(&mut v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+        g(&mut v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+        g(&mut v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+        g(&mut v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+
+    for i in 0..8 {
+        h[i] ^= v[i] ^ v[i + 8];
+    }
+}
+
+/// Compute the BLAKE2s-256 digest of `data`.
+pub fn digest(data: &[u8]) -> [u8; 32] {
+    let mut h = IV;
+    h[0] ^= 0x01010000 | 32;
+
+    let mut block = [0u8; 64];
+    let mut count = 0u64;
+    let mut rest = data;
+
+    // The last block, even if full, is compressed with the final flag.
+    while rest.len() > 64 {
+        block.copy_from_slice(&rest[..64]);
+        count += 64;
+        compress(&mut h, &block, count, false);
+        rest = &rest[64..];
+    }
+
+    block = [0u8; 64];
+    block[..rest.len()].copy_from_slice(rest);
+    count += rest.len() as u64;
+    compress(&mut h, &block, count, true);
+
+    let mut out = [0u8; 32];
+    for (i, word) in h.iter().enumerate() {
+        out[4 * i..4 * i + 4].copy_from_slice(&word.to_le_bytes());
+    }
+    out
+}
+
+#[cfg(test)]
+mod tests {
+    use super::digest;
+
+    #[test]
+    fn rfc7693_abc() {
+        // Appendix B of RFC 7693.
+        let expect = [
+            0x50, 0x8C, 0x5E, 0x8C, 0x32, 0x7C, 0x14, 0xE2,
+            0xE1, 0xA7, 0x2B, 0xA3, 0x4E, 0xEB, 0x45, 0x2F,
+            0x37, 0x45, 0x8B, 0x20, 0x9E, 0xD6, 0x3A, 0x29,
+            0x4D, 0x99, 0x9B, 0x4C, 0x86, 0x67, 0x59, 0x82,
+        ];
+        assert_eq!(digest(b"abc"), expect);
+    }
+
+    #[test]
+    fn empty_and_block_boundary() {
+        assert_eq!(digest(b"")[..4], [0x69, 0x21, 0x7A, 0x30]);
+        assert_eq!(digest(&[0u8; 64])[..4], [0xAE, 0x09, 0xDB, 0x7C]);
+    }
+}
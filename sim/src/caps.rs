@@ -31,6 +31,9 @@ pub enum Caps {
     HwRollbackProtection = (1 << 18),
     EcdsaP384            = (1 << 19),
     SwapUsingOffset      = (1 << 20),
+    SwapStatusCompact    = (1 << 21),
+    SwapStatusJournal    = (1 << 22),
+    SwapScratchRing      = (1 << 23),
 }
 
 impl Caps {
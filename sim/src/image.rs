@@ -130,6 +130,9 @@ pub enum ImageManipulation {
     /// false to overlap by 1 byte
     OverlapImages(bool),
     CorruptHigherVersionImage,
+    /// The same payload at the same offsets in both slots, so that an
+    /// upgrade leaves most of the sectors of the image unchanged.
+    SharedPayload,
 }
 
 
@@ -138,7 +141,25 @@ impl ImagesBuilder {
     /// Some(builder) if is possible to test this configuration, or None if
     /// not possible (for example, if there aren't enough image slots).
     pub fn new(device: DeviceName, align: usize, erased_val: u8) -> Result<Self, String> {
-        let (flash, areadesc, unsupported_caps) = Self::make_device(device, align, erased_val);
+        let (mut flash, mut areadesc, unsupported_caps) = Self::make_device(device, align, erased_val);
+
+        // The compact swap status programs more bits of units already written.
+        if Caps::SwapStatusCompact.present() {
+            for dev in flash.values_mut() {
+                dev.set_rewrite_bits(true);
+            }
+        }
+
+        // The swap status journal gets a small device of its own, whose
+        // sectors it rotates through several times during a swap.
+        if Caps::SwapStatusJournal.present() {
+            let dev = SimFlash::new(vec![4096; 2], align, erased_val);
+            let dev_id = flash.keys().max().map_or(0, |id| id + 1);
+            let desc = Rc::get_mut(&mut areadesc).unwrap();
+            desc.add_flash_sectors(dev_id, &dev);
+            desc.add_image(0, 2 * 4096, FlashId::SwapStatus, dev_id);
+            flash.insert(dev_id, dev);
+        }
 
         // Swap-move and swap-offset require uniformly sized erase units, which
         // is why devices with varying page sizes list them as unsupported.
@@ -179,6 +200,13 @@ impl ImagesBuilder {
             }
         }
 
+        // The scratch ring refuses to upgrade when the scratch area does not
+        // split into windows of whole sectors able to hold any slot sector.
+        let ring = c::swap_scratch_ring();
+        if ring != 0 && scratch && !areadesc.supports_scratch_ring(ring, logical) {
+            return Err("scratch area does not split into ring windows".to_string());
+        }
+
         let num_images = Caps::get_num_images();
 
         let mut slots = Vec::with_capacity(num_images);
@@ -366,7 +394,19 @@ impl ImagesBuilder {
     }
 
     pub fn make_image(self, deps: &DepTest, permanent: bool) -> Images {
-        let mut images = self.make_no_upgrade_image(deps, ImageManipulation::None);
+        self.make_image_with_manipulation(deps, permanent, ImageManipulation::None)
+    }
+
+    /// Construct an `Images` whose upgrades share their payload with the
+    /// images they replace, so that only their first and last sectors
+    /// differ.
+    pub fn make_shared_payload_image(self) -> Images {
+        self.make_image_with_manipulation(&NO_DEPS, true, ImageManipulation::SharedPayload)
+    }
+
+    fn make_image_with_manipulation(self, deps: &DepTest, permanent: bool,
+                                    img_manipulation: ImageManipulation) -> Images {
+        let mut images = self.make_no_upgrade_image(deps, img_manipulation);
         for image in &images.images {
             mark_upgrade(&mut images.flash, &image.slots[1]);
         }
@@ -976,6 +1016,66 @@ impl Images {
         fails > 0
     }
 
+    /// Like `run_perm_with_fails`, but an interrupted swap status write is
+    /// left torn.  With sparse swap and images sharing their payload, this
+    /// interrupts the writes recording skipped steps.
+    pub fn run_perm_with_torn_status_fails(&self) -> bool {
+        if !Caps::modifies_flash() {
+            return false;
+        }
+
+        let mut fails = 0;
+        let total_flash_ops = self.total_count.unwrap();
+
+        if skip_slow_test() {
+            return false;
+        }
+
+        for i in 1 .. total_flash_ops {
+            info!("Try torn interruption at {}", i);
+            let mut flash = self.flash.clone();
+            self.mark_permanent_upgrades(&mut flash, 1);
+
+            let mut counter = i;
+            let result = c::boot_go_tearing_status(&mut flash, &self.areadesc, &mut counter);
+            if !result.interrupted() && !result.success() {
+                warn!("Unexpected return at step {}: {:?}", i, result);
+                fails += 1;
+                continue;
+            }
+
+            if !c::boot_go(&mut flash, &self.areadesc, None, None, false).success_no_asserts() {
+                warn!("Resume FAIL at step {} of {}", i, total_flash_ops);
+                fails += 1;
+                continue;
+            }
+
+            if !self.verify_images(&flash, 0, 1) {
+                warn!("FAIL at step {} of {}", i, total_flash_ops);
+                fails += 1;
+            }
+
+            if !self.verify_trailers(&flash, 0, BOOT_MAGIC_GOOD,
+                                     BOOT_FLAG_SET, BOOT_FLAG_SET) {
+                warn!("Mismatched trailer for the primary slot");
+                fails += 1;
+            }
+
+            if self.is_swap_upgrade() && !self.verify_images(&flash, 1, 0) {
+                warn!("Secondary slot FAIL at step {} of {}",
+                    i, total_flash_ops);
+                fails += 1;
+            }
+        }
+
+        if fails > 0 {
+            error!("{} out of {} failed {:.2}%", fails, total_flash_ops,
+                   fails as f32 * 100.0 / total_flash_ops as f32);
+        }
+
+        fails > 0
+    }
+
     pub fn run_perm_with_random_fails(&self, total_fails: usize) -> bool {
         if !Caps::modifies_flash() {
             return false;
@@ -1705,6 +1805,85 @@ impl Images {
         false
     }
 
+    /// Test that the warm boot record only skips the validation of images
+    /// whose slots are unchanged, and only when it is authenticated with the
+    /// key it is checked with.
+    #[cfg(feature = "warm-boot-cache")]
+    pub fn run_warm_boot(&self) -> bool {
+        if !Caps::DirectXip.present() && !Caps::RamLoad.present() {
+            return false;
+        }
+
+        c::warm_boot_enable(true);
+        c::warm_boot_set_key(1);
+
+        let mut flash = self.flash.clone();
+        if !self.warm_boot_go(&mut flash) {
+            error!("First boot failed");
+            c::warm_boot_enable(false);
+            return true;
+        }
+
+        // From now on, only the record can get the images booted.
+        self.corrupt_signatures(&mut flash);
+
+        let mut fails = 0;
+
+        if !self.warm_boot_go(&mut flash.clone()) {
+            error!("Unchanged images were validated again");
+            fails += 1;
+        }
+
+        c::warm_boot_set_key(2);
+        if self.warm_boot_go(&mut flash.clone()) {
+            error!("Record with a bad tag was accepted");
+            fails += 1;
+        }
+        c::warm_boot_set_key(1);
+
+        let mut changed = flash.clone();
+        for image in &self.images {
+            mark_upgrade(&mut changed, &image.slots[0]);
+        }
+        if self.warm_boot_go(&mut changed) {
+            error!("Record was accepted after a trailer change");
+            fails += 1;
+        }
+
+        c::warm_boot_enable(false);
+        fails > 0
+    }
+
+    #[cfg(feature = "warm-boot-cache")]
+    fn warm_boot_go(&self, flash: &mut SimMultiFlash) -> bool {
+        if Caps::RamLoad.present() {
+            let ram = RamBlock::new(self.ram.total - RAM_LOAD_ADDR, RAM_LOAD_ADDR);
+            ram.invoke(|| c::boot_go(flash, &self.areadesc, None, None, false)).success()
+        } else {
+            c::boot_go(flash, &self.areadesc, None, None, false).success()
+        }
+    }
+
+    /// Flip a bit of the last byte of the image in both slots. It is part of
+    /// the signature, so the header and the hash TLV are left unchanged.
+    #[cfg(feature = "warm-boot-cache")]
+    fn corrupt_signatures(&self, flash: &mut SimMultiFlash) {
+        for image in &self.images {
+            for (slot, data) in [&image.primaries, &image.upgrades].iter().enumerate() {
+                let dev = flash.get_mut(&image.slots[slot].dev_id).unwrap();
+                let align = dev.align();
+                let last = data.size() - 1;
+                let off = image.slots[slot].base_off + last - last % align;
+                let mut buf = vec![0u8; align];
+                dev.read(off, &mut buf).unwrap();
+                buf[last % align] ^= 1;
+                dev.set_verify_writes(false);
+                dev.write(off, &buf).unwrap();
+                dev.set_verify_writes(true);
+            }
+        }
+    }
+
     /// Adds a new flash area that fails statistically
     fn mark_bad_status_with_rate(&self, flash: &mut SimMultiFlash, slot: usize,
                                  rate: f32) {
@@ -2303,7 +2482,13 @@ fn install_image_with_key(
 
     // The core of the image itself is just pseudorandom data.
     let mut b_img = vec![0; len];
-    splat(&mut b_img, offset);
+    if img_manipulation == ImageManipulation::SharedPayload {
+        for (i, chunk) in b_img.chunks_mut(1024).enumerate() {
+            splat(chunk, i);
+        }
+    } else {
+        splat(&mut b_img, offset);
+    }
 
     // Add some information at the start of the payload to make it easier
     // to see what it is.  This will fail if the image itself is too small.
@@ -12,6 +12,7 @@ use std::{
 };
 use serde_derive::Deserialize;
 
+mod blake2s;
 mod caps;
 mod depends;
 mod image;
@@ -18,6 +18,7 @@ use byteorder::{
     LittleEndian, WriteBytesExt,
 };
 use cipher::FromBlockCipher;
+use crate::blake2s;
 use crate::caps::Caps;
 use crate::image::ImageVersion;
 use log::info;
@@ -52,6 +53,7 @@ pub enum TlvKinds {
     KEYHASH = 0x01,
     SHA256 = 0x10,
     SHA384 = 0x11,
+    BLAKE2S = 0x13,
     RSA2048 = 0x20,
     ECDSASIG = 0x22,
     RSA3072 = 0x23,
@@ -159,6 +161,14 @@ struct Dependency {
     version: ImageVersion,
 }
 
+/// The 32 byte image digest MCUboot is built for, BLAKE2s with the
+/// `hash-blake2s` feature and SHA256 otherwise.
+const HASH256: TlvKinds = if cfg!(feature = "hash-blake2s") {
+    TlvKinds::BLAKE2S
+} else {
+    TlvKinds::SHA256
+};
+
 impl TlvGen {
     /// Builder: select which signing key the generator will use. Has no
     /// effect on non-signing TLV kinds.
@@ -172,7 +182,7 @@ impl TlvGen {
     #[allow(dead_code)]
     pub fn new_hash_only() -> TlvGen {
         TlvGen {
-            kinds: vec![TlvKinds::SHA256],
+            kinds: vec![HASH256],
             ..Default::default()
         }
     }
@@ -180,7 +190,7 @@ impl TlvGen {
     #[allow(dead_code)]
     pub fn new_rsa_pss() -> TlvGen {
         TlvGen {
-            kinds: vec![TlvKinds::SHA256, TlvKinds::RSA2048],
+            kinds: vec![HASH256, TlvKinds::RSA2048],
             ..Default::default()
         }
     }
@@ -188,7 +198,7 @@ impl TlvGen {
     #[allow(dead_code)]
     pub fn new_rsa3072_pss() -> TlvGen {
         TlvGen {
-            kinds: vec![TlvKinds::SHA256, TlvKinds::RSA3072],
+            kinds: vec![HASH256, TlvKinds::RSA3072],
             ..Default::default()
         }
     }
@@ -198,7 +208,7 @@ impl TlvGen {
         let hash_kind = if cfg!(feature = "sig-p384") {
             TlvKinds::SHA384
         } else {
-            TlvKinds::SHA256
+            HASH256
         };
         TlvGen {
             kinds: vec![hash_kind, TlvKinds::ECDSASIG],
@@ -209,7 +219,7 @@ impl TlvGen {
     #[allow(dead_code)]
     pub fn new_ed25519() -> TlvGen {
         TlvGen {
-            kinds: vec![TlvKinds::SHA256, TlvKinds::ED25519],
+            kinds: vec![HASH256, TlvKinds::ED25519],
             ..Default::default()
         }
     }
@@ -223,7 +233,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::ENCRSA2048],
+            kinds: vec![HASH256, TlvKinds::ENCRSA2048],
             ..Default::default()
         }
     }
@@ -237,7 +247,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::RSA2048, TlvKinds::ENCRSA2048],
+            kinds: vec![HASH256, TlvKinds::RSA2048, TlvKinds::ENCRSA2048],
             ..Default::default()
         }
     }
@@ -251,7 +261,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::ENCKW],
+            kinds: vec![HASH256, TlvKinds::ENCKW],
             ..Default::default()
         }
     }
@@ -265,7 +275,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::RSA2048, TlvKinds::ENCKW],
+            kinds: vec![HASH256, TlvKinds::RSA2048, TlvKinds::ENCKW],
             ..Default::default()
         }
     }
@@ -279,7 +289,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::ECDSASIG, TlvKinds::ENCKW],
+            kinds: vec![HASH256, TlvKinds::ECDSASIG, TlvKinds::ENCKW],
             ..Default::default()
         }
     }
@@ -293,7 +303,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::ENCEC256],
+            kinds: vec![HASH256, TlvKinds::ENCEC256],
             ..Default::default()
         }
     }
@@ -307,7 +317,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::ECDSASIG, TlvKinds::ENCEC256],
+            kinds: vec![HASH256, TlvKinds::ECDSASIG, TlvKinds::ENCEC256],
             ..Default::default()
         }
     }
@@ -321,7 +331,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::ENCX25519],
+            kinds: vec![HASH256, TlvKinds::ENCX25519],
             ..Default::default()
         }
     }
@@ -335,7 +345,7 @@ impl TlvGen {
         };
         TlvGen {
             flags: flag,
-            kinds: vec![TlvKinds::SHA256, TlvKinds::ED25519, TlvKinds::ENCX25519],
+            kinds: vec![HASH256, TlvKinds::ED25519, TlvKinds::ENCX25519],
             ..Default::default()
         }
     }
@@ -343,11 +353,20 @@ impl TlvGen {
     #[allow(dead_code)]
     pub fn new_sec_cnt() -> TlvGen {
        TlvGen {
-            kinds: vec![TlvKinds::SHA256, TlvKinds::SECCNT],
+            kinds: vec![HASH256, TlvKinds::SECCNT],
             ..Default::default()
         }
     }
 
+    /// Compute a 32 byte digest with the algorithm of the image hash, which
+    /// MCUboot also uses for the key hash.
+    fn digest32(&self, data: &[u8]) -> Vec<u8> {
+        if self.kinds.contains(&TlvKinds::BLAKE2S) {
+            blake2s::digest(data).to_vec()
+        } else {
+            digest::digest(&digest::SHA256, data).as_ref().to_vec()
+        }
+    }
 }
 
 impl ManifestGen for TlvGen {
@@ -401,7 +420,7 @@ impl ManifestGen for TlvGen {
         // A very poor estimate.
 
         // Estimate the size of the image hash.
-        if self.kinds.contains(&TlvKinds::SHA256) {
+        if self.kinds.contains(&TlvKinds::SHA256) || self.kinds.contains(&TlvKinds::BLAKE2S) {
             estimate += 4 + 32;
         } else if self.kinds.contains(&TlvKinds::SHA384) {
             estimate += 4 + 48;
@@ -514,7 +533,8 @@ impl ManifestGen for TlvGen {
         // Placeholder for the size.
         result.write_u16::<LittleEndian>(0).unwrap();
 
-        if self.kinds.iter().any(|v| v == &TlvKinds::SHA256 || v == &TlvKinds::SHA384) {
+        if self.kinds.iter().any(|v| v == &TlvKinds::SHA256 || v == &TlvKinds::SHA384 ||
+                                     v == &TlvKinds::BLAKE2S) {
             // If a signature is not requested, corrupt the hash we are
             // generating.  But, if there is a signature, output the
             // correct hash.  We want the hash test to pass so that the
@@ -535,13 +555,16 @@ impl ManifestGen for TlvGen {
             let (hash,hash_size,tlv_kind) =  if self.kinds.contains(&TlvKinds::SHA256)
             {
                 let hash = digest::digest(&digest::SHA256, &sig_payload);
-                (hash,32,TlvKinds::SHA256)
+                (hash.as_ref().to_vec(),32,TlvKinds::SHA256)
+            }
+            else if self.kinds.contains(&TlvKinds::BLAKE2S) {
+                (blake2s::digest(&sig_payload).to_vec(),32,TlvKinds::BLAKE2S)
             }
             else {
                 let hash = digest::digest(&digest::SHA384, &sig_payload);
-                (hash,48,TlvKinds::SHA384)
+                (hash.as_ref().to_vec(),48,TlvKinds::SHA384)
             };
-            let hash = hash.as_ref();
+            let hash = hash.as_slice();
 
             assert!(hash.len() == hash_size);
             result.write_u16::<LittleEndian>(tlv_kind as u16).unwrap();
@@ -679,16 +702,16 @@ impl ManifestGen for TlvGen {
                 SigningKey::Unknown => (include_bytes!("../../root-ed25519-unknown.pem"), ED25519_PUB_KEY_UNKNOWN),
             };
 
-            let keyhash = digest::digest(&digest::SHA256, pub_key);
-            let keyhash = keyhash.as_ref();
+            let keyhash = self.digest32(pub_key);
+            let keyhash = keyhash.as_slice();
 
             assert!(keyhash.len() == 32);
             result.write_u16::<LittleEndian>(TlvKinds::KEYHASH as u16).unwrap();
             result.write_u16::<LittleEndian>(32).unwrap();
             result.extend_from_slice(keyhash);
 
-            let hash = digest::digest(&digest::SHA256, &sig_payload);
-            let hash = hash.as_ref();
+            let hash = self.digest32(&sig_payload);
+            let hash = hash.as_slice();
             assert!(hash.len() == 32);
 
             let key_bytes = pem::parse(pem_bytes).unwrap();
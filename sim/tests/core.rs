@@ -58,6 +58,8 @@ sim_test!(basic_revert, make_image(&NO_DEPS, true), run_basic_revert());
 sim_test!(revert_with_fails, make_image(&NO_DEPS, false), run_revert_with_fails());
 sim_test!(perm_with_fails, make_image(&NO_DEPS, true), run_perm_with_fails());
 sim_test!(perm_with_random_fails, make_image(&NO_DEPS, true), run_perm_with_random_fails(5));
+#[cfg(feature = "sparse-swap")]
+sim_test!(perm_with_torn_status_fails, make_shared_payload_image(), run_perm_with_torn_status_fails());
 sim_test!(norevert, make_image(&NO_DEPS, true), run_norevert());
 sim_test!(oversized_secondary_slot, make_oversized_secondary_slot_image(), run_fail_upgrade_primary_intact());
 #[cfg(feature = "check-load-addr")]
@@ -74,6 +76,8 @@ sim_test!(ram_load_first, make_no_upgrade_image(&NO_DEPS, ImageManipulation::Non
 sim_test!(ram_load_split, make_no_upgrade_image(&NO_DEPS, ImageManipulation::None), run_split_ram_load());
 #[cfg(not(feature = "check-load-addr"))]
 sim_test!(ram_load_from_flash, make_no_upgrade_image(&NO_DEPS, ImageManipulation::None), run_ram_load_from_flash());
+#[cfg(feature = "warm-boot-cache")]
+sim_test!(warm_boot, make_no_upgrade_image(&NO_DEPS, ImageManipulation::None), run_warm_boot());
 #[cfg(not(feature = "check-load-addr"))]
 sim_test!(ram_load_out_of_bounds, make_no_upgrade_image(&NO_DEPS, ImageManipulation::WrongOffset), run_ram_load_boot_with_result(false));
 #[cfg(not(feature = "check-load-addr"))]